@@ -0,0 +1,33 @@
+#include "bench_utils.hpp"
+
+#include <cstdlib>
+#include <string>
+
+/**
+ * Runs all registered benchmarks. Usage:
+ *
+ * HBenchExec [Filter] [MinSeconds]
+ *
+ * Filter: only run cases where "Group.Name" contains this substring
+ * MinSeconds: minimum duration (s) each measured body is repeated for, default 0.5 s
+ */
+int main(int argc, char** argv)
+{
+    const std::string Filter = (argc > 1) ? std::string(argv[1]) : std::string();
+    const double MinSeconds = (argc > 2) ? std::atof(argv[2]) : 0.5;
+
+    for (const Bench::Case& Case : Bench::Registry())
+    {
+        const std::string FullName = std::string(Case.Group) + std::string(".") + std::string(Case.Name);
+
+        if ((Filter.empty() == false) && (FullName.find(Filter) == std::string::npos))
+        {
+            continue;
+        }
+
+        Bench::State State{Case.Group, Case.Name, MinSeconds};
+        Case.Function(State);
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @file bench_utils.hpp
+ * Minimal self registering benchmark harness. Each benchmark case measures one or more
+ * bodies of work, each of which is repeated until a minimum wall clock duration has elapsed
+ */
+
+namespace Bench
+{
+    /**
+     * Prevents the compiler from eliding the computation of `Value`
+     * @param Value Result of the measured computation
+     */
+    template <typename T>
+    inline void DoNotOptimise(const T& Value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&Value) : "memory");
+#else
+        static const void* volatile Sink = nullptr;
+        Sink = &Value;
+#endif
+    }
+
+    /**
+     * Timing results of a single measured body
+     */
+    struct Measurement
+    {
+        /// Mean wall clock time per repetition (s)
+        double Seconds = 0.0;
+
+        /// Number of repetitions measured
+        size_t Repetitions = 0;
+
+        /// Mean wall clock time per item (s)
+        double SecondsPerItem = 0.0;
+    };
+
+    /**
+     * Measurement context handed to each benchmark case
+     */
+    class State
+    {
+    public:
+
+        /**
+         * @param Group Benchmark group name
+         * @param Name Benchmark case name
+         * @param MinSeconds Minimum time (s) to repeat each measured body for
+         */
+        State(const char* Group, const char* Name, double MinSeconds) noexcept :
+            mGroup{Group},
+            mName{Name},
+            mMinSeconds{MinSeconds}
+        {
+
+        }
+
+        /**
+         * Repeatedly evaluates `Body` until the minimum measurement duration has elapsed and
+         * reports the mean time per repetition and throughput
+         * @param Label Description of the measured body
+         * @param Items Number of items (states, cases, etc.) processed per evaluation of `Body`
+         * @param Body Measured callable
+         * @return Measurement
+         */
+        template <typename Function>
+        Measurement Measure(const char* Label, size_t Items, Function&& Body)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            // Warm up caches and lazy initialisation
+            Body();
+
+            size_t Repetitions = 0;
+            const auto Start = Clock::now();
+            auto Now = Start;
+
+            while (std::chrono::duration<double>(Now - Start).count() < mMinSeconds)
+            {
+                Body();
+                Repetitions++;
+                Now = Clock::now();
+            }
+
+            Measurement Result;
+            Result.Repetitions = Repetitions;
+            Result.Seconds = std::chrono::duration<double>(Now - Start).count() / static_cast<double>(Repetitions);
+            Result.SecondsPerItem = Result.Seconds / static_cast<double>((Items > 0) ? Items : 1);
+
+            printf("[%s.%s] %-40s %14.3f us/rep %12.3f ns/item %14.0f items/s (%zu reps)\n",
+                mGroup, mName, Label, Result.Seconds * 1.0E6, Result.SecondsPerItem * 1.0E9,
+                1.0 / Result.SecondsPerItem, Repetitions);
+
+            return Result;
+        }
+
+        /**
+         * Reports an auxillary (non timing) result, i.e accuracy or speed up
+         * @param Label Description of the value
+         * @param Value Reported value
+         * @param Unit Units of the reported value
+         */
+        void Report(const char* Label, double Value, const char* Unit) const
+        {
+            printf("[%s.%s] %-40s %14.6g %s\n", mGroup, mName, Label, Value, Unit);
+        }
+
+        /**
+         * @return Minimum time (s) each measured body is repeated for, for benchmarks that scale
+         * their own duration (i.e soak tests)
+         */
+        double GetMinSeconds(void) const noexcept {return mMinSeconds;}
+
+    private:
+        const char* mGroup = "";
+        const char* mName = "";
+        double mMinSeconds = 0.0;
+    };
+
+    /**
+     * Registered benchmark case
+     */
+    struct Case
+    {
+        const char* Group = "";
+        const char* Name = "";
+        void (*Function)(State&) = nullptr;
+    };
+
+    /**
+     * @return All registered benchmark cases
+     */
+    inline std::vector<Case>& Registry()
+    {
+        static std::vector<Case> Cases{};
+        return Cases;
+    }
+
+    /**
+     * Registers a benchmark case at static initialisation
+     */
+    struct Registrar
+    {
+        Registrar(const char* Group, const char* Name, void (*Function)(State&))
+        {
+            Registry().push_back(Case{.Group = Group, .Name = Name, .Function = Function});
+        }
+    };
+}
+
+/**
+ * Defines and registers a benchmark case, used as:
+ *
+ * BENCH(Group, Name)
+ * {
+ *     State.Measure("Label", Items, [&](){ ... });
+ * }
+ */
+#define BENCH(Group, Name)\
+    static void Group##_##Name##_Bench(Bench::State& State);\
+    static const Bench::Registrar Group##_##Name##_Registrar{#Group, #Name, Group##_##Name##_Bench};\
+    static void Group##_##Name##_Bench(Bench::State& State)
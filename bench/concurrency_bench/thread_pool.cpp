@@ -0,0 +1,172 @@
+#include "concurrency/thread_pool.hpp"
+#include "math/core_math.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t TASKS = 10000;
+    constexpr size_t DISPATCHES = 1000;
+    constexpr size_t ITERATIONS = 1000000;
+
+    // Workers of each measured pool, matching the hardware
+    size_t Workers(void)
+    {
+        const size_t Threads = std::thread::hardware_concurrency();
+        return (Threads > 1) ? Threads - 1 : 1;
+    }
+
+    // Work of an iteration of increasing cost
+    double Triangular(size_t Index) noexcept
+    {
+        double Sum = 0.0;
+
+        for (size_t Term = 0; Term < Index / 64; Term++)
+        {
+            Sum += Sqrt(static_cast<double>(Term));
+        }
+
+        return Sum;
+    }
+}
+
+// Overhead of spawning and waiting on empty tasks
+BENCH(Concurrency, TaskSpawn)
+{
+    ThreadPool Pool(Workers());
+
+    State.Measure("Spawn and wait", TASKS, [&]()
+    {
+        TaskGroup Group(Pool);
+
+        for (size_t Task = 0; Task < TASKS; Task++)
+        {
+            Group.Run([]() { });
+        }
+
+        Group.Wait();
+    });
+
+    State.Measure("Recursive spawn", TASKS, [&]()
+    {
+        const auto Spawn = [&](const auto& Self, size_t Count) -> void
+        {
+            if (Count <= 1)
+            {
+                return;
+            }
+
+            TaskGroup Group(Pool);
+            Group.Run([&]() {Self(Self, Count / 2);});
+            Self(Self, Count - Count / 2);
+            Group.Wait();
+        };
+
+        Spawn(Spawn, TASKS);
+    });
+
+    State.Report("Hardware threads", static_cast<double>(std::thread::hardware_concurrency()), "");
+}
+
+// Latency of dispatching a loop of one iteration per thread
+BENCH(Concurrency, Dispatch)
+{
+    ThreadPool Pool(Workers());
+    std::vector<double> Values(Pool.Concurrency());
+
+    State.Measure("Parallel for", DISPATCHES, [&]()
+    {
+        for (size_t Dispatch = 0; Dispatch < DISPATCHES; Dispatch++)
+        {
+            Pool.ParallelFor(Values.size(), [&](size_t Index) {Values[Index] += 1.0;});
+        }
+        Bench::DoNotOptimise(Values);
+    });
+}
+
+// Inexpensive iterations scheduled individually and in chunks
+BENCH(Concurrency, Grain)
+{
+    ThreadPool Pool(Workers());
+    std::vector<double> Values(ITERATIONS, 1.0);
+
+    for (const size_t Grain : {1u, 16u, 1024u})
+    {
+        State.Measure(("Grain " + std::to_string(Grain)).c_str(), ITERATIONS, [&]()
+        {
+            Pool.ParallelFor(Values.size(), Grain, [&](size_t Index) {Values[Index] *= 1.0000001;});
+            Bench::DoNotOptimise(Values);
+        });
+    }
+}
+
+// Iterations of linearly increasing cost, balanced by stealing
+BENCH(Concurrency, LoadBalance)
+{
+    constexpr size_t COUNT = 20000;
+
+    ThreadPool Pool(Workers());
+    std::vector<double> Values(COUNT);
+
+    const Bench::Measurement Serial = State.Measure("Serial", COUNT, [&]()
+    {
+        for (size_t Index = 0; Index < COUNT; Index++)
+        {
+            Values[Index] = Triangular(Index);
+        }
+        Bench::DoNotOptimise(Values);
+    });
+
+    const Bench::Measurement Parallel = State.Measure("Parallel", COUNT, [&]()
+    {
+        Pool.ParallelFor(COUNT, [&](size_t Index) {Values[Index] = Triangular(Index);});
+        Bench::DoNotOptimise(Values);
+    });
+
+    State.Report("Speed up", Serial.Seconds / Parallel.Seconds, "x");
+    State.Report("Efficiency", Serial.Seconds / (Parallel.Seconds * static_cast<double>(Pool.Concurrency())), "");
+}
+
+// Deterministic sum, against a serial loop
+BENCH(Concurrency, ParallelReduce)
+{
+    ThreadPool Pool(Workers());
+    std::vector<double> Values(ITERATIONS);
+
+    for (size_t Index = 0; Index < ITERATIONS; Index++)
+    {
+        Values[Index] = 1.0 / static_cast<double>(Index + 1);
+    }
+
+    State.Measure("Serial", ITERATIONS, [&]()
+    {
+        double Sum = 0.0;
+
+        for (const double Value : Values)
+        {
+            Sum += Value;
+        }
+        Bench::DoNotOptimise(Sum);
+    });
+
+    State.Measure("Parallel reduce", ITERATIONS, [&]()
+    {
+        const double Sum = Pool.ParallelReduce(ITERATIONS, 4096, 0.0,
+            [&](size_t Begin, size_t End)
+            {
+                double Partial = 0.0;
+
+                for (size_t Index = Begin; Index < End; Index++)
+                {
+                    Partial += Values[Index];
+                }
+
+                return Partial;
+            },
+            [](double A, double B) {return A + B;});
+        Bench::DoNotOptimise(Sum);
+    });
+}
@@ -0,0 +1,53 @@
+#include "dynamics/cr3bp.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const double MU = CR3BP::EARTH_MOON.MassRatio;
+
+    // Northern L2 halo orbit near its bifurcation from the planar Lyapunov family
+    const CR3BP::State HALO{.Data = {1.18, 0.0, 0.02, 0.0, -0.16, 0.0}};
+
+    constexpr size_t MEMBERS = 100;
+}
+
+// Time to generate the Earth-Moon L2 halo family from its bifurcation to the near rectilinear
+// orbits, by each continuation method, and the cost of a single correction
+BENCH(Dynamics, CR3BPHaloFamily)
+{
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+    const CR3BP::PeriodicOrbit Halo = CR3BP::CorrectSymmetric(HALO, 1.7, MU);
+
+    State.Measure("Single shooting correction", 1, [&]()
+    {
+        Bench::DoNotOptimise(CR3BP::CorrectSymmetric(HALO, 1.7, MU));
+    });
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        for (const auto& [Name, Settings] : {
+            std::pair{"Pseudo-arclength", CR3BP::ContinuationSettings{.Step = 5.0E-3, .MaxStep = 2.0E-2, .Members = MEMBERS}},
+            std::pair{"Natural parameter", CR3BP::ContinuationSettings{.Method = CR3BP::ContinuationMethod::NATURAL_PARAMETER, .Step = 2.0E-3,
+                .Members = MEMBERS}}})
+        {
+            std::vector<CR3BP::PeriodicOrbit> Family{};
+
+            const auto Result = State.Measure((std::string(Name) + ", " + std::to_string(MEMBERS) + " members" + Suffix).c_str(), MEMBERS, [&]()
+            {
+                Family = CR3BP::ContinueFamily(*Pool, Halo, MU, Settings);
+            });
+
+            State.Report((std::string(Name) + " members per second" + Suffix).c_str(), 1.0 / Result.SecondsPerItem, "members/s");
+            State.Report((std::string(Name) + " final period" + Suffix).c_str(), Family.back().Period * CR3BP::EARTH_MOON.Time / 86400.0, "days");
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#include "dynamics/nbody.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/random.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double MU_MOON = 4.9048695E12;
+    constexpr double STEP = 1.0;
+
+    // Fixed lunar position over the few seconds integrated (m)
+    const Vector3 MOON({3.844E8, 0.0, 0.0});
+
+    // Fragments of a breakup in a circular orbit of 7000 km, spread over tens of kilometres with
+    // a few metres per second of relative velocity, of masses from grams to hundreds of kilograms
+    NBodySystem MakeDebris(size_t Count, const NBodySettings& Settings)
+    {
+        NBodySystem System(Settings);
+        Random::Stream Stream(11, 0);
+        const double Radius = 7.0E6;
+        const double Speed = Sqrt(MU / Radius);
+
+        System.Reserve(Count);
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            const Vector3 Position({Radius + 1.0E4 * Stream.Normal(), 2.0E4 * Stream.Normal(), 1.0E4 * Stream.Normal()});
+            const Vector3 Velocity({3.0 * Stream.Normal(), Speed + 3.0 * Stream.Normal(), 3.0 * Stream.Normal()});
+            System.Add(6.674E-11 * Pow(10.0, -3.0 + 5.0 * Stream.Uniform()), Position, Velocity);
+        }
+
+        return System;
+    }
+
+    // Central gravity of the Earth and the tidal acceleration of the Moon
+    Vector3 ExternalField(double, const Vector3& Position) noexcept
+    {
+        const Vector3 Moon = MOON - Position;
+
+        return Position * (-MU / Cube(Position.Norm())) + Moon * (MU_MOON / Cube(Moon.Norm())) - MOON * (MU_MOON / Cube(MOON.Norm()));
+    }
+}
+
+// Leapfrog steps per second of debris clouds of increasing size, by direct summation and by the
+// Barnes-Hut octree, and the error of the octree relative to direct summation
+BENCH(Dynamics, NBody)
+{
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        for (const size_t Count : {1000u, 4000u, 16000u})
+        {
+            NBodySystem Debris = MakeDebris(Count, NBodySettings{.Method = NBodyMethod::DIRECT});
+
+            const auto Direct = State.Measure(("Direct, " + std::to_string(Count) + " bodies" + Suffix).c_str(), 1, [&]()
+            {
+                Debris.Integrate(*Pool, STEP, ExternalField);
+            });
+
+            State.Report(("Direct steps, " + std::to_string(Count) + " bodies" + Suffix).c_str(), 1.0 / Direct.SecondsPerItem, "steps/s");
+        }
+
+        for (const size_t Count : {4000u, 16000u, 100000u})
+        {
+            NBodySystem Debris = MakeDebris(Count, NBodySettings{.Method = NBodyMethod::BARNES_HUT});
+
+            const auto Tree = State.Measure(("Barnes-Hut, " + std::to_string(Count) + " bodies" + Suffix).c_str(), 1, [&]()
+            {
+                Debris.Integrate(*Pool, STEP, ExternalField);
+            });
+
+            State.Report(("Barnes-Hut steps, " + std::to_string(Count) + " bodies" + Suffix).c_str(), 1.0 / Tree.SecondsPerItem, "steps/s");
+        }
+    }
+
+    // Largest error of the mutual accelerations relative to the largest, by opening angle
+    NBodySystem Debris = MakeDebris(16000, NBodySettings{.Method = NBodyMethod::DIRECT});
+    std::vector<Vector3> Direct(Debris.Size(), Vector3::ZERO());
+    std::vector<Vector3> Tree(Debris.Size(), Vector3::ZERO());
+    Debris.MutualAccelerations(Parallel, Direct);
+
+    for (const double Opening : {0.3, 0.5, 0.7})
+    {
+        Debris.SetSettings(NBodySettings{.Method = NBodyMethod::BARNES_HUT, .Opening = Opening});
+        Debris.MutualAccelerations(Parallel, Tree);
+
+        double Error = 0.0, Scale = 0.0;
+
+        for (size_t Index = 0; Index < Debris.Size(); Index++)
+        {
+            Error = Max(Error, (Tree[Index] - Direct[Index]).Norm());
+            Scale = Max(Scale, Direct[Index].Norm());
+        }
+
+        State.Report(("Barnes-Hut error, opening " + std::to_string(Opening).substr(0, 3)).c_str(), Error / Scale, "");
+    }
+}
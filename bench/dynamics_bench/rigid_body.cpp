@@ -0,0 +1,143 @@
+#include "dynamics/rigid_body.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double STEP = 1.0;
+    constexpr size_t STEPS = 10;
+
+    constexpr Matrix3 INERTIA{.XX = 10.0, .XY = 0.5, .XZ = -0.3,
+                              .YX = 0.5, .YY = 20.0, .YZ = 0.2,
+                              .ZX = -0.3, .ZY = 0.2, .ZZ = 30.0};
+
+    // Vehicles spread over a shell of low Earth orbits
+    RigidBodyState MakeState(size_t Index)
+    {
+        const double Angle = 0.01 * static_cast<double>(Index);
+        const double Radius = 7.0E6 + 10.0 * static_cast<double>(Index);
+        const double Speed = Sqrt(MU / Radius);
+
+        return RigidBodyState{
+            .Position = Vector3({Radius * Cos(Angle), Radius * Sin(Angle), 0.0}),
+            .Velocity = Vector3({-Speed * Sin(Angle), Speed * Cos(Angle), 0.0}),
+            .Attitude = Quaternion::FromVectorAngle(Vector3::UNIT_Z(), Angle),
+            .AngularVelocity = Axis3{1.0E-3, 0.0, 1.0E-3}
+        };
+    }
+
+    // Adjugate inverse of a non singular matrix
+    constexpr Matrix3 Inverse(const Matrix3& I) noexcept
+    {
+        return Matrix3{
+            .XX = I.YY * I.ZZ - I.YZ * I.ZY, .XY = I.XZ * I.ZY - I.XY * I.ZZ, .XZ = I.XY * I.YZ - I.XZ * I.YY,
+            .YX = I.YZ * I.ZX - I.YX * I.ZZ, .YY = I.XX * I.ZZ - I.XZ * I.ZX, .YZ = I.XZ * I.YX - I.XX * I.YZ,
+            .ZX = I.YX * I.ZY - I.YY * I.ZX, .ZY = I.XY * I.ZX - I.XX * I.ZY, .ZZ = I.XX * I.YY - I.XY * I.YX} / I.Determinant();
+    }
+
+    /**
+     * Per vehicle reference implementation with the array of structures math types
+     */
+    struct Vehicle
+    {
+        RigidBodyState State{};
+        Matrix3 Inertia = INERTIA;
+        Matrix3 InverseInertia = Inverse(INERTIA);
+    };
+
+    struct Derivative
+    {
+        Vector3 Velocity = Vector3::ZERO();
+        Vector3 Acceleration = Vector3::ZERO();
+        Quaternion Attitude = Quaternion::ZERO();
+        Vector3 AngularAcceleration = Vector3::ZERO();
+    };
+
+    Derivative Evaluate(const Vehicle& Body, const RigidBodyState& State)
+    {
+        const double Radius = State.Position.Norm();
+        const Vector3 Omega(State.AngularVelocity);
+
+        return Derivative{
+            .Velocity = State.Velocity,
+            .Acceleration = -MU / (Radius * Radius * Radius) * State.Position,
+            .Attitude = (State.Attitude * Quaternion{.X = Omega.X, .Y = Omega.Y, .Z = Omega.Z, .S = 0.0}) * 0.5,
+            .AngularAcceleration = Body.InverseInertia * (-Omega.Cross(Body.Inertia * Omega))
+        };
+    }
+
+    RigidBodyState Advance(const RigidBodyState& State, const Derivative& Rate, double Step)
+    {
+        return RigidBodyState{
+            .Position = State.Position + Step * Rate.Velocity,
+            .Velocity = State.Velocity + Step * Rate.Acceleration,
+            .Attitude = State.Attitude + Rate.Attitude * Step,
+            .AngularVelocity = Vector3(State.AngularVelocity) + Step * Rate.AngularAcceleration
+        };
+    }
+
+    void Integrate(Vehicle& Body)
+    {
+        const Derivative K1 = Evaluate(Body, Body.State);
+        const Derivative K2 = Evaluate(Body, Advance(Body.State, K1, 0.5 * STEP));
+        const Derivative K3 = Evaluate(Body, Advance(Body.State, K2, 0.5 * STEP));
+        const Derivative K4 = Evaluate(Body, Advance(Body.State, K3, STEP));
+
+        const Derivative Sum{
+            .Velocity = K1.Velocity + 2.0 * K2.Velocity + 2.0 * K3.Velocity + K4.Velocity,
+            .Acceleration = K1.Acceleration + 2.0 * K2.Acceleration + 2.0 * K3.Acceleration + K4.Acceleration,
+            .Attitude = K1.Attitude + K2.Attitude * 2.0 + K3.Attitude * 2.0 + K4.Attitude,
+            .AngularAcceleration = K1.AngularAcceleration + 2.0 * K2.AngularAcceleration + 2.0 * K3.AngularAcceleration + K4.AngularAcceleration
+        };
+
+        Body.State = Advance(Body.State, Sum, STEP / 6.0);
+        Body.State.Attitude = Body.State.Attitude.Unit();
+    }
+}
+
+// Vehicles x steps per second of point mass gravity and torque free rotation
+BENCH(Dynamics, RigidBodySwarm)
+{
+    const auto Gravity = [](RigidBodySwarm& Stage) noexcept {Stage.AddPointMassGravity(MU);};
+
+    for (const size_t Count : {16u, 256u, 1024u, 4096u})
+    {
+        RigidBodySwarm Swarm;
+        std::vector<Vehicle> Vehicles(Count);
+        Swarm.Reserve(Count);
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            Swarm.Add(RigidBodyProperties{.Mass = 100.0, .Inertia = INERTIA}, MakeState(Index));
+            Vehicles[Index].State = MakeState(Index);
+        }
+
+        const std::string Suffix = " (" + std::to_string(Count) + " vehicles)";
+
+        const Bench::Measurement Reference = State.Measure(("Per vehicle" + Suffix).c_str(), Count * STEPS, [&]()
+        {
+            for (size_t Step = 0; Step < STEPS; Step++)
+            {
+                for (Vehicle& Body : Vehicles)
+                {
+                    Integrate(Body);
+                }
+            }
+            Bench::DoNotOptimise(Vehicles);
+        });
+
+        const Bench::Measurement Batched = State.Measure(("Swarm" + Suffix).c_str(), Count * STEPS, [&]()
+        {
+            for (size_t Step = 0; Step < STEPS; Step++)
+            {
+                Swarm.Integrate(STEP, Gravity);
+            }
+            Bench::DoNotOptimise(Swarm);
+        });
+
+        State.Report(("Speed up" + Suffix).c_str(), Reference.Seconds / Batched.Seconds, "x");
+    }
+}
@@ -0,0 +1,106 @@
+#include "spice_kernel_set.hpp"
+#include "ephemeris/analytic.hpp"
+#include "ephemeris/spice.hpp"
+#include "bench_utils.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    // One year of epochs at a six hour interval from J2000
+    std::vector<double> MakeEpochs()
+    {
+        std::vector<double> Epochs(1461);
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            Epochs[Index] = 6.0 * 3600.0 * static_cast<double>(Index);
+        }
+        return Epochs;
+    }
+
+    struct BenchBody
+    {
+        const char* Label;
+        Analytic::Body Object;
+        Analytic::Body Reference;
+        const char* SpiceObject;
+        const char* SpiceReference;
+    };
+
+    constexpr BenchBody BODIES[] = {
+        {"Sun wrt Earth", Analytic::Body::SUN, Analytic::Body::EARTH, "SUN", "EARTH"},
+        {"Moon wrt Earth", Analytic::Body::MOON, Analytic::Body::EARTH, "MOON", "EARTH"},
+        {"Mars wrt Sun", Analytic::Body::MARS, Analytic::Body::SUN, "MARS BARYCENTER", "SUN"},
+        {"Jupiter wrt Earth", Analytic::Body::JUPITER, Analytic::Body::EARTH, "JUPITER BARYCENTER", "EARTH"}
+    };
+}
+
+// Evaluation speed of the analytic series
+BENCH(AnalyticEphemeris, Speed)
+{
+    const std::vector<double> Epochs = MakeEpochs();
+    std::vector<EphemerisState> States(Epochs.size());
+
+    for (const BenchBody& Body : BODIES)
+    {
+        const AnalyticEphemeris Eph(Body.Object, Body.Reference);
+        State.Measure(Body.Label, Epochs.size(), [&]()
+        {
+            Eph.GetStates(Epochs, States);
+            Bench::DoNotOptimise(States);
+        });
+    }
+}
+
+// Speed and accuracy against Spice. Requires a planetary ephemeris kernel (i.e de440.bsp), 
+// set the environment variable HAMILTON_DE_KERNEL to its path to enable
+BENCH(AnalyticEphemeris, VersusSpice)
+{
+    const char* KernelPath = std::getenv("HAMILTON_DE_KERNEL");
+    if (KernelPath == nullptr)
+    {
+        printf("[AnalyticEphemeris.VersusSpice] Skipped, HAMILTON_DE_KERNEL is not set\n");
+        return;
+    }
+
+    Spice::KernelSet Kernels{ };
+    Kernels.LoadAuxillary(DEFAULT_LEAP_SECOND_KERNAL);
+    Kernels.LoadEphemeris(std::string(KernelPath));
+
+    const std::vector<double> Epochs = MakeEpochs();
+    std::vector<EphemerisState> AnalyticStates(Epochs.size());
+    std::vector<EphemerisState> SpiceStates(Epochs.size());
+
+    for (const BenchBody& Body : BODIES)
+    {
+        const AnalyticEphemeris Analytic(Body.Object, Body.Reference);
+        const SpiceEphemeris Spice({.Object = Body.SpiceObject, .Frame = "J2000", .Reference = Body.SpiceReference});
+
+        const auto AnalyticTime = State.Measure("Analytic", Epochs.size(), [&]()
+        {
+            Analytic.GetStates(Epochs, AnalyticStates);
+            Bench::DoNotOptimise(AnalyticStates);
+        });
+
+        const auto SpiceTime = State.Measure("Spice", Epochs.size(), [&]()
+        {
+            Spice.GetStates(Epochs, SpiceStates);
+            Bench::DoNotOptimise(SpiceStates);
+        });
+
+        double MaxAngle = 0.0, MaxDistance = 0.0;
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            const Vector3& A = AnalyticStates[Index].Pos;
+            const Vector3& S = SpiceStates[Index].Pos;
+            MaxAngle = Max(MaxAngle, Acos(Clamp(Vector3::Dot(A.Unit(), S.Unit()), -1.0, 1.0)));
+            MaxDistance = Max(MaxDistance, Abs(A.Norm() - S.Norm()));
+        }
+
+        printf("[AnalyticEphemeris.VersusSpice] %s\n", Body.Label);
+        State.Report("Speed up over Spice", SpiceTime.Seconds / AnalyticTime.Seconds, "x");
+        State.Report("Max direction error", R2D(MaxAngle) * 3600.0, "arcsec");
+        State.Report("Max distance error", MaxDistance * 1.0E-3, "km");
+    }
+}
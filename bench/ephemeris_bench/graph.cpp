@@ -0,0 +1,91 @@
+#include "ephemeris/graph.hpp"
+#include "math/constants.hpp"
+#include "bench_utils.hpp"
+
+#include <memory>
+#include <vector>
+
+/**
+ * Circular orbit relative to a parent body, representative of the cost of evaluating 
+ * an analytic or interpolated ephemeris
+ */
+class CircularEphemeris : public Ephemeris
+{
+public:
+    CircularEphemeris(double Radius, double Rate) : mRadius{Radius}, mRate{Rate} { }
+
+    EphemerisState GetState(double EpochTime) const noexcept override
+    {
+        const double Angle = mRate * EpochTime;
+        const double C = Cos(Angle), S = Sin(Angle);
+        return EphemerisState{
+            .Pos = Vector3({mRadius * C, mRadius * S, 0.0}),
+            .Vel = Vector3({-mRadius * mRate * S, mRadius * mRate * C, 0.0}),
+            .LightTime = mRadius / SPEED_LIGHT
+        };
+    }
+
+private:
+    double mRadius;
+    double mRate;
+};
+
+// A spacecraft near the moon observed from the moon, earth, sun and itself, for many spacecraft.
+// Compares independently chained evaluations against the memoised graph
+BENCH(EphemerisGraph, ManyPairsPerEpoch)
+{
+    constexpr int32_t SSB = 0, SUN = 10, EMB = 3, EARTH = 399, MOON = 301;
+    constexpr size_t NUMBER_CRAFT = 64;
+
+    const CircularEphemeris SunWrtSSB(7.0E8, 1.0E-8);
+    const CircularEphemeris EMBWrtSSB(1.496E11, 1.99E-7);
+    const CircularEphemeris EarthWrtEMB(4.67E6, 2.66E-6);
+    const CircularEphemeris MoonWrtEMB(3.80E8, 2.66E-6);
+
+    std::vector<std::unique_ptr<CircularEphemeris>> Craft{};
+    EphemerisGraph Graph(SSB);
+    Graph.AddBody(SUN, SSB, SunWrtSSB);
+    Graph.AddBody(EMB, SSB, EMBWrtSSB);
+    Graph.AddBody(EARTH, EMB, EarthWrtEMB);
+    Graph.AddBody(MOON, EMB, MoonWrtEMB);
+
+    std::vector<BodyPair> Pairs{};
+    for (size_t Index = 0; Index < NUMBER_CRAFT; Index++)
+    {
+        const int32_t ID = -1000 - static_cast<int32_t>(Index);
+        Craft.push_back(std::make_unique<CircularEphemeris>(7.0E7 + 1.0E5 * static_cast<double>(Index), 1.0E-5));
+        Graph.AddBody(ID, MOON, *Craft.back());
+        Pairs.push_back({ID, MOON});
+        Pairs.push_back({ID, EARTH});
+        Pairs.push_back({ID, SUN});
+    }
+
+    std::vector<EphemerisState> Out(Pairs.size());
+    double Epoch = 0.0;
+
+    // Each pair re-derives both barycentric chains from scratch
+    State.Measure("Independent chains", Pairs.size(), [&]()
+    {
+        Epoch += 60.0;
+        for (size_t Index = 0; Index < NUMBER_CRAFT; Index++)
+        {
+            const auto CraftState = Craft[Index]->GetState(Epoch);
+            const auto Moon = MoonWrtEMB.GetState(Epoch).Pos + EMBWrtSSB.GetState(Epoch).Pos;
+            const auto Earth = EarthWrtEMB.GetState(Epoch).Pos + EMBWrtSSB.GetState(Epoch).Pos;
+            const auto Sun = SunWrtSSB.GetState(Epoch).Pos;
+            const auto CraftSSB = Craft[Index]->GetState(Epoch).Pos + MoonWrtEMB.GetState(Epoch).Pos + EMBWrtSSB.GetState(Epoch).Pos;
+            Out[3 * Index].Pos = CraftState.Pos;
+            Out[3 * Index + 1].Pos = CraftSSB - Earth;
+            Out[3 * Index + 2].Pos = CraftSSB - Sun;
+            Bench::DoNotOptimise(Moon);
+        }
+        Bench::DoNotOptimise(Out);
+    });
+
+    State.Measure("Memoised graph", Pairs.size(), [&]()
+    {
+        Epoch += 60.0;
+        Graph.GetRelativeStates(Pairs, Epoch, Out);
+        Bench::DoNotOptimise(Out);
+    });
+}
@@ -0,0 +1,95 @@
+#include "spice_kernel_set.hpp"
+#include "ephemeris/kernel_manager.hpp"
+#include "bench_utils.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const std::string GATEWAY_KERNEL = std::string(PROJECT_DIR)
+        + std::string("/data/spice/gateway_nrho_reference/receding_horiz_3189_1burnApo_DiffCorr_15yr.bsp");
+
+    constexpr int32_t GATEWAY = -60000;
+    constexpr int32_t EARTH = 399;
+
+    // 2024 June 10, 13:00:00 PST
+    constexpr double EPOCH = 771368469.183;
+
+    /**
+     * @return Kernels to benchmark, the gateway kernel and optionally a planetary kernel
+     * given by the environment variable HAMILTON_DE_KERNEL
+     */
+    std::vector<std::string> GetKernels()
+    {
+        std::vector<std::string> Kernels{GATEWAY_KERNEL};
+        const char* Planetary = std::getenv("HAMILTON_DE_KERNEL");
+
+        if (Planetary != nullptr)
+        {
+            Kernels.push_back(std::string(Planetary));
+        }
+
+        return Kernels;
+    }
+}
+
+// Time to make a kernel available, eagerly loading against registering in the coverage index
+BENCH(KernelManager, Startup)
+{
+    for (const std::string& Path : GetKernels())
+    {
+        printf("[KernelManager.Startup] %s\n", Path.c_str());
+
+        State.Measure("Spice::KernelSet::LoadEphemeris", 1, [&]()
+        {
+            Spice::KernelSet Kernels{ };
+            Kernels.LoadEphemeris(Path);
+        });
+
+        State.Measure("KernelManager::Register", 1, [&]()
+        {
+            KernelManager Manager{};
+            Bench::DoNotOptimise(Manager.Register(Path));
+        });
+    }
+}
+
+// Latency from start up to the first state, eager loading against loading on first query
+BENCH(KernelManager, FirstQuery)
+{
+    const SpiceEphemeris Direct({.Object = "-60000", .Frame = "J2000", .Reference = "EARTH"});
+
+    State.Measure("Eager load + GetState", 1, [&]()
+    {
+        Spice::KernelSet Kernels{ };
+        Kernels.LoadEphemeris(GATEWAY_KERNEL);
+        Bench::DoNotOptimise(Direct.GetState(EPOCH));
+    });
+
+    State.Measure("Register + lazy GetState", 1, [&]()
+    {
+        KernelManager Manager{};
+        Manager.Register(GATEWAY_KERNEL);
+
+        const LazySpiceEphemeris Lazy(Manager, {.Object = "-60000", .Frame = "J2000", .Reference = "EARTH"}, GATEWAY, EARTH);
+        Bench::DoNotOptimise(Lazy.GetState(EPOCH));
+    });
+
+    // Steady state overhead of the coverage lookup once loaded
+    KernelManager Manager{};
+    Manager.Register(GATEWAY_KERNEL);
+    const LazySpiceEphemeris Lazy(Manager, {.Object = "-60000", .Frame = "J2000", .Reference = "EARTH"}, GATEWAY, EARTH);
+    Lazy.GetState(EPOCH);
+
+    State.Measure("Loaded GetState (direct)", 1, [&]()
+    {
+        Bench::DoNotOptimise(Direct.GetState(EPOCH));
+    });
+
+    State.Measure("Loaded GetState (lazy)", 1, [&]()
+    {
+        Bench::DoNotOptimise(Lazy.GetState(EPOCH));
+    });
+}
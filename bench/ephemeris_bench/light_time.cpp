@@ -0,0 +1,82 @@
+#include "ephemeris/analytic.hpp"
+#include "ephemeris/light_time.hpp"
+#include "bench_utils.hpp"
+
+#include <vector>
+
+namespace
+{
+    // Observers distributed over a shell at geostationary radius about the Earth
+    std::vector<EphemerisState> MakeObservers(size_t Count, double EpochTime)
+    {
+        const EphemerisState Earth = AnalyticEphemeris::CalculateState(Analytic::Body::EARTH, Analytic::Body::SUN, EpochTime);
+        std::vector<EphemerisState> Observers(Count);
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            const double Angle = 2.0 * PI * static_cast<double>(Index) / static_cast<double>(Count);
+            const Vector3 Radial = Vector3({Cos(Angle), Sin(Angle), Sin(3.0 * Angle) * 0.1}).Unit();
+            Observers[Index] = EphemerisState{
+                .Pos = Earth.Pos + Radial * 4.2164E7,
+                .Vel = Earth.Vel + Vector3({-Radial.Y, Radial.X, 0.0}) * 3.0746E3
+            };
+        }
+
+        return Observers;
+    }
+}
+
+// Light time and aberration corrected pairs per second, for 1024 observers of each target
+BENCH(LightTime, Pairs)
+{
+    const AnalyticEphemeris Moon(Analytic::Body::MOON, Analytic::Body::SUN);
+    const AnalyticEphemeris Mars(Analytic::Body::MARS, Analytic::Body::SUN);
+    const AnalyticEphemeris Jupiter(Analytic::Body::JUPITER, Analytic::Body::SUN);
+    const AnalyticEphemeris Neptune(Analytic::Body::NEPTUNE, Analytic::Body::SUN);
+    const Ephemeris* const BODIES[] = {&Moon, &Mars, &Jupiter, &Neptune};
+
+    constexpr double Epoch = 7.0E8;
+    const std::vector<EphemerisState> Shell = MakeObservers(1024, Epoch);
+
+    std::vector<const Ephemeris*> Targets;
+    std::vector<EphemerisState> Observers;
+
+    for (const Ephemeris* Body : BODIES)
+    {
+        Targets.insert(Targets.end(), Shell.size(), Body);
+        Observers.insert(Observers.end(), Shell.begin(), Shell.end());
+    }
+
+    std::vector<EphemerisState> Out(Targets.size());
+
+    // Reference, independent iteration of each pair through GetState
+    State.Measure("Per pair GetState", Targets.size(), [&]()
+    {
+        for (size_t Index = 0; Index < Targets.size(); Index++)
+        {
+            double LightTime = 0.0;
+            for (size_t Iteration = 0; Iteration < 8; Iteration++)
+            {
+                const Vector3 Pos = Targets[Index]->GetState(Epoch - LightTime).Pos - Observers[Index].Pos;
+                const double Next = Pos.Norm() / SPEED_LIGHT;
+                Out[Index].Pos = Pos;
+                if (Abs(Next - LightTime) <= 1.0E-9)
+                {
+                    break;
+                }
+                LightTime = Next;
+            }
+        }
+        Bench::DoNotOptimise(Out);
+    });
+
+    LightTimeSolver Solver{};
+
+    State.Measure("LightTimeSolver", Targets.size(), [&]()
+    {
+        Bench::DoNotOptimise(Solver.Solve(Targets, Observers, Epoch, Out));
+        Bench::DoNotOptimise(Out);
+    });
+
+    State.Report("Iterations", static_cast<double>(Solver.GetIterations()), "");
+}
@@ -0,0 +1,53 @@
+#include "spice_kernel_set.hpp"
+#include "spice_ephemeris.hpp"
+#include "spice_label_map.hpp"
+#include "spice_time.hpp"
+#include "ephemeris/spice.hpp"
+#include "bench_utils.hpp"
+
+#include <vector>
+
+// One day of gateway states at a one minute interval, evaluated one epoch at a time
+// and as a single batch
+BENCH(Spice, GetStates)
+{
+    auto GatewayEphemeris = SpiceEphemeris({
+        .Object = Spice::GetObjectString(Spice::ObjectID::GATEWAY),
+        .Frame = Spice::GetFrameString(Spice::FrameID::J2000),
+        .Reference = Spice::GetObjectString(Spice::ObjectID::EARTH)
+    });
+
+    Spice::KernelSet Kernels{ };
+    Kernels.LoadAuxillary(DEFAULT_LEAP_SECOND_KERNAL);
+    Kernels.LoadEphemeris(std::string(PROJECT_DIR)
+        + std::string("/data/spice/gateway_nrho_reference/receding_horiz_3189_1burnApo_DiffCorr_15yr.bsp"));
+
+    constexpr size_t NUMBER_EPOCHS = 1440;
+    const double StartEpoch = Spice::Date2Epoch("2024 June 10, 13:00:00 PST");
+
+    std::vector<double> Epochs(NUMBER_EPOCHS);
+    for (size_t Index = 0; Index < NUMBER_EPOCHS; Index++)
+    {
+        Epochs[Index] = StartEpoch + 60.0 * static_cast<double>(Index);
+    }
+
+    std::vector<EphemerisState> States(NUMBER_EPOCHS);
+    const Ephemeris& Eph = GatewayEphemeris;
+
+    const auto Scalar = State.Measure("GetState loop", NUMBER_EPOCHS, [&]()
+    {
+        for (size_t Index = 0; Index < NUMBER_EPOCHS; Index++)
+        {
+            States[Index] = Eph.GetState(Epochs[Index]);
+        }
+        Bench::DoNotOptimise(States);
+    });
+
+    const auto Batch = State.Measure("GetStates batch", NUMBER_EPOCHS, [&]()
+    {
+        Eph.GetStates(Epochs, States);
+        Bench::DoNotOptimise(States);
+    });
+
+    State.Report("Batch speed up", Scalar.Seconds / Batch.Seconds, "x");
+}
@@ -0,0 +1,94 @@
+#include "meta/snapshot.hpp"
+#include "twobody/orbit.hpp"
+#include "bench_utils.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t OBJECTS = 50000;
+
+    // One in every CHANGED objects changes between snapshots
+    constexpr size_t CHANGED = 100;
+}
+
+// Full and delta snapshot and restore of a 50,000 orbit scenario
+BENCH(Meta, Snapshot)
+{
+    const std::string Full = (std::filesystem::temp_directory_path() / "bench_snapshot_full.snap").string();
+    const std::string Delta = (std::filesystem::temp_directory_path() / "bench_snapshot_delta.snap").string();
+
+    // Orbits are constructed in place, as their dynamic index refers to themselves
+    std::vector<std::unique_ptr<TwoBody::Orbit>> Orbits;
+    SnapshotSet Checkpoint;
+
+    for (size_t Index = 0; Index < OBJECTS; Index++)
+    {
+        const double Phase = static_cast<double>(Index) / static_cast<double>(OBJECTS);
+
+        Orbits.emplace_back(new TwoBody::Orbit(TwoBody::Orbit::FromKeplerianElements(TwoBody::KeplerianElements{
+            .SemiParameter = 6.9E6 + 1.0E5 * Phase,
+            .SemiMajorAxis = 6.9E6 + 1.0E5 * Phase,
+            .Inclination = 0.9,
+            .Node = 2.0 * PI * Phase,
+            .GravitationalParameter = 3.986004418E14})));
+
+        Checkpoint.Register(HString(("Orbit" + std::to_string(Index)).c_str()), *Orbits.back());
+    }
+
+    double Time = 0.0;
+
+    const auto Advance = [&]()
+    {
+        Time += 1.0;
+
+        for (size_t Index = 0; Index < OBJECTS; Index += CHANGED)
+        {
+            Orbits[Index]->Update(Time);
+        }
+    };
+
+    State.Measure("Save", OBJECTS, [&]()
+    {
+        Bench::DoNotOptimise(Checkpoint.Save(Full));
+    });
+
+    State.Measure("Save delta", OBJECTS, [&]()
+    {
+        Advance();
+        Bench::DoNotOptimise(Checkpoint.SaveDelta(Delta));
+    });
+
+    State.Measure("Restore", OBJECTS, [&]()
+    {
+        Checkpoint.Restore(Full);
+    });
+
+    State.Measure("Restore with delta", OBJECTS, [&]()
+    {
+        Checkpoint.Restore(Full);
+        Advance();
+        Checkpoint.SaveDelta(Delta);
+        Checkpoint.Restore(Full, {Delta});
+    });
+
+    // Inspection of every saved orbit, without restoring
+    State.Measure("View", OBJECTS, [&]()
+    {
+        const SnapshotReader Reader(Full);
+        double Total = 0.0;
+
+        for (size_t Index = 0; Index < Reader.Size(); Index++)
+        {
+            Total += Reader.View<TwoBody::Orbit::State>(Index).Elements.SemiMajorAxis;
+        }
+
+        Bench::DoNotOptimise(Total);
+    });
+
+    State.Report("Full size", static_cast<double>(std::filesystem::file_size(Full)) / 1.0E6, "MB");
+    State.Report("Delta size", static_cast<double>(std::filesystem::file_size(Delta)) / 1.0E6, "MB");
+}
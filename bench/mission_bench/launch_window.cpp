@@ -0,0 +1,76 @@
+#include "mission/launch_window.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t SITES = 16;
+    constexpr size_t INCLINATIONS = 90;
+    constexpr size_t NODES = 360;
+
+    // Sites spread in latitude and longitude, inclinations from equatorial to retrograde and nodes every degree
+    std::vector<Mission::LaunchSite> MakeSites()
+    {
+        std::vector<Mission::LaunchSite> Sites(SITES);
+
+        for (size_t Index = 0; Index < SITES; Index++)
+        {
+            Sites[Index] = Mission::LaunchSite{.Latitude = D2R(-60.0 + 8.0 * static_cast<double>(Index)), .Longitude = D2R(22.5 * static_cast<double>(Index))};
+        }
+
+        return Sites;
+    }
+
+    std::vector<double> MakeAngles(size_t Count, double Step)
+    {
+        std::vector<double> Angles(Count);
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            Angles[Index] = D2R(Step * static_cast<double>(Index));
+        }
+
+        return Angles;
+    }
+}
+
+// Cells per second of a week long launch window search over a grid of sites, inclinations and nodes
+BENCH(Mission, LaunchWindowGrid)
+{
+    const std::vector<Mission::LaunchSite> Sites = MakeSites();
+    const std::vector<double> Inclinations = MakeAngles(INCLINATIONS, 2.0);
+    const std::vector<double> Nodes = MakeAngles(NODES, 1.0);
+    const Mission::LaunchGrid Grid{.Sites = Sites, .Inclinations = Inclinations, .Nodes = Nodes, .Altitude = 500.0E3};
+    const Mission::LaunchWindowSettings Settings{.Duration = 7.0 * 86400.0, .PlaneTolerance = D2R(0.5)};
+    std::vector<Mission::LaunchCell> Cells(Grid.Size());
+
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        const auto Result = State.Measure(("Grid of " + std::to_string(Grid.Size()) + " cells" + Suffix).c_str(), Grid.Size(), [&]()
+        {
+            Mission::EvaluateLaunchGrid(*Pool, Grid, Settings, Cells);
+            Bench::DoNotOptimise(Cells.data());
+        });
+
+        State.Report(("Cells per second" + Suffix).c_str(), 1.0 / Result.SecondsPerItem, "cells/s");
+    }
+
+    // A single site and target searched opportunity by opportunity
+    std::vector<Mission::LaunchOpportunity> Opportunities(32);
+    const Mission::TargetOrbit Target{.Inclination = D2R(51.6), .Node = 1.0, .Altitude = 400.0E3};
+
+    State.Measure("Single search", 1, [&]()
+    {
+        Bench::DoNotOptimise(Mission::FindLaunchOpportunities(Sites[8], Target, Settings, Opportunities));
+    });
+}
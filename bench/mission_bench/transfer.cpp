@@ -0,0 +1,88 @@
+#include "mission/transfer.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "coordinates/earth.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = Earth::GRAVITATIONAL_CONSTANT;
+    constexpr size_t PLANES = 24;
+    constexpr size_t SLOTS = 20;
+
+    /**
+     * @return Orbit of a circular state of a radius, inclination, node and argument of latitude
+     */
+    TwoBody::Orbit MakeCircular(double Radius, double Inclination, double Node, double Latitude)
+    {
+        const double Speed = Sqrt(MU / Radius);
+        const Vector3 Position({Cos(Node) * Cos(Latitude) - Sin(Node) * Sin(Latitude) * Cos(Inclination),
+            Sin(Node) * Cos(Latitude) + Cos(Node) * Sin(Latitude) * Cos(Inclination), Sin(Latitude) * Sin(Inclination)});
+        const Vector3 Velocity({-Cos(Node) * Sin(Latitude) - Sin(Node) * Cos(Latitude) * Cos(Inclination),
+            -Sin(Node) * Sin(Latitude) + Cos(Node) * Cos(Latitude) * Cos(Inclination), Cos(Latitude) * Sin(Inclination)});
+
+        return TwoBody::Orbit::FromNewtonian(Position * Radius, Velocity * Speed, MU);
+    }
+
+    // Slots of a Walker 53 degree constellation at 550 km, in planes of nodes 15 degrees apart
+    std::vector<TwoBody::Orbit> MakeSlots()
+    {
+        std::vector<TwoBody::Orbit> Slots{};
+        Slots.reserve(PLANES * SLOTS);
+
+        for (size_t Plane = 0; Plane < PLANES; Plane++)
+        {
+            for (size_t Slot = 0; Slot < SLOTS; Slot++)
+            {
+                Slots.push_back(MakeCircular(Earth::WGS84::SEMI_MAJOR_AXIS + 550.0E3, D2R(53.0), D2R(15.0 * static_cast<double>(Plane)),
+                    2.0 * PI * (static_cast<double>(Slot) + 0.05 * static_cast<double>(Plane)) / static_cast<double>(SLOTS)));
+            }
+        }
+
+        return Slots;
+    }
+}
+
+// Plans per second of the deployment of every slot of a constellation from a parking orbit, each
+// by the least delta v rendezvous within three days
+BENCH(Mission, ConstellationDeployment)
+{
+    const TwoBody::Orbit Parking = MakeCircular(Earth::WGS84::SEMI_MAJOR_AXIS + 300.0E3, D2R(52.0), D2R(5.0), 0.0);
+    const std::vector<TwoBody::Orbit> Slots = MakeSlots();
+    const Mission::RendezvousSettings Settings{.MaxDuration = 3.0 * 86400.0};
+    std::vector<Mission::RendezvousPlan> Plans(Slots.size());
+
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    State.Measure("Hohmann transfer with plane change", 1, [&]()
+    {
+        Bench::DoNotOptimise(Mission::Hohmann(Parking.GetElements(), Slots[0].GetElements()));
+    });
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        const auto Result = State.Measure((std::to_string(Slots.size()) + " slots" + Suffix).c_str(), Slots.size(), [&]()
+        {
+            Mission::PlanRendezvous(*Pool, Parking, Slots, Settings, Plans);
+            Bench::DoNotOptimise(Plans.data());
+        });
+
+        State.Report(("Plans per second" + Suffix).c_str(), 1.0 / Result.SecondsPerItem, "plans/s");
+    }
+
+    double Total = 0.0;
+
+    for (const Mission::RendezvousPlan& Plan : Plans)
+    {
+        Total += (Plan.Status == Mission::RendezvousStatus::SUCCESS) ? Plan.Transfer.DeltaV : 0.0;
+    }
+
+    State.Report("Mean delta v per slot", Total / static_cast<double>(Plans.size()), "m/s");
+}
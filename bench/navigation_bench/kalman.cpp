@@ -0,0 +1,109 @@
+#include "navigation/attitude_filter.hpp"
+#include "navigation/kalman.hpp"
+#include "bench_utils.hpp"
+
+namespace
+{
+    constexpr double STEP = 1.0;
+    constexpr size_t CYCLES = 1000;
+
+    // Constant velocity motion of a position and velocity in three dimensions
+    MatrixN<6, 6> MakeTransition(void)
+    {
+        MatrixN<6, 6> Transition = MatrixN<6, 6>::IDENTITY();
+
+        for (size_t Axis = 0; Axis < 3; Axis++)
+        {
+            Transition(Axis, Axis + 3) = STEP;
+        }
+
+        return Transition;
+    }
+
+    const MatrixN<6, 6> TRANSITION = MakeTransition();
+    const MatrixN<6, 6> PROCESS_NOISE = MatrixN<6, 6>::IDENTITY() * 1.0E-4;
+    const MatrixN<3, 3> MEASUREMENT_NOISE = MatrixN<3, 3>::IDENTITY() * 25.0;
+
+    const VectorN<6> INITIAL_STATE{.Data = {7.0E6, 1.0E5, -2.0E5, -100.0, 7500.0, 10.0}};
+    const MatrixN<6, 6> INITIAL_COVARIANCE = MatrixN<6, 6>::IDENTITY() * 100.0;
+
+    // Range, and the sines of azimuth and elevation, of a station at the origin
+    VectorN<3> Observe(const VectorN<6>& X) noexcept
+    {
+        const double Range = Sqrt(Square(X[0]) + Square(X[1]) + Square(X[2]));
+        return VectorN<3>{.Data = {Range, X[1] / Range, X[2] / Range}};
+    }
+
+    VectorN<3> ObserveLinearised(const VectorN<6>& X, MatrixN<3, 6>& Jacobian) noexcept
+    {
+        const VectorN<3> Result = Observe(X);
+        const double Range = Result[0];
+
+        for (size_t Axis = 0; Axis < 3; Axis++)
+        {
+            Jacobian(0, Axis) = X[Axis] / Range;
+            Jacobian(1, Axis) = -X[1] * X[Axis] / Cube(Range);
+            Jacobian(2, Axis) = -X[2] * X[Axis] / Cube(Range);
+        }
+
+        Jacobian(1, 1) += 1.0 / Range;
+        Jacobian(2, 2) += 1.0 / Range;
+        return Result;
+    }
+
+    template <Navigation::CovarianceForm Form>
+    void MeasureExtended(Bench::State& Context, const char* Label)
+    {
+        Navigation::ExtendedKalmanFilter<6, Form> Filter(INITIAL_STATE, INITIAL_COVARIANCE);
+        const VectorN<3> Measurement = Observe(INITIAL_STATE);
+
+        Context.Measure(Label, CYCLES, [&]()
+        {
+            for (size_t Cycle = 0; Cycle < CYCLES; Cycle++)
+            {
+                Filter.Predict([](const VectorN<6>& X, MatrixN<6, 6>& Jacobian) {Jacobian = TRANSITION; return TRANSITION * X;}, PROCESS_NOISE);
+                Filter.Update(Measurement, MEASUREMENT_NOISE, ObserveLinearised);
+            }
+
+            Bench::DoNotOptimise(Filter);
+        });
+    }
+}
+
+// Latency of a prediction and update cycle of a six element state, and of the attitude filter
+BENCH(Navigation, Kalman)
+{
+    MeasureExtended<Navigation::CovarianceForm::JOSEPH>(State, "Extended, Joseph (per cycle)");
+    MeasureExtended<Navigation::CovarianceForm::SQUARE_ROOT>(State, "Extended, square root (per cycle)");
+
+    Navigation::UnscentedKalmanFilter<6> Unscented(INITIAL_STATE, INITIAL_COVARIANCE);
+    const VectorN<3> Measurement = Observe(INITIAL_STATE);
+
+    State.Measure("Unscented (per cycle)", CYCLES, [&]()
+    {
+        for (size_t Cycle = 0; Cycle < CYCLES; Cycle++)
+        {
+            Unscented.Predict([](const VectorN<6>& X) {return TRANSITION * X;}, PROCESS_NOISE);
+            Unscented.Update(Measurement, MEASUREMENT_NOISE, Observe);
+        }
+
+        Bench::DoNotOptimise(Unscented);
+    });
+
+    Navigation::AttitudeFilter::ErrorCovariance Covariance = MatrixN<6, 6>::IDENTITY() * 1.0E-2;
+    Navigation::AttitudeFilter Attitude(Quaternion::IDENTITY(), Vector3::ZERO(), Covariance, Navigation::GyroNoise{});
+    const Vector3 Sun = Vector3({1.0, 0.0, 0.0});
+    const Vector3 Field = Vector3({0.0, 0.6, 0.8});
+
+    State.Measure("Attitude, two vectors (per cycle)", CYCLES, [&]()
+    {
+        for (size_t Cycle = 0; Cycle < CYCLES; Cycle++)
+        {
+            Attitude.Predict(Vector3({1.0E-3, 0.0, 0.0}), 0.1);
+            Attitude.UpdateVector(Sun, Sun, 1.0E-3);
+            Attitude.UpdateVector(Field, Field, 1.0E-3);
+        }
+
+        Bench::DoNotOptimise(Attitude);
+    });
+}
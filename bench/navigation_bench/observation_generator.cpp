@@ -0,0 +1,87 @@
+#include "navigation/observation_generator.hpp"
+#include "twobody/orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr size_t TARGETS = 20;
+    constexpr size_t STATIONS = 12;
+
+    // Low Earth orbits of a range of inclinations and phases
+    std::vector<std::unique_ptr<TwoBody::OrbitEphemeris>> MakeTargets()
+    {
+        std::vector<std::unique_ptr<TwoBody::OrbitEphemeris>> Targets{};
+        Targets.reserve(TARGETS);
+
+        for (size_t Index = 0; Index < TARGETS; Index++)
+        {
+            const double Phase = 0.3 * static_cast<double>(Index);
+            const double Inclination = 0.2 + 0.07 * static_cast<double>(Index);
+            const double Radius = 6.9E6 + 2.0E4 * static_cast<double>(Index);
+            const double Speed = Sqrt(MU / Radius);
+
+            Targets.push_back(std::make_unique<TwoBody::OrbitEphemeris>(TwoBody::Orbit::FromNewtonian(
+                Vector3({Radius * Cos(Phase), Radius * Sin(Phase), 0.0}),
+                Vector3({-Speed * Sin(Phase) * Cos(Inclination), Speed * Cos(Phase) * Cos(Inclination), Speed * Sin(Inclination)}), MU)));
+        }
+
+        return Targets;
+    }
+
+    // Stations spread in longitude, alternately north and south
+    void AddStations(Navigation::ObservationGenerator& Generator)
+    {
+        for (size_t Index = 0; Index < STATIONS; Index++)
+        {
+            const double Latitude = ((Index % 2 == 0) ? 1.0 : -1.0) * (10.0 + 3.0 * static_cast<double>(Index));
+            Generator.AddStation(Navigation::GroundStation{.Location = {.Lat = Latitude, .Lgt = 30.0 * static_cast<double>(Index)}, .MinElevation = 0.1});
+        }
+    }
+}
+
+// Observations per second of a day of tracking of a constellation by a station network, streamed to a file
+BENCH(Navigation, ObservationGenerator)
+{
+    const std::vector<std::unique_ptr<TwoBody::OrbitEphemeris>> Targets = MakeTargets();
+    const std::string Path = (std::filesystem::temp_directory_path() / "bench_observations.hobs").string();
+
+    Navigation::ObservationGenerator Generator(Navigation::GeneratorSettings{.Interval = 10.0});
+    AddStations(Generator);
+
+    for (const std::unique_ptr<TwoBody::OrbitEphemeris>& Target : Targets)
+    {
+        Generator.AddTarget(*Target);
+    }
+
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        Navigation::ObservationWriter Counter(Path);
+        const uint64_t Observations = Generator.Generate(*Pool, Counter);
+        Counter.Close();
+
+        State.Measure(("Generate" + Suffix).c_str(), Observations, [&]()
+        {
+            Navigation::ObservationWriter Writer(Path);
+            Bench::DoNotOptimise(Generator.Generate(*Pool, Writer));
+            Writer.Close();
+        });
+
+        State.Report(("Observations" + Suffix).c_str(), static_cast<double>(Observations), "");
+    }
+
+    std::filesystem::remove(Path);
+}
@@ -0,0 +1,79 @@
+#include "navigation/orbit_determination.hpp"
+#include "coordinates/general.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/random.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double EARTH_RADIUS = 6.378137E6;
+    constexpr size_t OBSERVATIONS = 100000;
+    constexpr double INTERVAL = 2.0;
+
+    const TwoBody::StateVector TRUTH = TwoBody::MakeStateVector(
+        Vector3({6.9E6, 1.0E5, -2.0E5}),
+        Vector3({-100.0, 5800.0, 4800.0}));
+
+    const double SIGMAS[] = {5.0, 0.01, 1.0E-4, 1.0E-4};
+
+    // Range, range rate and angles from a station fixed in the inertial frame, every interval
+    void Populate(Navigation::OrbitDetermination& Fit)
+    {
+        const LLARad Site{.LatRad = 0.3, .LgtRad = 0.1, .Alt = 0.0};
+        const Vector3 Station = Vector3({EARTH_RADIUS * Cos(Site.LatRad) * Cos(Site.LgtRad), EARTH_RADIUS * Cos(Site.LatRad) * Sin(Site.LgtRad), EARTH_RADIUS * Sin(Site.LatRad)});
+
+        Random::Stream Noise(1, 0);
+        MatrixN<1, 6> Partials{};
+        Fit.Reserve(OBSERVATIONS);
+
+        for (size_t Index = 0; Index < OBSERVATIONS; Index++)
+        {
+            const double Time = INTERVAL * static_cast<double>(Index / 4);
+            const TwoBody::StateVector State = TwoBody::Propagate(TRUTH, MU, Time);
+            const size_t Type = Index % 4;
+
+            Navigation::Observation Measurement{
+                .Time = Time,
+                .Type = static_cast<Navigation::ObservationType>(Type),
+                .Sigma = SIGMAS[Type],
+                .StationPosition = Station,
+                .InertialToENU = QuatBCBF2ENU(Site)
+            };
+
+            Measurement.Value = Navigation::OrbitDetermination::Evaluate(Measurement, State, Partials) + Noise.Normal(0.0, Measurement.Sigma);
+            Fit.Add(Measurement);
+        }
+    }
+}
+
+// Observations fitted per second by batch least squares, from a state kilometres in error
+BENCH(Navigation, OrbitDetermination)
+{
+    Navigation::OrbitDetermination Fit(MU);
+    Populate(Fit);
+
+    const TwoBody::StateVector Initial = TRUTH + TwoBody::StateVector{.Data = {2000.0, -1500.0, 1000.0, 1.0, -2.0, 1.5}};
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+        Navigation::FitResult Result{};
+
+        State.Measure(("Solve" + Suffix).c_str(), OBSERVATIONS, [&]()
+        {
+            Result = Fit.Solve(*Pool, Initial);
+            Bench::DoNotOptimise(Result);
+        });
+
+        State.Report(("Iterations" + Suffix).c_str(), static_cast<double>(Result.Iterations), "");
+        State.Report(("Position error" + Suffix).c_str(), (Vector3({Result.State[0], Result.State[1], Result.State[2]}) -
+            Vector3({TRUTH[0], TRUTH[1], TRUTH[2]})).Norm(), "m");
+    }
+}
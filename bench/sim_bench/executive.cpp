@@ -0,0 +1,102 @@
+#include "sim/executive.hpp"
+#include "bench_utils.hpp"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t COMPONENTS = 1000;
+    constexpr size_t LEVELS = 4;
+    constexpr uint64_t FRAMES = 100;
+
+    // Update rates (Hz) of the rate groups, the first being the base rate
+    constexpr double RATES[] = {100.0, 50.0, 25.0, 10.0};
+
+    /**
+     * Near empty component, such that the measured time is dominated by the executive
+     */
+    class TrivialComponent : public Component
+    {
+    public:
+        TrivialComponent(const std::string& Name, double Rate, const Signal<double>* Input) :
+            Component(Name, Rate),
+            mInput{Input}
+        {
+            AddOutput(Output);
+        }
+
+        void Update(double Time, double Step) override
+        {
+            const double Previous = (mInput != nullptr) ? mInput->Get() : 0.0;
+            Output.Set(Previous + Time * Step);
+        }
+
+        Signal<double> Output{};
+
+    private:
+        const Signal<double>* mInput = nullptr;
+    };
+
+    // Chains of components across the levels, with rates cycling through the rate groups
+    std::vector<std::unique_ptr<TrivialComponent>> MakeComponents(Executive& Exec)
+    {
+        std::vector<std::unique_ptr<TrivialComponent>> Components;
+
+        for (size_t Index = 0; Index < COMPONENTS; Index++)
+        {
+            const size_t Level = Index % LEVELS;
+            const double Rate = RATES[(Index / LEVELS) % std::size(RATES)];
+            TrivialComponent* Input = (Level > 0) ? Components.back().get() : nullptr;
+
+            Components.push_back(std::make_unique<TrivialComponent>("C" + std::to_string(Index), Rate,
+                (Input != nullptr) ? &Input->Output : nullptr));
+
+            if (Input != nullptr)
+            {
+                Components.back()->DependsOn(*Input);
+            }
+
+            Exec.Add(*Components.back());
+        }
+
+        Exec.Build();
+        return Components;
+    }
+}
+
+// Per frame overhead of a 1000 component multi-rate model
+BENCH(Sim, ExecutiveFrame)
+{
+    const size_t Workers = (std::thread::hardware_concurrency() > 1) ? std::thread::hardware_concurrency() - 1 : 1;
+
+    Executive Serial(RATES[0]);
+    Executive Parallel(RATES[0], Workers);
+    const auto SerialComponents = MakeComponents(Serial);
+    const auto ParallelComponents = MakeComponents(Parallel);
+
+    const Bench::Measurement SerialTime = State.Measure("Serial", FRAMES, [&]()
+    {
+        Serial.Run(FRAMES);
+        Bench::DoNotOptimise(SerialComponents.back()->Output.Get());
+    });
+
+    const Bench::Measurement ParallelTime = State.Measure("Parallel", FRAMES, [&]()
+    {
+        Parallel.Run(FRAMES);
+        Bench::DoNotOptimise(ParallelComponents.back()->Output.Get());
+    });
+
+    // Mean number of component updates in each base frame
+    double Updates = 0.0;
+    for (const auto& Member : SerialComponents)
+    {
+        Updates += 1.0 / static_cast<double>(Member->GetDivisor());
+    }
+
+    State.Report("Serial time per update", SerialTime.SecondsPerItem * 1.0E9 / Updates, "ns");
+    State.Report("Workers", static_cast<double>(Workers), "");
+    State.Report("Parallel speed up", SerialTime.Seconds / ParallelTime.Seconds, "x");
+}
@@ -0,0 +1,71 @@
+#include "sim/monte_carlo.hpp"
+#include "math/vector3.hpp"
+#include "bench_utils.hpp"
+
+#include <span>
+#include <string>
+#include <thread>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr size_t CASES = 512;
+    constexpr size_t STEPS = 200;
+    constexpr double STEP = 10.0;
+
+    // Point mass orbit from a dispersed insertion state, integrated by RK4. Parameters are
+    // indexed in order of addition to the dispersions
+    void Insertion(const MonteCarloCase& Case, std::span<double> Outputs)
+    {
+        Vector3 Position({Case[0], 0.0, 0.0});
+        Vector3 Velocity({0.0, Case[1], Case[2]});
+
+        const auto Acceleration = [](const Vector3& R) {return -MU / (R.Norm() * R.NormSquared()) * R;};
+
+        for (size_t Step = 0; Step < STEPS; Step++)
+        {
+            const Vector3 K1V = Acceleration(Position);
+            const Vector3 K1R = Velocity;
+            const Vector3 K2V = Acceleration(Position + 0.5 * STEP * K1R);
+            const Vector3 K2R = Velocity + 0.5 * STEP * K1V;
+            const Vector3 K3V = Acceleration(Position + 0.5 * STEP * K2R);
+            const Vector3 K3R = Velocity + 0.5 * STEP * K2V;
+            const Vector3 K4V = Acceleration(Position + STEP * K3R);
+            const Vector3 K4R = Velocity + STEP * K3V;
+
+            Position = Position + STEP / 6.0 * (K1R + 2.0 * K2R + 2.0 * K3R + K4R);
+            Velocity = Velocity + STEP / 6.0 * (K1V + 2.0 * K2V + 2.0 * K3V + K4V);
+        }
+
+        Outputs[0] = Position.Norm();
+        Outputs[1] = Velocity.Norm();
+    }
+}
+
+// Cases per second of a dispersed orbit insertion, for 1 to 64 threads
+BENCH(Sim, MonteCarlo)
+{
+    DispersionSet Dispersions;
+    Dispersions.AddNormal("Radius", 6.778E6, 1.0E3);
+    Dispersions.AddNormal("Speed", 7.668E3, 5.0);
+    Dispersions.AddUniform("Cross", -10.0, 10.0);
+
+    const MonteCarlo Experiment(Dispersions, {"Radius", "Speed"}, MonteCarloOptions{.Cases = CASES, .Seed = 1, .ChunkSize = 4});
+    double Serial = 0.0;
+
+    for (const size_t Threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+        ThreadPool Pool(Threads - 1);
+        const std::string Label = std::to_string(Threads) + " threads";
+
+        const Bench::Measurement Result = State.Measure(Label.c_str(), CASES, [&]()
+        {
+            Bench::DoNotOptimise(Experiment.Run(Pool, Insertion));
+        });
+
+        Serial = (Threads == 1) ? Result.Seconds : Serial;
+        State.Report(("Speed up " + Label).c_str(), Serial / Result.Seconds, "x");
+    }
+
+    State.Report("Hardware threads", static_cast<double>(std::thread::hardware_concurrency()), "");
+}
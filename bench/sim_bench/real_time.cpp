@@ -0,0 +1,67 @@
+#include "sim/real_time.hpp"
+#include "bench_utils.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr double BASE_RATE = 1000.0;
+    constexpr size_t COMPONENTS = 100;
+
+    // Soak duration relative to the minimum measurement time
+    constexpr double SOAK_SCALE = 10.0;
+
+    /**
+     * Small fixed workload per update
+     */
+    class WorkComponent : public Component
+    {
+    public:
+        WorkComponent(const std::string& Name, double Rate) : Component(Name, Rate) { }
+
+        void Update(double Time, double Step) override
+        {
+            double Value = Time;
+
+            for (int Iteration = 0; Iteration < 64; Iteration++)
+            {
+                Value = Value * 0.999 + Step;
+            }
+
+            Output.Set(Value);
+        }
+
+        Signal<double> Output{};
+    };
+}
+
+// Release jitter of a 1 kHz frame over a soak of ten times the minimum measurement time
+BENCH(Sim, RealTimeJitter)
+{
+    std::vector<std::unique_ptr<WorkComponent>> Components;
+    Executive Exec(BASE_RATE);
+
+    for (size_t Index = 0; Index < COMPONENTS; Index++)
+    {
+        Components.push_back(std::make_unique<WorkComponent>("C" + std::to_string(Index), (Index % 2 == 0) ? 1000.0 : 100.0));
+        Exec.Add(*Components.back());
+    }
+
+    RealTimeRunner Runner(Exec, RealTimeOptions{.Cpus = {0}, .LockMemory = true});
+    const uint64_t Frames = static_cast<uint64_t>(SOAK_SCALE * State.GetMinSeconds() * BASE_RATE);
+    Runner.Run(Frames);
+
+    const Indexable* Telemetry = Runner.GetDynamicIndexMap();
+    State.Report("Frames", static_cast<double>(*Telemetry->GetPtrInt("Frames")), "");
+    State.Report("Jitter P50", *Telemetry->GetPtrDouble("Jitter.P50") * 1.0E6, "us");
+    State.Report("Jitter P99", *Telemetry->GetPtrDouble("Jitter.P99") * 1.0E6, "us");
+    State.Report("Jitter P99.9", *Telemetry->GetPtrDouble("Jitter.P999") * 1.0E6, "us");
+    State.Report("Jitter max", *Telemetry->GetPtrDouble("Jitter.Max") * 1.0E6, "us");
+    State.Report("Frame mean", *Telemetry->GetPtrDouble("Frame.Mean") * 1.0E6, "us");
+    State.Report("Frame P99", *Telemetry->GetPtrDouble("Frame.P99") * 1.0E6, "us");
+    State.Report("Overruns", static_cast<double>(*Telemetry->GetPtrInt("Overruns")), "");
+    State.Report("Memory locked", *Telemetry->GetPtrBool("MemoryLocked") ? 1.0 : 0.0, "");
+    State.Report("Pinned", *Telemetry->GetPtrBool("Pinned") ? 1.0 : 0.0, "");
+}
@@ -0,0 +1,112 @@
+#include "sim/recorder.hpp"
+#include "bench_utils.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr size_t PARAMETERS = 1000;
+    constexpr size_t FRAMES = 1000;
+
+    /**
+     * Simulation state of slowly varying, oscillating and constant parameters
+     */
+    struct Scenario
+    {
+        std::vector<double> Values = std::vector<double>(PARAMETERS, 0.0);
+        std::unique_ptr<Indexable> DynamicIndex{};
+
+        Scenario()
+        {
+            std::map<HString, const double*> Map;
+
+            for (size_t Index = 0; Index < PARAMETERS; Index++)
+            {
+                Map.emplace(HString(("P" + std::to_string(Index)).c_str()), &Values[Index]);
+            }
+
+            DynamicIndex = std::make_unique<Indexable>(IndexMap{.PtrMapDouble = Map});
+        }
+
+        void Update(size_t Frame)
+        {
+            const double Time = 0.01 * static_cast<double>(Frame);
+
+            for (size_t Index = 0; Index < PARAMETERS; Index++)
+            {
+                switch (Index % 4)
+                {
+                    case 0: Values[Index] = Time * static_cast<double>(Index); break;
+                    case 1: Values[Index] = std::sin(Time + static_cast<double>(Index)); break;
+                    case 2: Values[Index] = static_cast<double>(Frame / 100); break;
+                    default: Values[Index] = 1.0; break;
+                }
+            }
+        }
+    };
+}
+
+// Frames per second recorded from 1000 bound parameters, against formatting each frame as
+// text, with the size of each file relative to the raw values
+BENCH(Sim, Recorder)
+{
+    const std::string Binary = (std::filesystem::temp_directory_path() / "bench_recorder.htlm").string();
+    const std::string Text = (std::filesystem::temp_directory_path() / "bench_recorder.csv").string();
+
+    // Precomputed frames, such that only recording is measured
+    Scenario Simulation;
+    std::vector<std::vector<double>> Frames;
+
+    for (size_t Frame = 0; Frame < FRAMES; Frame++)
+    {
+        Simulation.Update(Frame);
+        Frames.push_back(Simulation.Values);
+    }
+
+    State.Measure("Columnar", FRAMES, [&]()
+    {
+        Recorder Telemetry(Binary);
+
+        for (size_t Index = 0; Index < PARAMETERS; Index++)
+        {
+            Telemetry.Bind(*Simulation.DynamicIndex, ("P" + std::to_string(Index)).c_str());
+        }
+
+        Telemetry.Start();
+
+        for (size_t Frame = 0; Frame < FRAMES; Frame++)
+        {
+            Simulation.Values = Frames[Frame];
+            Telemetry.Record(0.01 * static_cast<double>(Frame));
+        }
+
+        Telemetry.Stop();
+    });
+
+    State.Measure("Text", FRAMES, [&]()
+    {
+        std::ofstream File(Text);
+
+        for (size_t Frame = 0; Frame < FRAMES; Frame++)
+        {
+            Simulation.Values = Frames[Frame];
+            File << std::to_string(0.01 * static_cast<double>(Frame));
+
+            for (const double Value : Simulation.Values)
+            {
+                File << ',' << std::to_string(Value);
+            }
+
+            File << '\n';
+        }
+    });
+
+    const double Raw = static_cast<double>(FRAMES * (PARAMETERS + 1) * sizeof(double));
+    State.Report("Columnar size", static_cast<double>(std::filesystem::file_size(Binary)) / Raw, "of raw");
+    State.Report("Text size", static_cast<double>(std::filesystem::file_size(Text)) / Raw, "of raw");
+}
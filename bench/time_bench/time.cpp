@@ -0,0 +1,126 @@
+#include "spice_kernel_set.hpp"
+#include "spice_time.hpp"
+#include "ephemeris/spice.hpp"
+#include "time/time_scales.hpp"
+#include "time/iso8601.hpp"
+#include "bench_utils.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Ten years of UTC epochs at a one hour interval from 2015
+    std::vector<Time::Epoch> MakeEpochs()
+    {
+        const Time::Epoch Start = Time::FromCalendar(Time::CalendarDate{2015, 1, 1});
+        std::vector<Time::Epoch> Epochs(87660);
+
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            Epochs[Index] = Start.AddSeconds(3600.0 * static_cast<double>(Index));
+        }
+
+        return Epochs;
+    }
+
+    // ISO-8601 strings of a subset of the epochs
+    std::vector<std::string> MakeStrings(const std::vector<Time::Epoch>& Epochs, size_t Count)
+    {
+        std::vector<std::string> Strings;
+        std::array<char, 32> Buffer{};
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            const size_t Length = Time::FormatISO8601(Epochs[Index * (Epochs.size() / Count)], Buffer, 3);
+            Strings.emplace_back(Buffer.data(), Length);
+        }
+
+        return Strings;
+    }
+}
+
+// Time scale conversion throughput
+BENCH(Time, Conversions)
+{
+    const std::vector<Time::Epoch> Epochs = MakeEpochs();
+    std::vector<Time::Epoch> Out(Epochs.size());
+
+    State.Measure("UTC -> TAI", Epochs.size(), [&]()
+    {
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            Out[Index] = Time::UTC2TAI(Epochs[Index]);
+        }
+        Bench::DoNotOptimise(Out);
+    });
+
+    State.Measure("UTC -> TDB", Epochs.size(), [&]()
+    {
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            Out[Index] = Time::Convert(Epochs[Index], Time::TimeScale::UTC, Time::TimeScale::TDB);
+        }
+        Bench::DoNotOptimise(Out);
+    });
+
+    State.Measure("TDB -> UTC", Epochs.size(), [&]()
+    {
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            Out[Index] = Time::Convert(Epochs[Index], Time::TimeScale::TDB, Time::TimeScale::UTC);
+        }
+        Bench::DoNotOptimise(Out);
+    });
+}
+
+// ISO-8601 parsing and formatting throughput, against Spice string conversion
+BENCH(Time, ISO8601)
+{
+    const std::vector<std::string> Strings = MakeStrings(MakeEpochs(), 4096);
+    std::vector<Time::Epoch> Parsed(Strings.size());
+    std::vector<double> EphemerisTimes(Strings.size());
+    std::array<char, 32> Buffer{};
+
+    const auto Native = State.Measure("Parse + UTC -> TDB", Strings.size(), [&]()
+    {
+        for (size_t Index = 0; Index < Strings.size(); Index++)
+        {
+            Parsed[Index] = Time::ParseISO8601(Strings[Index]).Value;
+            EphemerisTimes[Index] = Time::UTC2EphemerisTime(Parsed[Index]);
+        }
+        Bench::DoNotOptimise(EphemerisTimes);
+    });
+
+    State.Measure("Format", Strings.size(), [&]()
+    {
+        for (size_t Index = 0; Index < Strings.size(); Index++)
+        {
+            Bench::DoNotOptimise(Time::FormatISO8601(Parsed[Index], Buffer, 3));
+        }
+    });
+
+    Spice::KernelSet Kernels{ };
+    Kernels.LoadAuxillary(DEFAULT_LEAP_SECOND_KERNAL);
+
+    const auto SpiceTime = State.Measure("Spice::Date2Epoch", Strings.size(), [&]()
+    {
+        for (size_t Index = 0; Index < Strings.size(); Index++)
+        {
+            EphemerisTimes[Index] = Spice::Date2Epoch(Strings[Index]);
+        }
+        Bench::DoNotOptimise(EphemerisTimes);
+    });
+
+    State.Report("Speed up over Spice", SpiceTime.Seconds / Native.Seconds, "x");
+}
+
+// Start up cost of parsing the leap second kernel
+BENCH(Time, LoadLeapSecondKernel)
+{
+    State.Measure("naif0012.tls", 1, [&]()
+    {
+        Bench::DoNotOptimise(Time::LoadLeapSecondKernel(DEFAULT_LEAP_SECOND_KERNAL));
+    });
+}
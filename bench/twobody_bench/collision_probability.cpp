@@ -0,0 +1,106 @@
+#include "twobody/collision_probability.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t EVENTS = 4000;
+    constexpr uint64_t SAMPLES = 4000000;
+
+    /**
+     * Conjunction crossing along Z, with a miss along X and a covariance of standard deviations
+     * along X and Y, rotated about Z
+     */
+    TwoBody::Conjunction MakeConjunction(double Miss, double SigmaX, double SigmaY, double Angle, double Radius)
+    {
+        const double C = Cos(Angle), S = Sin(Angle);
+        const double XX = Square(SigmaX), YY = Square(SigmaY);
+
+        return TwoBody::Conjunction{
+            .RelativePosition = Vector3({Miss, 0.0, 0.0}),
+            .RelativeVelocity = Vector3({0.0, 0.0, 10000.0}),
+            .Covariance = Matrix3{.XX = C * C * XX + S * S * YY, .XY = C * S * (XX - YY), .XZ = 0.0,
+                                  .YX = C * S * (XX - YY), .YY = S * S * XX + C * C * YY, .YZ = 0.0,
+                                  .ZX = 0.0, .ZY = 0.0, .ZZ = 1.0E4},
+            .HardBodyRadius = Radius};
+    }
+
+    // A day of screening, of a range of miss distances, covariance shapes and orientations
+    std::vector<TwoBody::Conjunction> MakeConjunctions(size_t Count)
+    {
+        std::vector<TwoBody::Conjunction> Events{};
+        Events.reserve(Count);
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            const double Fraction = static_cast<double>(Index) / static_cast<double>(Count);
+            Events.push_back(MakeConjunction(50.0 + 2000.0 * Fraction, 100.0 + 900.0 * Fraction, 20.0 + 80.0 * Fraction, 7.0 * Fraction, 5.0 + 15.0 * Fraction));
+        }
+
+        return Events;
+    }
+}
+
+// Conjunctions per second evaluated by each method, in batches
+BENCH(TwoBody, CollisionProbability)
+{
+    const std::vector<TwoBody::Conjunction> Events = MakeConjunctions(EVENTS);
+    std::vector<double> Probabilities(EVENTS);
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        for (const auto& [Name, Method] : {std::pair{"Foster", TwoBody::CollisionMethod::FOSTER}, std::pair{"Chan", TwoBody::CollisionMethod::CHAN},
+                                           std::pair{"Alfano maximum", TwoBody::CollisionMethod::ALFANO_MAXIMUM}})
+        {
+            State.Measure((Name + Suffix).c_str(), EVENTS, [&]()
+            {
+                TwoBody::CollisionProbability(*Pool, Events, Method, Probabilities);
+                Bench::DoNotOptimise(Probabilities);
+            });
+        }
+
+        State.Measure(("Monte Carlo, 4M samples" + Suffix).c_str(), 1, [&]()
+        {
+            Bench::DoNotOptimise(TwoBody::MonteCarloProbability(*Pool, Events[0], SAMPLES, 1));
+        });
+    }
+}
+
+// Error of the Chan series against Foster, and of Foster against Monte Carlo in standard errors,
+// by miss distance, aspect ratio and hard body radius in units of the major standard deviation
+BENCH(TwoBody, CollisionProbabilityAccuracy)
+{
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Pool((Threads > 1) ? Threads - 1 : 1);
+
+    for (const double Miss : {0.0, 1.0, 3.0})
+    {
+        for (const double Aspect : {1.0, 4.0, 20.0})
+        {
+            for (const double Radius : {0.01, 0.1, 0.5})
+            {
+                const TwoBody::Conjunction Event = MakeConjunction(100.0 * Miss, 100.0, 100.0 / Aspect, 0.3, 100.0 * Radius);
+                const TwoBody::EncounterPlane Plane = TwoBody::ProjectEncounter(Event);
+                const double Foster = TwoBody::FosterProbability(Plane);
+                const TwoBody::MonteCarloCollision Sampled = TwoBody::MonteCarloProbability(Pool, Event, SAMPLES, 2);
+
+                char Label[96];
+                std::snprintf(Label, sizeof(Label), "Miss %.0f sigma, aspect %.0f, radius %.2f sigma", Miss, Aspect, Radius);
+                State.Report((std::string(Label) + ", Foster").c_str(), Foster, "");
+                State.Report((std::string(Label) + ", Chan error").c_str(), Abs(TwoBody::ChanProbability(Plane) - Foster) / Foster, "");
+                State.Report((std::string(Label) + ", Monte Carlo error").c_str(),
+                    (Sampled.StandardError > 0.0) ? Abs(Sampled.Probability - Foster) / Sampled.StandardError : 0.0, "sigma");
+            }
+        }
+    }
+}
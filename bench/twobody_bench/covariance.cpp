@@ -0,0 +1,71 @@
+#include "twobody/covariance.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double STEP = 600.0;
+    constexpr size_t COUNT = 10000;
+
+    // Catalog of low Earth orbits with correlated uncertainty
+    void Populate(TwoBody::CovarianceBatch& Catalog)
+    {
+        const double Sigma[6] = {100.0, 50.0, 30.0, 0.1, 0.05, 0.02};
+        TwoBody::StateCovariance Covariance{};
+
+        for (size_t Row = 0; Row < 6; Row++)
+        {
+            for (size_t Col = 0; Col < 6; Col++)
+            {
+                Covariance(Row, Col) = ((Row == Col) ? 1.0 : 0.3) * Sigma[Row] * Sigma[Col];
+            }
+        }
+
+        Catalog.Reserve(COUNT);
+
+        for (size_t Index = 0; Index < COUNT; Index++)
+        {
+            const double Angle = 0.001 * static_cast<double>(Index);
+            const double Radius = 6.9E6 + 100.0 * static_cast<double>(Index);
+            const double Speed = 1.01 * Sqrt(MU / Radius);
+
+            Catalog.Add(TwoBody::MakeStateVector(
+                Vector3({Radius * Cos(Angle), Radius * Sin(Angle), 0.0}),
+                Vector3({-Speed * Sin(Angle) * 0.8, Speed * Cos(Angle) * 0.8, Speed * 0.6})), Covariance);
+        }
+    }
+}
+
+// Covariances per second of linear and unscented propagation, serially and by the pool
+BENCH(TwoBody, Covariance)
+{
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        TwoBody::CovarianceBatch Linear(MU);
+        TwoBody::CovarianceBatch Unscented(MU);
+        Populate(Linear);
+        Populate(Unscented);
+
+        State.Measure(("Linear" + Suffix).c_str(), COUNT, [&]()
+        {
+            Linear.PropagateLinear(*Pool, STEP);
+            Bench::DoNotOptimise(Linear);
+        });
+
+        State.Measure(("Unscented" + Suffix).c_str(), COUNT, [&]()
+        {
+            Unscented.PropagateUnscented(*Pool, STEP);
+            Bench::DoNotOptimise(Unscented);
+        });
+    }
+}
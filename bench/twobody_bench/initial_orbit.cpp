@@ -0,0 +1,131 @@
+#include "twobody/initial_orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double EARTH_RADIUS = 6.378137E6;
+    constexpr double EARTH_RATE = 7.2921159E-5;
+    constexpr size_t COUNT = 10000;
+
+    // One in every few candidates mixes observations of different objects
+    constexpr size_t MISMATCH_INTERVAL = 4;
+
+    const Vector3 POSITION = Vector3({6.9E6, 1.0E5, -2.0E5});
+    const Vector3 VELOCITY = Vector3({-100.0, 5800.0, 4800.0});
+
+    Vector3 Truth(double Time)
+    {
+        return TwoBody::PropagateUniversal(POSITION, VELOCITY, MU, Time).Pos;
+    }
+
+    // Candidate position triplets, closely and widely spaced in turn
+    std::vector<TwoBody::PositionTriplet> MakePositions()
+    {
+        std::vector<TwoBody::PositionTriplet> Triplets(COUNT);
+
+        for (size_t Index = 0; Index < COUNT; Index++)
+        {
+            const double Start = static_cast<double>(Index);
+            const double Spacing = (Index % 2 == 0) ? 20.0 : 400.0;
+            TwoBody::PositionTriplet& Triplet = Triplets[Index];
+
+            Triplet.Times = {Start, Start + Spacing, Start + 2.0 * Spacing};
+            Triplet.Positions = {Truth(Triplet.Times[0]), Truth(Triplet.Times[1]), Truth(Triplet.Times[2])};
+
+            if (Index % MISMATCH_INTERVAL == 0)
+            {
+                Triplet.Positions[0] = Triplet.Positions[0] + Vector3({0.0, 0.0, 3.0E5});
+            }
+        }
+
+        return Triplets;
+    }
+
+    // Candidate angles triplets from a site near the ground track at the middle time
+    std::vector<TwoBody::AnglesTriplet> MakeAngles()
+    {
+        std::vector<TwoBody::AnglesTriplet> Triplets(COUNT);
+
+        for (size_t Index = 0; Index < COUNT; Index++)
+        {
+            const double Start = static_cast<double>(Index % 1000);
+            TwoBody::AnglesTriplet& Triplet = Triplets[Index];
+            Triplet.Times = {Start, Start + 60.0, Start + 120.0};
+
+            const Vector3 Site = (Truth(Triplet.Times[1]) + Vector3({3.0E5, -4.0E5, 2.0E5})).Unit() * EARTH_RADIUS;
+
+            for (size_t Obs = 0; Obs < 3; Obs++)
+            {
+                const Quaternion Rotation = Quaternion::FromVectorAngle(Vector3::UNIT_Z(), EARTH_RATE * (Triplet.Times[Obs] - Triplet.Times[1]));
+                Triplet.Sites[Obs] = Rotation.RotateInv(Site);
+                Triplet.Directions[Obs] = (Truth(Triplet.Times[Obs]) - Triplet.Sites[Obs]).Unit();
+            }
+
+            if (Index % MISMATCH_INTERVAL == 0)
+            {
+                Triplet.Directions[0] = (Triplet.Directions[0] + Vector3({0.0, 0.2, 0.1})).Unit();
+            }
+        }
+
+        return Triplets;
+    }
+
+    size_t CountSuccesses(const std::vector<TwoBody::InitialOrbitSolution>& Solutions)
+    {
+        size_t Successes = 0;
+
+        for (const TwoBody::InitialOrbitSolution& Solution : Solutions)
+        {
+            Successes += (Solution.Status == TwoBody::InitialOrbitStatus::SUCCESS) ? size_t(1) : size_t(0);
+        }
+
+        return Successes;
+    }
+}
+
+// Candidate triplets per second of each initial orbit determination method, serially and by the pool
+BENCH(TwoBody, InitialOrbit)
+{
+    const std::vector<TwoBody::PositionTriplet> Positions = MakePositions();
+    const std::vector<TwoBody::AnglesTriplet> Angles = MakeAngles();
+    std::vector<TwoBody::InitialOrbitSolution> Solutions(COUNT);
+
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        for (const auto& [Name, Method] : {std::pair{"Gibbs", TwoBody::PositionMethod::GIBBS},
+                                           std::pair{"Herrick-Gibbs", TwoBody::PositionMethod::HERRICK_GIBBS},
+                                           std::pair{"Automatic", TwoBody::PositionMethod::AUTOMATIC}})
+        {
+            State.Measure((std::string(Name) + Suffix).c_str(), COUNT, [&]()
+            {
+                TwoBody::SolveBatch(*Pool, std::span<const TwoBody::PositionTriplet>(Positions), Method, MU, {}, Solutions);
+                Bench::DoNotOptimise(Solutions);
+            });
+        }
+
+        for (const auto& [Name, Method] : {std::pair{"Gauss", TwoBody::AnglesMethod::GAUSS},
+                                           std::pair{"Gooding", TwoBody::AnglesMethod::GOODING}})
+        {
+            State.Measure((std::string(Name) + Suffix).c_str(), COUNT, [&]()
+            {
+                TwoBody::SolveBatch(*Pool, std::span<const TwoBody::AnglesTriplet>(Angles), Method, MU, {}, Solutions);
+                Bench::DoNotOptimise(Solutions);
+            });
+
+            State.Report((std::string(Name) + " solved" + Suffix).c_str(), static_cast<double>(CountSuccesses(Solutions)), "");
+        }
+    }
+}
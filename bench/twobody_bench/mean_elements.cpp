@@ -0,0 +1,128 @@
+#include "twobody/mean_elements.hpp"
+#include "twobody/covariance.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/ode.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double DAY = 86400.0;
+    constexpr double YEAR = 365.25 * DAY;
+    constexpr size_t ORBITS = 100000;
+
+    // Orbits integrated numerically, far fewer as each takes thousands of evaluations per day
+    constexpr size_t INTEGRATED = 64;
+
+    // Low Earth orbits of a range of altitudes, eccentricities, inclinations below the critical
+    // inclination, and phases
+    std::vector<TwoBody::KeplerianElements> MakeOrbits(size_t Count)
+    {
+        std::vector<TwoBody::KeplerianElements> Orbits(Count);
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            const double Fraction = static_cast<double>(Index) / static_cast<double>(Count);
+            const double SemiMajorAxis = 6.8E6 + 1.0E6 * Fraction;
+            const double Eccentricity = 0.001 + 0.02 * Fraction;
+            const double Perigee = 13.0 * Fraction;
+            const double Anomoly = 29.0 * Fraction;
+
+            Orbits[Index] = TwoBody::KeplerianElements{
+                .SemiParameter = SemiMajorAxis * (1.0 - Square(Eccentricity)),
+                .SemiMajorAxis = SemiMajorAxis,
+                .Eccentricity = Eccentricity,
+                .Inclination = 0.3 + 0.7 * Fraction,
+                .Node = 17.0 * Fraction,
+                .ArgumentPerigee = Perigee,
+                .TrueAnomoly = Anomoly,
+                .ArgumentLatitude = Perigee + Anomoly,
+                .GravitationalParameter = MU};
+        }
+
+        return Orbits;
+    }
+
+    /**
+     * Osculating state after a time of flight, by numerical integration under J2
+     */
+    ODE::IntegratorResult<6, 1> IntegrateOblate(const TwoBody::KeplerianElements& Osculating, double DeltaTime)
+    {
+        const EphemerisState Initial = TwoBody::Kepler2Newtonian(Osculating);
+
+        return ODE::DormandPrince([](double, const TwoBody::StateVector& State)
+        {
+            const Vector3 Acceleration = TwoBody::OblateAcceleration(Vector3({State[0], State[1], State[2]}), MU);
+            return TwoBody::StateVector{.Data = {State[3], State[4], State[5], Acceleration.X, Acceleration.Y, Acceleration.Z}};
+        }, 0.0, DeltaTime, TwoBody::MakeStateVector(Initial.Pos, Initial.Vel), ODE::IntegratorSettings{.RelativeTolerance = 1.0E-10, .AbsoluteTolerance = 1.0E-6});
+    }
+}
+
+// Orbits per second propagated a year by the secular J2 rates, converted between mean and
+// osculating elements, and integrated numerically a day under J2 for comparison
+BENCH(TwoBody, MeanElements)
+{
+    const std::vector<TwoBody::KeplerianElements> Mean = MakeOrbits(ORBITS);
+    std::vector<TwoBody::KeplerianElements> Result(ORBITS);
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        State.Measure(("Secular, one year" + Suffix).c_str(), ORBITS, [&]()
+        {
+            TwoBody::PropagateMean(*Pool, Mean, YEAR, Result);
+            Bench::DoNotOptimise(Result);
+        });
+
+        State.Measure(("Mean to osculating" + Suffix).c_str(), ORBITS, [&]()
+        {
+            TwoBody::MeanToOsculating(*Pool, Mean, Result);
+            Bench::DoNotOptimise(Result);
+        });
+
+        State.Measure(("Osculating to mean" + Suffix).c_str(), ORBITS, [&]()
+        {
+            TwoBody::OsculatingToMean(*Pool, Mean, Result);
+            Bench::DoNotOptimise(Result);
+        });
+
+        std::vector<ODE::IntegratorResult<6, 1>> Integrated(INTEGRATED);
+
+        const auto Numerical = State.Measure(("Numerical, one day" + Suffix).c_str(), INTEGRATED, [&]()
+        {
+            Pool->ParallelFor(INTEGRATED, 1, [&](size_t Index)
+            {
+                Integrated[Index] = IntegrateOblate(TwoBody::MeanToOsculating(Mean[Index * (ORBITS / INTEGRATED)]), DAY);
+            });
+
+            Bench::DoNotOptimise(Integrated);
+        });
+
+        // Numerical cost grows with the time of flight, the analytic cost does not
+        State.Report(("Numerical, one year" + Suffix).c_str(), Numerical.SecondsPerItem * (YEAR / DAY) * 1.0E3, "ms/orbit");
+
+        uint64_t Steps = 0;
+        double PositionError = 0.0;
+
+        for (size_t Index = 0; Index < INTEGRATED; Index++)
+        {
+            const TwoBody::KeplerianElements& Initial = Mean[Index * (ORBITS / INTEGRATED)];
+            const EphemerisState Analytic = TwoBody::Kepler2Newtonian(TwoBody::MeanToOsculating(TwoBody::PropagateMean(Initial, DAY)));
+            const ODE::IntegratorResult<6, 1>& Final = Integrated[Index];
+
+            Steps += Final.Steps;
+            PositionError = Max(PositionError, (Analytic.Pos - Vector3({Final.State[0], Final.State[1], Final.State[2]})).Norm());
+        }
+
+        State.Report(("Integration steps per day" + Suffix).c_str(), static_cast<double>(Steps) / static_cast<double>(INTEGRATED), "");
+        State.Report(("Analytic position error, one day" + Suffix).c_str(), PositionError, "m");
+    }
+}
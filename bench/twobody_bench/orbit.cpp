@@ -0,0 +1,71 @@
+#include "twobody/orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double STEP = 60.0;
+
+    // Catalog of elliptical orbits of varied size, shape and phase
+    TwoBody::KeplerianElements MakeElements(size_t Index)
+    {
+        const double SemiMajorAxis = 7.0E6 + 10.0 * static_cast<double>(Index);
+        const double Eccentricity = 0.0001 + 0.7 * static_cast<double>(Index % 1000) / 1000.0;
+
+        return TwoBody::KeplerianElements{
+            .SemiParameter = SemiMajorAxis * (1.0 - Eccentricity * Eccentricity),
+            .SemiMajorAxis = SemiMajorAxis,
+            .Eccentricity = Eccentricity,
+            .Inclination = 0.9,
+            .Node = 0.001 * static_cast<double>(Index),
+            .ArgumentPerigee = 1.2,
+            .TrueAnomoly = 0.01 * static_cast<double>(Index % 628),
+            .GravitationalParameter = MU};
+    }
+}
+
+// Orbits per second of a catalog propagated in place, serially and by the pool
+BENCH(TwoBody, BulkUpdate)
+{
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Pool((Threads > 1) ? Threads - 1 : 1);
+
+    for (const size_t Count : {10000u, 50000u})
+    {
+        std::vector<std::unique_ptr<TwoBody::Orbit>> Catalog;
+        std::vector<TwoBody::Orbit*> Orbits;
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            Catalog.emplace_back(new TwoBody::Orbit(TwoBody::Orbit::FromKeplerianElements(MakeElements(Index))));
+            Orbits.push_back(Catalog.back().get());
+        }
+
+        const std::string Suffix = " (" + std::to_string(Count) + " orbits)";
+
+        const Bench::Measurement Serial = State.Measure(("Serial" + Suffix).c_str(), Count, [&]()
+        {
+            for (TwoBody::Orbit* Entry : Orbits)
+            {
+                Entry->Update(STEP);
+            }
+            Bench::DoNotOptimise(Orbits);
+        });
+
+        const Bench::Measurement Parallel = State.Measure(("Pool" + Suffix).c_str(), Count, [&]()
+        {
+            TwoBody::Orbit::Update(Pool, Orbits, STEP);
+            Bench::DoNotOptimise(Orbits);
+        });
+
+        State.Report(("Speed up" + Suffix).c_str(), Serial.Seconds / Parallel.Seconds, "x");
+    }
+
+    State.Report("Threads", static_cast<double>(Pool.Concurrency()), "");
+}
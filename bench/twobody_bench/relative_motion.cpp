@@ -0,0 +1,77 @@
+#include "twobody/relative_motion.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "bench_utils.hpp"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double STEP = 60.0;
+    constexpr size_t DEPUTIES = 100000;
+
+    const EphemerisState CHIEF{.Pos = Vector3({7.0E6, 0.0, 0.0}), .Vel = Vector3({1500.0, 7200.0, 5400.0})};
+
+    // Deputies within a few kilometres of the chief
+    TwoBody::StateVector MakeDeputy(size_t Index)
+    {
+        const double Phase = 0.001 * static_cast<double>(Index);
+        const double Scale = 100.0 + 0.02 * static_cast<double>(Index);
+
+        return TwoBody::StateVector{.Data = {Scale * Cos(Phase), 2.0 * Scale * Sin(Phase), 0.5 * Scale * Cos(3.0 * Phase),
+                                             1.0E-3 * Scale * Sin(Phase), -2.0E-3 * Scale * Cos(Phase), 1.0E-3 * Scale}};
+    }
+}
+
+// Deputies per second propagated relative to the chief, by one transition matrix per step, and
+// inertially for comparison
+BENCH(TwoBody, RelativeMotion)
+{
+    const TwoBody::KeplerianElements Chief = TwoBody::Newtonian2Kepler(CHIEF.Pos, CHIEF.Vel, MU);
+    const size_t Threads = std::thread::hardware_concurrency();
+    ThreadPool Serial(0);
+    ThreadPool Parallel((Threads > 1) ? Threads - 1 : 1);
+
+    for (ThreadPool* Pool : {&Serial, &Parallel})
+    {
+        const std::string Suffix = " (" + std::to_string(Pool->Concurrency()) + " threads)";
+
+        for (const auto& [Name, Model] : {std::pair{"Clohessy-Wiltshire", TwoBody::RelativeModel::CLOHESSY_WILTSHIRE},
+                                          std::pair{"Yamanaka-Ankersen", TwoBody::RelativeModel::YAMANAKA_ANKERSEN}})
+        {
+            TwoBody::Formation Deputies(Chief, Model);
+            Deputies.Reserve(DEPUTIES);
+
+            for (size_t Index = 0; Index < DEPUTIES; Index++)
+            {
+                Deputies.Add(MakeDeputy(Index));
+            }
+
+            State.Measure((std::string(Name) + Suffix).c_str(), DEPUTIES, [&]()
+            {
+                Deputies.Propagate(*Pool, STEP);
+                Bench::DoNotOptimise(Deputies);
+            });
+        }
+
+        std::vector<EphemerisState> Inertial(DEPUTIES);
+
+        for (size_t Index = 0; Index < DEPUTIES; Index++)
+        {
+            Inertial[Index] = TwoBody::LVLHToInertial(CHIEF, MakeDeputy(Index));
+        }
+
+        State.Measure(("Inertial" + Suffix).c_str(), DEPUTIES, [&]()
+        {
+            Pool->ParallelFor(DEPUTIES, 256, [&](size_t Index)
+            {
+                Inertial[Index] = TwoBody::PropagateUniversal(Inertial[Index].Pos, Inertial[Index].Vel, MU, STEP);
+            });
+
+            Bench::DoNotOptimise(Inertial);
+        });
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+
+/**
+ * Restricts the calling thread to a single logical CPU
+ * @param Cpu Zero based index of the logical CPU
+ * @return True if the affinity was applied, false if unsupported or not permitted
+ */
+bool PinCurrentThread(size_t Cpu) noexcept;
+
+/**
+ * Restricts a thread to a single logical CPU
+ * @param Thread Thread to restrict
+ * @param Cpu Zero based index of the logical CPU
+ * @return True if the affinity was applied, false if unsupported or not permitted
+ */
+bool PinThread(std::thread& Thread, size_t Cpu) noexcept;
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * Lock free single producer, single consumer ring of fixed width records. Records are
+ * written and read in place, so neither side copies or allocates:
+ *
+ *  std::span<double> Slot = Ring.BeginPush();      // Producer thread
+ *  if (Slot.empty() == false) {Fill(Slot); Ring.EndPush();}
+ *
+ *  std::span<const double> Record = Ring.Front();  // Consumer thread
+ *  if (Record.empty() == false) {Use(Record); Ring.Pop();}
+ */
+template <typename T>
+class SpscRing
+{
+public:
+
+    /**
+     * @param Records Number of records held, rounded up to a power of two
+     * @param Width Elements of each record
+     */
+    SpscRing(size_t Records, size_t Width) : mWidth{Width}
+    {
+        size_t Capacity = 1;
+
+        while (Capacity < Records)
+        {
+            Capacity *= 2;
+        }
+
+        mMask = Capacity - 1;
+        mData.resize(Capacity * Width);
+    }
+
+    /** @return Number of records held when full */
+    size_t Capacity(void) const noexcept {return mMask + 1;}
+
+    /** @return Elements of each record */
+    size_t Width(void) const noexcept {return mWidth;}
+
+    /**
+     * Producer only
+     * @return Slot of the next record, empty if the ring is full
+     */
+    std::span<T> BeginPush(void) noexcept
+    {
+        const uint64_t Head = mHead.load(std::memory_order_relaxed);
+
+        if (Head - mCachedTail > mMask)
+        {
+            mCachedTail = mTail.load(std::memory_order_acquire);
+
+            if (Head - mCachedTail > mMask)
+            {
+                return {};
+            }
+        }
+
+        return {mData.data() + (Head & mMask) * mWidth, mWidth};
+    }
+
+    /**
+     * Producer only, publishes the slot of BeginPush to the consumer
+     */
+    void EndPush(void) noexcept
+    {
+        mHead.store(mHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * Consumer only
+     * @return Oldest record, empty if the ring is empty
+     */
+    std::span<const T> Front(void) noexcept
+    {
+        const uint64_t Tail = mTail.load(std::memory_order_relaxed);
+
+        if (Tail == mCachedHead)
+        {
+            mCachedHead = mHead.load(std::memory_order_acquire);
+
+            if (Tail == mCachedHead)
+            {
+                return {};
+            }
+        }
+
+        return {mData.data() + (Tail & mMask) * mWidth, mWidth};
+    }
+
+    /**
+     * Consumer only, releases the record of Front to the producer
+     */
+    void Pop(void) noexcept
+    {
+        mTail.store(mTail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    size_t mWidth = 0;
+    uint64_t mMask = 0;
+    std::vector<T> mData{};
+
+    // Records pushed, and the producer's last observation of the consumer
+    alignas(64) std::atomic<uint64_t> mHead{0};
+    uint64_t mCachedTail = 0;
+
+    // Records popped, and the consumer's last observation of the producer
+    alignas(64) std::atomic<uint64_t> mTail{0};
+    uint64_t mCachedHead = 0;
+};
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Placement of the worker threads of a pool over the logical CPUs. Hints are applied on a
+ * best effort basis, and ignored where affinity is unsupported or not permitted
+ */
+enum class AffinityHint
+{
+    NONE,       // Threads are placed by the operating system
+    COMPACT,    // Workers occupy consecutive CPUs, sharing caches (and NUMA nodes) where possible
+    SCATTER     // Workers are spread evenly over every CPU, maximising memory bandwidth
+};
+
+/**
+ * Fixed set of persistent worker threads executing data parallel loops and tasks. The
+ * calling thread participates in each loop, so a pool of N workers provides N + 1 way
+ * parallelism. Dispatch of a loop does not allocate.
+ *
+ * Iterations are divided evenly between the threads up front. Each thread executes its
+ * own iterations in order, and once exhausted steals the upper half of the remaining
+ * iterations of another thread, balancing iterations of uneven cost without contending
+ * on a shared counter.
+ *
+ * Tasks (see `TaskGroup`) are pushed to the queue of the spawning thread, which executes
+ * its most recent tasks first while idle threads steal the oldest.
+ *
+ * A loop started from within a loop body or task of the same pool executes serially on
+ * the calling thread. Loop bodies and tasks must not throw
+ */
+class ThreadPool
+{
+public:
+
+    /**
+     * @param Workers Number of worker threads in addition to the calling thread
+     * @param Hint Placement of the workers
+     */
+    explicit ThreadPool(size_t Workers, AffinityHint Hint = AffinityHint::NONE);
+
+    ~ThreadPool();
+
+    // Workers refer back to the pool
+    ThreadPool(const ThreadPool& Pool) = delete;
+
+    /**
+     * @return Number of threads executing each loop, including the calling thread
+     */
+    size_t Concurrency(void) const noexcept {return mWorkers.size() + 1;}
+
+    /**
+     * Restricts a worker thread to a single logical CPU
+     * @param Worker Index of the worker, less than Concurrency() - 1
+     * @param Cpu Zero based index of the logical CPU
+     * @return True if the affinity was applied, false if unsupported or not permitted
+     */
+    bool PinWorker(size_t Worker, size_t Cpu) noexcept;
+
+    /**
+     * Invokes `Body(Index)` for each index in [0, Count), blocking until all have completed
+     * @param Count Number of iterations
+     * @param Body Callable taking a size_t index
+     */
+    template <typename Func>
+    void ParallelFor(size_t Count, Func&& Body)
+    {
+        using FuncType = std::remove_reference_t<Func>;
+
+        if ((mWorkers.empty() == true) || (Count < 2) || (IsActive() == true))
+        {
+            for (size_t Index = 0; Index < Count; Index++)
+            {
+                Body(Index);
+            }
+            return;
+        }
+
+        Dispatch(Job{
+            .Context = const_cast<void*>(static_cast<const void*>(std::addressof(Body))),
+            .Invoke = [](void* Context, size_t Index) {(*static_cast<FuncType*>(Context))(Index);},
+            .Count = Count
+        });
+    }
+
+    /**
+     * Invokes `Body(Index)` for each index in [0, Count), in chunks of consecutive indices
+     * executed by a single thread, blocking until all have completed. A larger grain
+     * reduces the scheduling overhead of inexpensive iterations
+     * @param Count Number of iterations
+     * @param Grain Iterations of each chunk, at least one
+     * @param Body Callable taking a size_t index
+     */
+    template <typename Func>
+    void ParallelFor(size_t Count, size_t Grain, Func&& Body)
+    {
+        Grain = (Grain > 0) ? Grain : 1;
+
+        ParallelFor((Count + Grain - 1) / Grain, [&](size_t Chunk)
+        {
+            const size_t End = (Count - Chunk * Grain < Grain) ? Count : (Chunk + 1) * Grain;
+
+            for (size_t Index = Chunk * Grain; Index < End; Index++)
+            {
+                Body(Index);
+            }
+        });
+    }
+
+    /**
+     * Reduces [0, Count) in chunks of `Grain` consecutive indices in parallel, then combines
+     * the result of each chunk in order. Chunks depend only upon the grain, so the result is
+     * identical for any number of threads, even for operations which do not associate
+     * exactly such as floating point addition
+     * @param Count Number of iterations
+     * @param Grain Iterations of each chunk, at least one
+     * @param Identity Result of an empty range, and initial value of the combination
+     * @param Map Callable taking the begin and end of a chunk, returning its result
+     * @param Combine Callable taking two results, returning their combination
+     * @return Combination of the result of every chunk
+     */
+    template <typename T, typename MapFunc, typename CombineFunc>
+    T ParallelReduce(size_t Count, size_t Grain, const T& Identity, MapFunc&& Map, CombineFunc&& Combine)
+    {
+        Grain = (Grain > 0) ? Grain : 1;
+        std::vector<T> Partial((Count + Grain - 1) / Grain, Identity);
+
+        ParallelFor(Partial.size(), [&](size_t Chunk)
+        {
+            const size_t End = (Count - Chunk * Grain < Grain) ? Count : (Chunk + 1) * Grain;
+            Partial[Chunk] = Map(Chunk * Grain, End);
+        });
+
+        T Result = Identity;
+
+        for (const T& Value : Partial)
+        {
+            Result = Combine(Result, Value);
+        }
+
+        return Result;
+    }
+
+private:
+
+    friend class TaskGroup;
+
+    /**
+     * Type erased task, owning its closure
+     */
+    struct QueuedTask
+    {
+        // Invokes then destroys the closure
+        void (*Invoke)(void*) = nullptr;
+        void* Context = nullptr;
+
+        // Unfinished tasks of the group
+        std::atomic<size_t>* Pending = nullptr;
+    };
+
+    /**
+     * Tasks spawned by a thread
+     */
+    struct alignas(64) Queue
+    {
+        std::mutex Mutex{};
+        std::deque<QueuedTask> Tasks{};
+    };
+
+    /**
+     * Type erased loop body
+     */
+    struct Job
+    {
+        void* Context = nullptr;
+        void (*Invoke)(void*, size_t) = nullptr;
+        size_t Count = 0;
+
+        // First iteration of the current batch
+        size_t Offset = 0;
+    };
+
+    /**
+     * Unclaimed iterations of a thread, relative to the start of the current batch, packed
+     * as (Begin << 32 | End) such that the owner and thieves claim with a single exchange
+     */
+    struct alignas(64) Range
+    {
+        std::atomic<uint64_t> Bounds{0};
+    };
+
+    /**
+     * Publishes a job to the workers in batches of at most MAX_BATCH iterations,
+     * participates, then waits for completion of each
+     */
+    void Dispatch(const Job& Task);
+
+    /**
+     * Claims and executes iterations of a batch until none remain
+     * @param Task Batch of the job
+     * @param Slot Range of the executing thread, zero for the calling thread
+     */
+    void Execute(const Job& Task, size_t Slot) noexcept;
+
+    /**
+     * @return Iteration claimed from the front of the range of `Slot`, or NONE if empty
+     */
+    uint64_t Pop(size_t Slot) noexcept;
+
+    /**
+     * Moves the upper half of the iterations of another thread into the range of `Slot`
+     * @return Iteration claimed from the stolen iterations, or NONE if every range is empty
+     */
+    uint64_t Steal(size_t Slot) noexcept;
+
+    // Largest batch representable by a packed range
+    static constexpr size_t MAX_BATCH = 0xFFFFFFFF;
+    static constexpr uint64_t NONE = ~uint64_t(0);
+
+    /**
+     * @return `true` if the calling thread is executing a loop or task of this pool
+     */
+    bool IsActive(void) const noexcept;
+
+    /**
+     * Queues a task on the queue of the calling thread, waking a worker if any sleep
+     * @throws std::bad_alloc if the task could not be queued, in which case it is not queued
+     */
+    void Submit(const QueuedTask& Item);
+
+    /**
+     * Executes a task from the queue of the calling thread, or stolen from another
+     * @return `false` if every queue is empty
+     */
+    bool RunTask(void) noexcept;
+
+    /**
+     * Executes a task from the queue of `Slot`, or stolen from another
+     * @return `false` if every queue is empty
+     */
+    bool RunTask(size_t Slot) noexcept;
+
+    /**
+     * Worker thread entry point
+     * @param Slot Range and queue of the worker
+     */
+    void WorkerLoop(size_t Slot);
+
+    std::vector<std::thread> mWorkers{};
+
+    // Serialises loops started by different threads
+    std::mutex mDispatchMutex{};
+
+    // Guards the job and generation, signalled on each dispatch or task while workers sleep
+    std::mutex mMutex{};
+    std::condition_variable mWake{};
+    Job mJob{};
+    std::atomic<uint64_t> mGeneration{0};
+    bool mStop = false;
+
+    // Tasks of each thread, the first shared by every thread outside the pool
+    std::unique_ptr<Queue[]> mQueues{};
+    std::atomic<size_t> mQueued{0};
+    std::atomic<size_t> mSleepers{0};
+
+    // Unclaimed iterations of each thread
+    std::unique_ptr<Range[]> mRanges{};
+
+    // Workers yet to finish the current batch
+    std::atomic<size_t> mBusy{0};
+};
+
+/**
+ * Set of tasks executed by the threads of a pool, which may be waited upon together.
+ * Tasks may spawn further tasks into the same or another group:
+ *
+ *  TaskGroup Group(Pool);
+ *  Group.Run([&]() {Left = Solve(A);});
+ *  Group.Run([&]() {Right = Solve(B);});
+ *  Group.Wait();
+ *
+ * The waiting thread executes queued tasks until the group completes. Each task allocates
+ * its closure, so tasks suit coarse or irregular work, with `ParallelFor` preferred for
+ * loops
+ */
+class TaskGroup
+{
+public:
+
+    /**
+     * @param Pool Pool executing the tasks, outliving the group
+     */
+    explicit TaskGroup(ThreadPool& Pool) noexcept : mPool{Pool} { }
+
+    /**
+     * Waits for every task of the group
+     */
+    ~TaskGroup() {Wait();}
+
+    // Queued tasks refer to the group
+    TaskGroup(const TaskGroup& Group) = delete;
+
+    /**
+     * Queues a task
+     * @param Body Callable taking no arguments, copied or moved into the task. Must not throw
+     * @throws If the closure cannot be allocated or copied, or the task queued, in which case
+     * the group is unchanged
+     */
+    template <typename Func>
+    void Run(Func&& Body)
+    {
+        using FuncType = std::decay_t<Func>;
+
+        // The closure is owned here until the queue takes it, and the task counted before it
+        // can run
+        auto Closure = std::make_unique<FuncType>(std::forward<Func>(Body));
+        mPending.fetch_add(1, std::memory_order_relaxed);
+
+        try
+        {
+            mPool.Submit(ThreadPool::QueuedTask{
+                .Invoke = [](void* Context)
+                {
+                    const std::unique_ptr<FuncType> Owned(static_cast<FuncType*>(Context));
+                    (*Owned)();
+                },
+                .Context = Closure.get(),
+                .Pending = &mPending
+            });
+        }
+        catch (...)
+        {
+            mPending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+
+        Closure.release();
+    }
+
+    /**
+     * Executes queued tasks until every task of the group has completed
+     */
+    void Wait(void) noexcept;
+
+private:
+    ThreadPool& mPool;
+    std::atomic<size_t> mPending{0};
+};
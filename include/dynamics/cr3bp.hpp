@@ -0,0 +1,294 @@
+#pragma once
+
+#include "math/constants.hpp"
+#include "math/matrixn.hpp"
+#include "math/vector3.hpp"
+#include "numerics/ode.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * Circular restricted three body problem, the motion of a massless body under two primaries
+ * in circular orbits about their barycentre. States are nondimensional, in the frame rotating
+ * with the primaries: the origin at the barycentre, X from the larger primary towards the
+ * smaller, Z along the angular momentum. Lengths are in units of the separation of the
+ * primaries, and times in units of the inverse of their mean motion, such that a period of
+ * the primaries is 2 PI
+ */
+namespace CR3BP
+{
+    /// Position and velocity [x, y, z, vx, vy, vz] in the rotating frame
+    using State = VectorN<6>;
+
+    /// State transition matrix, partial derivatives of a final state with respect to the initial state
+    using Transition = MatrixN<6, 6>;
+
+    /**
+     * Pair of primaries and the scales of the nondimensional units
+     */
+    struct System
+    {
+        /// Mass of the smaller primary as a fraction of the total, mu
+        double MassRatio = 0.0;
+
+        /// Unit length, the separation of the primaries (m)
+        double Length = 1.0;
+
+        /// Unit time, the inverse of the mean motion of the primaries (s)
+        double Time = 1.0;
+
+        /**
+         * @param LargerParameter Gravitational parameter of the larger primary (m3/s2)
+         * @param SmallerParameter Gravitational parameter of the smaller primary (m3/s2)
+         * @param Distance Separation of the primaries (m)
+         * @return System of the primaries
+         */
+        static constexpr System FromBodies(double LargerParameter, double SmallerParameter, double Distance) noexcept
+        {
+            return System{
+                .MassRatio = SmallerParameter / (LargerParameter + SmallerParameter),
+                .Length = Distance,
+                .Time = Sqrt(Cube(Distance) / (LargerParameter + SmallerParameter))};
+        }
+
+        /** @return Position in the rotating frame (m) */
+        Vector3 Position(const State& X) const noexcept {return Vector3({X[0], X[1], X[2]}) * Length;}
+
+        /** @return Velocity in the rotating frame (m/s) */
+        Vector3 Velocity(const State& X) const noexcept {return Vector3({X[3], X[4], X[5]}) * (Length / Time);}
+    };
+
+    /// Earth and Moon, of the lunar mass ratio 1 / 81.30056 and mean separation 384400 km
+    constexpr System EARTH_MOON = System::FromBodies(Earth::GRAVITATIONAL_CONSTANT, Earth::GRAVITATIONAL_CONSTANT / 81.30056, 3.844E8);
+
+    /**
+     * Equilibrium points of the rotating frame
+     */
+    enum class LibrationPoint
+    {
+        L1,     // Collinear, between the primaries
+        L2,     // Collinear, beyond the smaller primary
+        L3,     // Collinear, beyond the larger primary
+        L4,     // Equilateral, leading the smaller primary
+        L5      // Equilateral, trailing the smaller primary
+    };
+
+    /**
+     * @param MassRatio Mass ratio of the system
+     * @param Point Libration point
+     * @return Position of the libration point
+     */
+    Vector3 LibrationPosition(double MassRatio, LibrationPoint Point) noexcept;
+
+    /**
+     * @param X State
+     * @param MassRatio Mass ratio of the system
+     * @return Derivative of the state
+     */
+    State Derivative(const State& X, double MassRatio) noexcept;
+
+    /**
+     * @param X State
+     * @param MassRatio Mass ratio of the system
+     * @return Partial derivatives of the derivative of the state with respect to the state
+     */
+    MatrixN<6, 6> Jacobian(const State& X, double MassRatio) noexcept;
+
+    /**
+     * Derivative of the state and its state transition matrix, integrated together as the
+     * variational equations dPhi/dt = A Phi
+     * @param X State in the first column, and the state transition matrix in the remaining columns
+     * @param MassRatio Mass ratio of the system
+     * @return Derivative of `X`
+     */
+    MatrixN<6, 7> VariationalDerivative(const MatrixN<6, 7>& X, double MassRatio) noexcept;
+
+    /**
+     * Jacobi constant, the integral of motion 2 U - v^2 of the pseudo potential U
+     * @param X State
+     * @param MassRatio Mass ratio of the system
+     * @return Jacobi constant
+     */
+    double JacobiConstant(const State& X, double MassRatio) noexcept;
+
+    /// Tolerances of the integration of trajectories and their variational equations
+    constexpr ODE::IntegratorSettings INTEGRATOR_SETTINGS{.RelativeTolerance = 1.0E-12, .AbsoluteTolerance = 1.0E-12, .MinStep = 1.0E-12};
+
+    /**
+     * @param X Initial state
+     * @param MassRatio Mass ratio of the system
+     * @param Time Time of flight, which may be negative
+     * @param Settings Tolerances of the integration
+     * @return State after `Time` and exit status
+     */
+    ODE::IntegratorResult<6, 1> Propagate(const State& X, double MassRatio, double Time, const ODE::IntegratorSettings& Settings = INTEGRATOR_SETTINGS) noexcept;
+
+    /**
+     * Propagates a state together with its state transition matrix
+     * @param X Initial state
+     * @param MassRatio Mass ratio of the system
+     * @param Time Time of flight, which may be negative
+     * @param Settings Tolerances of the integration
+     * @return State after `Time` in the first column, its state transition matrix in the
+     * remaining columns, and exit status
+     */
+    ODE::IntegratorResult<6, 7> PropagateTransition(const State& X, double MassRatio, double Time,
+        const ODE::IntegratorSettings& Settings = INTEGRATOR_SETTINGS) noexcept;
+
+    /**
+     * Periodic orbit of the rotating frame
+     */
+    struct PeriodicOrbit
+    {
+        /// State at the start of the period. For an orbit symmetric about the XZ plane, the
+        /// crossing of the plane with y = vx = vz = 0
+        State InitialState{};
+
+        /// Period
+        double Period = 0.0;
+
+        /// Jacobi constant
+        double JacobiConstant = 0.0;
+
+        /// State transition matrix over one period
+        Transition Monodromy{};
+
+        /// Newton iterations of the correction
+        size_t Iterations = 0;
+
+        /// `true` if the periodicity constraints were met to the tolerance
+        bool Converged = false;
+    };
+
+    /**
+     * Component of the initial state held fixed by the correction of a symmetric periodic
+     * orbit, parameterising its family
+     */
+    enum class FamilyParameter
+    {
+        X,      // Crossing of the X axis
+        Z,      // Out of plane amplitude at the crossing, not applicable to planar orbits
+        VY      // Velocity at the crossing
+    };
+
+    /**
+     * Newton correction input parameters
+     */
+    struct CorrectorSettings
+    {
+        /// Procedure will exit successfully once the norm of the constraints falls below this
+        double Tolerance = 1.0E-10;
+
+        /// Procedure will exit with error if this many iterations are exceeded
+        size_t MaxIterations = 25;
+
+        /// Tolerances of the integration of each trajectory
+        ODE::IntegratorSettings Integration = INTEGRATOR_SETTINGS;
+    };
+
+    /**
+     * Linear approximation of a planar Lyapunov orbit about a collinear libration point, a
+     * guess for the correction of small orbits
+     * @param MassRatio Mass ratio of the system
+     * @param Point Collinear libration point
+     * @param Amplitude Displacement along X of the first crossing of the X axis from the
+     * libration point
+     * @return Approximate orbit from the crossing, with its period
+     */
+    PeriodicOrbit LyapunovGuess(double MassRatio, LibrationPoint Point, double Amplitude) noexcept;
+
+    /**
+     * Corrects a periodic orbit symmetric about the XZ plane, such as a Lyapunov, halo or
+     * vertical orbit, by single shooting over a half period from a perpendicular crossing of
+     * the plane to the next, which must then also be perpendicular. Orbits with z = vz = 0
+     * are treated as planar
+     * Ref: Howell, Three-Dimensional, Periodic, 'Halo' Orbits, 1984
+     * @param Guess State at the crossing, of which x, z and vy are used
+     * @param HalfPeriod Guess of the time to the next crossing
+     * @param MassRatio Mass ratio of the system
+     * @param Fixed Component of the state held fixed
+     * @param Settings Tolerance and limits of the correction
+     * @return Corrected orbit
+     */
+    PeriodicOrbit CorrectSymmetric(const State& Guess, double HalfPeriod, double MassRatio, FamilyParameter Fixed = FamilyParameter::Z,
+        const CorrectorSettings& Settings = {}) noexcept;
+
+    /**
+     * Corrects a general periodic orbit by multiple shooting, requiring continuity between
+     * consecutive arcs, with the final arc returning to the first state. Every state and
+     * duration is free, and each iteration takes the update of least norm. One component of
+     * the return to the first state is implied by the Jacobi constant, and is omitted. Arcs
+     * are propagated in parallel
+     * Ref: Pavlak, Trajectory Design and Orbit Maintenance Strategies in Multi-Body Dynamical
+     * Regimes, 2013, Chapter 3
+     * @param Pool Threads propagating the arcs
+     * @param Patches State at the start of each arc, corrected in place
+     * @param Durations Time of flight of each arc, corrected in place, the size of `Patches`
+     * @param MassRatio Mass ratio of the system
+     * @param Settings Tolerance and limits of the correction
+     * @return Corrected orbit, starting from the first state
+     */
+    PeriodicOrbit CorrectMultipleShooting(ThreadPool& Pool, std::span<State> Patches, std::span<double> Durations, double MassRatio,
+        const CorrectorSettings& Settings = {}) noexcept;
+
+    /**
+     * Method of stepping along a family of symmetric periodic orbits
+     */
+    enum class ContinuationMethod
+    {
+        NATURAL_PARAMETER,  // Steps in the family parameter, failing at folds of the parameter
+        PSEUDO_ARCLENGTH    // Steps along the tangent to the family, passing folds
+    };
+
+    /**
+     * Continuation input parameters
+     */
+    struct ContinuationSettings
+    {
+        ContinuationMethod Method = ContinuationMethod::PSEUDO_ARCLENGTH;
+
+        /// Component held fixed by each correction of natural parameter continuation, and
+        /// whose increase defines the direction of the first step of either method
+        FamilyParameter Parameter = FamilyParameter::Z;
+
+        /// Initial step in the parameter, or arclength of the free variables, negative to
+        /// decrease the parameter
+        double Step = 1.0E-3;
+
+        /// Bounds on the magnitude of the step, which halves on a failed correction and grows
+        /// by half after a batch without failure
+        double MinStep = 1.0E-6;
+        double MaxStep = 1.0E-2;
+
+        /// Number of members of the family, including the first
+        size_t Members = 50;
+
+        /// Members predicted from each converged member and corrected in parallel
+        size_t Batch = 8;
+
+        CorrectorSettings Corrector{};
+    };
+
+    /**
+     * Continues a family of periodic orbits symmetric about the XZ plane. Each round predicts a
+     * batch of members along the tangent to the family at the last converged member, at
+     * multiples of the step, and corrects the batch in parallel, accepting members up to the
+     * first failure. A correction failing to reduce the constraints each iteration, or moving
+     * further from its prediction than the step, fails, such that the family is not left for
+     * the libration point or a neighbouring family. The batch is fixed by the settings, so the
+     * family is identical for any number of threads
+     * Ref: Allgower and Georg, Introduction to Numerical Continuation Methods, 2003
+     * @param Pool Threads correcting each batch
+     * @param Initial Converged member of the family
+     * @param MassRatio Mass ratio of the system
+     * @param Settings Method and steps of the continuation
+     * @return Members of the family, in order from `Initial`, fewer than requested if the
+     * step fell below its minimum
+     */
+    std::vector<PeriodicOrbit> ContinueFamily(ThreadPool& Pool, const PeriodicOrbit& Initial, double MassRatio,
+        const ContinuationSettings& Settings = {});
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "concurrency/thread_pool.hpp"
+#include "math/vector3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * Evaluation of the mutual gravitation of the bodies of an N-body system
+ */
+enum class NBodyMethod
+{
+    DIRECT,     // Exact sum over every pair, O(N^2)
+    BARNES_HUT, // Octree approximating distant groups by their centre of mass, O(N log N)
+    AUTOMATIC   // Direct for few bodies, Barnes-Hut otherwise
+};
+
+/**
+ * N-body system input parameters
+ */
+struct NBodySettings
+{
+    NBodyMethod Method = NBodyMethod::AUTOMATIC;
+
+    /// Barnes-Hut opening angle, the largest ratio of the size of a cell to its distance from
+    /// a body for which the cell is approximated by its centre of mass. Zero opens every cell
+    double Opening = 0.5;
+
+    /// Plummer softening length (m), bounding the acceleration of close encounters
+    double Softening = 0.0;
+
+    /// Largest number of bodies in a leaf of the octree, summed directly
+    size_t LeafSize = 16;
+};
+
+/**
+ * Point masses under their mutual gravitation and an external field, such as the gravity of
+ * a central body and third bodies, integrated together by a kick-drift-kick leapfrog.
+ *
+ * Mutual gravitation is evaluated in parallel, either by direct summation, in tiles of
+ * bodies which the compiler vectorises and which remain in cache, or by a Barnes-Hut
+ * octree. The octree is rebuilt every step in parallel, the bodies sorted along a Morton
+ * curve and the cells created a level at a time, then walked for each body in parallel.
+ * Each acceleration is summed in a fixed order, so results are identical for any number of
+ * threads.
+ *
+ * The external field is a callable evaluated for every body in parallel:
+ *
+ *  System.Integrate(Pool, Step, [](double Time, const Vector3& Position) {return Gravity(Position);});
+ */
+class NBodySystem
+{
+public:
+
+    /**
+     * @param Settings Method and accuracy of the mutual gravitation
+     */
+    explicit NBodySystem(const NBodySettings& Settings = {}) noexcept : mSettings(Settings) { }
+
+    /**
+     * Adds a body
+     * @param GravitationalParameter Gravitational parameter of the body (m^3/s^2), zero for
+     * a test particle
+     * @param Position Initial position (m)
+     * @param Velocity Initial velocity (m/s)
+     * @return Index of the body
+     * @throws Error::GenericException if the gravitational parameter is negative
+     */
+    size_t Add(double GravitationalParameter, const Vector3& Position, const Vector3& Velocity);
+
+    /**
+     * Reserves storage, such that bodies may be added without reallocation
+     * @param Capacity Number of bodies
+     */
+    void Reserve(size_t Capacity);
+
+    /** @return Number of bodies */
+    size_t Size(void) const noexcept {return mMu.size();}
+
+    /** @return Time since the system was created (s) */
+    double GetTime(void) const noexcept {return mTime;}
+
+    /** @return Position of a body (m) */
+    Vector3 GetPosition(size_t Index) const noexcept {return Vector3({mX[Index], mY[Index], mZ[Index]});}
+
+    /** @return Velocity of a body (m/s) */
+    Vector3 GetVelocity(size_t Index) const noexcept {return Vector3({mVX[Index], mVY[Index], mVZ[Index]});}
+
+    /** @return Gravitational parameter of a body (m^3/s^2) */
+    double GetGravitationalParameter(size_t Index) const noexcept {return mMu[Index];}
+
+    /** @return Method and accuracy of the mutual gravitation */
+    const NBodySettings& GetSettings(void) const noexcept {return mSettings;}
+
+    /**
+     * @param Settings New method and accuracy of the mutual gravitation
+     */
+    void SetSettings(const NBodySettings& Settings) noexcept;
+
+    /**
+     * @return Method evaluating the mutual gravitation for the current number of bodies
+     */
+    NBodyMethod GetActiveMethod(void) const noexcept;
+
+    /**
+     * Evaluates the acceleration of every body due to the others
+     * @param Pool Threads evaluating the accelerations
+     * @param Accelerations Acceleration of each body (m/s^2), the size of the system
+     */
+    void MutualAccelerations(ThreadPool& Pool, std::span<Vector3> Accelerations);
+
+    /**
+     * Advances every body by a kick-drift-kick leapfrog step under the mutual gravitation
+     * only
+     * @param Pool Threads evaluating the accelerations
+     * @param Step Time step (s)
+     */
+    void Integrate(ThreadPool& Pool, double Step)
+    {
+        Integrate(Pool, Step, [](double, const Vector3&) noexcept {return Vector3::ZERO();});
+    }
+
+    /**
+     * Advances every body by a kick-drift-kick leapfrog step under the mutual gravitation and
+     * an external field. The accelerations at the end of the step are retained for the next,
+     * so each step evaluates the field once
+     * @param Pool Threads evaluating the accelerations
+     * @param Step Time step (s)
+     * @param Field Callable taking the time (s) and position (m) of a body, returning its
+     * external acceleration (m/s^2)
+     */
+    template <typename ExternalField>
+    void Integrate(ThreadPool& Pool, double Step, ExternalField&& Field)
+    {
+        const auto Evaluate = [&](double Time)
+        {
+            EvaluateMutual(Pool);
+            ForEachBody(Pool, [&](size_t Index)
+            {
+                const Vector3 External = Field(Time, Vector3({mX[Index], mY[Index], mZ[Index]}));
+                mAX[Index] += External.X;
+                mAY[Index] += External.Y;
+                mAZ[Index] += External.Z;
+            });
+        };
+
+        if (mAccelerationValid == false)
+        {
+            Evaluate(mTime);
+        }
+
+        Kick(Pool, 0.5 * Step);
+        Drift(Pool, Step);
+        mTime += Step;
+        Evaluate(mTime);
+        Kick(Pool, 0.5 * Step);
+        mAccelerationValid = true;
+    }
+
+private:
+
+    /**
+     * Cell of the octree, spanning a contiguous range of bodies in Morton order. The
+     * children of a cell are contiguous
+     */
+    struct Cell
+    {
+        /// Centre of mass (m)
+        double X = 0.0;
+        double Y = 0.0;
+        double Z = 0.0;
+
+        /// Total gravitational parameter (m^3/s^2)
+        double Mu = 0.0;
+
+        /// Edge length (m)
+        double Size = 0.0;
+
+        /// Range of bodies in Morton order
+        uint32_t Begin = 0;
+        uint32_t End = 0;
+
+        /// Index of the first child, and the number of children, zero for a leaf
+        uint32_t Child = 0;
+        uint32_t Children = 0;
+    };
+
+    // Bodies processed in sequence by each thread
+    static constexpr size_t BODY_GRAIN = 256;
+
+    /**
+     * Invokes `Body(Index)` for every body in parallel
+     */
+    template <typename Func>
+    void ForEachBody(ThreadPool& Pool, Func&& Body)
+    {
+        Pool.ParallelFor(Size(), BODY_GRAIN, Body);
+    }
+
+    /** Evaluates the mutual accelerations of every body into the accelerations */
+    void EvaluateMutual(ThreadPool& Pool);
+
+    /** Mutual accelerations by direct summation */
+    void EvaluateDirect(ThreadPool& Pool);
+
+    /** Mutual accelerations by a Barnes-Hut walk of the octree */
+    void EvaluateTree(ThreadPool& Pool);
+
+    /** Sorts the bodies along a Morton curve, and builds the octree of the sorted bodies */
+    void BuildTree(ThreadPool& Pool);
+
+    /** Advances the velocities by the accelerations over a time */
+    void Kick(ThreadPool& Pool, double Time);
+
+    /** Advances the positions by the velocities over a time */
+    void Drift(ThreadPool& Pool, double Time);
+
+    NBodySettings mSettings{};
+    double mTime = 0.0;
+    bool mAccelerationValid = false;
+
+    // State and acceleration of each body, stored per element
+    std::vector<double> mX{};
+    std::vector<double> mY{};
+    std::vector<double> mZ{};
+    std::vector<double> mVX{};
+    std::vector<double> mVY{};
+    std::vector<double> mVZ{};
+    std::vector<double> mAX{};
+    std::vector<double> mAY{};
+    std::vector<double> mAZ{};
+    std::vector<double> mMu{};
+
+    // Octree, with the bodies copied in Morton order and their keys and original indices
+    std::vector<Cell> mCells{};
+    std::vector<uint64_t> mKeys{};
+    std::vector<uint32_t> mOrder{};
+    std::vector<double> mSortedX{};
+    std::vector<double> mSortedY{};
+    std::vector<double> mSortedZ{};
+    std::vector<double> mSortedMu{};
+};
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "math/matrix3.hpp"
+#include "math/quaternion.hpp"
+#include "math/vector3.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * Mass properties of a rigid body
+ */
+struct RigidBodyProperties
+{
+    /// Mass (kg)
+    double Mass = 1.0;
+
+    /// Inertia tensor about the centre of mass in the body frame (kg m^2), symmetric
+    Matrix3 Inertia = Matrix3::IDENTITY();
+};
+
+/**
+ * State of a rigid body. The attitude transforms inertial co-ordinates into body
+ * co-ordinates, such that `Attitude.Rotate(V)` expresses an inertial vector in the body frame
+ */
+struct RigidBodyState
+{
+    /// Position of the centre of mass in the inertial frame (m)
+    Vector3 Position = Vector3::ZERO();
+
+    /// Velocity of the centre of mass in the inertial frame (m/s)
+    Vector3 Velocity = Vector3::ZERO();
+
+    /// Inertial to body transformation
+    Quaternion Attitude = Quaternion::IDENTITY();
+
+    /// Angular velocity of the body relative to the inertial frame, in the body frame (rad/s)
+    Axis3 AngularVelocity = Axis3::ZERO();
+};
+
+/**
+ * 6DOF rigid body dynamics of many vehicles propagated together. Translational motion
+ * follows Newton's second law and rotational motion Euler's equations, with quaternion
+ * attitude kinematics.
+ *
+ * Each state element, mass property and load of every vehicle is stored in its own
+ * contiguous array (structure of arrays), such that load models and integration are single
+ * loops over vehicles which the compiler vectorises. Individual vehicles are accessed by
+ * index through the per vehicle API.
+ *
+ * Loads are either applied (held constant over the next integration step, i.e thrust or
+ * actuator commands) or evaluated by a load model at every stage of the integrator
+ * (i.e gravity). Every load function adds to the loads of the current stage when invoked
+ * from a load model, and to the applied loads otherwise:
+ *
+ *  Swarm.AddTorque(Index, Command);
+ *  Swarm.Integrate(Step, [Mu](RigidBodySwarm& Stage) {Stage.AddPointMassGravity(Mu);});
+ *
+ * Integration is performed for consecutive groups of vehicles in turn, such that the
+ * fields of a group remain in cache over every stage. A load model is therefore invoked
+ * once per group and stage, and applies loads to the vehicles from `GetStageBegin()` up to
+ * `GetStageEnd()` only, as the whole swarm load functions do.
+ */
+class RigidBodySwarm
+{
+public:
+
+    /**
+     * Adds a vehicle
+     * @param Properties Mass properties
+     * @param State Initial state
+     * @return Index of the vehicle
+     * @throws Error::GenericException if the mass is not positive or the inertia is singular
+     */
+    size_t Add(const RigidBodyProperties& Properties, const RigidBodyState& State);
+
+    /**
+     * Reserves storage, such that vehicles may be added without reallocation
+     * @param Capacity Number of vehicles
+     */
+    void Reserve(size_t Capacity);
+
+    /** @return Number of vehicles */
+    size_t Size(void) const noexcept {return mCount;}
+
+    /** @return Index of the first vehicle of the current stage, zero outside of a stage */
+    size_t GetStageBegin(void) const noexcept {return mInStage ? mStageBegin : 0;}
+
+    /** @return Index past the last vehicle of the current stage, the number of vehicles outside of a stage */
+    size_t GetStageEnd(void) const noexcept {return mInStage ? mStageEnd : mCount;}
+
+    /**
+     * @param Index Vehicle index
+     * @return State of the vehicle
+     */
+    RigidBodyState GetState(size_t Index) const noexcept;
+
+    /**
+     * @param Index Vehicle index
+     * @param State New state of the vehicle
+     */
+    void SetState(size_t Index, const RigidBodyState& State) noexcept;
+
+    /**
+     * @param Index Vehicle index
+     * @return Mass properties of the vehicle
+     */
+    RigidBodyProperties GetProperties(size_t Index) const noexcept;
+
+    /**
+     * @param Index Vehicle index
+     * @param Properties New mass properties of the vehicle
+     * @throws Error::GenericException if the mass is not positive or the inertia is singular
+     */
+    void SetProperties(size_t Index, const RigidBodyProperties& Properties);
+
+    /**
+     * Applies a force through the centre of mass until the next integration step
+     * @param Index Vehicle index
+     * @param Force Force in the inertial frame (N)
+     */
+    void AddForce(size_t Index, const Vector3& Force) noexcept;
+
+    /**
+     * Applies a torque until the next integration step
+     * @param Index Vehicle index
+     * @param Torque Torque in the body frame (Nm)
+     */
+    void AddTorque(size_t Index, const Vector3& Torque) noexcept;
+
+    /**
+     * Applies a force at a point of the body until the next integration step, producing
+     * both a force and a torque
+     * @param Index Vehicle index
+     * @param Force Force in the inertial frame (N)
+     * @param Point Point of application relative to the centre of mass, in the body frame (m)
+     */
+    void AddForceAtPoint(size_t Index, const Vector3& Force, const Vector3& Point) noexcept;
+
+    /**
+     * Applies a force to every vehicle until the next integration step
+     * @param Forces Force of each vehicle in the inertial frame (N)
+     * @throws Error::HArraySizeMismatch if the number of forces does not match the number of vehicles
+     */
+    void AddForces(std::span<const Vector3> Forces);
+
+    /**
+     * Applies a torque to every vehicle until the next integration step
+     * @param Torques Torque of each vehicle in the body frame (Nm)
+     * @throws Error::HArraySizeMismatch if the number of torques does not match the number of vehicles
+     */
+    void AddTorques(std::span<const Vector3> Torques);
+
+    /**
+     * Adds the gravitational force of a point mass at the origin to every vehicle of the
+     * current stage, intended to be called from a load model
+     * @param Mu Gravitational parameter (m^3/s^2)
+     */
+    void AddPointMassGravity(double Mu) noexcept;
+
+    /**
+     * Adds the gravity gradient torque of a point mass at the origin to every vehicle of the
+     * current stage, intended to be called from a load model
+     * @param Mu Gravitational parameter (m^3/s^2)
+     */
+    void AddGravityGradientTorque(double Mu) noexcept;
+
+    /**
+     * @param Index Vehicle index
+     * @return Force (N) applied to the vehicle for the next integration step, in the inertial frame
+     */
+    Vector3 GetAppliedForce(size_t Index) const noexcept;
+
+    /**
+     * @param Index Vehicle index
+     * @return Torque (Nm) applied to the vehicle for the next integration step, in the body frame
+     */
+    Vector3 GetAppliedTorque(size_t Index) const noexcept;
+
+    /**
+     * Removes every applied load
+     */
+    void ClearLoads(void) noexcept;
+
+    /**
+     * Advances every vehicle by a fourth order Runge-Kutta step, with the applied loads held
+     * constant over the step. Applied loads are cleared afterwards
+     * @param Step Time step (s)
+     */
+    void Integrate(double Step) noexcept
+    {
+        Integrate(Step, [](RigidBodySwarm&) noexcept { });
+    }
+
+    /**
+     * Advances every vehicle by a fourth order Runge-Kutta step, evaluating a load model at
+     * each stage in addition to the applied loads held constant over the step. Applied
+     * loads are cleared afterwards
+     * @param Step Time step (s)
+     * @param Model Callable taking the swarm at the stage state, adding the loads of the model
+     */
+    template <typename LoadModel>
+    void Integrate(double Step, LoadModel&& Model)
+    {
+        for (size_t Begin = 0; Begin < mCount; Begin += GROUP)
+        {
+            mStageBegin = Begin;
+            mStageEnd = (mCount - Begin < GROUP) ? mCount : Begin + GROUP;
+
+            for (size_t Stage = 0; Stage < STAGES; Stage++)
+            {
+                BeginStage();
+                Model(*this);
+                EndStage(Stage, Step);
+            }
+        }
+    }
+
+private:
+
+    // Elements of the state of each vehicle
+    enum StateField : size_t
+    {
+        PX, PY, PZ, VX, VY, VZ, QX, QY, QZ, QS, WX, WY, WZ, STATE_FIELDS
+    };
+
+    // Mass properties of each vehicle, symmetric inertia (I) and its inverse (J)
+    enum PropertyField : size_t
+    {
+        MASS, INVERSE_MASS, IXX, IYY, IZZ, IXY, IXZ, IYZ, JXX, JYY, JZZ, JXY, JXZ, JYZ, PROPERTY_FIELDS
+    };
+
+    // Loads of each vehicle, applied (A) and total of the current stage (T)
+    enum LoadField : size_t
+    {
+        AFX, AFY, AFZ, ATX, ATY, ATZ, FX, FY, FZ, TX, TY, TZ, LOAD_FIELDS
+    };
+
+    static constexpr size_t STAGES = 4;
+
+    // Vehicles integrated together through every stage
+    static constexpr size_t GROUP = 64;
+
+    /**
+     * Fields of every vehicle stored contiguously per field, with a common capacity. Fields
+     * are padded by a cache line, such that the same vehicle of each field does not map to
+     * the same cache set when the capacity is a power of two
+     */
+    class Block
+    {
+    public:
+        explicit Block(size_t Fields) : mFields{Fields} { }
+
+        double* operator[](size_t Field) noexcept {return mData.data() + Field * mStride;}
+        const double* operator[](size_t Field) const noexcept {return mData.data() + Field * mStride;}
+
+        /** Moves every field to a new capacity, retaining the first `Count` elements */
+        void Resize(size_t Capacity, size_t Count);
+
+        size_t Capacity(void) const noexcept {return mCapacity;}
+
+    private:
+        static constexpr size_t PADDING = 8;
+
+        size_t mFields = 0;
+        size_t mCapacity = 0;
+        size_t mStride = 0;
+        std::vector<double> mData{};
+    };
+
+    /** @return First load field written to, applied loads outside of a stage */
+    size_t LoadOffset(void) const noexcept {return mInStage ? size_t(FX) : size_t(AFX);}
+
+    /** Resets the stage loads of the current group to the applied loads */
+    void BeginStage(void) noexcept;
+
+    /**
+     * Evaluates the derivative of a stage, and advances the current group to the state of
+     * the next stage. The last stage completes the step, clearing the applied loads
+     */
+    void EndStage(size_t Stage, double Step) noexcept;
+
+    /** EndStage, specialised for the first and last stages */
+    template <bool First, bool Last>
+    void AdvanceStage(double Weight, double Offset) noexcept;
+
+    size_t mCount = 0;
+    bool mInStage = false;
+
+    // Vehicles of the group being integrated
+    size_t mStageBegin = 0;
+    size_t mStageEnd = 0;
+
+    Block mState{STATE_FIELDS};
+    Block mProperties{PROPERTY_FIELDS};
+    Block mLoads{LOAD_FIELDS};
+
+    // State at the start of the step, and the weighted sum of stage derivatives
+    Block mStart{STATE_FIELDS};
+    Block mSum{STATE_FIELDS};
+};
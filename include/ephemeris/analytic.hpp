@@ -0,0 +1,365 @@
+#pragma once
+
+/**
+ * @file analytic.hpp
+ * Low precision analytic series for the positions of the Sun, Moon and planets. Suitable for
+ * eclipse screening, illumination and third body perturbations where JPL precision ephemeris
+ * are not required. All series are referred to the mean equator and equinox of J2000 (EME2000)
+ * and are constant evaluable.
+ *
+ * Sun and Moon: "Satellite Orbits", Oliver Montenbruck and Eberhard Gill, Section 3.3.2
+ * Approximately 0.01 deg (Sun) and a few arc minutes / 500 km (Moon) accuracy
+ *
+ * Planets: "Keplerian Elements for Approximate Positions of the Major Planets", E M Standish,
+ * Table 1 (valid 1800 AD - 2050 AD). Approximately 1 - 10 arc minute accuracy
+ */
+
+#include "math/constants.hpp"
+#include "math/core_math.hpp"
+#include "math/vector3.hpp"
+#include "ephemeris/ephemeris.hpp"
+
+#include <utility>
+
+namespace Analytic
+{
+    /// Astronomical unit (m)
+    constexpr double ASTRONOMICAL_UNIT = 149597870700.0;
+
+    /// Obliquity of the ecliptic at J2000 (rad)
+    constexpr double OBLIQUITY_J2000 = 23.43929111 * PI / 180.0;
+
+    /// Seconds per julian century
+    constexpr double SECONDS_PER_CENTURY = 36525.0 * 86400.0;
+
+    /// Ratio of the moon mass to the earth-moon system mass
+    constexpr double MOON_MASS_FRACTION = 1.0 / (1.0 + 81.30056);
+
+    /// Step (s) of the central difference used to compute velocities
+    constexpr double VELOCITY_STEP = 60.0;
+
+    /**
+     * Bodies supported by the analytic series
+     */
+    enum struct Body
+    {
+        SUN,
+        MERCURY,
+        VENUS,
+        EARTH_MOON_BARYCENTER,
+        EARTH,
+        MOON,
+        MARS,
+        JUPITER,
+        SATURN,
+        URANUS,
+        NEPTUNE
+    };
+
+    /**
+     * Mean orbital elements of a planet and their rates of change
+     */
+    struct PlanetElements
+    {
+        double SemiMajorAxis = 0.0;     // (au), (au / century)
+        double Eccentricity = 0.0;      // (-), (1 / century)
+        double Inclination = 0.0;       // (deg), (deg / century)
+        double MeanLongitude = 0.0;     // (deg), (deg / century)
+        double LongitudePerihelion = 0.0; // (deg), (deg / century)
+        double LongitudeNode = 0.0;     // (deg), (deg / century)
+    };
+
+    /**
+     * @param Planet Planet of interest, must not be the Sun, Earth or Moon
+     * @return Mean elements at J2000 and their rates per julian century
+     */
+    constexpr std::pair<PlanetElements, PlanetElements> GetPlanetElements(Body Planet) noexcept
+    {
+        switch (Planet)
+        {
+            case Body::MERCURY:
+                return {{0.38709927, 0.20563593, 7.00497902, 252.25032350, 77.45779628, 48.33076593},
+                        {0.00000037, 0.00001906, -0.00594749, 149472.67411175, 0.16047689, -0.12534081}};
+            case Body::VENUS:
+                return {{0.72333566, 0.00677672, 3.39467605, 181.97909950, 131.60246718, 76.67984255},
+                        {0.00000390, -0.00004107, -0.00078890, 58517.81538729, 0.00268329, -0.27769418}};
+            case Body::MARS:
+                return {{1.52371034, 0.09339410, 1.84969142, -4.55343205, -23.94362959, 49.55953891},
+                        {0.00001847, 0.00007882, -0.00813131, 19140.30268499, 0.44441088, -0.29257343}};
+            case Body::JUPITER:
+                return {{5.20288700, 0.04838624, 1.30439695, 34.39644051, 14.72847983, 100.47390909},
+                        {-0.00011607, -0.00013253, -0.00183714, 3034.74612775, 0.21252668, 0.20469106}};
+            case Body::SATURN:
+                return {{9.53667594, 0.05386179, 2.48599187, 49.95424423, 92.59887831, 113.66242448},
+                        {-0.00125060, -0.00050991, 0.00193609, 1222.49362201, -0.41897216, -0.28867794}};
+            case Body::URANUS:
+                return {{19.18916464, 0.04725744, 0.77263783, 313.23810451, 170.95427630, 74.01692503},
+                        {-0.00196176, -0.00004397, -0.00242939, 428.48202785, 0.40805281, 0.04240589}};
+            case Body::NEPTUNE:
+                return {{30.06992276, 0.00859048, 1.77004347, -55.12002969, 44.96476227, 131.78422574},
+                        {0.00026291, 0.00005105, 0.00035372, 218.45945325, -0.32241464, -0.00508664}};
+            default:
+                // Earth-moon barycentre
+                return {{1.00000261, 0.01671123, -0.00001531, 100.46457166, 102.93768193, 0.0},
+                        {0.00000562, -0.00004392, -0.01294668, 35999.37244981, 0.32327364, 0.0}};
+        }
+    }
+
+    /**
+     * @param Degrees Angle (deg), of any magnitude
+     * @return Equivalent angle (rad) in the range (-2 PI, 2 PI)
+     */
+    constexpr double ReduceDegrees(double Degrees) noexcept
+    {
+        return D2R(Fmod(Degrees, 360.0));
+    }
+
+    /**
+     * @param Arcseconds Angle (arcsec)
+     * @return Angle (rad)
+     */
+    constexpr double Arcsec2Rad(double Arcseconds) noexcept
+    {
+        return D2R(Arcseconds / 3600.0);
+    }
+
+    /**
+     * @param EpochTime Seconds (TDB) since J2000
+     * @return Julian centuries (TDB) since J2000
+     */
+    constexpr double EpochToCenturies(double EpochTime) noexcept
+    {
+        return EpochTime / SECONDS_PER_CENTURY;
+    }
+
+    /**
+     * Rotates ecliptic J2000 co-ordinates into the J2000 equatorial frame
+     * @param Ecliptic Position in the ecliptic frame
+     * @return Position in the equatorial frame
+     */
+    constexpr Vector3 Ecliptic2Equatorial(const Vector3& Ecliptic) noexcept
+    {
+        constexpr double CosEps = 0.91748206207689580;  // Cos(OBLIQUITY_J2000)
+        constexpr double SinEps = 0.39777715591412140;  // Sin(OBLIQUITY_J2000)
+
+        return Vector3({Ecliptic.X,
+                        CosEps * Ecliptic.Y - SinEps * Ecliptic.Z,
+                        SinEps * Ecliptic.Y + CosEps * Ecliptic.Z});
+    }
+
+    /**
+     * Solves Kepler's equation M = E - e sin(E) for an elliptic orbit
+     * @param MeanAnomoly Mean anomoly (rad)
+     * @param Eccentricity Eccentricity (< 1)
+     * @return Eccentric anomoly (rad)
+     */
+    constexpr double SolveKepler(double MeanAnomoly, double Eccentricity) noexcept
+    {
+        double Anomoly = (Eccentricity < 0.8) ? MeanAnomoly : PI;
+
+        for (int Index = 0; Index < 16; Index++)
+        {
+            const double Delta = (Anomoly - Eccentricity * Sin(Anomoly) - MeanAnomoly) / (1.0 - Eccentricity * Cos(Anomoly));
+            Anomoly -= Delta;
+
+            if (Abs(Delta) < 1.0E-14)
+            {
+                break;
+            }
+        }
+
+        return Anomoly;
+    }
+
+    /**
+     * @param Centuries Julian centuries (TDB) since J2000
+     * @return Geocentric position (m) of the Sun in EME2000
+     */
+    constexpr Vector3 SunPosition(double Centuries) noexcept
+    {
+        // Mean anomoly and ecliptic longitude
+        const double M = ReduceDegrees(357.5256 + 35999.049 * Centuries);
+        const double Longitude = D2R(282.9400) + M + Arcsec2Rad(6892.0 * Sin(M) + 72.0 * Sin(2.0 * M));
+        const double Distance = (149.619 - 2.499 * Cos(M) - 0.021 * Cos(2.0 * M)) * 1.0E9;
+
+        return Ecliptic2Equatorial(Vector3({Distance * Cos(Longitude), Distance * Sin(Longitude), 0.0}));
+    }
+
+    /**
+     * @param Centuries Julian centuries (TDB) since J2000
+     * @return Geocentric position (m) of the Moon in EME2000
+     */
+    constexpr Vector3 MoonPosition(double Centuries) noexcept
+    {
+        // Mean arguments of the lunar and solar orbits
+        const double L0 = ReduceDegrees(218.31617 + 481267.88088 * Centuries - 1.3972 * Centuries);
+        const double L  = ReduceDegrees(134.96292 + 477198.86753 * Centuries);
+        const double Lp = ReduceDegrees(357.52543 + 35999.04944 * Centuries);
+        const double F  = ReduceDegrees(93.27283 + 483202.01873 * Centuries);
+        const double D  = ReduceDegrees(297.85027 + 445267.11135 * Centuries);
+
+        const double Longitude = L0 + Arcsec2Rad(
+            22640.0 * Sin(L) + 769.0 * Sin(2.0 * L)
+            - 4586.0 * Sin(L - 2.0 * D) + 2370.0 * Sin(2.0 * D)
+            - 668.0 * Sin(Lp) - 412.0 * Sin(2.0 * F)
+            - 212.0 * Sin(2.0 * L - 2.0 * D) - 206.0 * Sin(L + Lp - 2.0 * D)
+            + 192.0 * Sin(L + 2.0 * D) - 165.0 * Sin(Lp - 2.0 * D)
+            + 148.0 * Sin(L - Lp) - 125.0 * Sin(D)
+            - 110.0 * Sin(L + Lp) - 55.0 * Sin(2.0 * F - 2.0 * D));
+
+        const double Latitude = Arcsec2Rad(
+            18520.0 * Sin(F + Longitude - L0 + Arcsec2Rad(412.0 * Sin(2.0 * F) + 541.0 * Sin(Lp)))
+            - 526.0 * Sin(F - 2.0 * D) + 44.0 * Sin(L + F - 2.0 * D)
+            - 31.0 * Sin(-L + F - 2.0 * D) - 25.0 * Sin(-2.0 * L + F)
+            - 23.0 * Sin(Lp + F - 2.0 * D) + 21.0 * Sin(-L + F)
+            + 11.0 * Sin(-Lp + F - 2.0 * D));
+
+        const double Distance = (385000.0 - 20905.0 * Cos(L) - 3699.0 * Cos(2.0 * D - L)
+            - 2956.0 * Cos(2.0 * D) - 570.0 * Cos(2.0 * L) + 246.0 * Cos(2.0 * L - 2.0 * D)
+            - 205.0 * Cos(Lp - 2.0 * D) - 171.0 * Cos(L + 2.0 * D) - 152.0 * Cos(L + Lp - 2.0 * D)) * 1.0E3;
+
+        const double CosLatitude = Cos(Latitude);
+
+        return Ecliptic2Equatorial(Vector3({
+            Distance * Cos(Longitude) * CosLatitude,
+            Distance * Sin(Longitude) * CosLatitude,
+            Distance * Sin(Latitude)}));
+    }
+
+    /**
+     * @param Planet Planet of interest (Mercury - Neptune or the Earth-Moon barycentre)
+     * @param Centuries Julian centuries (TDB) since J2000
+     * @return Heliocentric position (m) of the planet in EME2000
+     */
+    constexpr Vector3 PlanetPosition(Body Planet, double Centuries) noexcept
+    {
+        const auto [Elements, Rates] = GetPlanetElements(Planet);
+
+        const double A = (Elements.SemiMajorAxis + Rates.SemiMajorAxis * Centuries) * ASTRONOMICAL_UNIT;
+        const double E = Elements.Eccentricity + Rates.Eccentricity * Centuries;
+        const double I = D2R(Elements.Inclination + Rates.Inclination * Centuries);
+        const double MeanLongitude = Elements.MeanLongitude + Rates.MeanLongitude * Centuries;
+        const double Perihelion = Elements.LongitudePerihelion + Rates.LongitudePerihelion * Centuries;
+        const double Node = D2R(Elements.LongitudeNode + Rates.LongitudeNode * Centuries);
+
+        const double ArgumentPerihelion = D2R(Perihelion) - Node;
+        const double MeanAnomoly = ReduceDegrees(MeanLongitude - Perihelion);
+        const double EccentricAnomoly = SolveKepler(MeanAnomoly, E);
+
+        // Position within the orbital plane
+        const double XP = A * (Cos(EccentricAnomoly) - E);
+        const double YP = A * Sqrt(1.0 - E * E) * Sin(EccentricAnomoly);
+
+        const double CosW = Cos(ArgumentPerihelion), SinW = Sin(ArgumentPerihelion);
+        const double CosN = Cos(Node), SinN = Sin(Node);
+        const double CosI = Cos(I), SinI = Sin(I);
+
+        return Ecliptic2Equatorial(Vector3({
+            (CosW * CosN - SinW * SinN * CosI) * XP + (-SinW * CosN - CosW * SinN * CosI) * YP,
+            (CosW * SinN + SinW * CosN * CosI) * XP + (-SinW * SinN + CosW * CosN * CosI) * YP,
+            (SinW * SinI) * XP + (CosW * SinI) * YP}));
+    }
+
+    /**
+     * @param Object Body of interest
+     * @param Centuries Julian centuries (TDB) since J2000
+     * @return Heliocentric position (m) of the body in EME2000
+     */
+    constexpr Vector3 HeliocentricPosition(Body Object, double Centuries) noexcept
+    {
+        switch (Object)
+        {
+            case Body::SUN:
+                return Vector3::ZERO();
+            case Body::EARTH:
+                return -SunPosition(Centuries);
+            case Body::MOON:
+                return MoonPosition(Centuries) - SunPosition(Centuries);
+            case Body::EARTH_MOON_BARYCENTER:
+                return MOON_MASS_FRACTION * MoonPosition(Centuries) - SunPosition(Centuries);
+            default:
+                return PlanetPosition(Object, Centuries);
+        }
+    }
+
+    /**
+     * @param Object Body of interest
+     * @param Reference Body which the position is relative to
+     * @param Centuries Julian centuries (TDB) since J2000
+     * @return Position (m) of `Object` relative to `Reference` in EME2000
+     */
+    constexpr Vector3 RelativePosition(Body Object, Body Reference, double Centuries) noexcept
+    {
+        // Avoid the heliocentric round trip for the most common geocentric cases
+        if (Reference == Body::EARTH)
+        {
+            if (Object == Body::MOON)
+            {
+                return MoonPosition(Centuries);
+            }
+            else if (Object == Body::SUN)
+            {
+                return SunPosition(Centuries);
+            }
+        }
+
+        return HeliocentricPosition(Object, Centuries) - HeliocentricPosition(Reference, Centuries);
+    }
+}
+
+/**
+ * Ephemeris object using low precision analytic series as the backend. Interchangeable with
+ * `SpiceEphemeris` where low precision is acceptable, states are given in EME2000 (J2000)
+ */
+class AnalyticEphemeris : public Ephemeris
+{
+public:
+
+    /**
+     * @param Object Tracked body
+     * @param Reference Body which the state of `Object` is relative to
+     */
+    AnalyticEphemeris(Analytic::Body Object, Analytic::Body Reference) noexcept :
+        mObject{Object},
+        mReference{Reference}
+    {
+
+    }
+
+    /**
+     * Static calculation of the relative state, velocity is determined by a central difference
+     * of the analytic position series
+     * @param Object Tracked body
+     * @param Reference Body which the state of `Object` is relative to
+     * @param EpochTime Time (s) in the J2000 (TDB) epoch
+     * @return EphemerisState (Position, Velocity, LightTime)
+     */
+    static constexpr EphemerisState CalculateState(Analytic::Body Object, Analytic::Body Reference, double EpochTime) noexcept
+    {
+        using namespace Analytic;
+
+        const Vector3 Pos = RelativePosition(Object, Reference, EpochToCenturies(EpochTime));
+        const Vector3 Ahead = RelativePosition(Object, Reference, EpochToCenturies(EpochTime + VELOCITY_STEP));
+        const Vector3 Behind = RelativePosition(Object, Reference, EpochToCenturies(EpochTime - VELOCITY_STEP));
+
+        return EphemerisState{
+            .Pos = Pos,
+            .Vel = (Ahead - Behind) / (2.0 * VELOCITY_STEP),
+            .LightTime = Pos.Norm() / SPEED_LIGHT
+        };
+    }
+
+    /**
+     * Gets the current relative state of the tracked body relative to the reference body
+     * @param EpochTime Time (s) in the J2000 (TDB) epoch
+     * @return EphemerisState (Position, Velocity, LightTime)
+     */
+    EphemerisState GetState(double EpochTime) const noexcept override
+    {
+        return CalculateState(mObject, mReference, EpochTime);
+    }
+
+private:
+    Analytic::Body mObject = Analytic::Body::SUN;
+    Analytic::Body mReference = Analytic::Body::EARTH;
+};
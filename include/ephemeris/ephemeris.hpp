@@ -1,19 +1,22 @@
 #pragma once
 
 #include "math/vector3.hpp"
+#include "utils/errors.hpp"
+
+#include <span>
 
 /**
  * Celestial object relative position and velocity
  */
 struct EphemerisState
 {
-    // Position (m)    
+    // Position (m)
     Vector3 Pos = Vector3::ZERO();
 
-    // Velocity (m/s)    
+    // Velocity (m/s)
     Vector3 Vel = Vector3::ZERO();
 
-    // Light delay between reference object and target body (s)    
+    // Light delay between reference object and target body (s)
     double LightTime = 0.0;
 };
 
@@ -24,15 +27,40 @@ class Ephemeris
 {
 public:
     Ephemeris() = default;
+    virtual ~Ephemeris() = default;
 
     // Should never copy
     Ephemeris(const Ephemeris& Eph) = delete;
 
     /**
-     * Gets the current relative state of the tracked body in the 
+     * Gets the current relative state of the tracked body in the
      * default reference frame relative to the default reference object
      * @param EpochTime Time (s) in the reference epoch
      * @return EphemerisState (Position, Velocity, LightTime)
      */
-    EphemerisState GetState(double EpochTime) const;
-};
\ No newline at end of file
+    virtual EphemerisState GetState(double EpochTime) const noexcept = 0;
+
+    /**
+     * Gets the relative state of the tracked body at each of the given epochs. Backends
+     * should override this where a batch can be evaluated more efficiently than
+     * repeated calls to `GetState`, i.e where ascending `Epochs` allow lookups to be reused
+     * @param Epochs Times (s) in the reference epoch, preferably in ascending order
+     * @param Out EphemerisState at each of the `Epochs`, must be the same size as `Epochs`
+     * @return False if any of the `Epochs` could not be evaluated, the state of each of which
+     * is left as the default `EphemerisState`
+     */
+    virtual bool GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const
+    {
+        if (Epochs.size() != Out.size())
+        {
+            throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+        }
+
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            Out[Index] = GetState(Epochs[Index]);
+        }
+
+        return true;
+    }
+};
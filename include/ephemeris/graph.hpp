@@ -0,0 +1,162 @@
+#pragma once
+
+#include "ephemeris/ephemeris.hpp"
+
+#include <cstdint>
+#include <map>
+#include <span>
+#include <vector>
+
+/**
+ * Object/observer pair of bodies within an ephemeris graph
+ */
+struct BodyPair
+{
+    // Identifier of the observed body
+    int32_t Object = 0;
+
+    // Identifier of the observing (reference) body
+    int32_t Observer = 0;
+};
+
+/**
+ * Tree of celestial bodies in which the state of each body is provided by an ephemeris
+ * relative to its parent, i.e Moon -> Earth-Moon Barycentre -> Solar System Barycentre.
+ *
+ * The state of each body relative to the root is evaluated at most once per epoch and
+ * memoised, such that any object/observer pair is composed as a vector difference of
+ * two root relative states. Bodies are identified by integer codes, NAIF ID codes are
+ * recommended.
+ *
+ * Not thread safe, the memoised states are shared between all queries
+ */
+class EphemerisGraph
+{
+public:
+
+    /**
+     * @param RootID Identifier of the root body (i.e solar system barycentre) which
+     * all other states are ultimately relative to
+     */
+    explicit EphemerisGraph(int32_t RootID);
+
+    // Memoised states refer into the node storage
+    EphemerisGraph(const EphemerisGraph& Graph) = delete;
+
+    /**
+     * Adds a body to the graph. The ephemeris must outlive the graph
+     * @param BodyID Identifier of the new body
+     * @param ParentID Identifier of an existing body which `Eph` is relative to
+     * @param Eph Ephemeris of the new body relative to the parent body
+     * @return `false` if `BodyID` already exists or `ParentID` does not exist
+     */
+    bool AddBody(int32_t BodyID, int32_t ParentID, const Ephemeris& Eph);
+
+    /**
+     * @return `true` if the given body exists in the graph
+     */
+    bool HasBody(int32_t BodyID) const noexcept {return mIndex.contains(BodyID);}
+
+    /**
+     * @return Number of bodies in the graph, including the root
+     */
+    size_t Size(void) const noexcept {return mNodes.size();}
+
+    /**
+     * @param BodyID Identifier of the body
+     * @param EpochTime Time (s) in the reference epoch
+     * @return State of the body relative to the root. Returns a zero state if the
+     * body does not exist
+     */
+    EphemerisState GetRootState(int32_t BodyID, double EpochTime) const noexcept;
+
+    /**
+     * @param Pair Object and observer identifiers
+     * @param EpochTime Time (s) in the reference epoch
+     * @return Geometric state of the object relative to the observer. Returns a zero
+     * state if either body does not exist
+     */
+    EphemerisState GetRelativeState(const BodyPair& Pair, double EpochTime) const noexcept;
+
+    /**
+     * Evaluates many object/observer pairs at a single epoch. Each body in the graph is
+     * evaluated at most once irrespective of the number of pairs
+     * @param Pairs Object and observer identifiers
+     * @param EpochTime Time (s) in the reference epoch
+     * @param Out Relative state of each pair, must be the same size as `Pairs`
+     */
+    void GetRelativeStates(std::span<const BodyPair> Pairs, double EpochTime, std::span<EphemerisState> Out) const;
+
+    /**
+     * Discards all memoised states, required if any ephemeris in the graph is modified
+     */
+    void ClearCache(void) const noexcept;
+
+private:
+
+    /**
+     * Graph vertex
+     */
+    struct Node
+    {
+        // Body identifier
+        int32_t ID = 0;
+
+        // Index of the parent node, root node is its own parent
+        size_t Parent = 0;
+
+        // Ephemeris relative to the parent, nullptr for the root
+        const Ephemeris* Eph = nullptr;
+
+        // Epoch of the memoised state, NaN if nothing is memoised
+        mutable double CachedEpoch = 0.0;
+
+        // Memoised state relative to the root
+        mutable EphemerisState CachedState{};
+    };
+
+    /**
+     * @return State of the node relative to the root, evaluating any stale ancestors
+     */
+    const EphemerisState& EvaluateNode(size_t NodeIndex, double EpochTime) const noexcept;
+
+    // Graph vertices, root first, parents always precede their children
+    std::vector<Node> mNodes{};
+
+    // Body identifier -> node index
+    std::map<int32_t, size_t> mIndex{};
+};
+
+/**
+ * Ephemeris view of a single object/observer pair within an ephemeris graph, allows
+ * graph composed states to be used wherever an `Ephemeris` is expected
+ */
+class GraphEphemeris : public Ephemeris
+{
+public:
+
+    /**
+     * @param Graph Graph containing both bodies, must outlive this object
+     * @param Pair Object and observer identifiers
+     */
+    GraphEphemeris(const EphemerisGraph& Graph, const BodyPair& Pair) noexcept :
+        mGraph{Graph},
+        mPair{Pair}
+    {
+
+    }
+
+    /**
+     * Gets the state of the object relative to the observer
+     * @param EpochTime Time (s) in the reference epoch
+     * @return EphemerisState (Position, Velocity, LightTime)
+     */
+    EphemerisState GetState(double EpochTime) const noexcept override
+    {
+        return mGraph.GetRelativeState(mPair, EpochTime);
+    }
+
+private:
+    const EphemerisGraph& mGraph;
+    BodyPair mPair{};
+};
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "ephemeris/spice.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Spice
+{
+    class KernelSet;
+}
+
+/**
+ * Time interval over which a body is covered by a registered ephemeris kernel
+ */
+struct KernelCoverage
+{
+    // NAIF ID of the covered body
+    int32_t Body = 0;
+
+    // NAIF ID of the body the segments are relative to
+    int32_t Center = 0;
+
+    // Start of the interval (s past J2000 TDB)
+    double Start = 0.0;
+
+    // End of the interval (s past J2000 TDB)
+    double End = 0.0;
+
+    // Index of the kernel within the manager
+    size_t Kernel = 0;
+};
+
+/**
+ * Registers Spice ephemeris kernels (SPK) without loading them. On registration only
+ * the DAF summary records are read, via a memory mapping of the file, to build an index
+ * of the bodies and time intervals each kernel covers. A kernel is then furnished to
+ * Spice on the first query requiring it, and the least recently used kernels are
+ * unloaded whenever the loaded kernels exceed the memory budget.
+ *
+ * Spice gives precedence to the most recently loaded kernel where coverage overlaps,
+ * which is dependent on query order once loading is lazy. Kernels which overlap for the
+ * same body should therefore be consistent with one another.
+ *
+ * Not thread safe, as with Spice itself
+ */
+class KernelManager
+{
+public:
+
+    /// Memory budget allowing any number of kernels to remain loaded
+    static constexpr size_t UNLIMITED = 0;
+
+    /**
+     * @param MemoryBudget Upper limit on the total size (bytes) of loaded ephemeris kernels.
+     * Kernels required by a single query are never unloaded, so the budget may be exceeded
+     * if one query requires more
+     */
+    explicit KernelManager(size_t MemoryBudget = UNLIMITED);
+
+    ~KernelManager();
+
+    // Owns loaded kernels
+    KernelManager(const KernelManager& Manager) = delete;
+
+    /**
+     * Adds an ephemeris kernel to the coverage index, the kernel is not loaded
+     * @param Path Path to a binary SPK file
+     * @return `false` if the file cannot be mapped or is not a DAF/SPK file
+     */
+    bool Register(const std::string& Path);
+
+    /**
+     * Loads a non ephemeris kernel (i.e leap seconds or frames) immediately, these remain
+     * loaded for the lifetime of the manager and do not count towards the budget
+     * @param Path Path to the kernel
+     */
+    void LoadAuxillary(const std::string& Path);
+
+    /**
+     * Ensures that every kernel covering the bodies over the given interval is loaded, along
+     * with those covering the chain of centres each body is relative to. Kernels required
+     * by one call are never unloaded to meet the budget within the same call
+     * @param Bodies NAIF IDs of the bodies, i.e an object and observer
+     * @param Start Start of the interval (s past J2000 TDB)
+     * @param End End of the interval (s past J2000 TDB)
+     * @return `false` if any body is not covered over the entire interval
+     */
+    bool Require(std::span<const int32_t> Bodies, double Start, double End);
+
+    /**
+     * @param Body NAIF ID of the body
+     * @param Start Start of the interval (s past J2000 TDB)
+     * @param End End of the interval (s past J2000 TDB)
+     * @return `false` if the body is not covered over the entire interval
+     */
+    bool Require(int32_t Body, double Start, double End) {return Require(std::span<const int32_t>(&Body, 1), Start, End);}
+
+    /**
+     * @param Body NAIF ID of the body
+     * @param EpochTime Epoch (s past J2000 TDB)
+     * @return `false` if the body is not covered at the epoch
+     */
+    bool Require(int32_t Body, double EpochTime) {return Require(Body, EpochTime, EpochTime);}
+
+    /**
+     * @param Body NAIF ID of the body
+     * @param EpochTime Epoch (s past J2000 TDB)
+     * @return `true` if a registered kernel covers the body at the epoch
+     */
+    bool IsCovered(int32_t Body, double EpochTime) const noexcept;
+
+    /**
+     * @return Coverage index, ordered by body then start time
+     */
+    std::span<const KernelCoverage> GetCoverage(void) const noexcept {return mCoverage;}
+
+    /**
+     * Unloads all ephemeris kernels, auxillary kernels remain loaded
+     */
+    void UnloadAll(void) noexcept;
+
+    /** @return Number of registered ephemeris kernels */
+    size_t RegisteredCount(void) const noexcept {return mKernels.size();}
+
+    /** @return Number of currently loaded ephemeris kernels */
+    size_t LoadedCount(void) const noexcept;
+
+    /** @return Total size (bytes) of currently loaded ephemeris kernels */
+    size_t LoadedBytes(void) const noexcept {return mLoadedBytes;}
+
+    /** @return Memory budget (bytes) */
+    size_t GetMemoryBudget(void) const noexcept {return mMemoryBudget;}
+
+private:
+
+    /**
+     * Registered ephemeris kernel
+     */
+    struct Kernel
+    {
+        // Path to the file
+        std::string Path{};
+
+        // File size (bytes)
+        size_t Bytes = 0;
+
+        // Spice kernel set holding only this kernel, null while unloaded
+        std::unique_ptr<Spice::KernelSet> Set{};
+
+        // Query counter at the most recent use
+        uint64_t LastUsed = 0;
+    };
+
+    /**
+     * Loads the kernels covering a body and the chain of centres of each of its segments
+     * over the interval
+     * @return `true` if the body itself is covered over the entire interval
+     */
+    bool LoadChain(int32_t Body, double Start, double End);
+
+    /**
+     * Loads a kernel if required and marks it as used by the current query
+     */
+    void Touch(size_t Index);
+
+    /**
+     * Unloads least recently used kernels until the budget is met, excluding any used by
+     * the current query
+     */
+    void EnforceBudget(void) noexcept;
+
+    size_t mMemoryBudget = UNLIMITED;
+    size_t mLoadedBytes = 0;
+    uint64_t mQuery = 0;
+
+    std::vector<Kernel> mKernels{};
+    std::vector<KernelCoverage> mCoverage{};
+    std::unique_ptr<Spice::KernelSet> mAuxillary{};
+};
+
+/**
+ * Spice ephemeris which requests its kernels from a kernel manager prior to each query,
+ * such that kernels are only loaded once a body is first evaluated
+ */
+class LazySpiceEphemeris : public Ephemeris
+{
+public:
+
+    /**
+     * @param Manager Kernel manager, must outlive this object
+     * @param Inputs Spice object, frame and reference names
+     * @param ObjectID NAIF ID of the object
+     * @param ReferenceID NAIF ID of the reference body
+     */
+    LazySpiceEphemeris(KernelManager& Manager, const Spice::EphemerisInputs& Inputs, int32_t ObjectID, int32_t ReferenceID) noexcept :
+        mManager{Manager},
+        mSpice{Inputs},
+        mObjectID{ObjectID},
+        mReferenceID{ReferenceID}
+    {
+
+    }
+
+    /**
+     * Gets the relative state of the tracked body, loading kernels where required. A kernel
+     * which fails to load returns the default state
+     * @param EpochTime Time (s) in the reference epoch
+     * @return EphemerisState (Position, Velocity, LightTime)
+     */
+    EphemerisState GetState(double EpochTime) const noexcept override;
+
+    /**
+     * Gets the relative state at many epochs, kernels covering the full span of epochs
+     * are loaded once prior to evaluation. A kernel which fails to load fails every epoch
+     * @param Epochs Times (s) in the reference epoch, preferably in ascending order
+     * @param Out EphemerisState at each of the `Epochs`, must be the same size as `Epochs`
+     * @return False if any of the `Epochs` could not be evaluated, the state of each of which
+     * is left as the default `EphemerisState`
+     * @throws Error::HArraySizeMismatch if `Epochs` and `Out` differ in size
+     */
+    bool GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const override;
+
+private:
+    KernelManager& mManager;
+    SpiceEphemeris mSpice;
+    int32_t mObjectID = 0;
+    int32_t mReferenceID = 0;
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "ephemeris/ephemeris.hpp"
+#include "math/constants.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * Direction of the light path between target and observer
+ */
+enum struct LightTimeDirection
+{
+    // Light emitted by the target earlier is received by the observer at the epoch
+    RECEPTION,
+
+    // Light emitted by the observer at the epoch is received by the target later
+    TRANSMISSION
+};
+
+/**
+ * Light time solution settings
+ */
+struct LightTimeOptions
+{
+    // Direction of the light path
+    LightTimeDirection Direction = LightTimeDirection::RECEPTION;
+
+    // Apply stellar aberration due to the observer velocity
+    bool Aberration = true;
+
+    // Convergence threshold on successive light time estimates (s)
+    double Tolerance = 1.0E-9;
+
+    // Maximum number of ephemeris evaluations per pair, including the geometric state
+    size_t MaxIterations = 8;
+};
+
+/**
+ * Corrects a relative position for stellar aberration, the apparent displacement of
+ * the target towards the direction of motion of the observer. Equivalent to the Spice
+ * STELAB/STLABX routines
+ * @param Pos Light time corrected target position relative to the observer (m)
+ * @param ObserverVel Observer velocity relative to the solar system barycentre (m/s)
+ * @param Direction Direction of the light path
+ * @return Apparent target position relative to the observer (m)
+ */
+constexpr Vector3 StellarAberration(const Vector3& Pos, const Vector3& ObserverVel, LightTimeDirection Direction) noexcept
+{
+    const double Sign = (Direction == LightTimeDirection::RECEPTION) ? 1.0 : -1.0;
+    const Vector3 Axis = Vector3::Cross(Pos.Unit(), ObserverVel * (Sign / SPEED_LIGHT));
+    const double SinAngle = Axis.Norm();
+
+    if (SinAngle == 0.0)
+    {
+        return Pos;
+    }
+
+    // Rotation about an axis perpendicular to the position (Rodrigues)
+    const double CosAngle = Sqrt(1.0 - SinAngle * SinAngle);
+    return Pos * CosAngle + Vector3::Cross(Axis / SinAngle, Pos) * SinAngle;
+}
+
+/**
+ * Solves the light time between many target/observer pairs at a single epoch, via a
+ * fixed point iteration of each pair until successive light time estimates converge.
+ * Converged pairs are masked out of subsequent iterations, and the remaining pairs are
+ * grouped by target such that each backend receives a single batched `GetStates` query
+ * per iteration.
+ *
+ * Scratch storage is retained between calls, so repeated solutions of at most the same
+ * number of pairs do not allocate. Not thread safe, use one solver per thread
+ */
+class LightTimeSolver
+{
+public:
+
+    /**
+     * @param Options Solution settings
+     */
+    explicit LightTimeSolver(const LightTimeOptions& Options = LightTimeOptions{}) noexcept :
+        mOptions{Options}
+    {
+
+    }
+
+    /**
+     * @param Targets Ephemeris of each target relative to a common origin (i.e solar system
+     * barycentre), must not be null. Pairs may share targets
+     * @param Observers State of each observer relative to the same origin at the epoch
+     * @param EpochTime Time (s) in the reference epoch at the observer
+     * @param Out Light time (and optionally aberration) corrected state of each target
+     * relative to its observer, must be the same size as `Targets` and `Observers`
+     * @return Number of pairs which did not converge within the maximum iterations, these
+     * retain the latest estimate, or whose target could not be evaluated, these are left as
+     * the default `EphemerisState`
+     */
+    size_t Solve(std::span<const Ephemeris* const> Targets, std::span<const EphemerisState> Observers, double EpochTime, std::span<EphemerisState> Out);
+
+    /**
+     * @return Number of iterations taken by the slowest pair of the latest solution
+     */
+    size_t GetIterations(void) const noexcept {return mIterations;}
+
+    /**
+     * @return Solution settings
+     */
+    const LightTimeOptions& GetOptions(void) const noexcept {return mOptions;}
+
+private:
+    LightTimeOptions mOptions{};
+    size_t mIterations = 0;
+
+    // Pair indices ordered by target
+    std::vector<size_t> mOrder{};
+
+    // Latest light time estimate of each pair (s)
+    std::vector<double> mLightTime{};
+
+    // Convergence mask, of each pair converged, still iterating or failed
+    std::vector<uint8_t> mActive{};
+
+    // Batch of active pairs sharing a target
+    std::vector<size_t> mBatchIndex{};
+    std::vector<double> mBatchEpochs{};
+    std::vector<EphemerisState> mBatchStates{};
+};
@@ -24,13 +24,21 @@ public:
     // Standard initialiser
     SpiceEphemeris(const Spice::EphemerisInputs& Inputs) noexcept;
 
-    /* 
-     * Gets the current relative state of the tracked body in the 
+    /*
+     * Gets the current relative state of the tracked body in the
      * default reference frame relative to the default reference object
      */
-    EphemerisState GetState(double EpochTime) const noexcept;
+    EphemerisState GetState(double EpochTime) const noexcept override;
+
+    /*
+     * Gets the relative state of the tracked body at each of the given epochs, one
+     * Spice query per epoch as the wrapper exposes no lookup shared between them.
+     * Returns false if Spice failed at any epoch, each of which is left as the
+     * default state
+     */
+    bool GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const override;
 
 private:
 
     Spice::EphemerisInputs mParams{};
-};
\ No newline at end of file
+};
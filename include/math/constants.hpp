@@ -27,6 +27,10 @@ namespace Earth
     /// Earth standard gravity (m/s2)   
     constexpr double EQUATORIAL_GRAVITY = 9.7803253359;                
 
+    /// Earth second zonal harmonic coefficient (unnormalised, JGM3), with respect to the
+    /// WGS84 equatorial radius
+    constexpr double J2 = 1.0826269E-3;
+
     namespace WGS84
     {
         /// Earth WGS84 Equatorial Radius (m)    
@@ -263,6 +263,103 @@ namespace Math
         }
     }
 
+    /**
+     * @return e^`Val` - 1, accurate for small `Val`
+     */
+    template <typename T>
+    inline constexpr T Expm1(T Val) noexcept
+    {
+        if (std::is_constant_evaluated() == true)
+        {
+            return gcem::expm1(Val);
+        }
+        else
+        {
+            return expm1(Val);
+        }
+    }
+
+    /**
+     * @return Natural logarithm of `Val`
+     */
+    template <typename T>
+    inline constexpr T Log(T Val) noexcept
+    {
+        if (std::is_constant_evaluated() == true)
+        {
+            return gcem::log(Val);
+        }
+        else
+        {
+            return log(Val);
+        }
+    }
+
+    /**
+     * @return Error function of `Val`
+     */
+    template <typename T>
+    inline constexpr T Erf(T Val) noexcept
+    {
+        if (std::is_constant_evaluated() == true)
+        {
+            return gcem::erf(Val);
+        }
+        else
+        {
+            return erf(Val);
+        }
+    }
+
+    /**
+     * @return Complementary error function of `Val`, 1 - erf(`Val`), accurate for large `Val`.
+     * Constant evaluation sums the series of erf with positive terms below 1.5, where the
+     * cancellation of 1 - erf(`Val`) loses fewer than 5 bits, and the continued fraction
+     * of Laplace from 1.5
+     */
+    template <typename T>
+    inline constexpr T Erfc(T Val) noexcept
+    {
+        if (std::is_constant_evaluated() == true)
+        {
+            // 1 / sqrt(PI)
+            constexpr T INVERSE_ROOT_PI = T{0.56418958354775628695};
+
+            if (Val < T{0})
+            {
+                return T{2} - Erfc(-Val);
+            }
+
+            if (Val < T{1.5})
+            {
+                T Sum = T{0};
+                T Term = T{1};
+
+                for (int Index = 0; Index < 64; Index++)
+                {
+                    Sum += Term;
+                    Term *= T{2} * Val * Val / static_cast<T>(2 * Index + 3);
+                }
+
+                return T{1} - T{2} * INVERSE_ROOT_PI * Val * gcem::exp(-Val * Val) * Sum;
+            }
+
+            // Evaluated from its tail, 128 terms converging to double precision from 1.5
+            T Fraction = Val;
+
+            for (int Index = 128; Index > 0; Index--)
+            {
+                Fraction = Val + static_cast<T>(Index) / (T{2} * Fraction);
+            }
+
+            return INVERSE_ROOT_PI * gcem::exp(-Val * Val) / Fraction;
+        }
+        else
+        {
+            return erfc(Val);
+        }
+    }
+
     /** 
      * @return cosh(`Val`)
      */
@@ -547,6 +644,16 @@ namespace Math
         return std::numeric_limits<T>::infinity();
     }
 
+    /**
+     * @param Val Value to be tested
+     * @return `true` if `Val` is neither infinite nor NaN
+     */
+    template <typename T>
+    inline constexpr bool IsFinite(T Val) noexcept
+    {
+        return (Val == Val) && (Abs(Val) < Infinity<T>());
+    }
+
     /** 
      * Clamps a value between a certain range. Behaviour is undefined if Lower > Upper
      * @param Val Value to be clamped
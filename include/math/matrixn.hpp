@@ -0,0 +1,332 @@
+#pragma once
+
+#include "core_math.hpp"
+
+#include <array>
+#include <cstddef>
+
+/**
+ * General fixed size `Rows` x `Cols` matrix, stored contiguously in row major order. A
+ * single column matrix serves as a vector of `Rows` elements
+ */
+template <size_t Rows, size_t Cols>
+class MatrixN
+{
+public:
+
+    static_assert((Rows > 0) && (Cols > 0), "Matrix must have at least one element");
+
+    /**
+     * @return Identity Matrix
+     */
+    static constexpr MatrixN IDENTITY(void) noexcept requires (Rows == Cols)
+    {
+        MatrixN Result{};
+
+        for (size_t Index = 0; Index < Rows; Index++)
+        {
+            Result(Index, Index) = 1.0;
+        }
+
+        return Result;
+    }
+
+    /**
+     * @return Zero Matrix
+     */
+    static constexpr MatrixN ZERO(void) noexcept
+    {
+        return MatrixN{};
+    }
+
+    //
+    // Elements
+    //
+    std::array<double, Rows * Cols> Data{};
+
+    /** Element at a row and column */
+    constexpr double& operator()(size_t Row, size_t Col) noexcept {return Data[Row * Cols + Col];}
+
+    /** Element at a row and column */
+    constexpr double operator()(size_t Row, size_t Col) const noexcept {return Data[Row * Cols + Col];}
+
+    /** Element in row major order */
+    constexpr double& operator[](size_t Index) noexcept {return Data[Index];}
+
+    /** Element in row major order */
+    constexpr double operator[](size_t Index) const noexcept {return Data[Index];}
+
+    /**
+     * @return Transpose of `this`
+     */
+    constexpr MatrixN<Cols, Rows> Transpose(void) const noexcept
+    {
+        MatrixN<Cols, Rows> Result{};
+
+        for (size_t Row = 0; Row < Rows; Row++)
+        {
+            for (size_t Col = 0; Col < Cols; Col++)
+            {
+                Result(Col, Row) = (*this)(Row, Col);
+            }
+        }
+
+        return Result;
+    }
+
+    /**
+     * @return Symmetric part of `this`, removing the asymmetry accumulated by rounding
+     */
+    constexpr MatrixN Symmetric(void) const noexcept requires (Rows == Cols)
+    {
+        MatrixN Result{};
+
+        for (size_t Row = 0; Row < Rows; Row++)
+        {
+            for (size_t Col = 0; Col < Cols; Col++)
+            {
+                Result(Row, Col) = 0.5 * ((*this)(Row, Col) + (*this)(Col, Row));
+            }
+        }
+
+        return Result;
+    }
+
+    /**
+     * Cholesky decomposition of a symmetric positive definite matrix
+     * @param Lower Lower triangular matrix L, such that L x L^T is `this`
+     * @return `true` if the matrix is positive definite, otherwise `Lower` is unspecified
+     */
+    constexpr bool Cholesky(MatrixN& Lower) const noexcept requires (Rows == Cols)
+    {
+        Lower = MatrixN{};
+
+        for (size_t Col = 0; Col < Cols; Col++)
+        {
+            double Diagonal = (*this)(Col, Col);
+
+            for (size_t K = 0; K < Col; K++)
+            {
+                Diagonal -= Lower(Col, K) * Lower(Col, K);
+            }
+
+            if ((Diagonal > 0.0) == false)
+            {
+                return false;
+            }
+
+            Lower(Col, Col) = Sqrt(Diagonal);
+
+            for (size_t Row = Col + 1; Row < Rows; Row++)
+            {
+                double Sum = (*this)(Row, Col);
+
+                for (size_t K = 0; K < Col; K++)
+                {
+                    Sum -= Lower(Row, K) * Lower(Col, K);
+                }
+
+                Lower(Row, Col) = Sum / Lower(Col, Col);
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Solves `this` x X = B by Cholesky decomposition, for a symmetric positive definite `this`
+     * @param B Right hand side, of one or more columns
+     * @param X Solution
+     * @return `true` if the matrix is positive definite, otherwise `X` is unspecified
+     */
+    template <size_t K>
+    constexpr bool SolveSymmetric(const MatrixN<Rows, K>& B, MatrixN<Rows, K>& X) const noexcept requires (Rows == Cols)
+    {
+        MatrixN Lower{};
+
+        if (Cholesky(Lower) == false)
+        {
+            return false;
+        }
+
+        // Forward substitution of L x Y = B, then back substitution of L^T x X = Y
+        X = B;
+
+        for (size_t Col = 0; Col < K; Col++)
+        {
+            for (size_t Row = 0; Row < Rows; Row++)
+            {
+                double Sum = X(Row, Col);
+
+                for (size_t I = 0; I < Row; I++)
+                {
+                    Sum -= Lower(Row, I) * X(I, Col);
+                }
+
+                X(Row, Col) = Sum / Lower(Row, Row);
+            }
+
+            for (size_t Row = Rows; Row-- > 0;)
+            {
+                double Sum = X(Row, Col);
+
+                for (size_t I = Row + 1; I < Rows; I++)
+                {
+                    Sum -= Lower(I, Row) * X(I, Col);
+                }
+
+                X(Row, Col) = Sum / Lower(Row, Row);
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @param Row Index of the row
+     * @param Col Index of the column
+     * @return Matrix of `BlockRows` x `BlockCols` elements of `this`, from the row and column
+     */
+    template <size_t BlockRows, size_t BlockCols>
+    constexpr MatrixN<BlockRows, BlockCols> Block(size_t Row, size_t Col) const noexcept
+    {
+        MatrixN<BlockRows, BlockCols> Result{};
+
+        for (size_t I = 0; I < BlockRows; I++)
+        {
+            for (size_t J = 0; J < BlockCols; J++)
+            {
+                Result(I, J) = (*this)(Row + I, Col + J);
+            }
+        }
+
+        return Result;
+    }
+
+    /**
+     * Sets the elements of a block of `this`
+     * @param Row Index of the row
+     * @param Col Index of the column
+     * @param Value Elements of the block
+     */
+    template <size_t BlockRows, size_t BlockCols>
+    constexpr void SetBlock(size_t Row, size_t Col, const MatrixN<BlockRows, BlockCols>& Value) noexcept
+    {
+        for (size_t I = 0; I < BlockRows; I++)
+        {
+            for (size_t J = 0; J < BlockCols; J++)
+            {
+                (*this)(Row + I, Col + J) = Value(I, J);
+            }
+        }
+    }
+
+    //
+    // Matrix Operations
+    //
+
+    /** Multiplication by matrix */
+    template <size_t Other>
+    constexpr MatrixN<Rows, Other> operator*(const MatrixN<Cols, Other>& Mat) const noexcept
+    {
+        MatrixN<Rows, Other> Result{};
+
+        for (size_t Row = 0; Row < Rows; Row++)
+        {
+            for (size_t K = 0; K < Cols; K++)
+            {
+                const double Value = (*this)(Row, K);
+
+                for (size_t Col = 0; Col < Other; Col++)
+                {
+                    Result(Row, Col) += Value * Mat(K, Col);
+                }
+            }
+        }
+
+        return Result;
+    }
+
+    /** Multiplication by scalar */
+    constexpr MatrixN operator*(double A) const noexcept
+    {
+        MatrixN Result{};
+
+        for (size_t Index = 0; Index < Data.size(); Index++)
+        {
+            Result.Data[Index] = A * Data[Index];
+        }
+
+        return Result;
+    }
+
+    /** Division by scalar */
+    constexpr MatrixN operator/(double A) const noexcept
+    {
+        MatrixN Result{};
+
+        for (size_t Index = 0; Index < Data.size(); Index++)
+        {
+            Result.Data[Index] = Data[Index] / A;
+        }
+
+        return Result;
+    }
+
+    /** Addition with matrix */
+    constexpr MatrixN operator+(const MatrixN& Mat) const noexcept
+    {
+        MatrixN Result{};
+
+        for (size_t Index = 0; Index < Data.size(); Index++)
+        {
+            Result.Data[Index] = Data[Index] + Mat.Data[Index];
+        }
+
+        return Result;
+    }
+
+    /** Subtraction with matrix */
+    constexpr MatrixN operator-(const MatrixN& Mat) const noexcept
+    {
+        MatrixN Result{};
+
+        for (size_t Index = 0; Index < Data.size(); Index++)
+        {
+            Result.Data[Index] = Data[Index] - Mat.Data[Index];
+        }
+
+        return Result;
+    }
+
+    /** Negation */
+    constexpr MatrixN operator-(void) const noexcept
+    {
+        return *this * -1.0;
+    }
+
+    /** Equality comparison */
+    constexpr bool operator==(const MatrixN& Mat) const noexcept
+    {
+        return Data == Mat.Data;
+    }
+
+    /** Inequality comparison */
+    constexpr bool operator!=(const MatrixN& Mat) const noexcept
+    {
+        return !(*this == Mat);
+    }
+};
+
+/** Multiplication by scalar on left */
+template <size_t Rows, size_t Cols>
+constexpr MatrixN<Rows, Cols> operator*(double A, const MatrixN<Rows, Cols>& Mat) noexcept
+{
+    return Mat * A;
+}
+
+/**
+ * Column vector of `Size` elements
+ */
+template <size_t Size>
+using VectorN = MatrixN<Size, 1>;
@@ -0,0 +1,264 @@
+#pragma once
+
+#include "utils/errors.hpp"
+#include "utils/hstring.hpp"
+#include "utils/mapped_file.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Plain state of an object, saved and restored as a block of bytes
+ */
+struct SnapshotBlock
+{
+    /// Name of the type owning the state, identifying the layout of the block
+    HString Type{};
+
+    /// Version of the layout, incremented whenever it changes
+    uint32_t Version = 0;
+
+    /// State of the object, trivially copyable and free of pointers
+    std::span<std::byte> Data{};
+};
+
+/**
+ * Layout of the state of a type
+ */
+struct SnapshotSchema
+{
+    /// Name of the type
+    HString Type{};
+
+    /// Version of the layout
+    uint32_t Version = 0;
+
+    /// Size of the state (bytes)
+    uint32_t Bytes = 0;
+};
+
+/**
+ * An object whose complete state is a single plain block, i.e
+ *
+ *  SnapshotBlock GetSnapshotBlock(void) noexcept
+ *  {
+ *      return SnapshotBlock{.Type = "Vehicle", .Version = 1, .Data = std::as_writable_bytes(std::span(&mState, 1))};
+ *  }
+ */
+template <typename T>
+concept Snapshotable = requires(T& Object)
+{
+    {Object.GetSnapshotBlock()} -> std::same_as<SnapshotBlock>;
+};
+
+/**
+ * Read only view of a snapshot file. The file is memory mapped and blocks are viewed in
+ * place, so a block may be inspected without restoring or copying it
+ */
+class SnapshotReader
+{
+public:
+
+    /**
+     * @param Path Path of the file
+     * @throws Error::GenericException if the file cannot be mapped or is not a valid snapshot
+     */
+    explicit SnapshotReader(const std::string& Path);
+
+    /** @return Identifier of the snapshot */
+    uint64_t GetId(void) const noexcept {return mId;}
+
+    /** @return Identifier of the snapshot a delta applies to, zero for a full snapshot */
+    uint64_t GetBase(void) const noexcept {return mBase;}
+
+    /** @return `true` if the snapshot only holds the objects changed since its base */
+    bool IsDelta(void) const noexcept {return mBase != 0;}
+
+    /** @return Number of objects held */
+    size_t Size(void) const noexcept {return mObjects.size();}
+
+    /**
+     * @param Index Index of an object
+     * @return Key of the object
+     */
+    const HString& GetKey(size_t Index) const noexcept {return mObjects[Index].Key;}
+
+    /**
+     * @param Index Index of an object
+     * @return Layout of the state of the object
+     */
+    const SnapshotSchema& GetSchema(size_t Index) const noexcept {return mSchemas[mObjects[Index].Type];}
+
+    /**
+     * @param Index Index of an object
+     * @return State of the object, viewing the mapped file
+     */
+    std::span<const std::byte> GetBlock(size_t Index) const noexcept;
+
+    /**
+     * @param Key Key of an object
+     * @return Index of the object
+     * @throws Error::GenericException if the object is not held
+     */
+    size_t Find(const HString& Key) const;
+
+    /**
+     * Views the state of an object in place
+     * @param Index Index of an object
+     * @return State of the object, valid for the lifetime of the reader
+     * @throws Error::GenericException if the size of the state does not match
+     */
+    template <typename T>
+    const T& View(size_t Index) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshot state must be trivially copyable");
+
+        if ((GetSchema(Index).Bytes != sizeof(T)) || (mObjects[Index].Offset % alignof(T) != 0))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Snapshot block does not match the viewed type");
+        }
+
+        return *reinterpret_cast<const T*>(mFile.Data().data() + mObjects[Index].Offset);
+    }
+
+private:
+
+    /**
+     * Object held by the snapshot
+     */
+    struct Object
+    {
+        HString Key{};
+        uint32_t Type = 0;
+        size_t Offset = 0;
+    };
+
+    MappedFile mFile{};
+    uint64_t mId = 0;
+    uint64_t mBase = 0;
+    std::vector<SnapshotSchema> mSchemas{};
+    std::vector<Object> mObjects{};
+};
+
+/**
+ * Checkpoints and restores the state of a set of registered objects. A full snapshot holds
+ * every object, a delta only the objects whose state changed since the previous snapshot of
+ * the set, and is restored on top of the chain of snapshots it was saved after:
+ *
+ *  SnapshotSet Checkpoint;
+ *  Checkpoint.Register("Orbit", Orbit);
+ *
+ *  Checkpoint.Save("t0.snap");
+ *  Checkpoint.SaveDelta("t1.snap");
+ *  Checkpoint.Restore("t0.snap", {"t1.snap"});
+ *
+ * The file is a header, a schema and object table and then the state blocks, 8 byte aligned
+ * and in native byte order:
+ *
+ *  Header   "HSNP", u32 version, u64 id, u64 base id, u32 types, u32 objects
+ *  Types    per type {u32 version, u32 bytes, u16 name length, name}
+ *  Objects  per object {u32 type, u16 key length, key}
+ *  Blocks   state of each object
+ *
+ * Objects are matched by key on restore, and the type, version and size of each must match
+ * those registered, so a changed layout is rejected rather than misread
+ */
+class SnapshotSet
+{
+public:
+
+    /**
+     * Registers the state block of an object
+     * @param Key Unique key of the object
+     * @param Block State of the object, which must outlive the set
+     * @throws Error::GenericException if the key is already registered or the type is
+     * registered with a different version or size
+     */
+    void Register(const HString& Key, const SnapshotBlock& Block);
+
+    /**
+     * Registers an object
+     * @param Key Unique key of the object
+     * @param Object Object, which must outlive the set
+     * @throws Error::GenericException if the key is already registered or the type is
+     * registered with a different version or size
+     */
+    template <Snapshotable T>
+    void Register(const HString& Key, T& Object) {Register(Key, Object.GetSnapshotBlock());}
+
+    /** @return Number of registered objects */
+    size_t Size(void) const noexcept {return mObjects.size();}
+
+    /**
+     * Saves the state of every object
+     * @param Path Path of the file to write
+     * @return Identifier of the snapshot
+     * @throws Error::GenericException if the file cannot be written
+     */
+    uint64_t Save(const std::string& Path);
+
+    /**
+     * Saves the state of every object changed since the previous snapshot saved or restored
+     * @param Path Path of the file to write
+     * @return Identifier of the snapshot
+     * @throws Error::GenericException if no previous snapshot exists or the file cannot be written
+     */
+    uint64_t SaveDelta(const std::string& Path);
+
+    /**
+     * Restores the state of every object from a full snapshot followed by deltas
+     * @param Path Path of the full snapshot
+     * @param Deltas Path of each delta applied after the full snapshot, in the order saved
+     * @throws Error::GenericException if a snapshot is invalid, the deltas do not follow in
+     * sequence, the full snapshot does not hold every object exactly once or a schema does not
+     * match. The whole chain is validated before any state is restored, so a failed restore
+     * leaves every object unchanged
+     */
+    void Restore(const std::string& Path, const std::vector<std::string>& Deltas = {});
+
+    /** @return Identifier of the previous snapshot saved or restored, zero if none */
+    uint64_t GetId(void) const noexcept {return mId;}
+
+private:
+
+    /**
+     * Registered object
+     */
+    struct Registration
+    {
+        HString Key{};
+        uint32_t Type = 0;
+        std::span<std::byte> Data{};
+
+        // Offset of the state within the shadow
+        size_t Shadow = 0;
+    };
+
+    /** Writes the objects, all or those changed */
+    uint64_t Write(const std::string& Path, bool Delta);
+
+    /**
+     * Matches the objects of a snapshot to the registered objects, validating their schemas
+     * @return Registered object of each held object
+     * @throws Error::GenericException if an object is unregistered, held more than once or of
+     * a different schema
+     */
+    std::vector<size_t> Match(const SnapshotReader& Snapshot) const;
+
+    /** Restores the objects of a validated snapshot */
+    void Apply(const SnapshotReader& Snapshot, std::span<const size_t> Targets) noexcept;
+
+    std::vector<SnapshotSchema> mTypes{};
+    std::vector<Registration> mObjects{};
+    std::map<HString, size_t> mKeys{};
+
+    // State of every object when last saved or restored, from which deltas are found
+    std::vector<std::byte> mShadow{};
+    uint64_t mId = 0;
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "math/constants.hpp"
+#include "mission/manoeuvre.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+class ThreadPool;
+
+namespace Mission
+{
+    /**
+     * Launch site on the WGS84 ellipsoid
+     */
+    struct LaunchSite
+    {
+        /// Geodetic latitude (rad)
+        double Latitude = 0.0;
+
+        /// Longitude (rad)
+        double Longitude = 0.0;
+
+        /// Altitude above the ellipsoid (m)
+        double Altitude = 0.0;
+    };
+
+    /**
+     * Circular target orbit. The node is the right ascension of the ascending node in the
+     * inertial frame aligned with the Earth fixed frame at time zero (as `Earth::ECI2ECEF`)
+     */
+    struct TargetOrbit
+    {
+        /// Inclination (rad)
+        double Inclination = 0.0;
+
+        /// Right ascension of the ascending node at time zero (rad)
+        double Node = 0.0;
+
+        /// Altitude above the equatorial radius (m)
+        double Altitude = 0.0;
+    };
+
+    /**
+     * Launch window search input parameters
+     */
+    struct LaunchWindowSettings
+    {
+        /// Start of the search, seconds from time zero (s)
+        double Start = 0.0;
+
+        /// Duration of the search (s)
+        double Duration = 86400.0;
+
+        /// Largest angle of the site from the target plane at which a launch is acceptable, a
+        /// yaw steering allowance defining the width of each window (rad)
+        double PlaneTolerance = 0.0;
+
+        /// `true` to regress the node of the target by the secular rate of the Earth's J2
+        bool NodalRegression = true;
+
+        /// Pass of the site through the target plane accepted
+        bool Ascending = true;
+        bool Descending = true;
+    };
+
+    /**
+     * A launch opportunity, the site passing through the target plane
+     */
+    struct LaunchOpportunity
+    {
+        /// Time at which the site lies in the target plane, seconds from time zero (s)
+        double Time = 0.0;
+
+        /// Opening and closing of the window, where the site lies within the plane tolerance (s)
+        double Open = 0.0;
+        double Close = 0.0;
+
+        /// True azimuth of the launch, from north towards east (rad)
+        double Azimuth = 0.0;
+
+        /// Velocity to be supplied by the vehicle, the orbital velocity less that of the site (m/s)
+        double DeltaV = 0.0;
+
+        LaunchPass Pass = LaunchPass::ASCENDING;
+    };
+
+    /**
+     * Launch opportunities of a site and target over the search
+     */
+    struct LaunchWindowResult
+    {
+        LaunchStatus Status = LaunchStatus::SUCCESS;
+
+        /// Number of opportunities found, which may exceed those stored
+        size_t Count = 0;
+    };
+
+    /**
+     * Finds the times at which a launch site passes through the plane of a target orbit. The
+     * site is carried into the inertial frame by `Earth::ECI2ECEF`, after which its right
+     * ascension and that of the (regressing) node advance linearly, so each crossing is solved
+     * in closed form. The window about each crossing is to first order in the tolerance.
+     * A site just reaching the plane crosses it once per revolution, the passes merged into
+     * a single ascending opportunity, and a site within the tolerance throughout (such as an
+     * equatorial site and target) has a single opportunity spanning the search
+     * @param Site Launch site
+     * @param Target Target orbit
+     * @param Settings Search interval and tolerance
+     * @param Opportunities Opportunities in time order, as many as fit
+     * @return Status and number of opportunities in the search interval
+     */
+    LaunchWindowResult FindLaunchOpportunities(const LaunchSite& Site, const TargetOrbit& Target, const LaunchWindowSettings& Settings,
+        std::span<LaunchOpportunity> Opportunities) noexcept;
+
+    /**
+     * Dense grid of launch sites, target inclinations and target nodes, at a common altitude
+     */
+    struct LaunchGrid
+    {
+        std::span<const LaunchSite> Sites{};
+        std::span<const double> Inclinations{};
+        std::span<const double> Nodes{};
+
+        /// Altitude of every target orbit (m)
+        double Altitude = 0.0;
+
+        /** @return Number of cells of the grid */
+        size_t Size(void) const noexcept {return Sites.size() * Inclinations.size() * Nodes.size();}
+
+        /** @return Index of the cell of a site, inclination and node, the node varying fastest */
+        size_t Index(size_t Site, size_t Inclination, size_t Node) const noexcept
+        {
+            return (Site * Inclinations.size() + Inclination) * Nodes.size() + Node;
+        }
+    };
+
+    /**
+     * First launch opportunity of a cell of a grid
+     */
+    struct LaunchCell
+    {
+        LaunchStatus Status = LaunchStatus::SUCCESS;
+
+        /// Number of opportunities in the search interval, zero if none
+        uint32_t Count = 0;
+
+        /// Earliest opportunity, valid if `Count` is non zero
+        LaunchOpportunity First{};
+    };
+
+    /**
+     * Evaluates the first launch opportunity of every cell of a grid in parallel. The site
+     * geometry and launch velocity of each site and inclination are computed once and shared
+     * by the nodes of the row
+     * @param Pool Threads evaluating the grid
+     * @param Grid Sites, inclinations and nodes
+     * @param Settings Search interval and tolerance
+     * @param Cells Result of each cell, of `Grid.Size()` in the order of `Grid.Index`
+     */
+    void EvaluateLaunchGrid(ThreadPool& Pool, const LaunchGrid& Grid, const LaunchWindowSettings& Settings, std::span<LaunchCell> Cells) noexcept;
+}
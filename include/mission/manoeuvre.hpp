@@ -2,45 +2,64 @@
 
 #include "math/core_math.hpp"
 
-// 
-// HACK HACK HACK!: This code does not meet quality standards and needs review
-//
+/**
+ * Outcome of a launch to inclination/velocity manoeuvre
+ */
+enum class LaunchStatus
+{
+    SUCCESS,                    // Azimuth and velocity components computed
+    INCLINATION_UNREACHABLE     // The site latitude exceeds the inclination (or its supplement) of the target
+};
+
+/**
+ * Pass of the launch site through the target orbit plane
+ */
+enum class LaunchPass
+{
+    ASCENDING,  // Launch northwards, the site passing the plane on the ascending half of the orbit
+    DESCENDING  // Launch southwards, the site passing the plane on the descending half of the orbit
+};
 
 /// Output of a launch to inclination/velocity maneouvre
 struct LaunchVelocityResult
 { 
-    double Vx = 0.0;              // X component of delta v required (m/s)
-    double Vy = 0.0;              // Y component of delta v required (m/s)
-    double AzimuthInertial = 0.0; // Azimith to launch to if the source body was not rotating
+    double Vx = 0.0;              // East component of delta v required (m/s)
+    double Vy = 0.0;              // North component of delta v required (m/s)
+    double AzimuthInertial = 0.0; // Azimuth to launch to if the source body was not rotating (rad)
     double Azimuth = 0.0;         // True Azimuth to launch to (rad)
+    LaunchStatus Status = LaunchStatus::SUCCESS;
 };
 
 /// Inputs to a launch to inclination/velocity maneouvre
 struct LaunchVelocityInputs
 {
     double TargetInclination = 0.0;  // Required orbital inclination (rad)
-    double SiteLatitude = 0.0;       // Launch site latitude (rad)
-    double OrbitalVelocity = 0.0;    // Required orbital velocity (rad)
-    double SiteVelocity = 0.0;       // Linear velocity due to body rotation at the launch site (m/s)
+    double SiteLatitude = 0.0;       // Launch site geocentric latitude (rad)
+    double OrbitalVelocity = 0.0;    // Required orbital velocity (m/s)
+    double SiteVelocity = 0.0;       // Eastward linear velocity due to body rotation at the launch site (m/s)
+    LaunchPass Pass = LaunchPass::ASCENDING;
 }; 
 
 /**
- * Rough calculation of some basic launch parameters to acehive a given (circular) orbital
- * velocity and inclination from a launch site latitude and velocty
+ * Basic launch parameters to achieve a given (circular) orbital velocity and inclination from
+ * a launch site latitude and velocity, neglecting gravity and drag losses
+ * @param Inputs Target orbit and launch site
+ * @return Azimuth and velocity components, or `LaunchStatus::INCLINATION_UNREACHABLE` if
+ * the plane of the target does not pass over the site
  */
-constexpr LaunchVelocityResult LaunchVelocityComponents(const LaunchVelocityInputs& Inputs)
+constexpr LaunchVelocityResult LaunchVelocityComponents(const LaunchVelocityInputs& Inputs) noexcept
 {
     LaunchVelocityResult Result;
 
-    if (Inputs.SiteLatitude > Inputs.TargetInclination)
+    const auto CosLatitude = Cos(Inputs.SiteLatitude);
+    const auto CosInclination = Cos(Inputs.TargetInclination);
+
+    if (Abs(CosInclination) > CosLatitude)
     {
-        printf("Cannot acheive desired inclination %g, from launch site at latitude %g in a single manoeuvre\n",
-            R2D(Inputs.TargetInclination), R2D(Inputs.SiteLatitude));
+        Result.Status = LaunchStatus::INCLINATION_UNREACHABLE;
         return Result;
     }
 
-    const auto CosLatitude = Cos(Inputs.SiteLatitude);
-
     // We are at the north or south pole, the concept of azimuth breaks down here    
     if (CosLatitude == 0)
     {
@@ -48,10 +67,15 @@ constexpr LaunchVelocityResult LaunchVelocityComponents(const LaunchVelocityInpu
     }
     else
     {
-        Result.AzimuthInertial = Asin(Cos(Inputs.TargetInclination) / CosLatitude);
+        Result.AzimuthInertial = Asin(Clamp(CosInclination / CosLatitude, -1.0, 1.0));
+    }
+
+    if (Inputs.Pass == LaunchPass::DESCENDING)
+    {
+        Result.AzimuthInertial = PI - Result.AzimuthInertial;
     }
 
-    Result.Vx = Inputs.OrbitalVelocity * Sin(Result.AzimuthInertial) - Inputs.SiteVelocity * CosLatitude;
+    Result.Vx = Inputs.OrbitalVelocity * Sin(Result.AzimuthInertial) - Inputs.SiteVelocity;
     Result.Vy = Inputs.OrbitalVelocity * Cos(Result.AzimuthInertial);
     Result.Azimuth = Atan2(Result.Vx, Result.Vy);
 
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "math/vector3.hpp"
+#include "twobody/orbit.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+class ThreadPool;
+
+namespace Mission
+{
+    /// Largest number of impulses of a transfer
+    constexpr size_t MAX_IMPULSES = 4;
+
+    /**
+     * Instantaneous change of velocity, applied where the velocity is horizontal
+     */
+    struct Impulse
+    {
+        /// Time of the impulse from the start of the transfer (s)
+        double Time = 0.0;
+
+        /// Change of velocity in the local frame before the impulse: radial, along track and
+        /// along the angular momentum, as `TwoBody::LVLHFrame` (m/s)
+        Vector3 DeltaV = Vector3::ZERO();
+
+        /// Rotation of the orbit plane by the impulse (rad)
+        double PlaneChange = 0.0;
+    };
+
+    /**
+     * Sequence of impulses of a transfer
+     */
+    struct TransferPlan
+    {
+        std::array<Impulse, MAX_IMPULSES> Impulses{};
+        size_t Count = 0;
+
+        /// Sum of the magnitudes of the impulses (m/s)
+        double DeltaV = 0.0;
+
+        /// Time from the start of the transfer to the last impulse (s)
+        double Duration = 0.0;
+    };
+
+    /**
+     * Hohmann transfer between circular orbits, with a combined plane change split between the
+     * two impulses to minimise the total delta v
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Algorithms 36 and 42
+     * @param InitialRadius Radius of the initial orbit (m)
+     * @param FinalRadius Radius of the final orbit (m)
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param PlaneChange Angle between the initial and final planes, at the line of nodes of which
+     * the impulses are applied (rad)
+     * @return Impulses at the initial and final radius
+     */
+    TransferPlan Hohmann(double InitialRadius, double FinalRadius, double GravitationalParameter, double PlaneChange = 0.0) noexcept;
+
+    /**
+     * Bi-elliptic transfer between circular orbits through an intermediate apoapsis, with a
+     * combined plane change split between the three impulses to minimise the total delta v
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Algorithm 37
+     * @param InitialRadius Radius of the initial orbit (m)
+     * @param FinalRadius Radius of the final orbit (m)
+     * @param IntermediateRadius Apoapsis common to both transfer ellipses (m)
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param PlaneChange Angle between the initial and final planes (rad)
+     * @return Impulses at the initial, intermediate and final radius
+     */
+    TransferPlan BiElliptic(double InitialRadius, double FinalRadius, double IntermediateRadius, double GravitationalParameter,
+        double PlaneChange = 0.0) noexcept;
+
+    /**
+     * Phasing manoeuvre of a chaser in the circular orbit of its target, entering an orbit whose
+     * period returns the chaser to its starting point as the target arrives
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Algorithm 44
+     * @param Radius Radius of the common orbit (m)
+     * @param PhaseAngle Angle by which the target leads the chaser, negative if it trails (rad)
+     * @param Revolutions Revolutions of the chaser in the phasing orbit
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @return Impulses entering and leaving the phasing orbit, none if no phasing orbit of the
+     * revolutions passes through the common orbit
+     */
+    TransferPlan Phasing(double Radius, double PhaseAngle, uint32_t Revolutions, double GravitationalParameter) noexcept;
+
+    /**
+     * @return Angle between the orbit planes of two sets of elements (rad)
+     */
+    double PlaneAngle(const TwoBody::KeplerianElements& Initial, const TwoBody::KeplerianElements& Final) noexcept;
+
+    /**
+     * Hohmann transfer between near circular orbits at their semi-major axes, with the optimal
+     * combined plane change between them
+     */
+    TransferPlan Hohmann(const TwoBody::KeplerianElements& Initial, const TwoBody::KeplerianElements& Final) noexcept;
+
+    /**
+     * Bi-elliptic transfer between near circular orbits at their semi-major axes, with the
+     * optimal combined plane change between them
+     */
+    TransferPlan BiElliptic(const TwoBody::KeplerianElements& Initial, const TwoBody::KeplerianElements& Final, double IntermediateRadius) noexcept;
+
+    /**
+     * Shape of the transfer of a rendezvous
+     */
+    enum class TransferKind
+    {
+        HOHMANN,    // Two impulses through a single ellipse
+        BI_ELLIPTIC // Three impulses through two ellipses of a common apoapsis
+    };
+
+    /**
+     * Outcome of a rendezvous plan
+     */
+    enum class RendezvousStatus
+    {
+        SUCCESS,    // Least delta v plan satisfying the constraints
+        INFEASIBLE  // No candidate satisfied the constraints
+    };
+
+    /**
+     * Rendezvous planner input parameters
+     */
+    struct RendezvousSettings
+    {
+        /// Longest time from the start to the rendezvous (s)
+        double MaxDuration = 5.0 * 86400.0;
+
+        /// Lowest periapsis of any transfer or phasing orbit (m)
+        double MinRadius = 6578.137E3;
+
+        /// Highest apoapsis of any transfer or phasing orbit (m)
+        double MaxRadius = 1.0E8;
+
+        /// Crossings of the line of nodes considered for departure
+        uint32_t Departures = 8;
+
+        /// Most revolutions of the phasing orbit considered
+        uint32_t Revolutions = 16;
+
+        /// Starts of the intermediate radius of bi-elliptic transfers, spaced logarithmically up
+        /// to `MaxRadius`, zero to only consider Hohmann transfers
+        uint32_t Starts = 4;
+
+        /// Golden section iterations refining the intermediate radius about each start
+        uint32_t Iterations = 20;
+    };
+
+    /**
+     * Least delta v rendezvous of a chaser with a target
+     */
+    struct RendezvousPlan
+    {
+        RendezvousStatus Status = RendezvousStatus::INFEASIBLE;
+        TransferKind Kind = TransferKind::HOHMANN;
+
+        /// Impulses from the start, the last completing the rendezvous
+        TransferPlan Transfer{};
+
+        /// Wait before the first impulse (s)
+        double Wait = 0.0;
+
+        /// Apoapsis of a bi-elliptic transfer (m)
+        double IntermediateRadius = 0.0;
+
+        /// Revolutions of the phasing orbit, zero if the transfer arrives at the target
+        uint32_t Revolutions = 0;
+    };
+
+    /**
+     * Plans the least delta v rendezvous of a chaser with a target, each treated as circular at
+     * its semi-major axis. The chaser departs at a crossing of the line of nodes of the two
+     * planes, making the plane change with the impulses of a Hohmann or bi-elliptic transfer,
+     * then enters a phasing orbit to meet the target, the last impulse of the transfer merged
+     * with the entry to the phasing orbit and the plane change split against the merged
+     * impulse. Every departure, phasing revolution and start of the intermediate radius is
+     * evaluated, the intermediate radius refined by golden sections
+     * @param Chaser Orbit of the chaser at the start
+     * @param Target Orbit of the target at the start
+     * @param Settings Constraints and search
+     * @return Least delta v plan, or `RendezvousStatus::INFEASIBLE`
+     */
+    RendezvousPlan PlanRendezvous(const TwoBody::Orbit& Chaser, const TwoBody::Orbit& Target, const RendezvousSettings& Settings = {}) noexcept;
+
+    /**
+     * Plans the rendezvous of a chaser with each of many targets, such as the slots of a
+     * constellation, evaluating the starts of every target in parallel. Identical to
+     * `PlanRendezvous` of each target for any number of threads
+     * @param Pool Threads evaluating the starts
+     * @param Chaser Orbit of the chaser at the start
+     * @param Targets Orbit of each target at the start
+     * @param Settings Constraints and search
+     * @param Plans Plan of each target, of the size of `Targets`
+     * @throws Error::HArraySizeMismatch if the number of plans does not match the number of targets
+     */
+    void PlanRendezvous(ThreadPool& Pool, const TwoBody::Orbit& Chaser, std::span<const TwoBody::Orbit> Targets, const RendezvousSettings& Settings,
+        std::span<RendezvousPlan> Plans);
+}
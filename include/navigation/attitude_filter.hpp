@@ -0,0 +1,100 @@
+#pragma once
+
+#include "math/matrixn.hpp"
+#include "math/quaternion.hpp"
+#include "math/vector3.hpp"
+#include "navigation/kalman.hpp"
+
+namespace Navigation
+{
+    /**
+     * Noise of a rate integrating gyro
+     */
+    struct GyroNoise
+    {
+        /// Angle random walk, noise density of the rate (rad/s/sqrt(Hz))
+        double AngleRandomWalk = 1.0E-5;
+
+        /// Rate random walk, noise density of the bias (rad/s2/sqrt(Hz))
+        double RateRandomWalk = 1.0E-8;
+    };
+
+    /**
+     * Multiplicative extended Kalman filter of attitude and gyro bias. The attitude is held
+     * as a unit quaternion, transforming inertial co-ordinates into body co-ordinates, while
+     * the filter estimates a three element attitude error about it together with the bias
+     * error. Each update folds the error into the quaternion and bias and resets it to zero,
+     * such that the quaternion never leaves the unit sphere:
+     *
+     *  AttitudeFilter Filter(Initial, Bias, Covariance, Noise);
+     *  Filter.Predict(Gyro, Step);
+     *  Filter.UpdateVector(SunInertial, SunBody, SunSensorNoise);
+     */
+    class AttitudeFilter
+    {
+    public:
+
+        /// Attitude error (rad) followed by bias error (rad/s)
+        using ErrorCovariance = MatrixN<6, 6>;
+
+        /**
+         * @param Attitude Initial inertial to body transformation
+         * @param Bias Initial gyro bias (rad/s)
+         * @param Covariance Initial covariance of the attitude and bias errors
+         * @param Noise Gyro noise
+         * @throws Error::GenericException if the covariance is not positive definite
+         */
+        AttitudeFilter(const Quaternion& Attitude, const Vector3& Bias, const ErrorCovariance& Covariance, const GyroNoise& Noise);
+
+        /** @return Estimated inertial to body transformation */
+        const Quaternion& GetAttitude(void) const noexcept {return mAttitude;}
+
+        /** @return Estimated gyro bias (rad/s) */
+        const Vector3& GetBias(void) const noexcept {return mBias;}
+
+        /** @return Covariance of the attitude and bias errors */
+        ErrorCovariance GetCovariance(void) const noexcept {return mFilter.GetCovariance();}
+
+        /**
+         * Propagates the attitude with a gyro measurement, held constant over the step
+         * @param Rate Measured angular velocity of the body in the body frame (rad/s)
+         * @param Step Time step (s)
+         */
+        void Predict(const Vector3& Rate, double Step) noexcept;
+
+        /**
+         * Updates with a direction measured in the body frame, i.e from a sun sensor,
+         * magnetometer or star tracker boresight
+         * @param Reference Known direction in the inertial frame, unit
+         * @param Measured Measured direction in the body frame, unit
+         * @param Sigma Standard deviation of each component of the measured direction
+         * @param Gate Rejection threshold of the squared Mahalanobis distance of the innovation
+         * @return Outcome of the update
+         */
+        UpdateStatus UpdateVector(const Vector3& Reference, const Vector3& Measured, double Sigma,
+            double Gate = Infinity<double>()) noexcept;
+
+        /**
+         * Updates with a measured attitude, i.e from a star tracker
+         * @param Measured Measured inertial to body transformation
+         * @param Sigma Standard deviation of each axis of the measured attitude (rad)
+         * @param Gate Rejection threshold of the squared Mahalanobis distance of the innovation
+         * @return Outcome of the update
+         */
+        UpdateStatus UpdateAttitude(const Quaternion& Measured, double Sigma, double Gate = Infinity<double>()) noexcept;
+
+    private:
+
+        /**
+         * Folds the estimated error into the attitude and bias, and zeroes it
+         */
+        void Reset(void) noexcept;
+
+        Quaternion mAttitude = Quaternion::IDENTITY();
+        Vector3 mBias = Vector3::ZERO();
+        GyroNoise mNoise{};
+
+        // Filter of the attitude and bias errors, zero between updates
+        ExtendedKalmanFilter<6> mFilter;
+    };
+}
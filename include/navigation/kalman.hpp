@@ -0,0 +1,507 @@
+#pragma once
+
+#include "math/core_math.hpp"
+#include "math/matrixn.hpp"
+#include "numerics/unscented.hpp"
+#include "utils/errors.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace Navigation
+{
+    /**
+     * Representation and update of the covariance of an extended Kalman filter
+     */
+    enum class CovarianceForm
+    {
+        JOSEPH,         // Full covariance, updated in the Joseph form which preserves symmetry and positive definiteness
+        SQUARE_ROOT     // Square root of the covariance, updated by Potter's method and re-triangularised by Householder QR
+    };
+
+    /**
+     * Outcome of a measurement update
+     */
+    enum class UpdateStatus
+    {
+        ACCEPTED,           // Measurement applied
+        GATED,              // Innovation beyond the gate, measurement rejected
+        ILL_CONDITIONED     // Innovation covariance not positive definite, measurement rejected
+    };
+
+    /**
+     * Process model of an extended Kalman filter, returning the propagated state and setting
+     * the Jacobian of the propagated state with respect to the state
+     */
+    template <typename T, size_t N>
+    concept LinearisedProcess = requires(T& Model, const VectorN<N>& State, MatrixN<N, N>& Jacobian)
+    {
+        {Model(State, Jacobian)} -> std::convertible_to<VectorN<N>>;
+    };
+
+    /**
+     * Measurement model of an extended Kalman filter, returning the predicted measurement and
+     * setting the Jacobian of the measurement with respect to the state
+     */
+    template <typename T, size_t N, size_t M>
+    concept LinearisedMeasurement = requires(T& Model, const VectorN<N>& State, MatrixN<M, N>& Jacobian)
+    {
+        {Model(State, Jacobian)} -> std::convertible_to<VectorN<M>>;
+    };
+
+    /**
+     * Nonlinear model of an unscented Kalman filter, mapping a state of `N` elements to `M`
+     */
+    template <typename T, size_t N, size_t M>
+    concept NonlinearModel = requires(T& Model, const VectorN<N>& State)
+    {
+        {Model(State)} -> std::convertible_to<VectorN<M>>;
+    };
+
+    /**
+     * Extended Kalman filter of a state of `N` elements. Storage is fixed at compile time, so
+     * neither prediction nor update allocates, and both execute in bounded time. Models are
+     * any callable, i.e a lambda capturing the step or sensor geometry:
+     *
+     *  ExtendedKalmanFilter<6> Filter(State, Covariance);
+     *  Filter.Predict([Step](const VectorN<6>& X, MatrixN<6, 6>& F) {...}, ProcessNoise);
+     *  Filter.Update(Range, RangeNoise, [&Station](const VectorN<6>& X, MatrixN<1, 6>& H) {...});
+     *
+     * @tparam N Number of state elements
+     * @tparam Form Representation of the covariance
+     */
+    template <size_t N, CovarianceForm Form = CovarianceForm::JOSEPH>
+    class ExtendedKalmanFilter
+    {
+    public:
+
+        /**
+         * @param State Initial state
+         * @param Covariance Initial covariance
+         * @throws Error::GenericException if the covariance is not positive definite
+         */
+        ExtendedKalmanFilter(const VectorN<N>& State, const MatrixN<N, N>& Covariance) : mState(State), mCovariance(Covariance)
+        {
+            MatrixN<N, N> Lower{};
+
+            if (Covariance.Cholesky(Lower) == false)
+            {
+                throw Error::GenericException(__FILE__, __LINE__, "Covariance is not positive definite");
+            }
+
+            if constexpr (Form == CovarianceForm::SQUARE_ROOT)
+            {
+                mCovariance = Lower;
+            }
+        }
+
+        /** @return Estimated state */
+        const VectorN<N>& GetState(void) const noexcept {return mState;}
+
+        /**
+         * Replaces the estimated state, retaining the covariance
+         * @param State Estimated state
+         */
+        void SetState(const VectorN<N>& State) noexcept {mState = State;}
+
+        /** @return Covariance of the estimated state */
+        MatrixN<N, N> GetCovariance(void) const noexcept
+        {
+            if constexpr (Form == CovarianceForm::SQUARE_ROOT)
+            {
+                return mCovariance * mCovariance.Transpose();
+            }
+            else
+            {
+                return mCovariance;
+            }
+        }
+
+        /**
+         * Propagates the state and covariance
+         * @param Process Process model, taking the state and the Jacobian to set
+         * @param ProcessNoise Covariance of the noise added over the step, positive semi definite
+         */
+        template <LinearisedProcess<N> Model>
+        void Predict(Model&& Process, const MatrixN<N, N>& ProcessNoise) noexcept
+        {
+            MatrixN<N, N> Jacobian = MatrixN<N, N>::IDENTITY();
+            mState = Process(static_cast<const VectorN<N>&>(mState), Jacobian);
+
+            if constexpr (Form == CovarianceForm::SQUARE_ROOT)
+            {
+                // Square root of [F S, Q^1/2] x [F S, Q^1/2]^T
+                MatrixN<2 * N, N> Compound{};
+                Compound.SetBlock(0, 0, (Jacobian * mCovariance).Transpose());
+                Compound.SetBlock(N, 0, SemiDefiniteRoot(ProcessNoise).Transpose());
+                mCovariance = Triangularise(Compound);
+            }
+            else
+            {
+                mCovariance = (Jacobian * mCovariance * Jacobian.Transpose() + ProcessNoise).Symmetric();
+            }
+        }
+
+        /**
+         * Updates the state and covariance with a measurement
+         * @param Measurement Measurement of `M` elements
+         * @param MeasurementNoise Covariance of the measurement, positive definite
+         * @param Measure Measurement model, taking the state and the Jacobian to set
+         * @param Gate Rejection threshold of the squared Mahalanobis distance of the innovation,
+         * i.e a chi squared quantile of `M` degrees of freedom
+         * @return Outcome of the update, the state and covariance are unchanged if rejected
+         */
+        template <size_t M, LinearisedMeasurement<N, M> Model>
+        UpdateStatus Update(const VectorN<M>& Measurement, const MatrixN<M, M>& MeasurementNoise, Model&& Measure,
+            double Gate = Infinity<double>()) noexcept
+        {
+            MatrixN<M, N> Jacobian{};
+            const VectorN<M> Innovation = Measurement - Measure(static_cast<const VectorN<N>&>(mState), Jacobian);
+
+            const MatrixN<N, N> Covariance = GetCovariance();
+            const MatrixN<M, N> HP = Jacobian * Covariance;
+            const MatrixN<M, M> InnovationCovariance = (HP * Jacobian.Transpose() + MeasurementNoise).Symmetric();
+
+            // Gain K = P H^T S^-1, from S K^T = H P
+            MatrixN<M, N> GainTranspose{};
+
+            if (InnovationCovariance.SolveSymmetric(HP, GainTranspose) == false)
+            {
+                return UpdateStatus::ILL_CONDITIONED;
+            }
+
+            if (Gate < Infinity<double>())
+            {
+                VectorN<M> Weighted{};
+                InnovationCovariance.SolveSymmetric(Innovation, Weighted);
+
+                if ((Innovation.Transpose() * Weighted)[0] > Gate)
+                {
+                    return UpdateStatus::GATED;
+                }
+            }
+
+            if constexpr (Form == CovarianceForm::SQUARE_ROOT)
+            {
+                return SequentialUpdate(Innovation, Jacobian, MeasurementNoise);
+            }
+            else
+            {
+                const MatrixN<N, M> Gain = GainTranspose.Transpose();
+                const MatrixN<N, N> Reduction = MatrixN<N, N>::IDENTITY() - Gain * Jacobian;
+
+                mState = mState + Gain * Innovation;
+                mCovariance = (Reduction * mCovariance * Reduction.Transpose() + Gain * MeasurementNoise * GainTranspose).Symmetric();
+                return UpdateStatus::ACCEPTED;
+            }
+        }
+
+    private:
+
+        /**
+         * Potter's square root update, applying decorrelated measurements one element at a time
+         */
+        template <size_t M>
+        UpdateStatus SequentialUpdate(const VectorN<M>& Innovation, const MatrixN<M, N>& Jacobian, const MatrixN<M, M>& MeasurementNoise) noexcept
+        {
+            MatrixN<M, M> NoiseRoot{};
+
+            if (MeasurementNoise.Cholesky(NoiseRoot) == false)
+            {
+                return UpdateStatus::ILL_CONDITIONED;
+            }
+
+            // Whitened innovation and Jacobian, L^-1 y and L^-1 H, of unit measurement noise
+            VectorN<M> Residual = Innovation;
+            MatrixN<M, N> Whitened = Jacobian;
+
+            for (size_t Row = 0; Row < M; Row++)
+            {
+                for (size_t I = 0; I < Row; I++)
+                {
+                    Residual[Row] -= NoiseRoot(Row, I) * Residual[I];
+
+                    for (size_t Col = 0; Col < N; Col++)
+                    {
+                        Whitened(Row, Col) -= NoiseRoot(Row, I) * Whitened(I, Col);
+                    }
+                }
+
+                Residual[Row] /= NoiseRoot(Row, Row);
+
+                for (size_t Col = 0; Col < N; Col++)
+                {
+                    Whitened(Row, Col) /= NoiseRoot(Row, Row);
+                }
+            }
+
+            VectorN<N> Correction{};
+
+            for (size_t Row = 0; Row < M; Row++)
+            {
+                const MatrixN<1, N> H = Whitened.template Block<1, N>(Row, 0);
+                const VectorN<N> Phi = (H * mCovariance).Transpose();
+                const double Alpha = 1.0 / ((Phi.Transpose() * Phi)[0] + 1.0);
+                const double Gamma = 1.0 / (1.0 + Sqrt(Alpha));
+                const VectorN<N> Gain = Alpha * (mCovariance * Phi);
+
+                // Residual of this element after the corrections of the previous elements
+                Correction = Correction + Gain * (Residual[Row] - (H * Correction)[0]);
+                mCovariance = mCovariance - Gamma * (Gain * Phi.Transpose());
+            }
+
+            mState = mState + Correction;
+            return UpdateStatus::ACCEPTED;
+        }
+
+        /**
+         * @param Covariance Positive semi definite matrix
+         * @return Lower triangular square root, with zero columns for zero variances
+         */
+        static MatrixN<N, N> SemiDefiniteRoot(const MatrixN<N, N>& Covariance) noexcept
+        {
+            MatrixN<N, N> Lower{};
+
+            for (size_t Col = 0; Col < N; Col++)
+            {
+                double Diagonal = Covariance(Col, Col);
+
+                for (size_t K = 0; K < Col; K++)
+                {
+                    Diagonal -= Lower(Col, K) * Lower(Col, K);
+                }
+
+                if (Diagonal <= 0.0)
+                {
+                    continue;
+                }
+
+                Lower(Col, Col) = Sqrt(Diagonal);
+
+                for (size_t Row = Col + 1; Row < N; Row++)
+                {
+                    double Sum = Covariance(Row, Col);
+
+                    for (size_t K = 0; K < Col; K++)
+                    {
+                        Sum -= Lower(Row, K) * Lower(Col, K);
+                    }
+
+                    Lower(Row, Col) = Sum / Lower(Col, Col);
+                }
+            }
+
+            return Lower;
+        }
+
+        /**
+         * Householder QR of a compound matrix A, where A^T A = S S^T
+         * @return Lower triangular square root S, the transpose of R
+         */
+        static MatrixN<N, N> Triangularise(MatrixN<2 * N, N> A) noexcept
+        {
+            for (size_t Col = 0; Col < N; Col++)
+            {
+                double Norm = 0.0;
+
+                for (size_t Row = Col; Row < 2 * N; Row++)
+                {
+                    Norm += Square(A(Row, Col));
+                }
+
+                Norm = Sqrt(Norm);
+
+                if (Norm == 0.0)
+                {
+                    continue;
+                }
+
+                // Reflection of the column onto -sign(a) |a| e1
+                const double Alpha = (A(Col, Col) > 0.0) ? -Norm : Norm;
+                std::array<double, 2 * N> V{};
+                double VNorm = 0.0;
+
+                for (size_t Row = Col; Row < 2 * N; Row++)
+                {
+                    V[Row] = A(Row, Col) - ((Row == Col) ? Alpha : 0.0);
+                    VNorm += Square(V[Row]);
+                }
+
+                if (VNorm == 0.0)
+                {
+                    continue;
+                }
+
+                for (size_t J = Col; J < N; J++)
+                {
+                    double Dot = 0.0;
+
+                    for (size_t Row = Col; Row < 2 * N; Row++)
+                    {
+                        Dot += V[Row] * A(Row, J);
+                    }
+
+                    const double Scale = 2.0 * Dot / VNorm;
+
+                    for (size_t Row = Col; Row < 2 * N; Row++)
+                    {
+                        A(Row, J) -= Scale * V[Row];
+                    }
+                }
+            }
+
+            MatrixN<N, N> Lower{};
+
+            for (size_t Row = 0; Row < N; Row++)
+            {
+                for (size_t Col = Row; Col < N; Col++)
+                {
+                    Lower(Col, Row) = A(Row, Col);
+                }
+            }
+
+            return Lower;
+        }
+
+        VectorN<N> mState{};
+
+        // Covariance, or its square root for the square root form
+        MatrixN<N, N> mCovariance{};
+    };
+
+    /**
+     * Unscented Kalman filter of a state of `N` elements, propagating 2N + 1 sigma points
+     * through the nonlinear process and measurement models rather than linearising them.
+     * Sigma points are held by the filter, so neither prediction nor update allocates:
+     *
+     *  UnscentedKalmanFilter<6> Filter(State, Covariance);
+     *  Filter.Predict([Step](const VectorN<6>& X) {...}, ProcessNoise);
+     *  Filter.Update(Range, RangeNoise, [&Station](const VectorN<6>& X) {...});
+     *
+     * @tparam N Number of state elements
+     */
+    template <size_t N>
+    class UnscentedKalmanFilter
+    {
+    public:
+
+        static constexpr size_t POINTS = Unscented::SigmaPoints<N>();
+
+        /**
+         * @param State Initial state
+         * @param Covariance Initial covariance
+         * @param Parameters Scaling of the sigma points
+         * @throws Error::GenericException if the covariance is not positive definite
+         */
+        UnscentedKalmanFilter(const VectorN<N>& State, const MatrixN<N, N>& Covariance, const Unscented::Parameters& Parameters = {}) :
+            mState(State), mCovariance(Covariance), mWeights(Unscented::CalculateWeights<N>(Parameters))
+        {
+            MatrixN<N, N> Lower{};
+
+            if (Covariance.Cholesky(Lower) == false)
+            {
+                throw Error::GenericException(__FILE__, __LINE__, "Covariance is not positive definite");
+            }
+        }
+
+        /** @return Estimated state */
+        const VectorN<N>& GetState(void) const noexcept {return mState;}
+
+        /** @return Covariance of the estimated state */
+        const MatrixN<N, N>& GetCovariance(void) const noexcept {return mCovariance;}
+
+        /**
+         * Propagates the state and covariance
+         * @param Process Process model, taking and returning the state
+         * @param ProcessNoise Covariance of the noise added over the step
+         * @return `false` if the covariance is no longer positive definite, in which case the
+         * filter is unchanged
+         */
+        template <NonlinearModel<N, N> Model>
+        bool Predict(Model&& Process, const MatrixN<N, N>& ProcessNoise) noexcept
+        {
+            if (Unscented::GenerateSigmaPoints<N>(mState, mCovariance, mWeights, mPoints) == false)
+            {
+                return false;
+            }
+
+            for (VectorN<N>& Point : mPoints)
+            {
+                Point = Process(static_cast<const VectorN<N>&>(Point));
+            }
+
+            const std::span<const VectorN<N>, POINTS> Points(mPoints);
+            mState = Unscented::Mean(Points, mWeights);
+            mCovariance = Unscented::CrossCovariance(Points, mState, Points, mState, mWeights) + ProcessNoise;
+            return true;
+        }
+
+        /**
+         * Updates the state and covariance with a measurement
+         * @param Measurement Measurement of `M` elements
+         * @param MeasurementNoise Covariance of the measurement, positive definite
+         * @param Measure Measurement model, taking the state and returning the measurement
+         * @param Gate Rejection threshold of the squared Mahalanobis distance of the innovation
+         * @return Outcome of the update, the state and covariance are unchanged if rejected
+         */
+        template <size_t M, NonlinearModel<N, M> Model>
+        UpdateStatus Update(const VectorN<M>& Measurement, const MatrixN<M, M>& MeasurementNoise, Model&& Measure,
+            double Gate = Infinity<double>()) noexcept
+        {
+            if (Unscented::GenerateSigmaPoints<N>(mState, mCovariance, mWeights, mPoints) == false)
+            {
+                return UpdateStatus::ILL_CONDITIONED;
+            }
+
+            std::array<VectorN<M>, POINTS> Predicted{};
+
+            for (size_t Point = 0; Point < POINTS; Point++)
+            {
+                Predicted[Point] = Measure(static_cast<const VectorN<N>&>(mPoints[Point]));
+            }
+
+            const std::span<const VectorN<N>, POINTS> Points(mPoints);
+            const std::span<const VectorN<M>, POINTS> Measurements(Predicted);
+
+            const VectorN<M> Mean = Unscented::Mean(Measurements, mWeights);
+            const MatrixN<M, M> InnovationCovariance = Unscented::CrossCovariance(Measurements, Mean, Measurements, Mean, mWeights) + MeasurementNoise;
+            const MatrixN<N, M> CrossCovariance = Unscented::CrossCovariance(Points, mState, Measurements, Mean, mWeights);
+            const VectorN<M> Innovation = Measurement - Mean;
+
+            // Gain K = Pxz S^-1, from S K^T = Pxz^T
+            MatrixN<M, N> GainTranspose{};
+
+            if (InnovationCovariance.SolveSymmetric(CrossCovariance.Transpose(), GainTranspose) == false)
+            {
+                return UpdateStatus::ILL_CONDITIONED;
+            }
+
+            if (Gate < Infinity<double>())
+            {
+                VectorN<M> Weighted{};
+                InnovationCovariance.SolveSymmetric(Innovation, Weighted);
+
+                if ((Innovation.Transpose() * Weighted)[0] > Gate)
+                {
+                    return UpdateStatus::GATED;
+                }
+            }
+
+            const MatrixN<N, M> Gain = GainTranspose.Transpose();
+            mState = mState + Gain * Innovation;
+            mCovariance = (mCovariance - Gain * InnovationCovariance * GainTranspose).Symmetric();
+            return UpdateStatus::ACCEPTED;
+        }
+
+    private:
+
+        VectorN<N> mState{};
+        MatrixN<N, N> mCovariance{};
+        Unscented::Weights mWeights{};
+
+        // Sigma points of the latest prediction or update
+        std::array<VectorN<N>, POINTS> mPoints{};
+    };
+}
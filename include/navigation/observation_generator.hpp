@@ -0,0 +1,243 @@
+#pragma once
+
+#include "navigation/orbit_determination.hpp"
+#include "ephemeris/ephemeris.hpp"
+#include "math/lla.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class ThreadPool;
+
+namespace Navigation
+{
+    /**
+     * A tracking station fixed to the WGS84 Earth
+     */
+    struct GroundStation
+    {
+        /// Geodetic location of the station
+        LLA Location{};
+
+        /// Smallest elevation at which the target is visible (rad)
+        double MinElevation = 0.0;
+
+        /// Standard deviation of the measurement noise of each observation type, in the units of the observation
+        std::array<double, OBSERVATION_TYPES> Sigmas{5.0, 0.01, 1.0E-4, 1.0E-4, 3.0E-11};
+    };
+
+    /**
+     * A simulated observation, as written to and read from an observation stream
+     */
+    struct ObservationRecord
+    {
+        /// Time of the observation (s)
+        double Time = 0.0;
+
+        /// Measured value, including noise
+        double Value = 0.0;
+
+        /// Standard deviation of the noise
+        double Sigma = 0.0;
+
+        /// Index of the observed target
+        uint32_t Target = 0;
+
+        /// Index of the observing station
+        uint32_t Station = 0;
+
+        /// Measured quantity
+        ObservationType Type = ObservationType::RANGE;
+
+        /// Explicit padding, such that every byte of the record is defined
+        std::array<uint8_t, 7> Padding{};
+    };
+
+    static_assert(std::is_trivially_copyable_v<ObservationRecord>);
+    static_assert(sizeof(ObservationRecord) == 40);
+
+    /**
+     * Configuration of an observation generator
+     */
+    struct GeneratorSettings
+    {
+        /// Time of the first observations (s)
+        double Start = 0.0;
+
+        /// Time after which no observations are made (s)
+        double End = 86400.0;
+
+        /// Interval between observations (s)
+        double Interval = 10.0;
+
+        /// Observation times evaluated together, bounding the memory of the generator
+        size_t BatchEpochs = 256;
+
+        /// Seed of the noise of every observation
+        uint64_t Seed = 1;
+
+        /// Quantities measured by every station
+        std::vector<ObservationType> Types{ObservationType::RANGE, ObservationType::RANGE_RATE, ObservationType::AZIMUTH, ObservationType::ELEVATION};
+    };
+
+    /**
+     * Writes observation records to a binary stream as they are generated. The stream is a
+     * header followed by the records, in native byte order:
+     *
+     *  Header  "HOBS", u32 version, u32 record size
+     *  Record  f64 time, f64 value, f64 sigma, u32 target, u32 station, u8 type, 7 bytes padding
+     */
+    class ObservationWriter
+    {
+    public:
+
+        /**
+         * Creates the stream and writes its header
+         * @param Path Path of the file to write
+         * @throws Error::GenericException if the file cannot be written
+         */
+        explicit ObservationWriter(const std::string& Path);
+
+        /**
+         * Appends records to the stream
+         * @param Records Records
+         * @throws Error::GenericException if the file cannot be written
+         */
+        void Write(std::span<const ObservationRecord> Records);
+
+        /**
+         * Flushes and closes the stream
+         * @throws Error::GenericException if the file could not be written
+         */
+        void Close(void);
+
+        /** @return Records written */
+        uint64_t GetRecords(void) const noexcept {return mRecords;}
+
+    private:
+        std::ofstream mFile{};
+        uint64_t mRecords = 0;
+    };
+
+    /**
+     * Reads the records of an observation stream in batches, without reading the whole stream
+     */
+    class ObservationReader
+    {
+    public:
+
+        /**
+         * @param Path Path of the file
+         * @throws Error::GenericException if the file cannot be opened or is not an observation stream
+         */
+        explicit ObservationReader(const std::string& Path);
+
+        /**
+         * Reads the next records of the stream
+         * @param Records Records read, up to the size of the span
+         * @return Number of records read, zero at the end of the stream
+         * @throws Error::GenericException if the stream is truncated
+         */
+        size_t Read(std::span<ObservationRecord> Records);
+
+    private:
+        std::ifstream mFile{};
+    };
+
+    /**
+     * Generates simulated observations of targets by a network of ground stations. Targets
+     * are trajectory sources giving geocentric inertial states, i.e a `SpiceEphemeris` or an
+     * orbit through `TwoBody::OrbitEphemeris`, whose inertial frame coincides with the Earth
+     * fixed frame at time zero (as `Earth::ECI2ECEF`).
+     *
+     * Observation times are evaluated in batches: the states of every target are evaluated
+     * for the batch, then the visibility and observables of every target, station and time
+     * in parallel, after which the visible observations are written in order of time, target,
+     * station and type. Only one batch is held in memory at a time.
+     *
+     * The noise of each observation is drawn from a random stream identified by the target,
+     * station and type, at the position of the observation time, such that the stream is
+     * identical for any number of threads and batch size. Observations are geometric, without
+     * light time or refraction:
+     *
+     *  ObservationGenerator Generator(Settings);
+     *  Generator.AddStation(GroundStation{.Location = {.Lat = 51.1, .Lgt = -1.4}, .MinElevation = 0.1});
+     *  Generator.AddTarget(Ephemeris);
+     *  ObservationWriter Writer("passes.hobs");
+     *  Generator.Generate(Pool, Writer);
+     */
+    class ObservationGenerator
+    {
+    public:
+
+        /**
+         * @param Settings Configuration
+         * @throws Error::GenericException if the interval or batch size is not positive
+         */
+        explicit ObservationGenerator(const GeneratorSettings& Settings);
+
+        /**
+         * Adds a station
+         * @param Station Station
+         * @return Index of the station
+         */
+        size_t AddStation(const GroundStation& Station);
+
+        /**
+         * Adds a target
+         * @param Target Trajectory of the target, which must outlive the generator
+         * @return Index of the target
+         */
+        size_t AddTarget(const Ephemeris& Target);
+
+        /**
+         * Generates every observation of the configured times. Times at which a target could
+         * not be evaluated are not observed, and are counted by `GetSkipped`
+         * @param Pool Threads evaluating the observations
+         * @param Writer Stream to which the observations are written
+         * @return Number of observations generated
+         * @throws Error::GenericException if the stream cannot be written
+         */
+        uint64_t Generate(ThreadPool& Pool, ObservationWriter& Writer);
+
+        /** @return Target times which could not be evaluated by the last generation */
+        uint64_t GetSkipped(void) const noexcept {return mSkipped;}
+
+        /**
+         * Geometry of a generated observation, for orbit determination
+         * @param Record Observation record
+         * @return Observation, with the station state expressed in the inertial frame
+         */
+        Observation MakeObservation(const ObservationRecord& Record) const noexcept;
+
+    private:
+
+        /**
+         * Precomputed Earth fixed geometry of a station
+         */
+        struct StationGeometry
+        {
+            GroundStation Station{};
+            Vector3 Position = Vector3::ZERO();
+            Quaternion FixedToENU = Quaternion::IDENTITY();
+        };
+
+        /**
+         * Evaluates the observations of one target by one station at one time
+         * @return Number of observations written to `Out`
+         */
+        size_t EvaluateSlot(size_t Target, size_t Station, uint32_t Epoch, double Time, const EphemerisState& State,
+            ObservationRecord* Out) const noexcept;
+
+        GeneratorSettings mSettings{};
+        std::vector<StationGeometry> mStations{};
+        std::vector<const Ephemeris*> mTargets{};
+        uint64_t mSkipped = 0;
+    };
+}
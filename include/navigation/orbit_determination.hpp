@@ -0,0 +1,214 @@
+#pragma once
+
+#include "math/matrixn.hpp"
+#include "math/quaternion.hpp"
+#include "math/vector3.hpp"
+#include "twobody/covariance.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+namespace Navigation
+{
+    /**
+     * Quantity measured by a tracking station
+     */
+    enum class ObservationType : uint8_t
+    {
+        RANGE,          // Distance from the station to the target (m)
+        RANGE_RATE,     // Rate of change of the range (m/s)
+        AZIMUTH,        // Azimuth of the target in the local tangent plane of the station (rad)
+        ELEVATION,      // Elevation of the target above the local tangent plane of the station (rad)
+        DOPPLER         // One way Doppler shift as a fraction of the carrier frequency, -range rate / c
+    };
+
+    /** Number of observation types */
+    constexpr size_t OBSERVATION_TYPES = 5;
+
+    /**
+     * A scalar measurement of a target from a tracking station. The station state is
+     * expressed in the inertial frame of the estimated orbit at the time of the observation,
+     * such that rotation of the central body is accounted for by the caller
+     */
+    struct Observation
+    {
+        /// Time from the epoch of the estimated state (s)
+        double Time = 0.0;
+
+        /// Measured quantity
+        ObservationType Type = ObservationType::RANGE;
+
+        /// Measured value (m, m/s, rad or dimensionless)
+        double Value = 0.0;
+
+        /// Standard deviation of the measurement noise, in the units of the value
+        double Sigma = 1.0;
+
+        /// Position of the station (m)
+        Vector3 StationPosition = Vector3::ZERO();
+
+        /// Velocity of the station (m/s)
+        Vector3 StationVelocity = Vector3::ZERO();
+
+        /// Inertial to East, North, Up transformation of the station
+        Quaternion InertialToENU = Quaternion::IDENTITY();
+    };
+
+    /**
+     * Iteration control of a batch least squares fit
+     */
+    struct FitSettings
+    {
+        /// Maximum number of iterations (corrections of the state)
+        size_t MaxIterations = 20;
+
+        /// Convergence threshold of the relative change of the weighted RMS residual
+        double Tolerance = 1.0E-8;
+
+        /// Observations whose weighted residual exceeds this multiple of the weighted RMS of
+        /// the previous iteration are edited (excluded) from the next iteration
+        double EditMultiplier = 3.0;
+
+        /// Editing threshold of the first iteration, in standard deviations of the measurement
+        /// noise, large to tolerate a poor initial state
+        double InitialEdit = 1.0E6;
+    };
+
+    /**
+     * Outcome of a batch least squares fit
+     */
+    enum class FitStatus
+    {
+        CONVERGED,                  // Weighted RMS residual converged
+        MAX_ITERATIONS,             // Iteration limit reached before convergence
+        SINGULAR,                   // Normal equations not positive definite, the state is unobservable
+        INSUFFICIENT_OBSERVATIONS   // Fewer accepted observations than estimated parameters
+    };
+
+    /**
+     * Estimate and statistics of a batch least squares fit
+     */
+    struct FitResult
+    {
+        /// Outcome
+        FitStatus Status = FitStatus::INSUFFICIENT_OBSERVATIONS;
+
+        /// Estimated state at the epoch
+        TwoBody::StateVector State{};
+
+        /// Formal covariance of the estimated state, the inverse of the normal matrix
+        TwoBody::StateCovariance Covariance{};
+
+        /// Number of iterations performed
+        size_t Iterations = 0;
+
+        /// Weighted RMS residual of the accepted observations of the final iteration
+        double WeightedRMS = 0.0;
+
+        /// Number of accepted observations of the final iteration
+        size_t Accepted = 0;
+
+        /// Number of edited observations of the final iteration
+        size_t Edited = 0;
+    };
+
+    /**
+     * Batch weighted least squares estimate of the state of an orbit at an epoch from
+     * tracking observations, with two body motion about the central body.
+     *
+     * Each iteration evaluates the residual and partial derivatives of every observation in
+     * parallel, accumulating the normal equations of consecutive observations in a chunk
+     * local accumulator, and combines the accumulators in order such that the estimate is
+     * identical for any number of threads. The normal equations are solved by Cholesky
+     * decomposition. Consecutive observations sharing a time, i.e the range, range rate and
+     * angles of one pass, share one propagation of the state and its transition matrix:
+     *
+     *  OrbitDetermination Fit(Earth::GRAVITATIONAL_CONSTANT);
+     *  Fit.Add(Observation{.Time = 60.0, .Type = ObservationType::RANGE, ...});
+     *  const FitResult Result = Fit.Solve(Pool, InitialGuess);
+     */
+    class OrbitDetermination
+    {
+    public:
+
+        /**
+         * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+         */
+        explicit OrbitDetermination(double GravitationalParameter) noexcept : mGravitationalParameter(GravitationalParameter) { }
+
+        /**
+         * Adds an observation
+         * @param Measurement Observation
+         * @return Index of the observation
+         */
+        size_t Add(const Observation& Measurement);
+
+        /**
+         * Reserves storage, such that observations may be added without reallocation
+         * @param Capacity Number of observations
+         */
+        void Reserve(size_t Capacity);
+
+        /** @return Number of observations */
+        size_t Size(void) const noexcept {return mObservations.size();}
+
+        /** @return Observation */
+        const Observation& GetObservation(size_t Index) const noexcept {return mObservations[Index];}
+
+        /** @return Residual, observed minus computed, of an observation at the latest iteration */
+        double GetResidual(size_t Index) const noexcept {return mResiduals[Index];}
+
+        /** @return `true` if an observation was edited at the latest iteration */
+        bool IsEdited(size_t Index) const noexcept {return mEdited[Index] != 0;}
+
+        /**
+         * Fits the state at the epoch to the observations
+         * @param Pool Threads evaluating the observations
+         * @param InitialState Initial estimate of the state at the epoch
+         * @param Settings Iteration control
+         * @return Estimate and statistics, the state of the latest successful iteration if not converged
+         */
+        FitResult Solve(ThreadPool& Pool, const TwoBody::StateVector& InitialState, const FitSettings& Settings = {});
+
+        /**
+         * Computed value and partial derivatives of an observation of a state
+         * @param Measurement Observation, of which the value and noise are unused
+         * @param State State at the time of the observation
+         * @param Partials Partial derivatives of the computed value with respect to the state,
+         * zero for an angle within 1.0E-4 rad of the zenith, where the angles are not differentiable
+         * and such observations are edited
+         * @return Computed value
+         */
+        static double Evaluate(const Observation& Measurement, const TwoBody::StateVector& State, MatrixN<1, 6>& Partials) noexcept;
+
+    private:
+
+        /**
+         * Sums of the normal equations of a range of observations
+         */
+        struct Accumulator
+        {
+            MatrixN<6, 6> Normal{};
+            VectorN<6> Information{};
+            double SquaredResiduals = 0.0;
+            size_t Accepted = 0;
+            size_t Edited = 0;
+        };
+
+        /**
+         * Evaluates the observations of a group of consecutive observations sharing a time
+         */
+        void EvaluateGroup(size_t Group, const TwoBody::StateVector& Epoch, double Threshold, Accumulator& Sums) noexcept;
+
+        double mGravitationalParameter = 0.0;
+        std::vector<Observation> mObservations{};
+        std::vector<double> mResiduals{};
+        std::vector<uint8_t> mEdited{};
+
+        // First observation of each group of consecutive observations sharing a time
+        std::vector<size_t> mGroups{};
+    };
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+/**
+ * @file ode.hpp
+ */
+
+#include "math/core_math.hpp"
+#include "math/matrixn.hpp"
+
+#include <cstdint>
+
+namespace ODE
+{
+    /**
+     * A collection of exit flags for an integration
+     */
+    enum struct IntegratorStatus
+    {
+        /// Integrated to the end time
+        SUCCESS,
+
+        /// The step required to meet the tolerances fell below the minimum step
+        STEP_SIZE_UNDERFLOW,
+
+        /// Integration did not reach the end time in the maximum number of steps allowed
+        MAX_STEPS_EXCEEDED
+    };
+
+    /**
+     * Adaptive integrator input parameters
+     */
+    struct IntegratorSettings
+    {
+        /// Error per step allowed relative to the magnitude of each element of the state
+        double RelativeTolerance = 1.0E-10;
+
+        /// Error per step allowed in each element of the state
+        double AbsoluteTolerance = 1.0E-10;
+
+        /// Magnitude of the first step attempted, zero to estimate it from the derivative
+        double InitialStep = 0.0;
+
+        /// Procedure will exit with error if the step falls below this magnitude
+        double MinStep = 1.0E-9;
+
+        /// Procedure will exit with error if this many steps are exceeded, accepted or rejected
+        uint64_t MaxSteps = 1000000;
+    };
+
+    /**
+     * Integration exit struct
+     */
+    template <size_t Rows, size_t Cols>
+    struct IntegratorResult
+    {
+        /// State at the end time, or at the time the integration failed
+        MatrixN<Rows, Cols> State{};
+
+        /// Time reached
+        double Time = 0.0;
+
+        /// Steps accepted
+        uint64_t Steps = 0;
+
+        /// Steps rejected, and retried with a smaller step
+        uint64_t Rejected = 0;
+
+        IntegratorStatus ExitCode = IntegratorStatus::SUCCESS;
+    };
+
+    /**
+     * Single step of the classical fourth order Runge-Kutta method
+     * @param Function Derivative of the state, callable as `Function(Time, State)`
+     * @param Time Time at the start of the step
+     * @param State State at the start of the step
+     * @param Step Step in time, which may be negative
+     * @return State at the end of the step
+     */
+    template <size_t Rows, size_t Cols, typename Derivative>
+    constexpr MatrixN<Rows, Cols> RungeKutta4(const Derivative& Function, double Time, const MatrixN<Rows, Cols>& State, double Step) noexcept
+    {
+        const MatrixN<Rows, Cols> K1 = Function(Time, State);
+        const MatrixN<Rows, Cols> K2 = Function(Time + 0.5 * Step, State + K1 * (0.5 * Step));
+        const MatrixN<Rows, Cols> K3 = Function(Time + 0.5 * Step, State + K2 * (0.5 * Step));
+        const MatrixN<Rows, Cols> K4 = Function(Time + Step, State + K3 * Step);
+
+        return State + (K1 + K2 * 2.0 + K3 * 2.0 + K4) * (Step / 6.0);
+    }
+
+    /**
+     * Integrates with the classical fourth order Runge-Kutta method in equal steps
+     * @param Function Derivative of the state, callable as `Function(Time, State)`
+     * @param Start Initial time
+     * @param End Final time, before or after `Start`
+     * @param State Initial state
+     * @param Steps Number of steps, at least one
+     * @return State at `End`
+     */
+    template <size_t Rows, size_t Cols, typename Derivative>
+    constexpr MatrixN<Rows, Cols> RungeKutta4(const Derivative& Function, double Start, double End, const MatrixN<Rows, Cols>& State, uint64_t Steps) noexcept
+    {
+        const double Step = (End - Start) / static_cast<double>(Max(Steps, uint64_t(1)));
+        MatrixN<Rows, Cols> Result = State;
+
+        for (uint64_t Index = 0; Index < Max(Steps, uint64_t(1)); Index++)
+        {
+            Result = RungeKutta4(Function, Start + static_cast<double>(Index) * Step, Result, Step);
+        }
+
+        return Result;
+    }
+
+    /**
+     * Integrates with the adaptive fifth order Dormand-Prince method, controlling the local
+     * error estimated by the embedded fourth order solution
+     * Ref: Hairer, Norsett and Wanner, Solving Ordinary Differential Equations I, Section II.5
+     * @param Function Derivative of the state, callable as `Function(Time, State)`
+     * @param Start Initial time
+     * @param End Final time, before or after `Start`
+     * @param State Initial state
+     * @param Settings Tolerances and limits of the integration
+     * @return State at `End` and exit status
+     */
+    template <size_t Rows, size_t Cols, typename Derivative>
+    IntegratorResult<Rows, Cols> DormandPrince(const Derivative& Function, double Start, double End, const MatrixN<Rows, Cols>& State,
+        const IntegratorSettings& Settings = {}) noexcept
+    {
+        using Matrix = MatrixN<Rows, Cols>;
+        constexpr size_t SIZE = Rows * Cols;
+
+        // Root mean square of the elements of `Error` scaled by the tolerances
+        const auto ScaledNorm = [&](const Matrix& Error, const Matrix& Previous, const Matrix& Next)
+        {
+            double Sum = 0.0;
+
+            for (size_t Index = 0; Index < SIZE; Index++)
+            {
+                const double Scale = Settings.AbsoluteTolerance + Settings.RelativeTolerance * Max(Abs(Previous[Index]), Abs(Next[Index]));
+                Sum += Square(Error[Index] / Scale);
+            }
+
+            return Sqrt(Sum / static_cast<double>(SIZE));
+        };
+
+        IntegratorResult<Rows, Cols> Result{.State = State, .Time = Start};
+        const double Direction = (End < Start) ? -1.0 : 1.0;
+        Matrix K1 = Function(Start, State);
+
+        // Estimate the first step as that changing the state by about a hundredth of itself
+        double Step = Settings.InitialStep;
+
+        if (Step <= 0.0)
+        {
+            const double StateNorm = ScaledNorm(State, State, State);
+            const double DerivativeNorm = ScaledNorm(K1, State, State);
+            Step = ((StateNorm > 1.0E-5) && (DerivativeNorm > 1.0E-5)) ? 0.01 * StateNorm / DerivativeNorm : 1.0E-6;
+        }
+
+        while (Direction * (End - Result.Time) > 0.0)
+        {
+            if (Result.Steps + Result.Rejected >= Settings.MaxSteps)
+            {
+                Result.ExitCode = IntegratorStatus::MAX_STEPS_EXCEEDED;
+                return Result;
+            }
+
+            if (Step < Settings.MinStep)
+            {
+                Result.ExitCode = IntegratorStatus::STEP_SIZE_UNDERFLOW;
+                return Result;
+            }
+
+            // Land exactly on the end time
+            const bool Last = (Step >= Direction * (End - Result.Time));
+            const double H = Last ? (End - Result.Time) : Direction * Step;
+            const double Time = Result.Time;
+            const Matrix& Y = Result.State;
+
+            const Matrix K2 = Function(Time + H / 5.0, Y + K1 * (H / 5.0));
+            const Matrix K3 = Function(Time + 3.0 * H / 10.0, Y + (K1 * (3.0 / 40.0) + K2 * (9.0 / 40.0)) * H);
+            const Matrix K4 = Function(Time + 4.0 * H / 5.0, Y + (K1 * (44.0 / 45.0) - K2 * (56.0 / 15.0) + K3 * (32.0 / 9.0)) * H);
+            const Matrix K5 = Function(Time + 8.0 * H / 9.0, Y + (K1 * (19372.0 / 6561.0) - K2 * (25360.0 / 2187.0) + K3 * (64448.0 / 6561.0)
+                - K4 * (212.0 / 729.0)) * H);
+            const Matrix K6 = Function(Time + H, Y + (K1 * (9017.0 / 3168.0) - K2 * (355.0 / 33.0) + K3 * (46732.0 / 5247.0)
+                + K4 * (49.0 / 176.0) - K5 * (5103.0 / 18656.0)) * H);
+            const Matrix Next = Y + (K1 * (35.0 / 384.0) + K3 * (500.0 / 1113.0) + K4 * (125.0 / 192.0) - K5 * (2187.0 / 6784.0)
+                + K6 * (11.0 / 84.0)) * H;
+            const Matrix K7 = Function(Time + H, Next);
+
+            // Difference of the fifth and embedded fourth order solutions
+            const Matrix Error = (K1 * (71.0 / 57600.0) - K3 * (71.0 / 16695.0) + K4 * (71.0 / 1920.0) - K5 * (17253.0 / 339200.0)
+                + K6 * (22.0 / 525.0) - K7 * (1.0 / 40.0)) * H;
+            const double Norm = ScaledNorm(Error, Y, Next);
+
+            // Safety factor and bounds on the change of step, proportional to the error to the power -1/5
+            const double Factor = (Norm > 0.0) ? Clamp(0.9 * Pow(Norm, -0.2), 0.2, 5.0) : 5.0;
+
+            if (Norm <= 1.0)
+            {
+                Result.Time = Last ? End : Time + H;
+                Result.State = Next;
+                Result.Steps++;
+
+                // First same as last, the final stage is the first of the next step
+                K1 = K7;
+                Step = Abs(H) * Factor;
+            }
+            else
+            {
+                Result.Rejected++;
+                Step = Abs(H) * Min(Factor, 1.0);
+            }
+        }
+
+        return Result;
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+/**
+ * @file random.hpp
+ */
+
+#include "math/core_math.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace Random
+{
+    using Counter = std::array<uint32_t, 4>;
+    using Key = std::array<uint32_t, 2>;
+
+    /**
+     * Philox4x32-10 counter based generator (Salmon et al., 2011). Maps a counter and key
+     * to four independent uniformly distributed words without any internal state, such
+     * that any element of any stream is generated directly
+     * @param Count Counter
+     * @param K Key
+     * @return Four random words
+     */
+    constexpr Counter Philox(Counter Count, Key K) noexcept
+    {
+        constexpr uint64_t MULTIPLIER_0 = 0xD2511F53;
+        constexpr uint64_t MULTIPLIER_1 = 0xCD9E8D57;
+        constexpr uint32_t WEYL_0 = 0x9E3779B9;
+        constexpr uint32_t WEYL_1 = 0xBB67AE85;
+
+        for (int Round = 0; Round < 10; Round++)
+        {
+            const uint64_t Product0 = MULTIPLIER_0 * Count[0];
+            const uint64_t Product1 = MULTIPLIER_1 * Count[2];
+
+            Count = Counter{static_cast<uint32_t>(Product1 >> 32) ^ Count[1] ^ K[0],
+                            static_cast<uint32_t>(Product1),
+                            static_cast<uint32_t>(Product0 >> 32) ^ Count[3] ^ K[1],
+                            static_cast<uint32_t>(Product0)};
+
+            K[0] += WEYL_0;
+            K[1] += WEYL_1;
+        }
+
+        return Count;
+    }
+
+    /**
+     * @param High Upper word
+     * @param Low Lower word
+     * @return Uniformly distributed double in [0, 1) from the upper 53 bits of the words
+     */
+    constexpr double ToUniform(uint32_t High, uint32_t Low) noexcept
+    {
+        const uint64_t Bits = ((static_cast<uint64_t>(High) << 32) | Low) >> 11;
+        return static_cast<double>(Bits) * 0x1.0p-53;
+    }
+
+    /**
+     * Reproducible sequence of random numbers, identified by a seed and stream number. The
+     * element at each position of a stream depends only upon the seed, stream and position,
+     * so streams of independent work (i.e Monte Carlo cases) are reproducible regardless of
+     * the order or thread in which they are generated.
+     *
+     * Each block of the stream provides two uniform numbers, or one normal number
+     */
+    class Stream
+    {
+    public:
+
+        /**
+         * @param Seed Seed, common to every stream of an experiment
+         * @param Id Stream number
+         * @param Sub Sub-stream number, i.e a parameter of the stream
+         */
+        constexpr Stream(uint64_t Seed, uint64_t Id, uint32_t Sub = 0) noexcept
+            : mKey{static_cast<uint32_t>(Seed), static_cast<uint32_t>(Seed >> 32)},
+              mId{Id},
+              mSub{Sub}
+        { }
+
+        /**
+         * @param Block Position of the block in the stream
+         * @return Random words of the block
+         */
+        constexpr Counter Generate(uint32_t Block) const noexcept
+        {
+            return Philox(Counter{Block, mSub, static_cast<uint32_t>(mId), static_cast<uint32_t>(mId >> 32)}, mKey);
+        }
+
+        /**
+         * @return Next uniformly distributed number in [0, 1)
+         */
+        constexpr double Uniform(void) noexcept
+        {
+            if (mHasSpare == false)
+            {
+                const Counter Words = Generate(mBlock++);
+                mSpare = ToUniform(Words[2], Words[3]);
+                mHasSpare = true;
+                return ToUniform(Words[0], Words[1]);
+            }
+
+            mHasSpare = false;
+            return mSpare;
+        }
+
+        /**
+         * @param Min Lower bound
+         * @param Max Upper bound
+         * @return Next uniformly distributed number in [Min, Max)
+         */
+        constexpr double Uniform(double Min, double Max) noexcept
+        {
+            return Min + (Max - Min) * Uniform();
+        }
+
+        /**
+         * Box-Muller transform of a block
+         * @param Mean Mean
+         * @param Sigma Standard deviation
+         * @return Next normally distributed number
+         */
+        constexpr double Normal(double Mean = 0.0, double Sigma = 1.0) noexcept
+        {
+            const Counter Words = Generate(mBlock++);
+
+            // Exclude zero from the radial term
+            const double U = 1.0 - ToUniform(Words[0], Words[1]);
+            const double V = ToUniform(Words[2], Words[3]);
+
+            return Mean + Sigma * Sqrt(-2.0 * Log(U)) * Cos(2.0 * PI * V);
+        }
+
+        /**
+         * Moves to a position of the stream
+         * @param Block Position of the next block
+         */
+        constexpr void Seek(uint32_t Block) noexcept
+        {
+            mBlock = Block;
+            mHasSpare = false;
+        }
+
+    private:
+        Key mKey{};
+        uint64_t mId = 0;
+        uint32_t mSub = 0;
+        uint32_t mBlock = 0;
+        double mSpare = 0.0;
+        bool mHasSpare = false;
+    };
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+/**
+ * @file statistics.hpp
+ */
+
+#include "math/core_math.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace Statistics
+{
+    /**
+     * Online mean, variance and extrema of a sequence of samples (Welford's algorithm),
+     * without storing the samples. Accumulators of separate sequences are merged with the
+     * parallel formulation of Chan et al., the result being independent of the thread that
+     * accumulated each sequence provided the merge order is fixed
+     */
+    class Accumulator
+    {
+    public:
+
+        /**
+         * @param Value Sample to add
+         */
+        constexpr void Add(double Value) noexcept
+        {
+            mCount++;
+            const double Delta = Value - mMean;
+            mMean += Delta / static_cast<double>(mCount);
+            mM2 += Delta * (Value - mMean);
+            mMin = Min(mMin, Value);
+            mMax = Max(mMax, Value);
+        }
+
+        /**
+         * Adds the samples of another accumulator, as if added in sequence after those of `this`
+         * @param Other Accumulator to merge
+         */
+        constexpr void Merge(const Accumulator& Other) noexcept
+        {
+            if (Other.mCount == 0)
+            {
+                return;
+            }
+
+            const double Count = static_cast<double>(mCount);
+            const double OtherCount = static_cast<double>(Other.mCount);
+            const double Total = Count + OtherCount;
+            const double Delta = Other.mMean - mMean;
+
+            mMean += Delta * OtherCount / Total;
+            mM2 += Other.mM2 + Delta * Delta * Count * OtherCount / Total;
+            mCount += Other.mCount;
+            mMin = Min(mMin, Other.mMin);
+            mMax = Max(mMax, Other.mMax);
+        }
+
+        /** @return Number of samples */
+        constexpr uint64_t Count(void) const noexcept {return mCount;}
+
+        /** @return Mean of the samples, zero if empty */
+        constexpr double Mean(void) const noexcept {return mMean;}
+
+        /** @return Unbiased sample variance, zero with fewer than two samples */
+        constexpr double Variance(void) const noexcept
+        {
+            return (mCount > 1) ? mM2 / static_cast<double>(mCount - 1) : 0.0;
+        }
+
+        /** @return Sample standard deviation */
+        double StandardDeviation(void) const noexcept {return Sqrt(Variance());}
+
+        /** @return Smallest sample, infinity if empty */
+        constexpr double Minimum(void) const noexcept {return mMin;}
+
+        /** @return Largest sample, negative infinity if empty */
+        constexpr double Maximum(void) const noexcept {return mMax;}
+
+        constexpr bool operator==(const Accumulator& Other) const noexcept = default;
+
+    private:
+        uint64_t mCount = 0;
+        double mMean = 0.0;
+        double mM2 = 0.0;
+        double mMin = std::numeric_limits<double>::infinity();
+        double mMax = -std::numeric_limits<double>::infinity();
+    };
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+/**
+ * @file unscented.hpp
+ */
+
+#include "math/core_math.hpp"
+#include "math/matrixn.hpp"
+
+#include <cstddef>
+#include <span>
+
+namespace Unscented
+{
+    /**
+     * Scaling of the sigma points of the unscented transform. The defaults place the sigma
+     * points at Sqrt(N) standard deviations with a zero weight central point, which remains
+     * well conditioned for states of large magnitude such as orbital positions
+     */
+    struct Parameters
+    {
+        /// Spread of the sigma points about the mean, 0 < Alpha <= 1
+        double Alpha = 1.0;
+
+        /// Prior knowledge of the distribution, 2 is optimal for a Gaussian
+        double Beta = 2.0;
+
+        /// Secondary scaling
+        double Kappa = 0.0;
+    };
+
+    /**
+     * Weights of the sigma points of an `N` dimensional state
+     */
+    struct Weights
+    {
+        /// Distance of the sigma points from the mean, in standard deviations
+        double Scale = 0.0;
+
+        /// Weight of the central point in the mean
+        double Mean0 = 0.0;
+
+        /// Weight of the central point in the covariance
+        double Covariance0 = 0.0;
+
+        /// Weight of every other point in both
+        double Point = 0.0;
+    };
+
+    /**
+     * @return Number of sigma points of an `N` dimensional state
+     */
+    template <size_t N>
+    constexpr size_t SigmaPoints(void) noexcept
+    {
+        return 2 * N + 1;
+    }
+
+    /**
+     * @param Scaling Scaling of the sigma points
+     * @return Weights of the sigma points of an `N` dimensional state
+     */
+    template <size_t N>
+    constexpr Weights CalculateWeights(const Parameters& Scaling) noexcept
+    {
+        const double Dimension = static_cast<double>(N);
+        const double Lambda = Square(Scaling.Alpha) * (Dimension + Scaling.Kappa) - Dimension;
+
+        return Weights{
+            .Scale = Sqrt(Dimension + Lambda),
+            .Mean0 = Lambda / (Dimension + Lambda),
+            .Covariance0 = Lambda / (Dimension + Lambda) + 1.0 - Square(Scaling.Alpha) + Scaling.Beta,
+            .Point = 0.5 / (Dimension + Lambda)
+        };
+    }
+
+    /**
+     * Generates the sigma points of a distribution
+     * @param Mean Mean of the distribution
+     * @param Covariance Covariance of the distribution
+     * @param Weighting Weights of the sigma points
+     * @param Points Sigma points, the mean followed by pairs either side of it
+     * @return `false` if the covariance is not positive definite
+     */
+    template <size_t N>
+    constexpr bool GenerateSigmaPoints(const VectorN<N>& Mean, const MatrixN<N, N>& Covariance, const Weights& Weighting,
+        std::span<VectorN<N>, 2 * N + 1> Points) noexcept
+    {
+        MatrixN<N, N> Lower{};
+
+        if (Covariance.Cholesky(Lower) == false)
+        {
+            return false;
+        }
+
+        Points[0] = Mean;
+
+        for (size_t Col = 0; Col < N; Col++)
+        {
+            VectorN<N> Offset{};
+
+            for (size_t Row = Col; Row < N; Row++)
+            {
+                Offset[Row] = Weighting.Scale * Lower(Row, Col);
+            }
+
+            Points[1 + 2 * Col] = Mean + Offset;
+            Points[2 + 2 * Col] = Mean - Offset;
+        }
+
+        return true;
+    }
+
+    /**
+     * Weighted mean of transformed sigma points, taken relative to the central point to
+     * avoid cancellation between points of large magnitude
+     * @param Points Transformed sigma points
+     * @param Weighting Weights of the sigma points
+     * @return Mean
+     */
+    template <size_t M, size_t Count>
+    constexpr VectorN<M> Mean(std::span<const VectorN<M>, Count> Points, const Weights& Weighting) noexcept
+    {
+        VectorN<M> Sum{};
+
+        for (size_t Point = 1; Point < Count; Point++)
+        {
+            Sum = Sum + (Points[Point] - Points[0]);
+        }
+
+        return Points[0] + Weighting.Point * Sum;
+    }
+
+    /**
+     * Weighted cross covariance of two sets of transformed sigma points about their means
+     * @param A First set of sigma points
+     * @param MeanA Mean of the first set
+     * @param B Second set of sigma points
+     * @param MeanB Mean of the second set
+     * @param Weighting Weights of the sigma points
+     * @return Cross covariance, the covariance if both sets are the same
+     */
+    template <size_t M, size_t K, size_t Count>
+    constexpr MatrixN<M, K> CrossCovariance(std::span<const VectorN<M>, Count> A, const VectorN<M>& MeanA,
+        std::span<const VectorN<K>, Count> B, const VectorN<K>& MeanB, const Weights& Weighting) noexcept
+    {
+        MatrixN<M, K> Sum{};
+
+        for (size_t Point = 0; Point < Count; Point++)
+        {
+            const VectorN<M> DeviationA = A[Point] - MeanA;
+            const VectorN<K> DeviationB = B[Point] - MeanB;
+            const double Weight = (Point == 0) ? Weighting.Covariance0 : Weighting.Point;
+
+            for (size_t Row = 0; Row < M; Row++)
+            {
+                for (size_t Col = 0; Col < K; Col++)
+                {
+                    Sum(Row, Col) += Weight * DeviationA[Row] * DeviationB[Col];
+                }
+            }
+        }
+
+        return Sum;
+    }
+}
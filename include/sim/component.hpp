@@ -0,0 +1,96 @@
+#pragma once
+
+#include "meta/indexable.hpp"
+#include "sim/signal.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Executive;
+
+/**
+ * Base simulation component (dynamics, sensor, environment, GNC etc.). Components declare
+ * an update rate, the components whose outputs they consume within the same frame, and
+ * the signals they produce. The executive derives a static schedule from these.
+ */
+class Component
+{
+public:
+
+    /**
+     * @param Name Unique name, used as the telemetry key of the component
+     * @param Rate Update rate (Hz), the executive base rate must be an integer multiple
+     */
+    Component(const std::string& Name, double Rate) :
+        mName{Name},
+        mRate{Rate}
+    {
+
+    }
+
+    virtual ~Component() = default;
+
+    // Executive and other components refer to components by address
+    Component(const Component& Other) = delete;
+
+    /**
+     * Invoked once by the executive when the schedule is built, in dependency order
+     */
+    virtual void Initialise(void) { }
+
+    /**
+     * Advances the component. Components of the same level may update concurrently, so an
+     * update may only write to its own state and signals, and must not throw
+     * @param Time Simulation time (s) at the start of the step
+     * @param Step Time (s) elapsed between successive updates of this component
+     */
+    virtual void Update(double Time, double Step) = 0;
+
+    /**
+     * @return Telemetry of the component, nullptr if none is exposed
+     */
+    virtual const Indexable* GetDynamicIndexMap(void) const {return nullptr;}
+
+    /**
+     * Declares that this component consumes the outputs of `Other` within the same frame,
+     * such that `Other` is always updated first in frames where both are scheduled.
+     * Invalidates any schedule built by the executive
+     * @param Other Producing component
+     */
+    void DependsOn(const Component& Other) {mDependencies.push_back(&Other);}
+
+    /** @return Name of the component */
+    const std::string& GetName(void) const noexcept {return mName;}
+
+    /** @return Update rate (Hz) */
+    double GetRate(void) const noexcept {return mRate;}
+
+    /** @return Number of base frames between updates, valid once scheduled */
+    uint32_t GetDivisor(void) const noexcept {return mDivisor;}
+
+    /** @return Declared dependencies */
+    const std::vector<const Component*>& GetDependencies(void) const noexcept {return mDependencies;}
+
+    /** @return Declared output signals */
+    const std::vector<SignalBase*>& GetOutputs(void) const noexcept {return mOutputs;}
+
+protected:
+
+    /**
+     * Declares a signal produced by this component, published by the executive after each
+     * update of the component
+     * @param Output Signal owned by the component
+     */
+    void AddOutput(SignalBase& Output) {mOutputs.push_back(&Output);}
+
+private:
+    friend class Executive;
+
+    std::string mName{};
+    double mRate = 0.0;
+    uint32_t mDivisor = 1;
+
+    std::vector<const Component*> mDependencies{};
+    std::vector<SignalBase*> mOutputs{};
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "concurrency/thread_pool.hpp"
+#include "meta/indexable.hpp"
+#include "sim/component.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * Multi-rate simulation executive. Each component runs at an integer divisor of the
+ * base rate, and components are ordered into levels such that every component follows
+ * the components it depends upon. Building the executive produces a static schedule of
+ * levels for each base frame of the major frame (the least common multiple of all
+ * divisors). Components within a level are independent and execute in parallel on a
+ * thread pool, and the outputs of a level are published once the level completes.
+ */
+class Executive
+{
+public:
+
+    /**
+     * Contiguous range of scheduled components
+     */
+    struct Range
+    {
+        size_t Begin = 0;
+        size_t End = 0;
+    };
+
+    /**
+     * @param BaseRate Rate (Hz) of the fastest rate group
+     * @param Workers Number of worker threads in addition to the calling thread, zero
+     * executes every component on the calling thread
+     */
+    explicit Executive(double BaseRate, size_t Workers = 0);
+
+    // Components are referred to by address
+    Executive(const Executive& Other) = delete;
+
+    /**
+     * Adds a component, which must outlive the executive. Invalidates any built schedule
+     * @param Member Component to add
+     */
+    void Add(Component& Member);
+
+    /**
+     * Validates rates and dependencies, builds the static schedule, and initialises every
+     * component. Resets the simulation time to zero
+     * @throws Error::GenericException if a rate is not an integer divisor of the base rate,
+     * a dependency has not been added, dependencies are cyclic or names are not unique
+     */
+    void Build(void);
+
+    /**
+     * Executes one base frame
+     */
+    void Step(void);
+
+    /**
+     * Executes a number of base frames
+     * @param Frames Number of base frames
+     */
+    void Run(uint64_t Frames);
+
+    /**
+     * @return True if the schedule is built, and no component or dependency has been added
+     * since, otherwise the next step rebuilds it
+     */
+    bool IsBuilt(void) const noexcept;
+
+    /** @return Simulation time (s) of the next frame */
+    double GetTime(void) const noexcept {return mTime;}
+
+    /** @return Number of base frames executed */
+    uint64_t GetFrame(void) const noexcept {return mFrame;}
+
+    /** @return Base rate (Hz) */
+    double GetBaseRate(void) const noexcept {return mBaseRate;}
+
+    /** @return Number of base frames in the major frame, valid once built */
+    size_t GetMajorFrame(void) const noexcept {return mFrames.size();}
+
+    /** @return Levels of a base frame within the major frame, valid once built */
+    std::span<const Range> GetLevels(size_t Frame) const noexcept;
+
+    /** @return Components of a level, valid once built */
+    std::span<Component* const> GetComponents(const Range& Level) const noexcept;
+
+    /** @return Components in the order added */
+    std::span<Component* const> GetComponents(void) const noexcept {return mComponents;}
+
+    /** @return Range of the schedule executed in a base frame of the major frame, valid once built */
+    Range GetFrameSchedule(size_t Frame) const noexcept;
+
+    /**
+     * Enables timing of each component update, at the cost of two clock reads per update
+     * @param Enable True to record update durations
+     */
+    void SetProfiling(bool Enable) noexcept {mProfiling = Enable;}
+
+    /**
+     * @return Duration (ns) of the last update of each scheduled component, in schedule
+     * order. Only recorded while profiling
+     */
+    std::span<const int64_t> GetDurations(void) const noexcept {return mDurations;}
+
+    /** @return Worker pool, nullptr if executing on the calling thread only */
+    ThreadPool* GetThreadPool(void) noexcept {return mPool.get();}
+
+    /**
+     * Sets the smallest level executed in parallel, smaller levels execute on the calling
+     * thread as dispatch would cost more than it saves
+     * @param Threshold Minimum number of components
+     */
+    void SetParallelThreshold(size_t Threshold) noexcept {mParallelThreshold = Threshold;}
+
+    /**
+     * @return Telemetry of the executive ("Time"), and of each component keyed by name.
+     * Nullptr until built
+     */
+    const Indexable* GetDynamicIndexMap(void) const {return mDynamicIndex.get();}
+
+private:
+
+    /**
+     * Executes the components of a level, then publishes their outputs
+     */
+    void ExecuteLevel(const Range& Level);
+
+    double mBaseRate = 1.0;
+    double mTime = 0.0;
+    uint64_t mFrame = 0;
+    size_t mParallelThreshold = 16;
+    bool mBuilt = false;
+    bool mProfiling = false;
+
+    // Components in the order added
+    std::vector<Component*> mComponents{};
+
+    // Scheduled components of each base frame of the major frame in turn, grouped by level within each frame
+    std::vector<Component*> mSchedule{};
+
+    // Ranges of mSchedule forming each level
+    std::vector<Range> mLevels{};
+
+    // Ranges of mLevels forming each base frame of the major frame
+    std::vector<Range> mFrames{};
+
+    // Duration (ns) of the last update of each scheduled component
+    std::vector<int64_t> mDurations{};
+
+    // Dependencies declared by the components when built, as declaring another invalidates the schedule
+    size_t mDependencies = 0;
+
+    std::unique_ptr<ThreadPool> mPool{};
+    std::unique_ptr<Indexable> mDynamicIndex{};
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fixed size log-linear histogram of durations (ns). Each power of two range is split
+ * into 16 linear buckets, bounding the relative error of reported percentiles to 1/16
+ * over the range 1 ns to 68 s, with longer durations clamped into the final bucket.
+ * Recording is constant time and never allocates, so may be used within a real time frame
+ */
+class LatencyHistogram
+{
+public:
+
+    /// Number of linear buckets per power of two
+    static constexpr uint32_t SUB_BUCKET_BITS = 4;
+    static constexpr uint32_t SUB_BUCKETS = uint32_t(1) << SUB_BUCKET_BITS;
+
+    /// Largest distinguishable duration is 2^MAX_EXPONENT ns
+    static constexpr uint32_t MAX_EXPONENT = 36;
+
+    static constexpr size_t BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    /**
+     * Records a duration
+     * @param Duration Duration (ns), negative durations are recorded as zero
+     */
+    constexpr void Record(int64_t Duration) noexcept
+    {
+        const uint64_t Value = (Duration > 0) ? static_cast<uint64_t>(Duration) : 0;
+
+        mCounts[BucketIndex(Value)]++;
+        mCount++;
+        mSum += Value;
+        mMin = (Value < mMin) ? Value : mMin;
+        mMax = (Value > mMax) ? Value : mMax;
+    }
+
+    /**
+     * Clears every recorded duration
+     */
+    constexpr void Reset(void) noexcept
+    {
+        *this = LatencyHistogram{};
+    }
+
+    /**
+     * @param Fraction Fraction of recorded durations at or below the returned value, in [0, 1]
+     * @return Duration (ns) at the given quantile, the midpoint of its bucket clamped to the
+     * recorded extremes. The extremes are exact, and zero if nothing has been recorded
+     */
+    constexpr int64_t Percentile(double Fraction) const noexcept
+    {
+        if ((mCount == 0) || (Fraction >= 1.0))
+        {
+            return Max();
+        }
+
+        if (Fraction <= 0.0)
+        {
+            return Min();
+        }
+
+        // Rank of the requested duration, at least the first
+        const double Target = Fraction * static_cast<double>(mCount);
+        const uint64_t Rank = (Target <= 1.0) ? 1 : static_cast<uint64_t>(Target + 0.5);
+        uint64_t Seen = 0;
+
+        for (size_t Index = 0; Index < BUCKETS; Index++)
+        {
+            Seen += mCounts[Index];
+
+            if (Seen >= Rank)
+            {
+                const uint64_t Lower = BucketLower(Index);
+                const uint64_t Midpoint = Lower + (BucketLower(Index + 1) - Lower) / 2;
+                const uint64_t Clamped = (Midpoint < mMin) ? mMin : ((Midpoint > mMax) ? mMax : Midpoint);
+                return static_cast<int64_t>(Clamped);
+            }
+        }
+
+        return static_cast<int64_t>(mMax);
+    }
+
+    /** @return Number of recorded durations */
+    constexpr uint64_t Count(void) const noexcept {return mCount;}
+
+    /** @return Mean recorded duration (ns), zero if nothing has been recorded */
+    constexpr double Mean(void) const noexcept
+    {
+        return (mCount > 0) ? static_cast<double>(mSum) / static_cast<double>(mCount) : 0.0;
+    }
+
+    /** @return Shortest recorded duration (ns), zero if nothing has been recorded */
+    constexpr int64_t Min(void) const noexcept {return (mCount > 0) ? static_cast<int64_t>(mMin) : 0;}
+
+    /** @return Longest recorded duration (ns) */
+    constexpr int64_t Max(void) const noexcept {return static_cast<int64_t>(mMax);}
+
+private:
+
+    /**
+     * @return Index of the bucket containing a duration
+     */
+    static constexpr uint64_t BucketIndex(uint64_t Value) noexcept
+    {
+        if (Value < SUB_BUCKETS)
+        {
+            return Value;
+        }
+
+        const uint32_t Exponent = static_cast<uint32_t>(std::bit_width(Value)) - 1;
+
+        if (Exponent >= MAX_EXPONENT)
+        {
+            return BUCKETS - 1;
+        }
+
+        // Leading bits below the most significant select the linear bucket
+        const uint64_t Mantissa = (Value >> (Exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+        return (Exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + Mantissa;
+    }
+
+    /**
+     * @return Smallest duration contained by a bucket
+     */
+    static constexpr uint64_t BucketLower(size_t Index) noexcept
+    {
+        if (Index < SUB_BUCKETS)
+        {
+            return Index;
+        }
+
+        const uint64_t Exponent = Index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+        const uint64_t Mantissa = Index % SUB_BUCKETS;
+        return (uint64_t(SUB_BUCKETS) + Mantissa) << (Exponent - SUB_BUCKET_BITS);
+    }
+
+    std::array<uint64_t, BUCKETS> mCounts{};
+    uint64_t mCount = 0;
+    uint64_t mSum = 0;
+    uint64_t mMin = UINT64_MAX;
+    uint64_t mMax = 0;
+};
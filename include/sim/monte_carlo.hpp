@@ -0,0 +1,272 @@
+#pragma once
+
+#include "concurrency/thread_pool.hpp"
+#include "meta/indexable.hpp"
+#include "numerics/random.hpp"
+#include "numerics/statistics.hpp"
+#include "utils/hstring.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * Distribution of a dispersed parameter
+ */
+enum class DistributionType
+{
+    UNIFORM,    // Uniform between a lower and upper bound
+    NORMAL      // Normal with a mean and standard deviation
+};
+
+/**
+ * Dispersed parameter
+ */
+struct Dispersion
+{
+    /// Key of the parameter, as indexed by the dynamic index of the dispersed object
+    HString Key{};
+
+    /// Distribution of the parameter
+    DistributionType Type = DistributionType::NORMAL;
+
+    /// Lower bound (UNIFORM) or mean (NORMAL)
+    double A = 0.0;
+
+    /// Upper bound (UNIFORM) or standard deviation (NORMAL)
+    double B = 0.0;
+};
+
+/**
+ * Set of dispersed parameters. The sample of each parameter of each case is generated from
+ * its own counter based random stream, identified by the seed, case and parameter, so is
+ * independent of the order in which cases execute and of the other parameters of the set
+ */
+class DispersionSet
+{
+public:
+
+    /**
+     * @param Key Key of the parameter
+     * @param Min Lower bound
+     * @param Max Upper bound
+     * @throws Error::GenericException if the key is already dispersed or the bounds are reversed
+     */
+    void AddUniform(const HString& Key, double Min, double Max);
+
+    /**
+     * @param Key Key of the parameter
+     * @param Mean Mean
+     * @param Sigma Standard deviation
+     * @throws Error::GenericException if the key is already dispersed or the deviation is negative
+     */
+    void AddNormal(const HString& Key, double Mean, double Sigma);
+
+    /**
+     * Disperses a parameter normally about its nominal value
+     * @param Key Key of the parameter
+     * @param Nominal Dynamic index of the nominal object, providing the mean at `Key`
+     * @param Sigma Standard deviation
+     * @throws Error::GenericException if the key is already dispersed or not indexed by `Nominal`,
+     * or the deviation is negative
+     */
+    void AddNormal(const HString& Key, const Indexable& Nominal, double Sigma);
+
+    /** @return Number of dispersed parameters */
+    size_t Size(void) const noexcept {return mDispersions.size();}
+
+    /** @return Dispersed parameters, in order of addition */
+    const std::vector<Dispersion>& GetDispersions(void) const noexcept {return mDispersions;}
+
+    /**
+     * @param Key Key of a parameter
+     * @return Index of the parameter
+     * @throws Error::GenericException if the key is not dispersed
+     */
+    size_t Find(const HString& Key) const;
+
+    /**
+     * @param Seed Seed of the experiment
+     * @param Case Index of the case
+     * @param Parameter Index of the parameter
+     * @return Sample of the parameter for the case
+     */
+    double Sample(uint64_t Seed, uint64_t Case, size_t Parameter) const noexcept;
+
+private:
+
+    /** Validates and appends a dispersion */
+    void Add(const Dispersion& Parameter);
+
+    std::vector<Dispersion> mDispersions{};
+};
+
+/**
+ * Sampled parameters of a single case, presented to the model
+ */
+class MonteCarloCase
+{
+public:
+
+    /**
+     * @param Dispersions Dispersed parameters, outliving the case
+     * @param Seed Seed of the experiment
+     */
+    MonteCarloCase(const DispersionSet& Dispersions, uint64_t Seed);
+
+    // The dynamic index refers to the samples
+    MonteCarloCase(const MonteCarloCase& Case) = delete;
+
+    /**
+     * Samples every parameter of a case
+     * @param Index Index of the case
+     */
+    void Reset(uint64_t Index) noexcept;
+
+    /** @return Index of the case */
+    uint64_t GetIndex(void) const noexcept {return mIndex;}
+
+    /**
+     * @param Parameter Index of the parameter, as DispersionSet::Find
+     * @return Sample of the parameter
+     */
+    double operator[](size_t Parameter) const noexcept {return mSamples[Parameter];}
+
+    /**
+     * @param Key Key of the parameter
+     * @return Sample of the parameter
+     * @throws Error::GenericException if the key is not dispersed
+     */
+    double Get(const HString& Key) const;
+
+    /**
+     * Random stream of the case for use by the model, i.e process or measurement noise,
+     * reproducible and independent of the streams of the dispersions
+     * @param Sub Sub-stream number, less than 2^31
+     * @return Random stream at its first element
+     */
+    Random::Stream GetStream(uint32_t Sub) const noexcept;
+
+    /**
+     * Dynamic index of the samples, by the key of each parameter
+     * @return Pointer to the dynamic index
+     */
+    const Indexable* GetDynamicIndexMap(void) const noexcept {return mDynamicIndex.get();}
+
+private:
+    const DispersionSet& mDispersions;
+    uint64_t mSeed = 0;
+    uint64_t mIndex = 0;
+    std::vector<double> mSamples{};
+    std::unique_ptr<Indexable> mDynamicIndex{};
+};
+
+/**
+ * Configuration of a Monte Carlo experiment
+ */
+struct MonteCarloOptions
+{
+    /// Number of cases
+    size_t Cases = 1000;
+
+    /// Seed of every random stream of the experiment
+    uint64_t Seed = 0;
+
+    /// Consecutive cases executed and reduced in sequence by a single thread. Statistics of
+    /// each chunk are merged in chunk order, so are identical for any number of threads
+    size_t ChunkSize = 16;
+};
+
+/**
+ * Statistics of each output of an experiment
+ */
+struct MonteCarloResult
+{
+    /// Name of each output
+    std::vector<HString> Outputs{};
+
+    /// Statistics of each output over every case
+    std::vector<Statistics::Accumulator> Statistics{};
+
+    /**
+     * @param Output Name of an output
+     * @return Statistics of the output
+     * @throws Error::GenericException if the output does not exist
+     */
+    const Statistics::Accumulator& Get(const HString& Output) const;
+};
+
+/**
+ * Runs a model over many dispersed cases in parallel, reducing statistics of the outputs
+ * of each case online such that no trajectory is stored. Results are bitwise reproducible
+ * for a given seed and chunk size, regardless of the number of threads or scheduling:
+ *
+ *  DispersionSet Dispersions;
+ *  Dispersions.AddNormal("Orbit.Inclination", *Nominal.GetDynamicIndexMap(), 0.01);
+ *
+ *  const MonteCarlo Experiment(Dispersions, {"Perigee"}, MonteCarloOptions{.Cases = 10000});
+ *  const MonteCarloResult Result = Experiment.Run(Pool, [&](const MonteCarloCase& Case, std::span<double> Outputs)
+ *  {
+ *      Outputs[0] = Simulate(Case.Get("Orbit.Inclination"));
+ *  });
+ */
+class MonteCarlo
+{
+public:
+
+    /**
+     * @param Dispersions Dispersed parameters
+     * @param Outputs Name of each output of the model
+     * @param Options Configuration
+     * @throws Error::GenericException if the chunk size is zero
+     */
+    MonteCarlo(const DispersionSet& Dispersions, const std::vector<HString>& Outputs, const MonteCarloOptions& Options);
+
+    /**
+     * Executes every case
+     * @param Pool Threads executing chunks of cases, with work stealing between threads
+     * @param Model Callable taking the `const MonteCarloCase&` and a span of outputs, zeroed
+     * before each case, to be written. Must not throw
+     * @return Statistics of each output
+     */
+    template <typename Func>
+    MonteCarloResult Run(ThreadPool& Pool, Func&& Model) const
+    {
+        const size_t Outputs = mOutputs.size();
+        const size_t Chunks = (mOptions.Cases + mOptions.ChunkSize - 1) / mOptions.ChunkSize;
+        std::vector<Statistics::Accumulator> Partial(Chunks * Outputs);
+
+        Pool.ParallelFor(Chunks, [&](size_t Chunk)
+        {
+            MonteCarloCase Case(mDispersions, mOptions.Seed);
+            std::vector<double> Values(Outputs);
+            const size_t Begin = Chunk * mOptions.ChunkSize;
+            const size_t End = (mOptions.Cases - Begin < mOptions.ChunkSize) ? mOptions.Cases : Begin + mOptions.ChunkSize;
+
+            for (size_t Index = Begin; Index < End; Index++)
+            {
+                Case.Reset(Index);
+                std::fill(Values.begin(), Values.end(), 0.0);
+                Model(static_cast<const MonteCarloCase&>(Case), std::span<double>(Values));
+
+                for (size_t Output = 0; Output < Outputs; Output++)
+                {
+                    Partial[Chunk * Outputs + Output].Add(Values[Output]);
+                }
+            }
+        });
+
+        return Reduce(Partial);
+    }
+
+private:
+
+    /** Merges the statistics of each chunk in order */
+    MonteCarloResult Reduce(const std::vector<Statistics::Accumulator>& Partial) const;
+
+    DispersionSet mDispersions{};
+    std::vector<HString> mOutputs{};
+    MonteCarloOptions mOptions{};
+};
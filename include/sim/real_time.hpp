@@ -0,0 +1,185 @@
+#pragma once
+
+#include "meta/indexable.hpp"
+#include "sim/executive.hpp"
+#include "sim/latency_histogram.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Behaviour following a frame that completes after its deadline
+ */
+enum class OverrunPolicy
+{
+    CATCH_UP,   // Release late frames immediately until the schedule is recovered
+    SKIP        // Realign releases to the next period boundary, simulation time falls behind wall clock
+};
+
+/**
+ * Configuration of real time execution
+ */
+struct RealTimeOptions
+{
+    /// Time (s) before each release at which the runner stops sleeping and spins on the clock
+    double SpinThreshold = 200.0E-6;
+
+    /// Behaviour following an overrun
+    OverrunPolicy Policy = OverrunPolicy::CATCH_UP;
+
+    /// Logical CPUs to pin to, the first for the calling thread and the remainder for the
+    /// executive workers in order. Empty leaves scheduling to the operating system
+    std::vector<size_t> Cpus{};
+
+    /// Locks current and future pages of the process into memory when started, until the
+    /// runner is destroyed. The lock is process wide, and its release also unlocks pages
+    /// locked by any other means
+    bool LockMemory = false;
+
+    /// Bytes of stack touched when started, such that frames do not page fault
+    size_t PrefaultStack = 256 * 1024;
+
+    /// Frames between publication of statistics to telemetry, zero publishes once per
+    /// second of the base rate
+    uint64_t PublishInterval = 0;
+};
+
+/**
+ * Published latency statistics (s) of a histogram
+ */
+struct LatencyStatistics
+{
+    int Count = 0;
+    double Mean = 0.0;
+    double P50 = 0.0;
+    double P99 = 0.0;
+    double P999 = 0.0;
+    double Max = 0.0;
+};
+
+/**
+ * Executes an executive in real time, releasing each base frame on a monotonic clock.
+ * Between frames the runner sleeps until shortly before the next release, then spins,
+ * trading CPU time for release jitter in the order of microseconds.
+ *
+ * The runner records the release jitter and duration of every frame, and the duration of
+ * every component update, into fixed size histograms. Statistics are published to the
+ * dynamic index at a fixed interval, as computing percentiles is too costly per frame:
+ *
+ *  Frames, Overruns, Skipped               int
+ *  MemoryLocked, Pinned                    bool
+ *  Jitter.<Statistic>, Frame.<Statistic>   LatencyStatistics of the release jitter and frame duration
+ *  Components.<Name>.<Statistic>           LatencyStatistics of each component update
+ *  Executive                               Dynamic index of the executive
+ */
+class RealTimeRunner
+{
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param Exec Executive to run, which must outlive the runner. Built when started if required
+     * @param Options Real time configuration
+     */
+    explicit RealTimeRunner(Executive& Exec, const RealTimeOptions& Options = RealTimeOptions{});
+
+    // Telemetry refers to members by address
+    RealTimeRunner(const RealTimeRunner& Other) = delete;
+
+    /**
+     * Unlocks the memory of the process if locked when started
+     */
+    ~RealTimeRunner();
+
+    /**
+     * Prepares for real time execution. Builds the executive if it has not been built or
+     * its schedule has been invalidated, applies CPU affinity, locks and prefaults memory,
+     * enables profiling and resets all statistics. The first frame is released immediately
+     * by the following Step
+     */
+    void Start(void);
+
+    /**
+     * Waits for the release of the next frame, then executes it. Starts the runner if
+     * required, or restarts it if the schedule of the executive has been invalidated
+     * @return False if the frame completed after its deadline
+     */
+    bool Step(void);
+
+    /**
+     * Executes a number of frames in real time
+     * @param Frames Number of base frames
+     */
+    void Run(uint64_t Frames);
+
+    /**
+     * Publishes the recorded statistics to the dynamic index
+     */
+    void Publish(void);
+
+    /** @return Histogram of release jitter (ns) */
+    const LatencyHistogram& GetJitter(void) const noexcept {return mJitter;}
+
+    /** @return Histogram of frame durations (ns) */
+    const LatencyHistogram& GetFrameDurations(void) const noexcept {return mFrameDurations;}
+
+    /**
+     * @param Index Index of the component in the order added to the executive
+     * @return Histogram of update durations (ns) of the component
+     */
+    const LatencyHistogram& GetComponentDurations(size_t Index) const noexcept {return mComponentDurations[Index];}
+
+    /** @return Number of frames which completed after their deadline */
+    uint64_t GetOverruns(void) const noexcept {return mOverrunCount;}
+
+    /** @return Dynamic index of the runner statistics, nullptr until started */
+    const Indexable* GetDynamicIndexMap(void) const {return mDynamicIndex.get();}
+
+private:
+
+    /**
+     * Sleeps then spins until the given time
+     */
+    void WaitUntil(Clock::time_point Release) const noexcept;
+
+    /**
+     * Records the duration of each component update of the given frame of the major frame
+     */
+    void RecordComponents(size_t Frame) noexcept;
+
+    Executive& mExecutive;
+    RealTimeOptions mOptions{};
+    bool mStarted = false;
+
+    // Release of the first frame, and index of the next release relative to it
+    Clock::time_point mEpoch{};
+    uint64_t mReleaseCount = 0;
+
+    uint64_t mFrameCount = 0;
+    uint64_t mOverrunCount = 0;
+    uint64_t mSkippedCount = 0;
+
+    LatencyHistogram mJitter{};
+    LatencyHistogram mFrameDurations{};
+    std::vector<LatencyHistogram> mComponentDurations{};
+
+    // Component index of each entry of the executive schedule
+    std::vector<size_t> mScheduleComponents{};
+
+    // Published telemetry, sized once when started such that addresses are stable
+    int mFrames = 0;
+    int mOverruns = 0;
+    int mSkipped = 0;
+    bool mMemoryLocked = false;
+    bool mPinned = false;
+    LatencyStatistics mJitterStatistics{};
+    LatencyStatistics mFrameStatistics{};
+    std::vector<LatencyStatistics> mComponentStatistics{};
+    std::vector<std::unique_ptr<Indexable>> mStatisticsIndices{};
+    std::unique_ptr<Indexable> mComponentIndex{};
+    std::unique_ptr<Indexable> mDynamicIndex{};
+};
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "concurrency/spsc_ring.hpp"
+#include "meta/indexable.hpp"
+#include "utils/hstring.hpp"
+#include "utils/mapped_file.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Type of a recorded parameter. Every value is recorded as a double, the type allows
+ * post-processing to recover the original
+ */
+enum class TelemetryType : uint8_t
+{
+    DOUBLE,
+    INT,
+    BOOL
+};
+
+/**
+ * Configuration of a recorder
+ */
+struct RecorderOptions
+{
+    /// Frames buffered between the simulation and the writer thread
+    size_t RingFrames = 4096;
+
+    /// Frames compressed and written together, per column
+    size_t ChunkFrames = 1024;
+
+    /// Record waits for the writer when the buffer is full, otherwise the frame is dropped
+    bool Block = true;
+};
+
+/**
+ * Records parameters bound by their `Indexable` key to a binary columnar file. Each frame
+ * the bound values are copied into a lock free ring, from which a writer thread transposes
+ * frames into columns, compresses and writes them in chunks. Recording a frame does not
+ * format, allocate or perform I/O.
+ *
+ * Axis3 and Quaternion parameters are recorded as a column per element (`Key.X` etc.). The
+ * first column of every file is the frame time, named `Time`.
+ *
+ * The file is a schema header followed by chunks, in native byte order:
+ *
+ *  Header  "HTLM", u32 version, u32 columns, per column {u8 type, u16 name length, name}
+ *  Chunk   u32 frames, u32 bytes of each column, compressed data of each column
+ *
+ * Columns are compressed by XOR of each value with the previous value of the column,
+ * stored as a control byte counting the leading and trailing zero bytes followed by the
+ * remaining bytes. Constant and slowly varying parameters reduce to one or a few bytes
+ */
+class Recorder
+{
+public:
+
+    /**
+     * @param Path Path of the file to write
+     * @param Options Configuration
+     */
+    explicit Recorder(const std::string& Path, const RecorderOptions& Options = {});
+
+    /**
+     * Stops recording, if started
+     */
+    ~Recorder();
+
+    // The writer thread refers to the recorder
+    Recorder(const Recorder& Other) = delete;
+
+    /**
+     * Binds a parameter, recorded each frame from its address
+     * @param Source Dynamic index of the object owning the parameter, which must outlive recording
+     * @param Key Key of the parameter, also the name of its column
+     * @throws Error::GenericException if recording has started, the key is not indexed or
+     * is already bound
+     */
+    void Bind(const Indexable& Source, const HString& Key);
+
+    /**
+     * Writes the schema and starts the writer thread
+     * @throws Error::GenericException if already started or the file cannot be opened
+     */
+    void Start(void);
+
+    /**
+     * Records the current value of every bound parameter. Does nothing unless started
+     * @param Time Time of the frame
+     */
+    void Record(double Time) noexcept;
+
+    /**
+     * Writes every recorded frame, stops the writer thread and closes the file. Once a
+     * write fails, later frames are discarded and the failure reported here
+     * @throws Error::GenericException if the file could not be written
+     */
+    void Stop(void);
+
+    /** @return Number of columns, including the time */
+    size_t Columns(void) const noexcept {return 1 + mDoubles.size() + mInts.size() + mBools.size();}
+
+    /** @return Frames recorded */
+    uint64_t GetFrames(void) const noexcept {return mFrames;}
+
+    /** @return Frames dropped as the buffer was full */
+    uint64_t GetDropped(void) const noexcept {return mDropped;}
+
+private:
+
+    /** Adds the name of a column, rejecting duplicates */
+    void AddName(std::vector<HString>& Names, const HString& Name);
+
+    /** Writer thread entry point */
+    void WriterLoop(void);
+
+    std::string mPath{};
+    RecorderOptions mOptions{};
+
+    // Bound parameters, by type, and the name of each column
+    std::vector<const double*> mDoubles{};
+    std::vector<const int*> mInts{};
+    std::vector<const bool*> mBools{};
+    std::vector<HString> mDoubleNames{};
+    std::vector<HString> mIntNames{};
+    std::vector<HString> mBoolNames{};
+
+    // Opened by Start, then written only by the writer thread
+    std::ofstream mFile{};
+
+    std::unique_ptr<SpscRing<double>> mRing{};
+    std::thread mWriter{};
+    std::atomic<bool> mStop{false};
+    std::atomic<bool> mFailed{false};
+
+    // Producer thread counters
+    uint64_t mFrames = 0;
+    uint64_t mDropped = 0;
+};
+
+/**
+ * Reads a file written by a Recorder. The file is memory mapped and only the chunks of
+ * the requested columns are decompressed
+ */
+class TelemetryReader
+{
+public:
+
+    /**
+     * @param Path Path of the file
+     * @throws Error::GenericException if the file cannot be mapped or is not a valid recording
+     */
+    explicit TelemetryReader(const std::string& Path);
+
+    /** @return Number of columns, including the time */
+    size_t Columns(void) const noexcept {return mNames.size();}
+
+    /** @return Number of frames */
+    uint64_t Frames(void) const noexcept {return mFrames;}
+
+    /**
+     * @param Column Index of a column
+     * @return Name of the column
+     */
+    const HString& GetName(size_t Column) const noexcept {return mNames[Column];}
+
+    /**
+     * @param Column Index of a column
+     * @return Type of the column
+     */
+    TelemetryType GetType(size_t Column) const noexcept {return mTypes[Column];}
+
+    /**
+     * @param Name Name of a column
+     * @return Index of the column
+     * @throws Error::GenericException if the column does not exist
+     */
+    size_t Find(const HString& Name) const;
+
+    /**
+     * @param Column Index of a column
+     * @return Value of the column in every frame
+     * @throws Error::GenericException if the column does not exist, or a block of the column
+     * does not decode to exactly the frames of its chunk
+     */
+    std::vector<double> ReadColumn(size_t Column) const;
+
+    /**
+     * @param Name Name of a column
+     * @return Value of the column in every frame
+     * @throws Error::GenericException if the column does not exist or is malformed
+     */
+    std::vector<double> ReadColumn(const HString& Name) const {return ReadColumn(Find(Name));}
+
+private:
+
+    /**
+     * Location of the compressed data of a column within a chunk
+     */
+    struct Block
+    {
+        size_t Offset = 0;
+        size_t Bytes = 0;
+    };
+
+    MappedFile mFile{};
+    std::vector<HString> mNames{};
+    std::vector<TelemetryType> mTypes{};
+    uint64_t mFrames = 0;
+
+    // Frames of each chunk, and the block of each column of each chunk
+    std::vector<uint32_t> mChunkFrames{};
+    std::vector<Block> mBlocks{};
+};
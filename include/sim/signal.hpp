@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Type independent handle of a double buffered signal, allowing the executive to
+ * publish signals without knowledge of their type
+ */
+class SignalBase
+{
+public:
+
+    /**
+     * Publishes the value written during the current level, performed by the executive
+     * once every component of the level has completed
+     */
+    void Flip(void) noexcept {mFront ^= uint8_t(1);}
+
+protected:
+
+    // Index of the buffer visible to readers
+    uint8_t mFront = 0;
+};
+
+/**
+ * Double buffered value produced by a single component and read by any number of others.
+ * Readers always observe the last published value while the producer writes the next,
+ * such that components may execute in parallel without locks on the data path.
+ *
+ * The back buffer holds the value published two updates ago, so a producer must write
+ * the complete value on each update
+ */
+template <typename T>
+class Signal : public SignalBase
+{
+public:
+
+    Signal() = default;
+
+    /**
+     * @param Initial Value visible to readers until the first publication
+     */
+    explicit Signal(const T& Initial) : mBuffers{Initial, Initial} { }
+
+    /**
+     * @return Last published value
+     */
+    const T& Get(void) const noexcept {return mBuffers[mFront];}
+
+    /**
+     * Writes the next value, published at the end of the producing component's level
+     * @param Value Next value
+     */
+    void Set(const T& Value) noexcept(std::is_nothrow_copy_assignable_v<T>) {mBuffers[mFront ^ uint8_t(1)] = Value;}
+
+    /**
+     * @return Mutable reference to the next value, for in place construction of large values
+     */
+    T& Next(void) noexcept {return mBuffers[mFront ^ uint8_t(1)];}
+
+private:
+    std::array<T, 2> mBuffers{};
+};
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "math/core_math.hpp"
+
+#include <cstdint>
+
+/**
+ * @file epoch.hpp
+ * High precision two part epoch and calendar helpers
+ */
+
+namespace Time
+{
+    /// Seconds in a (non leap second) day
+    constexpr double SECONDS_PER_DAY = 86400.0;
+
+    /// Julian date of the J2000 epoch (2000-01-01 12:00:00)
+    constexpr double J2000_JULIAN_DATE = 2451545.0;
+
+    /// Days between the unix epoch (1970-01-01) and the J2000 epoch date (2000-01-01)
+    constexpr int64_t UNIX_TO_J2000_DAYS = 10957;
+
+    /**
+     * Supported time scales
+     */
+    enum struct TimeScale
+    {
+        /// Coordinated universal time
+        UTC,
+
+        /// International atomic time
+        TAI,
+
+        /// Terrestrial time
+        TT,
+
+        /// Barycentric dynamical time, the time scale of Spice ephemeris epochs
+        TDB,
+
+        /// Global positioning system time
+        GPS
+    };
+
+    /**
+     * Two part epoch consisting of whole days and a fraction of a day since J2000
+     * (2000-01-01 12:00:00) in some time scale. Retains sub nanosecond resolution over
+     * many centuries, unlike a single double of seconds.
+     *
+     * Within a UTC day containing a leap second, the fraction of the leap second
+     * is carried into the following day
+     */
+    struct Epoch
+    {
+        /// Whole days since J2000
+        double Day = 0.0;
+
+        /// Fraction of a day [0, 1)
+        double Fraction = 0.0;
+
+        /**
+         * @return Equivalent epoch with the fraction in the range [0, 1)
+         */
+        constexpr Epoch Normalise(void) const noexcept
+        {
+            const double Whole = Math::Floor(Fraction);
+            return Epoch{.Day = Day + Whole, .Fraction = Fraction - Whole};
+        }
+
+        /**
+         * @param Seconds Seconds since J2000
+         * @return Epoch
+         */
+        static constexpr Epoch FromSeconds(double Seconds) noexcept
+        {
+            const double Days = Math::Floor(Seconds / SECONDS_PER_DAY);
+            return Epoch{.Day = Days, .Fraction = (Seconds - Days * SECONDS_PER_DAY) / SECONDS_PER_DAY}.Normalise();
+        }
+
+        /**
+         * @param JulianDate Julian date, or the first part of a two part julian date
+         * @param JulianDate2 Second part of a two part julian date
+         * @return Epoch
+         */
+        static constexpr Epoch FromJulianDate(double JulianDate, double JulianDate2 = 0.0) noexcept
+        {
+            const double Days = JulianDate - J2000_JULIAN_DATE;
+            const double Whole = Math::Floor(Days);
+            return Epoch{.Day = Whole, .Fraction = (Days - Whole) + JulianDate2}.Normalise();
+        }
+
+        /**
+         * @return Seconds since J2000. Resolution is limited to that of a single double
+         */
+        constexpr double ToSeconds(void) const noexcept
+        {
+            return Day * SECONDS_PER_DAY + Fraction * SECONDS_PER_DAY;
+        }
+
+        /**
+         * @return Julian date. Resolution is limited to that of a single double
+         */
+        constexpr double ToJulianDate(void) const noexcept
+        {
+            return J2000_JULIAN_DATE + Day + Fraction;
+        }
+
+        /**
+         * @param Seconds Seconds to advance the epoch by, may be negative
+         * @return Advanced epoch
+         */
+        constexpr Epoch AddSeconds(double Seconds) const noexcept
+        {
+            return Epoch{.Day = Day, .Fraction = Fraction + Seconds / SECONDS_PER_DAY}.Normalise();
+        }
+
+        /**
+         * @param Other Epoch to difference against, in the same time scale
+         * @return Seconds elapsed from `Other` to this epoch
+         */
+        constexpr double SecondsSince(const Epoch& Other) const noexcept
+        {
+            return (Day - Other.Day) * SECONDS_PER_DAY + (Fraction - Other.Fraction) * SECONDS_PER_DAY;
+        }
+
+        /** Epoch comparison */
+        constexpr bool operator==(const Epoch& Other) const noexcept
+        {
+            return (Day == Other.Day) && (Fraction == Other.Fraction);
+        }
+
+        constexpr bool operator<(const Epoch& Other) const noexcept
+        {
+            return (Day < Other.Day) || ((Day == Other.Day) && (Fraction < Other.Fraction));
+        }
+    };
+
+    /**
+     * Proleptic gregorian calendar date
+     */
+    struct CalendarDate
+    {
+        int64_t Year = 2000;
+        int Month = 1;
+        int Day = 1;
+    };
+
+    /**
+     * @param Year Gregorian year
+     * @return `true` if `Year` is a leap year
+     */
+    constexpr bool IsLeapYear(int64_t Year) noexcept
+    {
+        return ((Year % 4 == 0) && (Year % 100 != 0)) || (Year % 400 == 0);
+    }
+
+    /**
+     * @param Year Gregorian year
+     * @param Month Month of the year (1 - 12)
+     * @return Number of days in the month
+     */
+    constexpr int DaysInMonth(int64_t Year, int Month) noexcept
+    {
+        constexpr int DAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return ((Month == 2) && IsLeapYear(Year)) ? 29 : DAYS[Month - 1];
+    }
+
+    /**
+     * Days from the unix epoch to a gregorian date
+     * Based upon "chrono-Compatible Low-Level Date Algorithms", Howard Hinnant
+     * @param Date Calendar date
+     * @return Days since 1970-01-01
+     */
+    constexpr int64_t DaysFromCivil(const CalendarDate& Date) noexcept
+    {
+        const int64_t Year = Date.Year - ((Date.Month <= 2) ? 1 : 0);
+        const int64_t Era = ((Year >= 0) ? Year : Year - 399) / 400;
+        const int64_t YearOfEra = Year - Era * 400;
+        const int64_t DayOfYear = (153 * (Date.Month + ((Date.Month > 2) ? -3 : 9)) + 2) / 5 + Date.Day - 1;
+        const int64_t DayOfEra = YearOfEra * 365 + YearOfEra / 4 - YearOfEra / 100 + DayOfYear;
+        return Era * 146097 + DayOfEra - 719468;
+    }
+
+    /**
+     * Gregorian date from days since the unix epoch
+     * Based upon "chrono-Compatible Low-Level Date Algorithms", Howard Hinnant
+     * @param Days Days since 1970-01-01
+     * @return Calendar date
+     */
+    constexpr CalendarDate CivilFromDays(int64_t Days) noexcept
+    {
+        Days += 719468;
+        const int64_t Era = ((Days >= 0) ? Days : Days - 146096) / 146097;
+        const int64_t DayOfEra = Days - Era * 146097;
+        const int64_t YearOfEra = (DayOfEra - DayOfEra / 1460 + DayOfEra / 36524 - DayOfEra / 146096) / 365;
+        const int64_t DayOfYear = DayOfEra - (365 * YearOfEra + YearOfEra / 4 - YearOfEra / 100);
+        const int64_t MonthPrime = (5 * DayOfYear + 2) / 153;
+        const int Day = static_cast<int>(DayOfYear - (153 * MonthPrime + 2) / 5 + 1);
+        const int Month = static_cast<int>((MonthPrime < 10) ? MonthPrime + 3 : MonthPrime - 9);
+
+        return CalendarDate{.Year = YearOfEra + Era * 400 + ((Month <= 2) ? 1 : 0), .Month = Month, .Day = Day};
+    }
+
+    /**
+     * @param Date Calendar date
+     * @param Hour Hour of the day (0 - 23)
+     * @param Minute Minute of the hour (0 - 59)
+     * @param Second Second of the minute [0, 61)
+     * @return Epoch at the given date and time, in the time scale of the calendar
+     */
+    constexpr Epoch FromCalendar(const CalendarDate& Date, int Hour = 0, int Minute = 0, double Second = 0.0) noexcept
+    {
+        // Calendar days begin at midnight, J2000 days begin at noon
+        const int64_t Days = DaysFromCivil(Date) - UNIX_TO_J2000_DAYS - 1;
+        const double Seconds = static_cast<double>(Hour * 3600 + Minute * 60) + Second;
+
+        return Epoch{.Day = static_cast<double>(Days), .Fraction = 0.5 + Seconds / SECONDS_PER_DAY}.Normalise();
+    }
+}
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "time/epoch.hpp"
+#include "time/leap_seconds.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+/**
+ * @file iso8601.hpp
+ * Allocation free ISO-8601 date/time parsing and formatting. The time scale of the
+ * text is not interpreted, i.e a UTC string yields a UTC epoch, other than a leap second
+ * being validated against a UTC leap second table
+ */
+
+namespace Time
+{
+    /**
+     * Outcome of parsing a date/time string
+     */
+    enum struct ParseStatus
+    {
+        /// String parsed successfully
+        SUCCESS,
+
+        /// String does not follow YYYY-MM-DD[Thh:mm[:ss[.fff]]][Z]
+        INVALID_FORMAT,
+
+        /// Month or day of the month out of range
+        INVALID_DATE,
+
+        /// Hour, minute or second out of range, including second 60 other than at a leap second
+        INVALID_TIME
+    };
+
+    /**
+     * Parsed epoch and status
+     */
+    struct ParseResult
+    {
+        Epoch Value{};
+        ParseStatus Status = ParseStatus::INVALID_FORMAT;
+    };
+
+    namespace Detail
+    {
+        /**
+         * Parses a fixed number of decimal digits
+         * @return Parsed value, or -1 if any character is not a digit
+         */
+        constexpr int64_t ParseDigits(std::string_view Str, size_t Start, size_t Count) noexcept
+        {
+            if (Start + Count > Str.size())
+            {
+                return -1;
+            }
+
+            int64_t Value = 0;
+
+            for (size_t Index = Start; Index < Start + Count; Index++)
+            {
+                if ((Str[Index] < '0') || (Str[Index] > '9'))
+                {
+                    return -1;
+                }
+
+                Value = Value * 10 + (Str[Index] - '0');
+            }
+
+            return Value;
+        }
+
+        /**
+         * Writes a zero padded decimal value
+         */
+        constexpr void WriteDigits(std::span<char> Buffer, size_t Start, size_t Count, int64_t Value) noexcept
+        {
+            for (size_t Index = Start + Count; Index > Start; Index--)
+            {
+                Buffer[Index - 1] = static_cast<char>('0' + (Value % 10));
+                Value /= 10;
+            }
+        }
+    }
+
+    /**
+     * Parses an ISO-8601 calendar date/time of the form YYYY-MM-DD[Thh:mm[:ss[.fff]]][Z],
+     * a space may be used in place of the 'T' separator. Second 60 is accepted only in the
+     * last minute of a day ending in a leap second of the table
+     * @param Str Date/time string
+     * @param Table Leap second table validating second 60
+     * @return Epoch and status, the epoch is only valid if the status is SUCCESS
+     */
+    constexpr ParseResult ParseISO8601(std::string_view Str, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        ParseResult Result{};
+
+        const int64_t Year = Detail::ParseDigits(Str, 0, 4);
+        const int64_t Month = Detail::ParseDigits(Str, 5, 2);
+        const int64_t Day = Detail::ParseDigits(Str, 8, 2);
+
+        if ((Year < 0) || (Month < 0) || (Day < 0) || (Str[4] != '-') || (Str[7] != '-'))
+        {
+            return Result;
+        }
+
+        if ((Month < 1) || (Month > 12) || (Day < 1) || (Day > DaysInMonth(Year, static_cast<int>(Month))))
+        {
+            Result.Status = ParseStatus::INVALID_DATE;
+            return Result;
+        }
+
+        int64_t Hour = 0;
+        int64_t Minute = 0;
+        int64_t Second = 0;
+        double SubSecond = 0.0;
+        size_t Position = 10;
+
+        if ((Position < Str.size()) && ((Str[Position] == 'T') || (Str[Position] == ' ')))
+        {
+            Hour = Detail::ParseDigits(Str, Position + 1, 2);
+            Minute = Detail::ParseDigits(Str, Position + 4, 2);
+
+            if ((Hour < 0) || (Minute < 0) || (Str[Position + 3] != ':'))
+            {
+                return Result;
+            }
+
+            Position += 6;
+
+            if ((Position < Str.size()) && (Str[Position] == ':'))
+            {
+                Second = Detail::ParseDigits(Str, Position + 1, 2);
+
+                if (Second < 0)
+                {
+                    return Result;
+                }
+
+                Position += 3;
+
+                if ((Position < Str.size()) && ((Str[Position] == '.') || (Str[Position] == ',')))
+                {
+                    double Scale = 0.1;
+                    Position++;
+
+                    const size_t DigitsStart = Position;
+
+                    while ((Position < Str.size()) && (Str[Position] >= '0') && (Str[Position] <= '9'))
+                    {
+                        SubSecond += Scale * static_cast<double>(Str[Position] - '0');
+                        Scale *= 0.1;
+                        Position++;
+                    }
+
+                    if (Position == DigitsStart)
+                    {
+                        return Result;
+                    }
+                }
+            }
+        }
+
+        if ((Position < Str.size()) && (Str[Position] == 'Z'))
+        {
+            Position++;
+        }
+
+        if (Position != Str.size())
+        {
+            return Result;
+        }
+
+        const CalendarDate Date{.Year = Year, .Month = static_cast<int>(Month), .Day = static_cast<int>(Day)};
+
+        if ((Hour > 23) || (Minute > 59) || (Second > 60) ||
+            ((Second == 60) && ((Hour != 23) || (Minute != 59) || (Table.HasLeapSecond(Date) == false))))
+        {
+            Result.Status = ParseStatus::INVALID_TIME;
+            return Result;
+        }
+
+        // Whole seconds and the fraction are combined separately to retain precision
+        Result.Value = FromCalendar(Date, static_cast<int>(Hour), static_cast<int>(Minute), static_cast<double>(Second))
+            .AddSeconds(SubSecond);
+        Result.Status = ParseStatus::SUCCESS;
+
+        return Result;
+    }
+
+    /**
+     * @param Decimals Number of fractional second digits
+     * @return Number of characters required to format an epoch, excluding the null terminator
+     */
+    constexpr size_t ISO8601Length(size_t Decimals) noexcept
+    {
+        return 19 + ((Decimals > 0) ? Decimals + 1 : 0);
+    }
+
+    /**
+     * Formats an epoch as YYYY-MM-DDThh:mm:ss[.fff], rounded to the given number of
+     * decimal places. Years outside of 0 - 9999 are not supported. No null terminator
+     * is written
+     * @param Value Epoch
+     * @param Buffer Output characters, requires at least `ISO8601Length(Decimals)`
+     * @param Decimals Number of fractional second digits (0 - 9)
+     * @return Number of characters written, zero if the buffer is too small
+     */
+    constexpr size_t FormatISO8601(const Epoch& Value, std::span<char> Buffer, size_t Decimals = 3) noexcept
+    {
+        const size_t Length = ISO8601Length(Decimals);
+
+        if ((Buffer.size() < Length) || (Decimals > 9))
+        {
+            return 0;
+        }
+
+        int64_t Scale = 1;
+
+        for (size_t Index = 0; Index < Decimals; Index++)
+        {
+            Scale *= 10;
+        }
+
+        // Shift to days starting at midnight then round to the requested resolution
+        const Epoch Midnight = Epoch{.Day = Value.Day, .Fraction = Value.Fraction + 0.5}.Normalise();
+        const int64_t UnitsPerDay = 86400 * Scale;
+        int64_t Units = static_cast<int64_t>(Math::Floor(Midnight.Fraction * static_cast<double>(UnitsPerDay) + 0.5));
+        int64_t Days = static_cast<int64_t>(Midnight.Day);
+
+        if (Units >= UnitsPerDay)
+        {
+            Units -= UnitsPerDay;
+            Days++;
+        }
+
+        const CalendarDate Date = CivilFromDays(Days + UNIX_TO_J2000_DAYS);
+        const int64_t Seconds = Units / Scale;
+
+        Detail::WriteDigits(Buffer, 0, 4, Date.Year);
+        Buffer[4] = '-';
+        Detail::WriteDigits(Buffer, 5, 2, Date.Month);
+        Buffer[7] = '-';
+        Detail::WriteDigits(Buffer, 8, 2, Date.Day);
+        Buffer[10] = 'T';
+        Detail::WriteDigits(Buffer, 11, 2, Seconds / 3600);
+        Buffer[13] = ':';
+        Detail::WriteDigits(Buffer, 14, 2, (Seconds / 60) % 60);
+        Buffer[16] = ':';
+        Detail::WriteDigits(Buffer, 17, 2, Seconds % 60);
+
+        if (Decimals > 0)
+        {
+            Buffer[19] = '.';
+            Detail::WriteDigits(Buffer, 20, Decimals, Units % Scale);
+        }
+
+        return Length;
+    }
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "time/epoch.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+/**
+ * @file leap_seconds.hpp
+ * Leap second and TDB model tables, equivalent to the contents of a NAIF leap
+ * seconds kernel (LSK)
+ */
+
+namespace Time
+{
+    /**
+     * Single step change of TAI - UTC
+     */
+    struct LeapSecond
+    {
+        /// UTC days since J2000 at which the offset takes effect (midnight, i.e -10227.5)
+        double Day = 0.0;
+
+        /// TAI - UTC (s) from `Day` onwards
+        double Offset = 0.0;
+    };
+
+    /**
+     * Constants of the TDB - TT model used by Spice
+     *
+     * TDB - TT = K * sin(E), E = M + EB * sin(M), M = M0 + M1 * t
+     *
+     * where t is seconds past J2000 TT
+     */
+    struct TDBModel
+    {
+        /// TT - TAI (s)
+        double DeltaTA = 32.184;
+
+        /// Amplitude (s)
+        double K = 1.657E-3;
+
+        /// Eccentricity of the Earth-Moon barycentre orbit
+        double EB = 1.671E-2;
+
+        /// Mean anomaly at J2000 (rad)
+        double M0 = 6.239996;
+
+        /// Mean anomaly rate (rad/s)
+        double M1 = 1.99096871E-7;
+    };
+
+    /**
+     * Fixed capacity table of leap seconds, usable within constant expressions and
+     * free of any allocation when queried
+     */
+    class LeapSecondTable
+    {
+    public:
+
+        /// Maximum number of leap second entries
+        static constexpr size_t CAPACITY = 64;
+
+        constexpr LeapSecondTable() = default;
+
+        /**
+         * @return Table equivalent to the naif0012.tls kernel distributed with Hamilton
+         */
+        static constexpr LeapSecondTable Default(void) noexcept
+        {
+            constexpr std::array<CalendarDate, 28> DATES = {{
+                {1972, 1, 1}, {1972, 7, 1}, {1973, 1, 1}, {1974, 1, 1}, {1975, 1, 1}, {1976, 1, 1},
+                {1977, 1, 1}, {1978, 1, 1}, {1979, 1, 1}, {1980, 1, 1}, {1981, 7, 1}, {1982, 7, 1},
+                {1983, 7, 1}, {1985, 7, 1}, {1988, 1, 1}, {1990, 1, 1}, {1991, 1, 1}, {1992, 7, 1},
+                {1993, 7, 1}, {1994, 7, 1}, {1996, 1, 1}, {1997, 7, 1}, {1999, 1, 1}, {2006, 1, 1},
+                {2009, 1, 1}, {2012, 7, 1}, {2015, 7, 1}, {2017, 1, 1}
+            }};
+
+            LeapSecondTable Table{};
+
+            for (size_t Index = 0; Index < DATES.size(); Index++)
+            {
+                Table.AddEntry(DATES[Index], 10.0 + static_cast<double>(Index));
+            }
+
+            return Table;
+        }
+
+        /**
+         * Appends a leap second, entries must be added in chronological order
+         * @param Date UTC date at which the offset takes effect (from midnight)
+         * @param Offset TAI - UTC (s) from `Date` onwards
+         * @return `false` if the table is full or the entry is out of order
+         */
+        constexpr bool AddEntry(const CalendarDate& Date, double Offset) noexcept
+        {
+            const Epoch Start = FromCalendar(Date);
+            const double Day = Start.Day + Start.Fraction;
+
+            if ((mSize == CAPACITY) || ((mSize > 0) && (Day <= mEntries[mSize - 1].Day)))
+            {
+                return false;
+            }
+
+            mEntries[mSize++] = LeapSecond{.Day = Day, .Offset = Offset};
+            return true;
+        }
+
+        /**
+         * @param UTC Epoch in UTC
+         * @return TAI - UTC (s) at the given epoch, zero prior to the first entry
+         */
+        constexpr double OffsetFromUTC(const Epoch& UTC) const noexcept
+        {
+            const double Day = UTC.Day + UTC.Fraction;
+
+            // Most queries are for recent epochs, search backwards from the latest entry
+            for (size_t Index = mSize; Index > 0; Index--)
+            {
+                if (Day >= mEntries[Index - 1].Day)
+                {
+                    return mEntries[Index - 1].Offset;
+                }
+            }
+
+            return 0.0;
+        }
+
+        /**
+         * @param TAI Epoch in TAI
+         * @return TAI - UTC (s) at the given epoch, zero prior to the first entry
+         */
+        constexpr double OffsetFromTAI(const Epoch& TAI) const noexcept
+        {
+            const double Day = TAI.Day + TAI.Fraction;
+
+            for (size_t Index = mSize; Index > 0; Index--)
+            {
+                const LeapSecond& Entry = mEntries[Index - 1];
+
+                if (Day >= Entry.Day + Entry.Offset / SECONDS_PER_DAY)
+                {
+                    return Entry.Offset;
+                }
+            }
+
+            return 0.0;
+        }
+
+        /**
+         * @param Date UTC date
+         * @return `true` if a leap second is inserted at the end of the date, i.e its last
+         * minute has a second 60. The offset of the first entry is not a leap second
+         */
+        constexpr bool HasLeapSecond(const CalendarDate& Date) const noexcept
+        {
+            const Epoch Start = FromCalendar(Date);
+            const double Following = Start.Day + Start.Fraction + 1.0;
+
+            for (size_t Index = mSize; Index > 1; Index--)
+            {
+                if (mEntries[Index - 1].Day == Following)
+                {
+                    return mEntries[Index - 1].Offset > mEntries[Index - 2].Offset;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @return Number of leap second entries
+         */
+        constexpr size_t Size(void) const noexcept {return mSize;}
+
+        /**
+         * @return Entry at the given index, unchecked
+         */
+        constexpr const LeapSecond& operator[](size_t Index) const noexcept {return mEntries[Index];}
+
+        /**
+         * @return TDB - TT model constants
+         */
+        constexpr const TDBModel& GetTDBModel(void) const noexcept {return mTDB;}
+
+        /**
+         * @param Model TDB - TT model constants
+         */
+        constexpr void SetTDBModel(const TDBModel& Model) noexcept {mTDB = Model;}
+
+    private:
+        std::array<LeapSecond, CAPACITY> mEntries{};
+        size_t mSize = 0;
+        TDBModel mTDB{};
+    };
+
+    /// Leap second table compiled into Hamilton
+    constexpr LeapSecondTable DEFAULT_LEAP_SECONDS = LeapSecondTable::Default();
+
+    /**
+     * Parses a NAIF text leap seconds kernel (i.e naif0012.tls). Intended to be called
+     * once at start up, the returned table is then passed to the time scale conversions
+     * @param Path Path to the kernel
+     * @return Leap second table
+     * @throws Error::GenericException if the file cannot be read or is malformed
+     */
+    LeapSecondTable LoadLeapSecondKernel(const std::string& Path);
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "time/epoch.hpp"
+#include "time/leap_seconds.hpp"
+
+/**
+ * @file time_scales.hpp
+ * Conversions between the UTC, TAI, TT, TDB and GPS time scales. All conversions
+ * pass through TAI, and are usable within constant expressions
+ */
+
+namespace Time
+{
+    /// TAI - GPS (s), constant since the GPS epoch (1980-01-06)
+    constexpr double TAI_MINUS_GPS = 19.0;
+
+    /**
+     * @param UTC Epoch in UTC
+     * @param Table Leap second table
+     * @return Epoch in TAI
+     */
+    constexpr Epoch UTC2TAI(const Epoch& UTC, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return UTC.AddSeconds(Table.OffsetFromUTC(UTC));
+    }
+
+    /**
+     * An epoch within a leap second maps onto the first second of the following day
+     * @param TAI Epoch in TAI
+     * @param Table Leap second table
+     * @return Epoch in UTC
+     */
+    constexpr Epoch TAI2UTC(const Epoch& TAI, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return TAI.AddSeconds(-Table.OffsetFromTAI(TAI));
+    }
+
+    /**
+     * @param TAI Epoch in TAI
+     * @param Table Table providing TT - TAI
+     * @return Epoch in TT
+     */
+    constexpr Epoch TAI2TT(const Epoch& TAI, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return TAI.AddSeconds(Table.GetTDBModel().DeltaTA);
+    }
+
+    /**
+     * @param TT Epoch in TT
+     * @param Table Table providing TT - TAI
+     * @return Epoch in TAI
+     */
+    constexpr Epoch TT2TAI(const Epoch& TT, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return TT.AddSeconds(-Table.GetTDBModel().DeltaTA);
+    }
+
+    /**
+     * @param TAI Epoch in TAI
+     * @return Epoch in GPS time
+     */
+    constexpr Epoch TAI2GPS(const Epoch& TAI) noexcept
+    {
+        return TAI.AddSeconds(-TAI_MINUS_GPS);
+    }
+
+    /**
+     * @param GPS Epoch in GPS time
+     * @return Epoch in TAI
+     */
+    constexpr Epoch GPS2TAI(const Epoch& GPS) noexcept
+    {
+        return GPS.AddSeconds(TAI_MINUS_GPS);
+    }
+
+    /**
+     * @param Seconds Seconds past J2000 in TT (or TDB, the difference is negligible)
+     * @param Model TDB - TT model constants
+     * @return TDB - TT (s)
+     */
+    constexpr double TDBMinusTT(double Seconds, const TDBModel& Model = TDBModel{}) noexcept
+    {
+        const double M = Model.M0 + Model.M1 * Seconds;
+        return Model.K * Math::Sin(M + Model.EB * Math::Sin(M));
+    }
+
+    /**
+     * @param TT Epoch in TT
+     * @param Table Table providing the TDB - TT model
+     * @return Epoch in TDB
+     */
+    constexpr Epoch TT2TDB(const Epoch& TT, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return TT.AddSeconds(TDBMinusTT(TT.ToSeconds(), Table.GetTDBModel()));
+    }
+
+    /**
+     * The TDB - TT model is evaluated at TDB rather than TT, the resulting error is
+     * below 1E-12 s and so no iteration is required
+     * @param TDB Epoch in TDB
+     * @param Table Table providing the TDB - TT model
+     * @return Epoch in TT
+     */
+    constexpr Epoch TDB2TT(const Epoch& TDB, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return TDB.AddSeconds(-TDBMinusTT(TDB.ToSeconds(), Table.GetTDBModel()));
+    }
+
+    /**
+     * @param In Epoch in the `From` time scale
+     * @param Table Leap second table
+     * @return Epoch in TAI
+     */
+    constexpr Epoch ToTAI(const Epoch& In, TimeScale From, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        switch (From)
+        {
+            case TimeScale::UTC: return UTC2TAI(In, Table);
+            case TimeScale::TT:  return TT2TAI(In, Table);
+            case TimeScale::TDB: return TT2TAI(TDB2TT(In, Table), Table);
+            case TimeScale::GPS: return GPS2TAI(In);
+            default:             return In;
+        }
+    }
+
+    /**
+     * @param TAI Epoch in TAI
+     * @param To Time scale to convert to
+     * @param Table Leap second table
+     * @return Epoch in the `To` time scale
+     */
+    constexpr Epoch FromTAI(const Epoch& TAI, TimeScale To, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        switch (To)
+        {
+            case TimeScale::UTC: return TAI2UTC(TAI, Table);
+            case TimeScale::TT:  return TAI2TT(TAI, Table);
+            case TimeScale::TDB: return TT2TDB(TAI2TT(TAI, Table), Table);
+            case TimeScale::GPS: return TAI2GPS(TAI);
+            default:             return TAI;
+        }
+    }
+
+    /**
+     * Converts an epoch between any two time scales
+     * @param In Epoch in the `From` time scale
+     * @param From Time scale of `In`
+     * @param To Time scale to convert to
+     * @param Table Leap second table
+     * @return Epoch in the `To` time scale
+     */
+    constexpr Epoch Convert(const Epoch& In, TimeScale From, TimeScale To, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return (From == To) ? In : FromTAI(ToTAI(In, From, Table), To, Table);
+    }
+
+    /**
+     * Converts a UTC epoch into the epoch time used by the ephemeris module (seconds
+     * past J2000 TDB), the equivalent of Spice::Date2Epoch without a string
+     * @param UTC Epoch in UTC
+     * @param Table Leap second table
+     * @return Seconds past J2000 TDB
+     */
+    constexpr double UTC2EphemerisTime(const Epoch& UTC, const LeapSecondTable& Table = DEFAULT_LEAP_SECONDS) noexcept
+    {
+        return Convert(UTC, TimeScale::UTC, TimeScale::TDB, Table).ToSeconds();
+    }
+}
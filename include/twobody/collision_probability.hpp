@@ -0,0 +1,155 @@
+#pragma once
+
+#include "math/matrix3.hpp"
+#include "math/vector3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+class ThreadPool;
+
+namespace TwoBody
+{
+    /**
+     * Close approach of two objects at the time of closest approach, under the short encounter
+     * assumptions: rectilinear relative motion, and a position uncertainty which is constant
+     * over the encounter
+     */
+    struct Conjunction
+    {
+        /// Position of the secondary relative to the primary (m)
+        Vector3 RelativePosition = Vector3::ZERO();
+
+        /// Velocity of the secondary relative to the primary (m/s), non zero
+        Vector3 RelativeVelocity = Vector3::ZERO();
+
+        /// Combined position covariance of both objects (m2), positive definite
+        Matrix3 Covariance = Matrix3::ZERO();
+
+        /// Radius of a sphere enclosing both objects (m)
+        double HardBodyRadius = 0.0;
+    };
+
+    /**
+     * Conjunction projected into the encounter plane, normal to the relative velocity, and
+     * expressed along the principal axes of the projected covariance
+     */
+    struct EncounterPlane
+    {
+        /// Miss distance along the major and minor axes (m)
+        double MissX = 0.0;
+        double MissY = 0.0;
+
+        /// Standard deviation along the major and minor axes (m), `SigmaX >= SigmaY`
+        double SigmaX = 0.0;
+        double SigmaY = 0.0;
+
+        /// Radius of a sphere enclosing both objects (m)
+        double HardBodyRadius = 0.0;
+    };
+
+    /**
+     * Method of computing the probability of collision of a conjunction
+     */
+    enum class CollisionMethod
+    {
+        FOSTER,         // Adaptive numerical integration of the density over the hard body disc
+        CHAN,           // Series of the equivalent circular disc and isotropic covariance
+        ALFANO_MAXIMUM  // Maximum over scalings of the covariance, for unreliable covariances
+    };
+
+    /// Terms of the Chan series, sufficient while the hard body radius is small against the
+    /// miss distance and standard deviations
+    constexpr size_t CHAN_TERMS = 10;
+
+    /**
+     * Projects a conjunction into its encounter plane
+     * @param Event Conjunction, with a non zero relative velocity
+     * @return Miss distance and covariance along the principal axes of the encounter plane
+     */
+    EncounterPlane ProjectEncounter(const Conjunction& Event) noexcept;
+
+    /**
+     * Probability of collision by numerical integration of the two dimensional density over
+     * the hard body disc, reduced to one dimension by integrating the minor axis analytically
+     * Ref: Foster and Estes, A Parametric Analysis of Orbital Debris Collision Probability and
+     * Maneuver Rate for Space Vehicles, 1992
+     * @param Plane Encounter plane
+     * @param Tolerance Error of the integration relative to the probability
+     * @return Probability of collision
+     */
+    double FosterProbability(const EncounterPlane& Plane, double Tolerance = 1.0E-10) noexcept;
+
+    /**
+     * Probability of collision by the convergent series of Chan, approximating the hard body
+     * disc and covariance by a disc of equal area in an isotropic density. Each term is
+     * evaluated without branches, so the cost is fixed
+     * Ref: Chan, Spacecraft Collision Probability, 2008, Chapter 4
+     * @param Plane Encounter plane
+     * @param Terms Number of terms of the series
+     * @return Probability of collision
+     */
+    double ChanProbability(const EncounterPlane& Plane, size_t Terms = CHAN_TERMS) noexcept;
+
+    /**
+     * Maximum probability of collision over every scaling of the covariance, preserving its
+     * shape, an upper bound when the size of the covariance is unreliable, each scaling
+     * integrated as by Foster. Unity for a miss within the hard body radius, where a
+     * vanishing covariance collides
+     * Ref: Alfano, Relating Position Uncertainty to Maximum Conjunction Probability, 2005
+     * @param Plane Encounter plane
+     * @return Maximum probability of collision
+     */
+    double AlfanoMaximumProbability(const EncounterPlane& Plane) noexcept;
+
+    /**
+     * @param Event Conjunction
+     * @param Method Method of computing the probability
+     * @return Probability of collision
+     */
+    double CollisionProbability(const Conjunction& Event, CollisionMethod Method) noexcept;
+
+    /**
+     * Probabilities of collision of a batch of conjunctions, in parallel across the pool.
+     * The Chan series is further evaluated across each chunk of conjunctions in structure
+     * of arrays, vectorised by the compiler, the other methods being thread parallel only
+     * @param Pool Threads evaluating the batch
+     * @param Events Conjunctions
+     * @param Method Method of computing the probability
+     * @param Probabilities Probability of collision of each conjunction, the size of `Events`
+     * @throws Error::HArraySizeMismatch if `Probabilities` differs in size from `Events`
+     */
+    void CollisionProbability(ThreadPool& Pool, std::span<const Conjunction> Events, CollisionMethod Method,
+        std::span<double> Probabilities);
+
+    /**
+     * Monte Carlo estimate of a probability of collision
+     */
+    struct MonteCarloCollision
+    {
+        /// Fraction of samples colliding
+        double Probability = 0.0;
+
+        /// Standard error of the probability
+        double StandardError = 0.0;
+
+        /// Number of samples, and of those colliding
+        uint64_t Samples = 0;
+        uint64_t Hits = 0;
+    };
+
+    /**
+     * Reference probability of collision by sampling the relative position from the full
+     * covariance, independent of the projection into the encounter plane. Each block of
+     * samples draws from its own random stream, so results are identical for any number of
+     * threads
+     * @param Pool Threads drawing the samples
+     * @param Event Conjunction
+     * @param Samples Number of samples
+     * @param Seed Seed of the random streams
+     * @return Estimated probability of collision
+     * @throws Error::GenericException if the covariance is not positive definite
+     */
+    MonteCarloCollision MonteCarloProbability(ThreadPool& Pool, const Conjunction& Event, uint64_t Samples, uint64_t Seed = 0);
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "math/matrixn.hpp"
+#include "math/vector3.hpp"
+#include "numerics/unscented.hpp"
+
+#include <cstddef>
+#include <vector>
+
+class ThreadPool;
+
+namespace TwoBody
+{
+    /// Cartesian state, position (m) followed by velocity (m/s)
+    using StateVector = VectorN<6>;
+
+    /// Covariance of a cartesian state (m2, m2/s, m2/s2)
+    using StateCovariance = MatrixN<6, 6>;
+
+    /// Number of sigma points of the unscented transform of a cartesian state
+    constexpr size_t SIGMA_POINTS = Unscented::SigmaPoints<6>();
+
+    /**
+     * @param Position Position (m)
+     * @param Velocity Velocity (m/s)
+     * @return Cartesian state
+     */
+    constexpr StateVector MakeStateVector(const Vector3& Position, const Vector3& Velocity) noexcept
+    {
+        return StateVector{.Data = {Position.X, Position.Y, Position.Z, Velocity.X, Velocity.Y, Velocity.Z}};
+    }
+
+    /**
+     * Propagates a cartesian state along its conic section
+     * @param State Initial state
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param DeltaTime Time of flight (s)
+     * @return State after `DeltaTime`
+     */
+    StateVector Propagate(const StateVector& State, double GravitationalParameter, double DeltaTime) noexcept;
+
+    /**
+     * Linearised state transition matrix of two body motion, by central differences of the
+     * propagated state
+     * @param State Initial state
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param DeltaTime Time of flight (s)
+     * @return Partial derivatives of the final state with respect to the initial state
+     */
+    MatrixN<6, 6> StateTransition(const StateVector& State, double GravitationalParameter, double DeltaTime) noexcept;
+
+    /**
+     * Propagates a covariance linearly about a state, as Phi x P x Phi^T
+     * @param State Initial state
+     * @param Covariance Initial covariance
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param DeltaTime Time of flight (s)
+     * @return Covariance after `DeltaTime`
+     */
+    StateCovariance PropagateLinear(const StateVector& State, const StateCovariance& Covariance, double GravitationalParameter, double DeltaTime) noexcept;
+
+    /**
+     * Propagates a state and covariance by the unscented transform, capturing the
+     * nonlinearity of the motion over long arcs or large uncertainties
+     * @param State Initial state, replaced by the propagated mean
+     * @param Covariance Initial covariance, replaced by the propagated covariance
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param DeltaTime Time of flight (s)
+     * @param Parameters Scaling of the sigma points
+     * @throws Error::GenericException if the covariance is not positive definite
+     */
+    void PropagateUnscented(StateVector& State, StateCovariance& Covariance, double GravitationalParameter, double DeltaTime,
+        const Unscented::Parameters& Parameters = {});
+
+    /**
+     * States and covariances of many objects propagated together about the same central
+     * body. Each state and covariance is stored contiguously and in turn, and the sigma
+     * points of every object are propagated as a single parallel batch:
+     *
+     *  CovarianceBatch Catalog(Earth::GRAVITATIONAL_CONSTANT);
+     *  Catalog.Add(State, Covariance);
+     *  Catalog.PropagateUnscented(Pool, 3600.0);
+     */
+    class CovarianceBatch
+    {
+    public:
+
+        /**
+         * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+         * @param Parameters Scaling of the sigma points of the unscented transform
+         */
+        explicit CovarianceBatch(double GravitationalParameter, const Unscented::Parameters& Parameters = {}) noexcept :
+            mGravitationalParameter(GravitationalParameter), mParameters(Parameters) { }
+
+        /**
+         * Adds an object
+         * @param State Initial state
+         * @param Covariance Initial covariance
+         * @return Index of the object
+         */
+        size_t Add(const StateVector& State, const StateCovariance& Covariance);
+
+        /**
+         * Reserves storage, such that objects may be added without reallocation
+         * @param Capacity Number of objects
+         */
+        void Reserve(size_t Capacity);
+
+        /** @return Number of objects */
+        size_t Size(void) const noexcept {return mStates.size();}
+
+        /** @return State of an object */
+        const StateVector& GetState(size_t Index) const noexcept {return mStates[Index];}
+
+        /** @return Covariance of an object */
+        const StateCovariance& GetCovariance(size_t Index) const noexcept {return mCovariances[Index];}
+
+        /**
+         * Propagates every state along its conic section and every covariance linearly
+         * @param Pool Threads propagating the objects
+         * @param DeltaTime Time of flight (s)
+         */
+        void PropagateLinear(ThreadPool& Pool, double DeltaTime) noexcept;
+
+        /**
+         * Propagates every state and covariance by the unscented transform
+         * @param Pool Threads propagating the objects
+         * @param DeltaTime Time of flight (s)
+         * @throws Error::GenericException if a covariance is not positive definite, in which
+         * case no object is propagated
+         */
+        void PropagateUnscented(ThreadPool& Pool, double DeltaTime);
+
+    private:
+
+        double mGravitationalParameter = 0.0;
+        Unscented::Parameters mParameters{};
+        std::vector<StateVector> mStates{};
+        std::vector<StateCovariance> mCovariances{};
+
+        // Sigma points of every object, SIGMA_POINTS per object in turn
+        std::vector<StateVector> mSigmaPoints{};
+    };
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "math/vector3.hpp"
+#include "twobody/kepler.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+class ThreadPool;
+
+namespace TwoBody
+{
+    /**
+     * Outcome of an initial orbit determination
+     */
+    enum class InitialOrbitStatus
+    {
+        SUCCESS,                // Orbit determined
+        DEGENERATE_GEOMETRY,    // Times not increasing, or lines of sight (nearly) coplanar
+        NOT_COPLANAR,           // Positions further from a common plane than allowed
+        NO_SOLUTION,            // No physical solution, i.e no positive root of the range equation
+        NOT_CONVERGED,          // Iterative refinement failed to converge
+        REJECTED                // Orbit determined but outside of the plausible limits
+    };
+
+    /**
+     * Three positions of an object at increasing times
+     */
+    struct PositionTriplet
+    {
+        /// Times of the positions (s)
+        std::array<double, 3> Times{};
+
+        /// Positions in an inertial frame (m)
+        std::array<Vector3, 3> Positions{Vector3::ZERO(), Vector3::ZERO(), Vector3::ZERO()};
+    };
+
+    /**
+     * Three directions to an object from observing sites at increasing times, i.e optical
+     * right ascension and declination observations
+     */
+    struct AnglesTriplet
+    {
+        /// Times of the observations (s)
+        std::array<double, 3> Times{};
+
+        /// Positions of the observing sites in an inertial frame (m)
+        std::array<Vector3, 3> Sites{Vector3::ZERO(), Vector3::ZERO(), Vector3::ZERO()};
+
+        /// Unit lines of sight from each site to the object
+        std::array<Vector3, 3> Directions{Vector3::ZERO(), Vector3::ZERO(), Vector3::ZERO()};
+    };
+
+    /**
+     * Plausible orbits, against which candidate triplets are screened
+     */
+    struct InitialOrbitLimits
+    {
+        /// Largest angle of the first position from the plane of the second and third (rad)
+        double MaxCoplanarity = 0.01;
+
+        /// Smallest radius of the middle position (m)
+        double MinRadius = 6.4E6;
+
+        /// Largest radius of the middle position (m)
+        double MaxRadius = 5.0E7;
+
+        /// Largest eccentricity
+        double MaxEccentricity = 0.95;
+    };
+
+    /**
+     * State of an object at the middle time of a triplet
+     */
+    struct InitialOrbitSolution
+    {
+        /// Outcome, the remaining fields are unspecified unless successful (or rejected)
+        InitialOrbitStatus Status = InitialOrbitStatus::NO_SOLUTION;
+
+        /// Time of the state, the middle time of the triplet (s)
+        double Time = 0.0;
+
+        /// Position (m)
+        Vector3 Position = Vector3::ZERO();
+
+        /// Velocity (m/s)
+        Vector3 Velocity = Vector3::ZERO();
+
+        /// Keplerian elements of the state
+        KeplerianElements Elements{};
+    };
+
+    /**
+     * Method of initial orbit determination from positions
+     */
+    enum class PositionMethod
+    {
+        GIBBS,          // Gibbs, for widely separated positions
+        HERRICK_GIBBS,  // Herrick-Gibbs, for closely spaced positions
+        AUTOMATIC       // Herrick-Gibbs if the positions are separated by less than a few degrees, otherwise Gibbs
+    };
+
+    /**
+     * Method of initial orbit determination from lines of sight
+     */
+    enum class AnglesMethod
+    {
+        GAUSS,      // Gauss, with iterative refinement of the Lagrange coefficients
+        GOODING     // Gooding, solving for the end ranges through Lambert's problem from the Gauss solution
+    };
+
+    /**
+     * Solves Lambert's problem by the universal variable formulation, for a transfer of less
+     * than one revolution
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Algorithm 58
+     * @param Initial Initial position (m)
+     * @param Final Final position (m)
+     * @param TimeOfFlight Time of flight (s), positive
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param Normal Direction of the angular momentum, selecting the short or long way
+     * @param InitialVelocity Velocity at the initial position (m/s)
+     * @param FinalVelocity Velocity at the final position (m/s)
+     * @return `false` if the transfer is undefined (positions collinear) or not solved
+     */
+    bool Lambert(const Vector3& Initial, const Vector3& Final, double TimeOfFlight, double GravitationalParameter, const Vector3& Normal,
+        Vector3& InitialVelocity, Vector3& FinalVelocity) noexcept;
+
+    /**
+     * Gibbs method of initial orbit determination from three widely separated positions
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Algorithm 54
+     * @param Triplet Positions
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param Limits Plausible orbits
+     * @return State at the middle time
+     */
+    InitialOrbitSolution Gibbs(const PositionTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits = {}) noexcept;
+
+    /**
+     * Herrick-Gibbs method of initial orbit determination from three closely spaced positions
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Algorithm 55
+     * @param Triplet Positions
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param Limits Plausible orbits
+     * @return State at the middle time
+     */
+    InitialOrbitSolution HerrickGibbs(const PositionTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits = {}) noexcept;
+
+    /**
+     * Gauss method of angles only initial orbit determination, refined by exact Lagrange
+     * coefficients. The smallest root of the range polynomial above the minimum radius is taken
+     * Ref: Curtis, Orbital Mechanics for Engineering Students, Algorithms 5.5 and 5.6
+     * @param Triplet Lines of sight
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param Limits Plausible orbits
+     * @return State at the middle time
+     */
+    InitialOrbitSolution Gauss(const AnglesTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits = {}) noexcept;
+
+    /**
+     * Gooding method of angles only initial orbit determination, solving for the ranges of
+     * the first and last observations such that the Lambert transfer between them passes
+     * through the middle line of sight. Starts from the Gauss solution, and remains accurate
+     * for arcs too long for the Gauss approximations
+     * Ref: Gooding, A New Procedure for the Solution of the Classical Problem of Minimal
+     * Orbit Determination from Three Lines of Sight, 1997
+     * @param Triplet Lines of sight
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param Limits Plausible orbits
+     * @return State at the middle time
+     */
+    InitialOrbitSolution Gooding(const AnglesTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits = {}) noexcept;
+
+    /**
+     * Determines the orbits of many position triplets in parallel
+     * @param Pool Threads solving the triplets
+     * @param Triplets Candidate triplets
+     * @param Method Method of solution
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param Limits Plausible orbits
+     * @param Solutions Solution of each triplet, of the same size as `Triplets`
+     * @throws Error::HArraySizeMismatch if `Solutions` differs in size from `Triplets`
+     */
+    void SolveBatch(ThreadPool& Pool, std::span<const PositionTriplet> Triplets, PositionMethod Method, double GravitationalParameter,
+        const InitialOrbitLimits& Limits, std::span<InitialOrbitSolution> Solutions);
+
+    /**
+     * Determines the orbits of many angles triplets in parallel
+     * @param Pool Threads solving the triplets
+     * @param Triplets Candidate triplets
+     * @param Method Method of solution
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param Limits Plausible orbits
+     * @param Solutions Solution of each triplet, of the same size as `Triplets`
+     * @throws Error::HArraySizeMismatch if `Solutions` differs in size from `Triplets`
+     */
+    void SolveBatch(ThreadPool& Pool, std::span<const AnglesTriplet> Triplets, AnglesMethod Method, double GravitationalParameter,
+        const InitialOrbitLimits& Limits, std::span<InitialOrbitSolution> Solutions);
+}
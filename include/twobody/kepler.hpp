@@ -100,7 +100,8 @@ namespace TwoBody
          */
         constexpr bool IsValid(const KeplerianElements& Elements) noexcept
         {
-            return (Elements.SemiMajorAxis > 0.0);
+            // The semi-major axis is negative for a hyperbolic trajectory and infinite for a parabolic trajectory
+            return (Elements.SemiParameter > 0.0);
         }
 
         /** 
@@ -435,15 +436,14 @@ namespace TwoBody
      * Computes the true anomoly using the eccentricity and eccentric/parabolic/hyperbolic anomoly.
      * @param EccentricAnomoly Eccentric anomoly (elliptic), hyperbolic anomoly (hyperbolic) or parabolic anomoly (parabolic) of the orbit (rad)
      * @param Eccentricity Eccentricity of the orbit
-     * @return True anomoly (rad)
+     * @return True anomoly (rad), within (-PI, PI]
      */
     constexpr double EccentricToTrueAnomoly(double Anomoly, double Eccentricity) noexcept
     {    
         if (Eccentricity < 1.0)
         {
-            // Elliptical    
-            const double CosE = Cos(Anomoly);
-            return Acos((CosE - Eccentricity) / (1.0 - Eccentricity * CosE));
+            // Elliptical
+            return Atan2(Sqrt(1.0 - Square(Eccentricity)) * Sin(Anomoly), Cos(Anomoly) - Eccentricity);
         }
         else if (Eccentricity == 1.0)
         {
@@ -453,8 +453,7 @@ namespace TwoBody
         else
         {
             // Hyperbolic
-            const double CoshH = Cosh(Anomoly);
-            return Acos( (CoshH - Eccentricity) / (1.0 - Eccentricity * CoshH) );
+            return Atan2(Sqrt(Square(Eccentricity) - 1.0) * Sinh(Anomoly), Eccentricity - Cosh(Anomoly));
         }
     }
 
@@ -505,5 +504,86 @@ namespace TwoBody
             return CCoefficents{.C2 = 0.5 - Angle / 24.0, .C3 = 1.0 / 6.0 - Angle / 120.0};
         }
     }    
+
+    /** 
+     * Propagates a state along its conic section by the universal variable formulation of
+     * Kepler's equation, valid for elliptical, parabolic and hyperbolic trajectories alike
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Algorithm 8
+     * @param Position Initial position (m)
+     * @param Velocity Initial velocity (m/s)
+     * @param GravitationalParameter Gravitational parameter of the central body (m3/s2)
+     * @param DeltaTime Time of flight, forwards or backwards (s)
+     * @return Position and velocity after `DeltaTime`
+     */
+    constexpr EphemerisState PropagateUniversal(const Vector3& Position, const Vector3& Velocity, double GravitationalParameter, double DeltaTime) noexcept
+    {
+        constexpr double TOLERANCE = 1.0E-13;
+        constexpr int MAX_ITERATIONS = 50;
+
+        if (DeltaTime == 0.0)
+        {
+            return EphemerisState{.Pos = Position, .Vel = Velocity};
+        }
+
+        const double SqrtMu = Sqrt(GravitationalParameter);
+        const double Radius0 = Position.Norm();
+        const double RadialSpeed = Position.Dot(Velocity) / SqrtMu;
+
+        // Reciprocal of the semi-major axis
+        const double Alpha = 2.0 / Radius0 - Velocity.NormSquared() / GravitationalParameter;
+
+        // Initial guess of the universal variable
+        double Chi = 0.0;
+
+        if (Alpha > 1.0E-12)
+        {
+            Chi = SqrtMu * DeltaTime * Alpha;
+        }
+        else if (Alpha < -1.0E-12)
+        {
+            const double SemiMajorAxis = 1.0 / Alpha;
+            const double Sign = Signum(DeltaTime);
+            Chi = Sign * Sqrt(-SemiMajorAxis) * Log((-2.0 * GravitationalParameter * Alpha * DeltaTime) /
+                (Position.Dot(Velocity) + Sign * Sqrt(-GravitationalParameter * SemiMajorAxis) * (1.0 - Radius0 * Alpha)));
+        }
+        else
+        {
+            const double SemiParameter = Position.Cross(Velocity).NormSquared() / GravitationalParameter;
+            const double S = 0.5 * Atan(1.0 / (3.0 * Sqrt(GravitationalParameter / Cube(SemiParameter)) * DeltaTime));
+            const double W = Atan(Cbrt(Tan(S)));
+            Chi = Sqrt(SemiParameter) * 2.0 / Tan(2.0 * W);
+        }
+
+        double Psi = 0.0;
+        double Radius = Radius0;
+        CCoefficents C{};
+
+        for (int Iteration = 0; Iteration < MAX_ITERATIONS; Iteration++)
+        {
+            Psi = Square(Chi) * Alpha;
+            C = CalculateCoefficients(Psi);
+            Radius = Square(Chi) * C.C2 + RadialSpeed * Chi * (1.0 - Psi * C.C3) + Radius0 * (1.0 - Psi * C.C2);
+
+            const double Step = (SqrtMu * DeltaTime - Cube(Chi) * C.C3 - RadialSpeed * Square(Chi) * C.C2 - Radius0 * Chi * (1.0 - Psi * C.C3)) / Radius;
+            Chi += Step;
+
+            if (Abs(Step) <= TOLERANCE * Max(1.0, Abs(Chi)))
+            {
+                break;
+            }
+        }
+
+        Psi = Square(Chi) * Alpha;
+        C = CalculateCoefficients(Psi);
+        Radius = Square(Chi) * C.C2 + RadialSpeed * Chi * (1.0 - Psi * C.C3) + Radius0 * (1.0 - Psi * C.C2);
+
+        // Lagrange coefficients
+        const double F = 1.0 - Square(Chi) / Radius0 * C.C2;
+        const double G = DeltaTime - Cube(Chi) / SqrtMu * C.C3;
+        const double FDot = SqrtMu / (Radius * Radius0) * Chi * (Psi * C.C3 - 1.0);
+        const double GDot = 1.0 - Square(Chi) / Radius * C.C2;
+
+        return EphemerisState{.Pos = F * Position + G * Velocity, .Vel = FDot * Position + GDot * Velocity};
+    }
 }
 
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "math/constants.hpp"
+#include "math/vector3.hpp"
+#include "twobody/kepler.hpp"
+
+#include <span>
+
+class ThreadPool;
+
+namespace TwoBody
+{
+    /**
+     * Second zonal harmonic of the gravity field of the central body
+     */
+    struct Oblateness
+    {
+        /// Unnormalised second zonal harmonic coefficient
+        double J2 = Earth::J2;
+
+        /// Reference equatorial radius of the coefficient (m)
+        double Radius = Earth::WGS84::SEMI_MAJOR_AXIS;
+    };
+
+    /**
+     * Secular rates of the angles of a closed orbit under the second zonal harmonic
+     */
+    struct SecularRates
+    {
+        /// Rate of the right ascension of the ascending node (rad/s)
+        double Node = 0.0;
+
+        /// Rate of the argument of perigee (rad/s)
+        double ArgumentPerigee = 0.0;
+
+        /// Rate of the mean anomoly, the mean motion corrected for oblateness (rad/s)
+        double MeanAnomoly = 0.0;
+    };
+
+    /**
+     * Secular rates of the angles of a closed orbit, to second order in J2
+     * Ref: Brouwer, Solution of the Problem of Artificial Satellite Theory Without Drag, 1959
+     * @param Mean Mean elements of the orbit, of which the semi-major axis, eccentricity,
+     * inclination and gravitational parameter are used
+     * @param Body Oblateness of the central body
+     * @return Rates of the node, argument of perigee and mean anomoly
+     */
+    SecularRates J2SecularRates(const KeplerianElements& Mean, const Oblateness& Body = {}) noexcept;
+
+    /**
+     * Propagates the mean elements of a closed orbit by the secular J2 rates. The semi-major
+     * axis, eccentricity and inclination are constant, and the node, perigee and mean
+     * anomoly advance linearly, making the cost independent of the time of flight
+     * @param Mean Mean elements of the orbit. The perigee and true anomoly of a circular
+     * orbit are taken as zero and the argument of latitude
+     * @param DeltaTime Time of flight (s)
+     * @param Body Oblateness of the central body
+     * @return Mean elements after `DeltaTime`, with every angle consistent
+     */
+    KeplerianElements PropagateMean(const KeplerianElements& Mean, double DeltaTime, const Oblateness& Body = {}) noexcept;
+
+    /**
+     * Osculating elements of a closed orbit from its mean elements, by the first order
+     * short and long period terms of Brouwer's theory, in Lyddane's form which remains
+     * defined for small eccentricities and inclinations. Within about 0.7 degrees of the
+     * critical inclination the long period terms, which are singular there, are dropped
+     * Ref: Schaub and Junkins, Analytical Mechanics of Space Systems, Appendix F
+     * @param Mean Mean elements of the orbit
+     * @param Body Oblateness of the central body
+     * @return Osculating elements
+     */
+    KeplerianElements MeanToOsculating(const KeplerianElements& Mean, const Oblateness& Body = {}) noexcept;
+
+    /**
+     * Mean elements of a closed orbit from its osculating elements, the inverse of
+     * `MeanToOsculating` to first order in J2
+     * @param Osculating Osculating elements of the orbit
+     * @param Body Oblateness of the central body
+     * @return Mean elements
+     */
+    KeplerianElements OsculatingToMean(const KeplerianElements& Osculating, const Oblateness& Body = {}) noexcept;
+
+    /**
+     * Gravitational acceleration of an oblate central body, the point mass and second zonal
+     * harmonic, for numerical integration of the osculating state
+     * @param Position Position in the inertial frame aligned with the pole of the body (m)
+     * @param GravitationalParameter Gravitational parameter of the body (m3/s2)
+     * @param Body Oblateness of the central body
+     * @return Acceleration (m/s2)
+     */
+    Vector3 OblateAcceleration(const Vector3& Position, double GravitationalParameter, const Oblateness& Body = {}) noexcept;
+
+    /**
+     * Propagates a batch of mean elements by the secular J2 rates
+     * @param Pool Threads propagating the batch
+     * @param Mean Mean elements of each orbit
+     * @param DeltaTime Time of flight (s)
+     * @param Propagated Mean elements of each orbit after `DeltaTime`, the size of `Mean`
+     * @param Body Oblateness of the central body
+     */
+    void PropagateMean(ThreadPool& Pool, std::span<const KeplerianElements> Mean, double DeltaTime,
+        std::span<KeplerianElements> Propagated, const Oblateness& Body = {}) noexcept;
+
+    /**
+     * Osculating elements of a batch of orbits from their mean elements
+     * @param Pool Threads converting the batch
+     * @param Mean Mean elements of each orbit
+     * @param Osculating Osculating elements of each orbit, the size of `Mean`
+     * @param Body Oblateness of the central body
+     */
+    void MeanToOsculating(ThreadPool& Pool, std::span<const KeplerianElements> Mean, std::span<KeplerianElements> Osculating,
+        const Oblateness& Body = {}) noexcept;
+
+    /**
+     * Mean elements of a batch of orbits from their osculating elements
+     * @param Pool Threads converting the batch
+     * @param Osculating Osculating elements of each orbit
+     * @param Mean Mean elements of each orbit, the size of `Osculating`
+     * @param Body Oblateness of the central body
+     */
+    void OsculatingToMean(ThreadPool& Pool, std::span<const KeplerianElements> Osculating, std::span<KeplerianElements> Mean,
+        const Oblateness& Body = {}) noexcept;
+}
@@ -2,6 +2,12 @@
 
 #include "kepler.hpp"
 #include "meta/indexable.hpp"
+#include "meta/snapshot.hpp"
+
+#include <span>
+#include <type_traits>
+
+class ThreadPool;
 
 namespace TwoBody
 {
@@ -22,6 +28,42 @@ namespace TwoBody
     {
     public:    
 
+        /** Version of the layout of `State`, incremented whenever it changes */
+        static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+        /** 
+         * Complete state of an orbit, saved and restored by snapshots as a plain block
+         */
+        struct State
+        {
+            /// Current keplerian state
+            KeplerianElements Elements{};
+
+            /// rad
+            double EccentricAnomoly = 0.0;
+
+            /// Mean time to travel one radian (s)
+            double MeanRadialPeriod = 0.0;
+
+            /// Orbital period (s)
+            double Period = 0.0;
+
+            /// Current radius from centre of central body (m)
+            double Radius = 0.0;
+
+            /// rad
+            double MeanAnomoly = 0.0;
+
+            /// Classification of the conic section
+            OrbitClassification Classification = OrbitClassification::INVALID;
+
+            /// Explicit padding, such that every byte of the block is defined
+            int32_t Padding = 0;
+        };
+
+        static_assert(std::is_trivially_copyable_v<State>);
+        static_assert(sizeof(State) == sizeof(KeplerianElements) + 6 * sizeof(double));
+
         /** 
          * Instantiate from Keplerian elements
          * @param Elements Keplerian Elements
@@ -47,32 +89,32 @@ namespace TwoBody
         /** 
          * @return KeplerianElements
          */
-        const KeplerianElements& GetElements(void) const noexcept {return mElements;}
+        const KeplerianElements& GetElements(void) const noexcept {return mState.Elements;}
 
         /**
          * @return Eccentric/Hyperbolic/Parabolic anomoly depending upon orbit classification
          */
-        double GetEccentricAnomoly(void) const noexcept {return mEccentricAnomoly;}
+        double GetEccentricAnomoly(void) const noexcept {return mState.EccentricAnomoly;}
 
         /**
          * @return Mean time to travel one radian (s)
          */
-        double GetMeanRadialPeriod(void) const noexcept {return mMeanRadialPeriod;}        
+        double GetMeanRadialPeriod(void) const noexcept {return mState.MeanRadialPeriod;}        
 
         /**
          * @return Orbital period (s)
          */
-        double GetPeriod(void) const noexcept {return mPeriod;}
+        double GetPeriod(void) const noexcept {return mState.Period;}
 
         /**
          * @return Current radius from centre of central body (m)
          */
-        double GetRadius(void) const noexcept {return mRadius;}
+        double GetRadius(void) const noexcept {return mState.Radius;}
 
         /**
          * @return Current mean anomoly
          */
-        double GetMeanAnomoly(void) const noexcept {return mMeanAnomoly;}
+        double GetMeanAnomoly(void) const noexcept {return mState.MeanAnomoly;}
  
         /** 
          * Calculates the delta time required to reach a given `TrueAnomoly`. Can calculate past states if `TrueAnomoly` < Current 
@@ -98,37 +140,68 @@ namespace TwoBody
          */
         void Update(double DeltaTime) noexcept;
 
+        /** 
+         * Updates many orbits in parallel, each as `Update`
+         * @param Pool Threads updating the orbits
+         * @param Orbits Orbits to update, each distinct
+         * @param DeltaTime Time difference from the current state of every orbit
+         */
+        static void Update(ThreadPool& Pool, std::span<Orbit* const> Orbits, double DeltaTime) noexcept;
+
         /** 
          * @return const reference to the dynamic index map
          */
         const Indexable* GetDynamicIndexMap(void) const {return &mDynamicIndex;}
 
-    private:
-
-        // Current keplerian state
-        KeplerianElements mElements{};
+        /** 
+         * @return State of the orbit as a snapshot block
+         */
+        SnapshotBlock GetSnapshotBlock(void) noexcept
+        {
+            return SnapshotBlock{.Type = "TwoBody::Orbit", .Version = SNAPSHOT_VERSION, .Data = std::as_writable_bytes(std::span(&mState, 1))};
+        }
 
-        // Classification of the conic section
-        OrbitClassification mClassification = OrbitClassification::INVALID;        
+    private:
 
-        // rad
-        double mEccentricAnomoly = 0.0;
+        // Complete orbital state
+        State mState{};
 
-        // Mean time to travel one radian (s)
-        double mMeanRadialPeriod = 0.0;        
+        // key to pointer mappings
+        Indexable mDynamicIndex;          
 
-        // Orbital period (s)
-        double mPeriod = 0.0;
+        Orbit(const KeplerianElements& Elements) noexcept;
+    };
 
-        // Current radius from centre of central body (m)
-        double mRadius = 0.0;
+    /**
+     * Ephemeris of the current state of an orbit, propagated by two body motion, such that
+     * an orbit may be used wherever a trajectory source is expected
+     */
+    class OrbitEphemeris : public Ephemeris
+    {
+    public:
 
-        // rad
-        double mMeanAnomoly = 0.0;    
+        /**
+         * @param Source Orbit, of which the current state is copied
+         * @param Epoch Time (s) of the current state of the orbit
+         */
+        OrbitEphemeris(const Orbit& Source, double Epoch = 0.0) noexcept :
+            mEpochState(Kepler2Newtonian(Source.GetElements())),
+            mGravitationalParameter(Source.GetElements().GravitationalParameter),
+            mEpoch(Epoch)
+        { }
 
-        // key to pointer mappings
-        Indexable mDynamicIndex;          
+        /**
+         * @param EpochTime Time (s)
+         * @return EphemerisState (Position, Velocity) relative to the central body
+         */
+        EphemerisState GetState(double EpochTime) const noexcept override
+        {
+            return PropagateUniversal(mEpochState.Pos, mEpochState.Vel, mGravitationalParameter, EpochTime - mEpoch);
+        }
 
-        Orbit(const KeplerianElements& Elements) noexcept;
+    private:
+        EphemerisState mEpochState{};
+        double mGravitationalParameter = 0.0;
+        double mEpoch = 0.0;
     };
 }    
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "math/matrixn.hpp"
+#include "math/rotator.hpp"
+#include "twobody/covariance.hpp"
+#include "twobody/kepler.hpp"
+
+#include <cstddef>
+#include <vector>
+
+class ThreadPool;
+
+namespace TwoBody
+{
+    /**
+     * Rotation from an inertial frame to the local vertical, local horizontal (LVLH, or
+     * Hill) frame of a chief: x radial, y along track (completing the triad) and z along the
+     * angular momentum
+     * @param Position Position of the chief (m)
+     * @param Velocity Velocity of the chief (m/s)
+     * @return Rotator from the inertial frame to the LVLH frame
+     */
+    Rotator LVLHFrame(const Vector3& Position, const Vector3& Velocity) noexcept;
+
+    /**
+     * Relative state of a deputy in the LVLH frame of a chief. The relative velocity is the
+     * rate of change of the relative position as seen in the rotating frame
+     * @param Chief Inertial state of the chief
+     * @param Deputy Inertial state of the deputy
+     * @return Relative position (m) and velocity (m/s) in the LVLH frame
+     */
+    StateVector InertialToLVLH(const EphemerisState& Chief, const EphemerisState& Deputy) noexcept;
+
+    /**
+     * Inertial state of a deputy from its relative state in the LVLH frame of a chief
+     * @param Chief Inertial state of the chief
+     * @param Relative Relative position (m) and velocity (m/s) in the LVLH frame
+     * @return Inertial state of the deputy
+     */
+    EphemerisState LVLHToInertial(const EphemerisState& Chief, const StateVector& Relative) noexcept;
+
+    /**
+     * Hill-Clohessy-Wiltshire state transition matrix of relative motion about a circular
+     * chief orbit, in the LVLH frame
+     * Ref: Vallado, Fundamentals of Astrodynamics and Applications, Section 6.8
+     * @param MeanMotion Mean motion of the chief (rad/s)
+     * @param DeltaTime Time of flight (s)
+     * @return Relative state after `DeltaTime` with respect to the initial relative state
+     */
+    MatrixN<6, 6> ClohessyWiltshire(double MeanMotion, double DeltaTime) noexcept;
+
+    /**
+     * Yamanaka-Ankersen state transition matrix of relative motion about an elliptical chief
+     * orbit, in the LVLH frame, the solution of the Tschauner-Hempel equations. Reduces to
+     * the Hill-Clohessy-Wiltshire matrix for a circular chief
+     * Ref: Yamanaka and Ankersen, New State Transition Matrix for Relative Motion on an
+     * Arbitrary Elliptical Orbit, 2002
+     * @param Chief Keplerian elements of the chief at the initial time, of which the
+     * eccentricity, semiparameter, true anomoly and gravitational parameter are used
+     * @param DeltaTime Time of flight (s)
+     * @return Relative state after `DeltaTime` with respect to the initial relative state
+     */
+    MatrixN<6, 6> YamanakaAnkersen(const KeplerianElements& Chief, double DeltaTime) noexcept;
+
+    /**
+     * Linearised model of relative motion
+     */
+    enum class RelativeModel
+    {
+        CLOHESSY_WILTSHIRE, // Circular chief, Hill-Clohessy-Wiltshire
+        YAMANAKA_ANKERSEN   // Elliptical chief, Yamanaka-Ankersen
+    };
+
+    /**
+     * Deputies of a formation, propagated by a linearised model of motion relative to a
+     * chief. Each propagation evaluates one transition matrix of the chief, applied to every
+     * deputy in parallel
+     */
+    class Formation
+    {
+    public:
+
+        /**
+         * @param Chief Keplerian elements of the chief, a closed orbit
+         * @param Model Model of relative motion
+         */
+        explicit Formation(const KeplerianElements& Chief, RelativeModel Model = RelativeModel::YAMANAKA_ANKERSEN) noexcept :
+            mChief(Chief), mModel(Model) { }
+
+        /**
+         * Adds a deputy
+         * @param Relative Relative state of the deputy in the LVLH frame of the chief
+         * @return Index of the deputy
+         */
+        size_t Add(const StateVector& Relative);
+
+        /**
+         * Reserves storage, such that deputies may be added without reallocation
+         * @param Capacity Number of deputies
+         */
+        void Reserve(size_t Capacity);
+
+        /** @return Number of deputies */
+        size_t Size(void) const noexcept {return mStates.size();}
+
+        /** @return Relative state of a deputy in the LVLH frame of the chief */
+        const StateVector& GetState(size_t Index) const noexcept {return mStates[Index];}
+
+        /** @return Keplerian elements of the chief */
+        const KeplerianElements& GetChief(void) const noexcept {return mChief;}
+
+        /**
+         * @param DeltaTime Time of flight (s)
+         * @return Transition matrix of every deputy from the current time
+         */
+        MatrixN<6, 6> Transition(double DeltaTime) const noexcept;
+
+        /**
+         * Propagates every deputy, and the anomoly of the chief
+         * @param Pool Threads propagating the deputies
+         * @param DeltaTime Time of flight (s)
+         */
+        void Propagate(ThreadPool& Pool, double DeltaTime) noexcept;
+
+    private:
+        KeplerianElements mChief{};
+        RelativeModel mModel = RelativeModel::YAMANAKA_ANKERSEN;
+        std::vector<StateVector> mStates{};
+    };
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * @file mapped_file.hpp
+ * Read only memory mapped file
+ */
+
+/**
+ * Read only view of an entire file mapped into memory. Pages are only read from disk
+ * when first accessed, so opening a large file and inspecting a small portion of it is
+ * inexpensive. Move only, the mapping is released on destruction
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    /**
+     * @param Path Path to the file, check `IsOpen` for success
+     */
+    explicit MappedFile(const std::string& Path) noexcept
+    {
+        Open(Path);
+    }
+
+    ~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile(const MappedFile& Other) = delete;
+    MappedFile& operator=(const MappedFile& Other) = delete;
+
+    MappedFile(MappedFile&& Other) noexcept :
+        mData{std::exchange(Other.mData, nullptr)},
+        mSize{std::exchange(Other.mSize, 0)}
+    {
+
+    }
+
+    MappedFile& operator=(MappedFile&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Close();
+            mData = std::exchange(Other.mData, nullptr);
+            mSize = std::exchange(Other.mSize, 0);
+        }
+        return *this;
+    }
+
+    /**
+     * Maps a file, releasing any existing mapping
+     * @param Path Path to the file
+     * @return `true` if the file was mapped. Empty files cannot be mapped
+     */
+    bool Open(const std::string& Path) noexcept
+    {
+        Close();
+
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+        HANDLE File = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (File == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER Size{};
+        HANDLE Mapping = nullptr;
+        if ((GetFileSizeEx(File, &Size) != 0) && (Size.QuadPart > 0))
+        {
+            Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        }
+        CloseHandle(File);
+
+        if (Mapping == nullptr)
+        {
+            return false;
+        }
+
+        mData = static_cast<const std::byte*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+        CloseHandle(Mapping);
+        mSize = (mData == nullptr) ? 0 : static_cast<size_t>(Size.QuadPart);
+#else
+        const int File = open(Path.c_str(), O_RDONLY);
+        if (File < 0)
+        {
+            return false;
+        }
+
+        struct stat Info{};
+        if ((fstat(File, &Info) != 0) || (Info.st_size <= 0))
+        {
+            close(File);
+            return false;
+        }
+
+        void* Data = mmap(nullptr, static_cast<size_t>(Info.st_size), PROT_READ, MAP_PRIVATE, File, 0);
+        close(File);
+
+        if (Data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        mData = static_cast<const std::byte*>(Data);
+        mSize = static_cast<size_t>(Info.st_size);
+#endif
+        return mData != nullptr;
+    }
+
+    /**
+     * Releases the mapping
+     */
+    void Close(void) noexcept
+    {
+        if (mData != nullptr)
+        {
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+            UnmapViewOfFile(mData);
+#else
+            munmap(const_cast<std::byte*>(mData), mSize);
+#endif
+        }
+
+        mData = nullptr;
+        mSize = 0;
+    }
+
+    /**
+     * @return `true` if a file is mapped
+     */
+    bool IsOpen(void) const noexcept {return mData != nullptr;}
+
+    /**
+     * @return Size of the file (bytes)
+     */
+    size_t Size(void) const noexcept {return mSize;}
+
+    /**
+     * @return Contents of the file
+     */
+    std::span<const std::byte> Data(void) const noexcept {return {mData, mSize};}
+
+private:
+    const std::byte* mData = nullptr;
+    size_t mSize = 0;
+};
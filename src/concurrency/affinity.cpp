@@ -0,0 +1,65 @@
+#include "concurrency/affinity.hpp"
+
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace
+{
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+    bool PinHandle(HANDLE Thread, size_t Cpu) noexcept
+    {
+        if (Cpu >= sizeof(DWORD_PTR) * 8)
+        {
+            return false;
+        }
+
+        return SetThreadAffinityMask(Thread, DWORD_PTR(1) << Cpu) != 0;
+    }
+#elif defined(__linux__)
+    bool PinHandle(pthread_t Thread, size_t Cpu) noexcept
+    {
+        if (Cpu >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        cpu_set_t Set;
+        CPU_ZERO(&Set);
+        CPU_SET(Cpu, &Set);
+        return pthread_setaffinity_np(Thread, sizeof(Set), &Set) == 0;
+    }
+#endif
+}
+
+bool PinCurrentThread(size_t Cpu) noexcept
+{
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+    return PinHandle(GetCurrentThread(), Cpu);
+#elif defined(__linux__)
+    return PinHandle(pthread_self(), Cpu);
+#else
+    // Affinity is advisory only on other platforms (i.e macOS)
+    static_cast<void>(Cpu);
+    return false;
+#endif
+}
+
+bool PinThread(std::thread& Thread, size_t Cpu) noexcept
+{
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+    return PinHandle(static_cast<HANDLE>(Thread.native_handle()), Cpu);
+#elif defined(__linux__)
+    return PinHandle(Thread.native_handle(), Cpu);
+#else
+    static_cast<void>(Thread);
+    static_cast<void>(Cpu);
+    return false;
+#endif
+}
@@ -0,0 +1,315 @@
+#include "concurrency/thread_pool.hpp"
+#include "concurrency/affinity.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    constexpr uint64_t LOWER = 0xFFFFFFFF;
+
+    constexpr uint64_t Pack(uint64_t Begin, uint64_t End) noexcept {return (Begin << 32) | End;}
+    constexpr uint64_t Begin(uint64_t Bounds) noexcept {return Bounds >> 32;}
+    constexpr uint64_t End(uint64_t Bounds) noexcept {return Bounds & LOWER;}
+
+    // Pool whose loop or task the current thread is executing, and the slot of the thread
+    thread_local const ThreadPool* tActive = nullptr;
+    thread_local size_t tSlot = 0;
+}
+
+ThreadPool::ThreadPool(size_t Workers, AffinityHint Hint) :
+    mQueues{std::make_unique<Queue[]>(Workers + 1)},
+    mRanges{std::make_unique<Range[]>(Workers + 1)}
+{
+    mWorkers.reserve(Workers);
+
+    for (size_t Index = 0; Index < Workers; Index++)
+    {
+        mWorkers.emplace_back([this, Index]() {WorkerLoop(Index + 1);});
+    }
+
+    const size_t Cpus = std::thread::hardware_concurrency();
+
+    for (size_t Index = 0; (Index < Workers) && (Cpus > 0); Index++)
+    {
+        // The calling thread is assumed to occupy the first CPU
+        switch (Hint)
+        {
+            case AffinityHint::COMPACT:
+                PinWorker(Index, (Index + 1) % Cpus);
+                break;
+            case AffinityHint::SCATTER:
+                PinWorker(Index, ((Index + 1) * Cpus / (Workers + 1)) % Cpus);
+                break;
+            case AffinityHint::NONE:
+                break;
+        }
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mStop = true;
+    }
+
+    mWake.notify_all();
+
+    for (std::thread& Worker : mWorkers)
+    {
+        Worker.join();
+    }
+}
+
+bool ThreadPool::PinWorker(size_t Worker, size_t Cpu) noexcept
+{
+    return (Worker < mWorkers.size()) && PinThread(mWorkers[Worker], Cpu);
+}
+
+bool ThreadPool::IsActive(void) const noexcept
+{
+    return tActive == this;
+}
+
+void ThreadPool::Dispatch(const Job& Task)
+{
+    const uint64_t Threads = Concurrency();
+    const std::lock_guard<std::mutex> Dispatching(mDispatchMutex);
+
+    // Loops started by the body execute serially
+    const ThreadPool* Previous = tActive;
+    tActive = this;
+
+    for (size_t Offset = 0; Offset < Task.Count; Offset += MAX_BATCH)
+    {
+        Job Batch = Task;
+        Batch.Offset = Offset;
+        Batch.Count = std::min(Task.Count - Offset, MAX_BATCH);
+
+        {
+            std::lock_guard<std::mutex> Lock(mMutex);
+
+            // Contiguous, evenly sized initial ranges
+            for (uint64_t Slot = 0; Slot < Threads; Slot++)
+            {
+                mRanges[Slot].Bounds.store(Pack(Batch.Count * Slot / Threads, Batch.Count * (Slot + 1) / Threads), std::memory_order_relaxed);
+            }
+
+            mJob = Batch;
+            mBusy.store(mWorkers.size(), std::memory_order_relaxed);
+            mGeneration.fetch_add(1, std::memory_order_release);
+        }
+
+        mWake.notify_all();
+
+        Execute(Batch, 0);
+
+        // Workers may still be completing claimed iterations
+        while (mBusy.load(std::memory_order_acquire) != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    tActive = Previous;
+}
+
+void ThreadPool::Execute(const Job& Task, size_t Slot) noexcept
+{
+    while (true)
+    {
+        uint64_t Index = Pop(Slot);
+
+        if (Index == NONE)
+        {
+            Index = Steal(Slot);
+
+            if (Index == NONE)
+            {
+                return;
+            }
+        }
+
+        Task.Invoke(Task.Context, Task.Offset + Index);
+    }
+}
+
+uint64_t ThreadPool::Pop(size_t Slot) noexcept
+{
+    std::atomic<uint64_t>& Bounds = mRanges[Slot].Bounds;
+    uint64_t Current = Bounds.load(std::memory_order_relaxed);
+
+    // Fails only when a thief has taken part of the range
+    while (Begin(Current) < End(Current))
+    {
+        if (Bounds.compare_exchange_weak(Current, Pack(Begin(Current) + 1, End(Current)), std::memory_order_relaxed) == true)
+        {
+            return Begin(Current);
+        }
+    }
+
+    return NONE;
+}
+
+uint64_t ThreadPool::Steal(size_t Slot) noexcept
+{
+    const size_t Threads = Concurrency();
+
+    for (size_t Step = 1; Step < Threads; Step++)
+    {
+        std::atomic<uint64_t>& Bounds = mRanges[(Slot + Step) % Threads].Bounds;
+        uint64_t Current = Bounds.load(std::memory_order_relaxed);
+
+        while (Begin(Current) < End(Current))
+        {
+            const uint64_t Middle = Begin(Current) + (End(Current) - Begin(Current)) / 2;
+
+            if (Bounds.compare_exchange_weak(Current, Pack(Begin(Current), Middle), std::memory_order_relaxed) == true)
+            {
+                // The range of this thread is empty, so no other thread modifies it concurrently
+                mRanges[Slot].Bounds.store(Pack(Middle + 1, End(Current)), std::memory_order_relaxed);
+                return Middle;
+            }
+        }
+    }
+
+    return NONE;
+}
+
+void ThreadPool::Submit(const QueuedTask& Item)
+{
+    const size_t Slot = (tActive == this) ? tSlot : 0;
+
+    {
+        std::lock_guard<std::mutex> Lock(mQueues[Slot].Mutex);
+        mQueues[Slot].Tasks.push_back(Item);
+    }
+
+    // Either a sleeping worker observes the task, or it is counted here and woken
+    mQueued.fetch_add(1, std::memory_order_seq_cst);
+
+    if (mSleepers.load(std::memory_order_seq_cst) > 0)
+    {
+        {
+            std::lock_guard<std::mutex> Lock(mMutex);
+        }
+
+        mWake.notify_one();
+    }
+}
+
+bool ThreadPool::RunTask(void) noexcept
+{
+    return RunTask((tActive == this) ? tSlot : 0);
+}
+
+bool ThreadPool::RunTask(size_t Slot) noexcept
+{
+    const size_t Threads = Concurrency();
+    QueuedTask Item{};
+
+    // Most recent task of this thread, otherwise the oldest task of another
+    for (size_t Step = 0; (Step < Threads) && (Item.Invoke == nullptr); Step++)
+    {
+        Queue& Tasks = mQueues[(Slot + Step) % Threads];
+        std::lock_guard<std::mutex> Lock(Tasks.Mutex);
+
+        if (Tasks.Tasks.empty() == true)
+        {
+            continue;
+        }
+
+        if (Step == 0)
+        {
+            Item = Tasks.Tasks.back();
+            Tasks.Tasks.pop_back();
+        }
+        else
+        {
+            Item = Tasks.Tasks.front();
+            Tasks.Tasks.pop_front();
+        }
+    }
+
+    if (Item.Invoke == nullptr)
+    {
+        return false;
+    }
+
+    mQueued.fetch_sub(1, std::memory_order_relaxed);
+
+    const ThreadPool* Previous = tActive;
+    const size_t PreviousSlot = tSlot;
+    tActive = this;
+    tSlot = Slot;
+
+    Item.Invoke(Item.Context);
+
+    tActive = Previous;
+    tSlot = PreviousSlot;
+    Item.Pending->fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void ThreadPool::WorkerLoop(size_t Slot)
+{
+    tActive = this;
+    tSlot = Slot;
+    uint64_t Seen = 0;
+
+    while (true)
+    {
+        Job Task{};
+        bool Loop = false;
+
+        {
+            std::unique_lock<std::mutex> Lock(mMutex);
+            mSleepers.fetch_add(1, std::memory_order_seq_cst);
+
+            mWake.wait(Lock, [&]()
+            {
+                return mStop || (mGeneration.load(std::memory_order_relaxed) != Seen) || (mQueued.load(std::memory_order_seq_cst) > 0);
+            });
+
+            mSleepers.fetch_sub(1, std::memory_order_relaxed);
+
+            if (mStop == true)
+            {
+                return;
+            }
+
+            if (mGeneration.load(std::memory_order_relaxed) != Seen)
+            {
+                Seen = mGeneration.load(std::memory_order_relaxed);
+                Task = mJob;
+                Loop = true;
+            }
+        }
+
+        if (Loop == true)
+        {
+            Execute(Task, Slot);
+            mBusy.fetch_sub(1, std::memory_order_release);
+        }
+
+        // Tasks, until none remain or a loop is dispatched
+        while ((mQueued.load(std::memory_order_acquire) > 0) && (mGeneration.load(std::memory_order_acquire) == Seen))
+        {
+            if (RunTask(Slot) == false)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+void TaskGroup::Wait(void) noexcept
+{
+    while (mPending.load(std::memory_order_acquire) > 0)
+    {
+        if (mPool.RunTask() == false)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
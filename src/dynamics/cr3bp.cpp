@@ -0,0 +1,742 @@
+#include "dynamics/cr3bp.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/root1d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+namespace
+{
+    // Collinear libration points, converged to near machine precision
+    constexpr RootFind::NewtonParameters LIBRATION_PARAMETERS{.Tolerance = 1.0E-15, .MaxIterations = 64};
+
+    // Free variables of a symmetric orbit, the crossing [x, z, vy] and the half period, and the
+    // constraints at the next crossing [y, vx, vz]
+    constexpr size_t SYMMETRIC_VARIABLES = 4;
+    constexpr size_t SYMMETRIC_CONSTRAINTS = 3;
+
+    // Index of each free variable of a symmetric orbit, and its component of the state
+    constexpr std::array<size_t, 3> CROSSING_COMPONENTS = {0, 2, 4};
+    constexpr std::array<size_t, SYMMETRIC_CONSTRAINTS> CONSTRAINT_COMPONENTS = {1, 3, 5};
+    constexpr size_t HALF_PERIOD = 3;
+
+    using Variables = std::array<double, SYMMETRIC_VARIABLES>;
+
+    /**
+     * Solves A x X = B in place by Gaussian elimination with partial pivoting
+     * @param A Square matrix of `Size` rows in row major order, overwritten
+     * @param B Right hand side, overwritten with the solution
+     * @param Size Number of rows
+     * @return `false` if the matrix is singular
+     */
+    bool SolveLinear(double* A, double* B, size_t Size) noexcept
+    {
+        for (size_t Col = 0; Col < Size; Col++)
+        {
+            size_t Pivot = Col;
+
+            for (size_t Row = Col + 1; Row < Size; Row++)
+            {
+                Pivot = (Abs(A[Row * Size + Col]) > Abs(A[Pivot * Size + Col])) ? Row : Pivot;
+            }
+
+            if ((Abs(A[Pivot * Size + Col]) > 0.0) == false)
+            {
+                return false;
+            }
+
+            for (size_t K = 0; K < Size; K++)
+            {
+                std::swap(A[Col * Size + K], A[Pivot * Size + K]);
+            }
+
+            std::swap(B[Col], B[Pivot]);
+
+            for (size_t Row = Col + 1; Row < Size; Row++)
+            {
+                const double Factor = A[Row * Size + Col] / A[Col * Size + Col];
+
+                for (size_t K = Col; K < Size; K++)
+                {
+                    A[Row * Size + K] -= Factor * A[Col * Size + K];
+                }
+
+                B[Row] -= Factor * B[Col];
+            }
+        }
+
+        for (size_t Row = Size; Row-- > 0;)
+        {
+            double Sum = B[Row];
+
+            for (size_t K = Row + 1; K < Size; K++)
+            {
+                Sum -= A[Row * Size + K] * B[K];
+            }
+
+            B[Row] = Sum / A[Row * Size + Row];
+        }
+
+        return true;
+    }
+
+    /**
+     * @return Partial derivative of the Jacobi constant with respect to each component of the state
+     */
+    CR3BP::State JacobiGradient(const CR3BP::State& X, double MassRatio) noexcept
+    {
+        const CR3BP::State F = CR3BP::Derivative(X, MassRatio);
+        CR3BP::State Gradient{};
+
+        // The gradient of the pseudo potential is the acceleration less the Coriolis terms
+        Gradient[0] = 2.0 * (F[3] - 2.0 * X[4]);
+        Gradient[1] = 2.0 * (F[4] + 2.0 * X[3]);
+        Gradient[2] = 2.0 * F[5];
+
+        for (size_t Index = 3; Index < 6; Index++)
+        {
+            Gradient[Index] = -2.0 * X[Index];
+        }
+
+        return Gradient;
+    }
+
+    /**
+     * @return State at the crossing of the free variables of a symmetric orbit
+     */
+    CR3BP::State CrossingState(const Variables& V) noexcept
+    {
+        return CR3BP::State{.Data = {V[0], 0.0, V[1], 0.0, V[2], 0.0}};
+    }
+
+    /**
+     * Constraint completing the correction of a symmetric orbit, either a free variable held
+     * fixed, or the projection of the change from a converged member onto the tangent to the
+     * family
+     */
+    struct SymmetricConstraint
+    {
+        /// Free variable held fixed, or none for pseudo-arclength
+        size_t Fixed = SYMMETRIC_VARIABLES;
+
+        Variables Base{};
+        Variables Tangent{};
+        double Arclength = 0.0;
+    };
+
+    /**
+     * Converged or failed correction of a symmetric orbit
+     */
+    struct SymmetricSolution
+    {
+        Variables V{};
+
+        /// Partial derivatives of the constraints with respect to the free variables at `V`
+        MatrixN<SYMMETRIC_CONSTRAINTS, SYMMETRIC_VARIABLES> Jacobian{};
+
+        size_t Iterations = 0;
+        bool Converged = false;
+    };
+
+    /**
+     * Free variables and constraints of a symmetric orbit, the out of plane pair omitted for
+     * a planar orbit
+     */
+    struct SymmetricProblem
+    {
+        std::array<size_t, SYMMETRIC_VARIABLES> Free{};
+        size_t FreeCount = 0;
+        size_t ConstraintCount = 0;
+
+        explicit SymmetricProblem(bool Planar) noexcept
+        {
+            Free = Planar ? std::array<size_t, SYMMETRIC_VARIABLES>{0, 2, 3, 0} : std::array<size_t, SYMMETRIC_VARIABLES>{0, 1, 2, 3};
+            FreeCount = Planar ? 3 : 4;
+            ConstraintCount = Planar ? 2 : 3;
+        }
+    };
+
+    /**
+     * @return `true` if the crossing of a symmetric orbit lies in the plane of the primaries
+     */
+    bool IsPlanar(const CR3BP::State& X) noexcept
+    {
+        return (X[2] == 0.0) && (X[5] == 0.0);
+    }
+
+    /**
+     * Evaluates the constraints of a symmetric orbit and their partial derivatives
+     * @return `false` if the integration failed
+     */
+    bool EvaluateSymmetric(const Variables& V, double MassRatio, const ODE::IntegratorSettings& Settings,
+        std::array<double, SYMMETRIC_CONSTRAINTS>& F, MatrixN<SYMMETRIC_CONSTRAINTS, SYMMETRIC_VARIABLES>& Jacobian) noexcept
+    {
+        const ODE::IntegratorResult<6, 7> Result = CR3BP::PropagateTransition(CrossingState(V), MassRatio, V[HALF_PERIOD], Settings);
+
+        if ((Result.ExitCode != ODE::IntegratorStatus::SUCCESS) || (V[HALF_PERIOD] <= 0.0))
+        {
+            return false;
+        }
+
+        const CR3BP::State Final = Result.State.Block<6, 1>(0, 0);
+        const CR3BP::State Rate = CR3BP::Derivative(Final, MassRatio);
+
+        for (size_t Row = 0; Row < SYMMETRIC_CONSTRAINTS; Row++)
+        {
+            const size_t Component = CONSTRAINT_COMPONENTS[Row];
+            F[Row] = Final[Component];
+
+            for (size_t Col = 0; Col < CROSSING_COMPONENTS.size(); Col++)
+            {
+                Jacobian(Row, Col) = Result.State(Component, CROSSING_COMPONENTS[Col] + 1);
+            }
+
+            Jacobian(Row, HALF_PERIOD) = Rate[Component];
+        }
+
+        return true;
+    }
+
+    /**
+     * Newton correction of a symmetric orbit, the constraints at the next crossing completed
+     * by a fixed variable or the pseudo-arclength constraint into a square system
+     * @param Monotone `true` to fail once the norm of the constraints increases
+     */
+    SymmetricSolution CorrectSymmetric(const Variables& Guess, double MassRatio, const SymmetricProblem& Problem,
+        const SymmetricConstraint& Extra, const CR3BP::CorrectorSettings& Settings, bool Monotone) noexcept
+    {
+        SymmetricSolution Solution{.V = Guess};
+        const bool Arclength = (Extra.Fixed == SYMMETRIC_VARIABLES);
+
+        // Free variables of the square system
+        std::array<size_t, SYMMETRIC_VARIABLES> Unknowns{};
+        size_t Size = 0;
+
+        for (size_t Index = 0; Index < Problem.FreeCount; Index++)
+        {
+            if (Problem.Free[Index] != Extra.Fixed)
+            {
+                Unknowns[Size++] = Problem.Free[Index];
+            }
+        }
+
+        double Previous = std::numeric_limits<double>::infinity();
+
+        for (; Solution.Iterations <= Settings.MaxIterations; Solution.Iterations++)
+        {
+            std::array<double, SYMMETRIC_CONSTRAINTS> F{};
+
+            if (EvaluateSymmetric(Solution.V, MassRatio, Settings.Integration, F, Solution.Jacobian) == false)
+            {
+                return Solution;
+            }
+
+            std::array<double, SYMMETRIC_VARIABLES * SYMMETRIC_VARIABLES> A{};
+            std::array<double, SYMMETRIC_VARIABLES> B{};
+            double Norm = 0.0;
+
+            for (size_t Row = 0; Row < Problem.ConstraintCount; Row++)
+            {
+                for (size_t Col = 0; Col < Size; Col++)
+                {
+                    A[Row * Size + Col] = Solution.Jacobian(Row, Unknowns[Col]);
+                }
+
+                B[Row] = -F[Row];
+                Norm += Square(F[Row]);
+            }
+
+            if (Arclength == true)
+            {
+                const size_t Row = Problem.ConstraintCount;
+                double Projection = -Extra.Arclength;
+
+                for (size_t Col = 0; Col < Size; Col++)
+                {
+                    A[Row * Size + Col] = Extra.Tangent[Unknowns[Col]];
+                    Projection += (Solution.V[Unknowns[Col]] - Extra.Base[Unknowns[Col]]) * Extra.Tangent[Unknowns[Col]];
+                }
+
+                B[Row] = -Projection;
+                Norm += Square(Projection);
+            }
+
+            if (Sqrt(Norm) < Settings.Tolerance)
+            {
+                Solution.Converged = true;
+                return Solution;
+            }
+
+            // Abandon a diverging correction of a close prediction before its trajectories lengthen
+            // without bound, a distant guess being permitted to converge irregularly
+            if ((Solution.Iterations == Settings.MaxIterations) || (Monotone && (Norm > Previous)) ||
+                (SolveLinear(A.data(), B.data(), Size) == false))
+            {
+                return Solution;
+            }
+
+            Previous = Norm;
+
+            for (size_t Col = 0; Col < Size; Col++)
+            {
+                Solution.V[Unknowns[Col]] += B[Col];
+            }
+        }
+
+        return Solution;
+    }
+
+    /**
+     * Unit tangent to a family at a converged member, the null vector of the partial
+     * derivatives of the constraints, oriented along `Reference`
+     * @return `false` if the partial derivatives are rank deficient
+     */
+    bool FamilyTangent(const SymmetricSolution& Member, const SymmetricProblem& Problem, const Variables& Reference, Variables& Tangent) noexcept
+    {
+        std::array<double, SYMMETRIC_VARIABLES * SYMMETRIC_VARIABLES> A{};
+        std::array<double, SYMMETRIC_VARIABLES> B{};
+        const size_t Size = Problem.FreeCount;
+
+        for (size_t Col = 0; Col < Size; Col++)
+        {
+            for (size_t Row = 0; Row < Problem.ConstraintCount; Row++)
+            {
+                A[Row * Size + Col] = Member.Jacobian(Row, Problem.Free[Col]);
+            }
+
+            A[Problem.ConstraintCount * Size + Col] = Reference[Problem.Free[Col]];
+        }
+
+        B[Problem.ConstraintCount] = 1.0;
+
+        if (SolveLinear(A.data(), B.data(), Size) == false)
+        {
+            return false;
+        }
+
+        double Norm = 0.0;
+
+        for (size_t Col = 0; Col < Size; Col++)
+        {
+            Norm += Square(B[Col]);
+        }
+
+        Tangent = Variables{};
+
+        for (size_t Col = 0; Col < Size; Col++)
+        {
+            Tangent[Problem.Free[Col]] = B[Col] / Sqrt(Norm);
+        }
+
+        return true;
+    }
+
+    /**
+     * @return Periodic orbit of a corrected symmetric orbit, with its monodromy matrix
+     */
+    CR3BP::PeriodicOrbit MakeSymmetricOrbit(const SymmetricSolution& Solution, double MassRatio, const CR3BP::CorrectorSettings& Settings) noexcept
+    {
+        CR3BP::PeriodicOrbit Orbit{
+            .InitialState = CrossingState(Solution.V),
+            .Period = 2.0 * Solution.V[HALF_PERIOD],
+            .JacobiConstant = CR3BP::JacobiConstant(CrossingState(Solution.V), MassRatio),
+            .Iterations = Solution.Iterations,
+            .Converged = Solution.Converged};
+
+        if (Solution.Converged == true)
+        {
+            const ODE::IntegratorResult<6, 7> Result = CR3BP::PropagateTransition(Orbit.InitialState, MassRatio, Orbit.Period, Settings.Integration);
+            Orbit.Monodromy = Result.State.Block<6, 6>(0, 1);
+            Orbit.Converged = (Result.ExitCode == ODE::IntegratorStatus::SUCCESS);
+        }
+
+        return Orbit;
+    }
+
+    /**
+     * @return Index of the free variable of a family parameter
+     */
+    size_t ParameterVariable(CR3BP::FamilyParameter Parameter, bool Planar) noexcept
+    {
+        switch (Parameter)
+        {
+            case CR3BP::FamilyParameter::Z:
+                return Planar ? 0 : 1;
+            case CR3BP::FamilyParameter::VY:
+                return 2;
+            case CR3BP::FamilyParameter::X:
+                break;
+        }
+
+        return 0;
+    }
+}
+
+Vector3 CR3BP::LibrationPosition(double MassRatio, LibrationPoint Point) noexcept
+{
+    const double Mu = MassRatio;
+
+    if ((Point == LibrationPoint::L4) || (Point == LibrationPoint::L5))
+    {
+        return Vector3({0.5 - Mu, ((Point == LibrationPoint::L4) ? 0.5 : -0.5) * Sqrt(3.0), 0.0});
+    }
+
+    // Zero of the pseudo potential gradient along the X axis, from the Hill sphere radius
+    const double Hill = Cbrt(Mu / 3.0);
+    const double Guess = (Point == LibrationPoint::L1) ? 1.0 - Mu - Hill : ((Point == LibrationPoint::L2) ? 1.0 - Mu + Hill : -1.0 - 5.0 * Mu / 12.0);
+
+    const auto Result = RootFind::Newton(
+        [=](double X) {return X - (1.0 - Mu) * (X + Mu) / Cube(Abs(X + Mu)) - Mu * (X - 1.0 + Mu) / Cube(Abs(X - 1.0 + Mu));},
+        [=](double X) {return 1.0 + 2.0 * (1.0 - Mu) / Cube(Abs(X + Mu)) + 2.0 * Mu / Cube(Abs(X - 1.0 + Mu));},
+        Guess,
+        LIBRATION_PARAMETERS);
+
+    return Vector3({Result.X, 0.0, 0.0});
+}
+
+CR3BP::State CR3BP::Derivative(const State& X, double MassRatio) noexcept
+{
+    const double Mu = MassRatio;
+    const double R1 = Sqrt(Square(X[0] + Mu) + Square(X[1]) + Square(X[2]));
+    const double R2 = Sqrt(Square(X[0] - 1.0 + Mu) + Square(X[1]) + Square(X[2]));
+    const double K1 = (1.0 - Mu) / Cube(R1);
+    const double K2 = Mu / Cube(R2);
+
+    return State{.Data = {
+        X[3],
+        X[4],
+        X[5],
+        2.0 * X[4] + X[0] - K1 * (X[0] + Mu) - K2 * (X[0] - 1.0 + Mu),
+        -2.0 * X[3] + X[1] - (K1 + K2) * X[1],
+        -(K1 + K2) * X[2]}};
+}
+
+MatrixN<6, 6> CR3BP::Jacobian(const State& X, double MassRatio) noexcept
+{
+    const double Mu = MassRatio;
+    const std::array<double, 3> D1 = {X[0] + Mu, X[1], X[2]};
+    const std::array<double, 3> D2 = {X[0] - 1.0 + Mu, X[1], X[2]};
+    const double R1 = Sqrt(Square(D1[0]) + Square(D1[1]) + Square(D1[2]));
+    const double R2 = Sqrt(Square(D2[0]) + Square(D2[1]) + Square(D2[2]));
+    const double K1 = (1.0 - Mu) / Cube(R1);
+    const double K2 = Mu / Cube(R2);
+    MatrixN<6, 6> A{};
+
+    for (size_t Row = 0; Row < 3; Row++)
+    {
+        A(Row, Row + 3) = 1.0;
+
+        // Hessian of the pseudo potential, the centrifugal term in the plane of the primaries
+        for (size_t Col = 0; Col < 3; Col++)
+        {
+            const double Diagonal = (Row == Col) ? ((Row < 2) ? 1.0 : 0.0) - K1 - K2 : 0.0;
+            A(Row + 3, Col) = Diagonal + 3.0 * (K1 * D1[Row] * D1[Col] / Square(R1) + K2 * D2[Row] * D2[Col] / Square(R2));
+        }
+    }
+
+    // Coriolis terms
+    A(3, 4) = 2.0;
+    A(4, 3) = -2.0;
+
+    return A;
+}
+
+MatrixN<6, 7> CR3BP::VariationalDerivative(const MatrixN<6, 7>& X, double MassRatio) noexcept
+{
+    const State Position = X.Block<6, 1>(0, 0);
+    const MatrixN<6, 6> A = Jacobian(Position, MassRatio);
+    MatrixN<6, 7> Result{};
+
+    Result.SetBlock(0, 0, Derivative(Position, MassRatio));
+    Result.SetBlock(0, 1, A * X.Block<6, 6>(0, 1));
+
+    return Result;
+}
+
+double CR3BP::JacobiConstant(const State& X, double MassRatio) noexcept
+{
+    const double Mu = MassRatio;
+    const double R1 = Sqrt(Square(X[0] + Mu) + Square(X[1]) + Square(X[2]));
+    const double R2 = Sqrt(Square(X[0] - 1.0 + Mu) + Square(X[1]) + Square(X[2]));
+
+    return Square(X[0]) + Square(X[1]) + 2.0 * (1.0 - Mu) / R1 + 2.0 * Mu / R2 - (Square(X[3]) + Square(X[4]) + Square(X[5]));
+}
+
+ODE::IntegratorResult<6, 1> CR3BP::Propagate(const State& X, double MassRatio, double Time, const ODE::IntegratorSettings& Settings) noexcept
+{
+    return ODE::DormandPrince([=](double, const State& Y) {return Derivative(Y, MassRatio);}, 0.0, Time, X, Settings);
+}
+
+ODE::IntegratorResult<6, 7> CR3BP::PropagateTransition(const State& X, double MassRatio, double Time, const ODE::IntegratorSettings& Settings) noexcept
+{
+    MatrixN<6, 7> Initial{};
+    Initial.SetBlock(0, 0, X);
+    Initial.SetBlock(0, 1, Transition::IDENTITY());
+
+    return ODE::DormandPrince([=](double, const MatrixN<6, 7>& Y) {return VariationalDerivative(Y, MassRatio);}, 0.0, Time, Initial, Settings);
+}
+
+CR3BP::PeriodicOrbit CR3BP::LyapunovGuess(double MassRatio, LibrationPoint Point, double Amplitude) noexcept
+{
+    const Vector3 Libration = LibrationPosition(MassRatio, Point);
+    const MatrixN<6, 6> A = Jacobian(State{.Data = {Libration.X, Libration.Y, Libration.Z, 0.0, 0.0, 0.0}}, MassRatio);
+    const double Uxx = A(3, 0);
+    const double Uyy = A(4, 1);
+
+    // Oscillatory root of the planar characteristic equation, L^2 + (4 - Uxx - Uyy) L + Uxx Uyy = 0
+    // in L = lambda^2, and the ratio of the amplitudes along Y and X
+    const double B = 4.0 - Uxx - Uyy;
+    const double Frequency = Sqrt(0.5 * (B + Sqrt(Square(B) - 4.0 * Uxx * Uyy)));
+    const double Ratio = (Square(Frequency) + Uxx) / (2.0 * Frequency);
+
+    return PeriodicOrbit{
+        .InitialState = State{.Data = {Libration.X + Amplitude, 0.0, 0.0, 0.0, -Ratio * Amplitude * Frequency, 0.0}},
+        .Period = 2.0 * PI / Frequency,
+        .JacobiConstant = JacobiConstant(State{.Data = {Libration.X + Amplitude, 0.0, 0.0, 0.0, -Ratio * Amplitude * Frequency, 0.0}}, MassRatio)};
+}
+
+CR3BP::PeriodicOrbit CR3BP::CorrectSymmetric(const State& Guess, double HalfPeriod, double MassRatio, FamilyParameter Fixed,
+    const CorrectorSettings& Settings) noexcept
+{
+    const bool Planar = IsPlanar(Guess);
+    const SymmetricProblem Problem(Planar);
+    const SymmetricConstraint Extra{.Fixed = ParameterVariable(Fixed, Planar)};
+    const Variables V = {Guess[0], Planar ? 0.0 : Guess[2], Guess[4], HalfPeriod};
+
+    return MakeSymmetricOrbit(::CorrectSymmetric(V, MassRatio, Problem, Extra, Settings, false), MassRatio, Settings);
+}
+
+CR3BP::PeriodicOrbit CR3BP::CorrectMultipleShooting(ThreadPool& Pool, std::span<State> Patches, std::span<double> Durations, double MassRatio,
+    const CorrectorSettings& Settings) noexcept
+{
+    const size_t Arcs = Patches.size();
+    const size_t VariableCount = 7 * Arcs;
+    const size_t ConstraintCount = 6 * Arcs - 1;
+    PeriodicOrbit Orbit{};
+
+    if (Arcs == 0)
+    {
+        return Orbit;
+    }
+
+    // Component of the return to the first state omitted, that most sensitive in the Jacobi constant
+    const State Gradient = JacobiGradient(Patches[0], MassRatio);
+    size_t Omitted = 0;
+
+    for (size_t Index = 1; Index < 6; Index++)
+    {
+        Omitted = (Abs(Gradient[Index]) > Abs(Gradient[Omitted])) ? Index : Omitted;
+    }
+
+    std::vector<ODE::IntegratorResult<6, 7>> Results(Arcs);
+    std::vector<double> Jacobian(ConstraintCount * VariableCount);
+    std::vector<double> Normal(ConstraintCount * ConstraintCount);
+    std::vector<double> F(ConstraintCount);
+
+    for (; Orbit.Iterations <= Settings.MaxIterations; Orbit.Iterations++)
+    {
+        Pool.ParallelFor(Arcs, [&](size_t Arc)
+        {
+            Results[Arc] = PropagateTransition(Patches[Arc], MassRatio, Durations[Arc], Settings.Integration);
+        });
+
+        // Continuity of each arc with the start of the next, in the free variables [state, duration]
+        // of each arc, in order
+        std::fill(Jacobian.begin(), Jacobian.end(), 0.0);
+        double Norm = 0.0;
+        size_t Row = 0;
+
+        for (size_t Arc = 0; Arc < Arcs; Arc++)
+        {
+            if ((Results[Arc].ExitCode != ODE::IntegratorStatus::SUCCESS) || (Durations[Arc] <= 0.0))
+            {
+                return Orbit;
+            }
+
+            const size_t Next = (Arc + 1) % Arcs;
+            const State Final = Results[Arc].State.Block<6, 1>(0, 0);
+            const State Rate = Derivative(Final, MassRatio);
+
+            for (size_t Component = 0; Component < 6; Component++, Row++)
+            {
+                if ((Next == 0) && (Component == Omitted))
+                {
+                    Row--;
+                    continue;
+                }
+
+                double* Partials = &Jacobian[Row * VariableCount];
+
+                for (size_t Col = 0; Col < 6; Col++)
+                {
+                    Partials[7 * Arc + Col] += Results[Arc].State(Component, Col + 1);
+                }
+
+                Partials[7 * Arc + 6] = Rate[Component];
+                Partials[7 * Next + Component] -= 1.0;
+                F[Row] = Final[Component] - Patches[Next][Component];
+                Norm += Square(F[Row]);
+            }
+        }
+
+        if (Sqrt(Norm) < Settings.Tolerance)
+        {
+            Orbit.Converged = true;
+            break;
+        }
+
+        if (Orbit.Iterations == Settings.MaxIterations)
+        {
+            return Orbit;
+        }
+
+        // Update of least norm, -J^T (J J^T)^-1 F
+        for (size_t I = 0; I < ConstraintCount; I++)
+        {
+            for (size_t J = 0; J <= I; J++)
+            {
+                double Sum = 0.0;
+
+                for (size_t K = 0; K < VariableCount; K++)
+                {
+                    Sum += Jacobian[I * VariableCount + K] * Jacobian[J * VariableCount + K];
+                }
+
+                Normal[I * ConstraintCount + J] = Sum;
+                Normal[J * ConstraintCount + I] = Sum;
+            }
+        }
+
+        if (SolveLinear(Normal.data(), F.data(), ConstraintCount) == false)
+        {
+            return Orbit;
+        }
+
+        for (size_t Col = 0; Col < VariableCount; Col++)
+        {
+            double Update = 0.0;
+
+            for (size_t I = 0; I < ConstraintCount; I++)
+            {
+                Update -= Jacobian[I * VariableCount + Col] * F[I];
+            }
+
+            if (Col % 7 == 6)
+            {
+                Durations[Col / 7] += Update;
+            }
+            else
+            {
+                Patches[Col / 7][Col % 7] += Update;
+            }
+        }
+    }
+
+    Orbit.InitialState = Patches[0];
+    Orbit.JacobiConstant = JacobiConstant(Patches[0], MassRatio);
+    Orbit.Monodromy = Transition::IDENTITY();
+
+    for (size_t Arc = 0; Arc < Arcs; Arc++)
+    {
+        Orbit.Period += Durations[Arc];
+        Orbit.Monodromy = Results[Arc].State.Block<6, 6>(0, 1) * Orbit.Monodromy;
+    }
+
+    return Orbit;
+}
+
+std::vector<CR3BP::PeriodicOrbit> CR3BP::ContinueFamily(ThreadPool& Pool, const PeriodicOrbit& Initial, double MassRatio,
+    const ContinuationSettings& Settings)
+{
+    std::vector<PeriodicOrbit> Family{Initial};
+    const bool Planar = IsPlanar(Initial.InitialState);
+    const SymmetricProblem Problem(Planar);
+    const size_t Parameter = ParameterVariable(Settings.Parameter, Planar);
+    const double Direction = (Settings.Step < 0.0) ? -1.0 : 1.0;
+    const bool Natural = (Settings.Method == ContinuationMethod::NATURAL_PARAMETER);
+
+    // Partial derivatives of the constraints at the initial member, corrected again with its
+    // parameter held fixed, and the tangent in the direction of increasing parameter
+    const Variables Start = {Initial.InitialState[0], Initial.InitialState[2], Initial.InitialState[4], 0.5 * Initial.Period};
+    SymmetricSolution Base = ::CorrectSymmetric(Start, MassRatio, Problem, SymmetricConstraint{.Fixed = Parameter}, Settings.Corrector, false);
+    Variables Reference{};
+    Variables Tangent{};
+    Reference[Parameter] = Direction;
+
+    if ((Base.Converged == false) || (FamilyTangent(Base, Problem, Reference, Tangent) == false))
+    {
+        return Family;
+    }
+
+    double Step = Min(Abs(Settings.Step), Settings.MaxStep);
+    std::vector<SymmetricSolution> Batch(Max(Settings.Batch, size_t(1)));
+    std::vector<PeriodicOrbit> Orbits(Batch.size());
+
+    while ((Family.size() < Settings.Members) && (Step >= Settings.MinStep))
+    {
+        const size_t Count = Min(Batch.size(), Settings.Members - Family.size());
+
+        Pool.ParallelFor(Count, [&](size_t Index)
+        {
+            const double Distance = Step * static_cast<double>(Index + 1);
+            SymmetricConstraint Extra{.Base = Base.V, .Tangent = Tangent, .Arclength = Distance};
+            Variables Guess = Base.V;
+
+            // Natural parameter steps along the tangent to the next value of the parameter
+            const double Scale = Natural ? Direction * Distance / Tangent[Parameter] : Distance;
+
+            for (size_t Variable = 0; Variable < SYMMETRIC_VARIABLES; Variable++)
+            {
+                Guess[Variable] += Scale * Tangent[Variable];
+            }
+
+            if (Natural == true)
+            {
+                Extra.Fixed = Parameter;
+                Guess[Parameter] = Base.V[Parameter] + Direction * Distance;
+            }
+
+            Batch[Index] = ::CorrectSymmetric(Guess, MassRatio, Problem, Extra, Settings.Corrector, true);
+
+            // A correction further from its prediction than the step may have left the family,
+            // i.e for the libration point, periodic for any period
+            double Correction = 0.0;
+
+            for (size_t Variable = 0; Variable < SYMMETRIC_VARIABLES; Variable++)
+            {
+                Correction += Square(Batch[Index].V[Variable] - Guess[Variable]);
+            }
+
+            Batch[Index].Converged = Batch[Index].Converged && (Sqrt(Correction) <= Step);
+            Orbits[Index] = MakeSymmetricOrbit(Batch[Index], MassRatio, Settings.Corrector);
+        });
+
+        size_t Accepted = 0;
+
+        while ((Accepted < Count) && (Orbits[Accepted].Converged == true))
+        {
+            Family.push_back(Orbits[Accepted++]);
+        }
+
+        if (Accepted == 0)
+        {
+            Step *= 0.5;
+            continue;
+        }
+
+        // Continue from the last accepted member, along the tangent oriented with the previous
+        const Variables Previous = Tangent;
+        Base = Batch[Accepted - 1];
+
+        if (FamilyTangent(Base, Problem, Previous, Tangent) == false)
+        {
+            break;
+        }
+
+        Step = (Accepted == Count) ? Min(1.5 * Step, Settings.MaxStep) : Step;
+    }
+
+    return Family;
+}
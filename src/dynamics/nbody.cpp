@@ -0,0 +1,513 @@
+#include "dynamics/nbody.hpp"
+
+#include "utils/errors.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace
+{
+    // Largest number of bodies for which automatic evaluation sums directly
+    constexpr size_t DIRECT_LIMIT = 2048;
+
+    // Targets accumulated together by the direct kernel, which the compiler vectorises
+    constexpr size_t LANES = 8;
+
+    // Tiles of targets processed by each thread against each block of sources, and the
+    // number of sources of a block, such that the block remains in the L1 cache
+    constexpr size_t TARGET_TILES = 16;
+    constexpr size_t SOURCE_BLOCK = 1024;
+
+    // Bits of each axis of a Morton key, and so the deepest level of the octree
+    constexpr uint64_t KEY_BITS = 21;
+
+    // Cells of a level of the octree processed in sequence by each thread
+    constexpr size_t CELL_GRAIN = 64;
+
+    // Bodies walked through the octree in sequence by each thread, consecutive in Morton
+    // order such that they open similar cells
+    constexpr size_t WALK_GRAIN = 64;
+
+    /**
+     * @return Bits of `Value` spread to every third bit
+     */
+    constexpr uint64_t Spread(uint64_t Value) noexcept
+    {
+        Value &= 0x1FFFFF;
+        Value = (Value | (Value << 32)) & 0x1F00000000FFFF;
+        Value = (Value | (Value << 16)) & 0x1F0000FF0000FF;
+        Value = (Value | (Value << 8)) & 0x100F00F00F00F00F;
+        Value = (Value | (Value << 4)) & 0x10C30C30C30C30C3;
+        Value = (Value | (Value << 2)) & 0x1249249249249249;
+        return Value;
+    }
+
+    /**
+     * Sort key of a body, its key then its index such that the order is unique
+     */
+    struct SortKey
+    {
+        uint64_t Key = 0;
+        uint32_t Index = 0;
+
+        bool operator<(const SortKey& Other) const noexcept
+        {
+            return (Key < Other.Key) || ((Key == Other.Key) && (Index < Other.Index));
+        }
+    };
+
+    /**
+     * Sorts in parallel, each thread sorting a run which are then merged pairwise
+     */
+    void ParallelSort(ThreadPool& Pool, std::vector<SortKey>& Keys)
+    {
+        const size_t Runs = Min(Pool.Concurrency(), Max(Keys.size() / 4096, size_t(1)));
+        const size_t Length = (Keys.size() + Runs - 1) / Runs;
+        const auto Bound = [&](size_t Run) {return Keys.begin() + static_cast<std::ptrdiff_t>(Min(Run * Length, Keys.size()));};
+
+        Pool.ParallelFor(Runs, [&](size_t Run)
+        {
+            std::sort(Bound(Run), Bound(Run + 1));
+        });
+
+        for (size_t Width = 1; Width < Runs; Width *= 2)
+        {
+            Pool.ParallelFor((Runs + 2 * Width - 1) / (2 * Width), [&](size_t Pair)
+            {
+                const size_t First = 2 * Width * Pair;
+                std::inplace_merge(Bound(First), Bound(Min(First + Width, Runs)), Bound(Min(First + 2 * Width, Runs)));
+            });
+        }
+    }
+}
+
+size_t NBodySystem::Add(double GravitationalParameter, const Vector3& Position, const Vector3& Velocity)
+{
+    if (GravitationalParameter < 0.0)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Gravitational parameter of a body must not be negative");
+    }
+
+    mX.push_back(Position.X);
+    mY.push_back(Position.Y);
+    mZ.push_back(Position.Z);
+    mVX.push_back(Velocity.X);
+    mVY.push_back(Velocity.Y);
+    mVZ.push_back(Velocity.Z);
+    mAX.push_back(0.0);
+    mAY.push_back(0.0);
+    mAZ.push_back(0.0);
+    mMu.push_back(GravitationalParameter);
+    mAccelerationValid = false;
+
+    return mMu.size() - 1;
+}
+
+void NBodySystem::Reserve(size_t Capacity)
+{
+    for (std::vector<double>* Field : {&mX, &mY, &mZ, &mVX, &mVY, &mVZ, &mAX, &mAY, &mAZ, &mMu})
+    {
+        Field->reserve(Capacity);
+    }
+}
+
+void NBodySystem::SetSettings(const NBodySettings& Settings) noexcept
+{
+    mSettings = Settings;
+    mAccelerationValid = false;
+}
+
+NBodyMethod NBodySystem::GetActiveMethod(void) const noexcept
+{
+    if (mSettings.Method == NBodyMethod::AUTOMATIC)
+    {
+        return (Size() <= DIRECT_LIMIT) ? NBodyMethod::DIRECT : NBodyMethod::BARNES_HUT;
+    }
+
+    return mSettings.Method;
+}
+
+void NBodySystem::MutualAccelerations(ThreadPool& Pool, std::span<Vector3> Accelerations)
+{
+    EvaluateMutual(Pool);
+
+    ForEachBody(Pool, [&](size_t Index)
+    {
+        Accelerations[Index] = Vector3({mAX[Index], mAY[Index], mAZ[Index]});
+    });
+
+    // The accelerations no longer include the external field
+    mAccelerationValid = false;
+}
+
+void NBodySystem::EvaluateMutual(ThreadPool& Pool)
+{
+    if (GetActiveMethod() == NBodyMethod::DIRECT)
+    {
+        EvaluateDirect(Pool);
+    }
+    else
+    {
+        EvaluateTree(Pool);
+    }
+}
+
+void NBodySystem::EvaluateDirect(ThreadPool& Pool)
+{
+    const size_t Count = Size();
+    const size_t Tiles = (Count + LANES - 1) / LANES;
+    const double Softening2 = Square(mSettings.Softening);
+
+    Pool.ParallelFor((Tiles + TARGET_TILES - 1) / TARGET_TILES, [&](size_t Chunk)
+    {
+        const size_t FirstTile = Chunk * TARGET_TILES;
+        const size_t ChunkTiles = Min(TARGET_TILES, Tiles - FirstTile);
+
+        // Targets of the chunk, unused lanes of the last tile computing but never storing
+        double X[TARGET_TILES][LANES]{};
+        double Y[TARGET_TILES][LANES]{};
+        double Z[TARGET_TILES][LANES]{};
+        double AX[TARGET_TILES][LANES]{};
+        double AY[TARGET_TILES][LANES]{};
+        double AZ[TARGET_TILES][LANES]{};
+
+        for (size_t Tile = 0; Tile < ChunkTiles; Tile++)
+        {
+            for (size_t Lane = 0; Lane < LANES; Lane++)
+            {
+                const size_t Index = Min((FirstTile + Tile) * LANES + Lane, Count - 1);
+                X[Tile][Lane] = mX[Index];
+                Y[Tile][Lane] = mY[Index];
+                Z[Tile][Lane] = mZ[Index];
+            }
+        }
+
+        // Sources are summed in index order for every target, whatever the blocking
+        for (size_t Block = 0; Block < Count; Block += SOURCE_BLOCK)
+        {
+            const size_t BlockEnd = Min(Block + SOURCE_BLOCK, Count);
+
+            for (size_t Tile = 0; Tile < ChunkTiles; Tile++)
+            {
+                for (size_t Source = Block; Source < BlockEnd; Source++)
+                {
+                    const double SX = mX[Source];
+                    const double SY = mY[Source];
+                    const double SZ = mZ[Source];
+                    const double Mu = mMu[Source];
+
+                    for (size_t Lane = 0; Lane < LANES; Lane++)
+                    {
+                        const double DX = SX - X[Tile][Lane];
+                        const double DY = SY - Y[Tile][Lane];
+                        const double DZ = SZ - Z[Tile][Lane];
+                        const double Distance2 = DX * DX + DY * DY + DZ * DZ + Softening2;
+
+                        // A body exerts no force upon itself, its separation being zero. Adding
+                        // rather than selecting keeps the loop free of branches to vectorise
+                        const double Safe = Distance2 + ((Distance2 > 0.0) ? 0.0 : 1.0);
+                        const double Scale = Mu / (Safe * Sqrt(Safe));
+
+                        AX[Tile][Lane] += DX * Scale;
+                        AY[Tile][Lane] += DY * Scale;
+                        AZ[Tile][Lane] += DZ * Scale;
+                    }
+                }
+            }
+        }
+
+        for (size_t Tile = 0; Tile < ChunkTiles; Tile++)
+        {
+            for (size_t Lane = 0; Lane < LANES; Lane++)
+            {
+                const size_t Index = (FirstTile + Tile) * LANES + Lane;
+
+                if (Index < Count)
+                {
+                    mAX[Index] = AX[Tile][Lane];
+                    mAY[Index] = AY[Tile][Lane];
+                    mAZ[Index] = AZ[Tile][Lane];
+                }
+            }
+        }
+    });
+}
+
+void NBodySystem::BuildTree(ThreadPool& Pool)
+{
+    const size_t Count = Size();
+
+    // Bounding cube of every body
+    struct Bounds
+    {
+        Vector3 Lower = Vector3({Infinity<double>(), Infinity<double>(), Infinity<double>()});
+        Vector3 Upper = Vector3({-Infinity<double>(), -Infinity<double>(), -Infinity<double>()});
+    };
+
+    const Bounds Box = Pool.ParallelReduce(Count, BODY_GRAIN, Bounds{}, [&](size_t Begin, size_t End)
+    {
+        Bounds Result{};
+
+        for (size_t Index = Begin; Index < End; Index++)
+        {
+            Result.Lower = Vector3({Min(Result.Lower.X, mX[Index]), Min(Result.Lower.Y, mY[Index]), Min(Result.Lower.Z, mZ[Index])});
+            Result.Upper = Vector3({Max(Result.Upper.X, mX[Index]), Max(Result.Upper.Y, mY[Index]), Max(Result.Upper.Z, mZ[Index])});
+        }
+
+        return Result;
+    },
+    [](const Bounds& A, const Bounds& B)
+    {
+        return Bounds{
+            .Lower = Vector3({Min(A.Lower.X, B.Lower.X), Min(A.Lower.Y, B.Lower.Y), Min(A.Lower.Z, B.Lower.Z)}),
+            .Upper = Vector3({Max(A.Upper.X, B.Upper.X), Max(A.Upper.Y, B.Upper.Y), Max(A.Upper.Z, B.Upper.Z)})};
+    });
+
+    const Vector3 Extent = Box.Upper - Box.Lower;
+    const double Edge = Max(Max(Extent.X, Extent.Y), Max(Extent.Z, 1.0E-9)) * (1.0 + 1.0E-9);
+    const double Scale = static_cast<double>(uint64_t(1) << KEY_BITS) / Edge;
+
+    // Keys in the previous order of the bodies, which changes little between steps, such
+    // that the runs are nearly sorted
+    if (mOrder.size() != Count)
+    {
+        mOrder.resize(Count);
+        std::iota(mOrder.begin(), mOrder.end(), uint32_t(0));
+    }
+
+    std::vector<SortKey> Keys(Count);
+
+    ForEachBody(Pool, [&](size_t Position)
+    {
+        const uint32_t Index = mOrder[Position];
+        const auto Quantise = [&](double Value, double Lower)
+        {
+            return Min(static_cast<uint64_t>((Value - Lower) * Scale), (uint64_t(1) << KEY_BITS) - 1);
+        };
+
+        Keys[Position] = SortKey{
+            .Key = (Spread(Quantise(mX[Index], Box.Lower.X)) << 2) | (Spread(Quantise(mY[Index], Box.Lower.Y)) << 1) | Spread(Quantise(mZ[Index], Box.Lower.Z)),
+            .Index = Index};
+    });
+
+    ParallelSort(Pool, Keys);
+
+    mKeys.resize(Count);
+    mSortedX.resize(Count);
+    mSortedY.resize(Count);
+    mSortedZ.resize(Count);
+    mSortedMu.resize(Count);
+
+    ForEachBody(Pool, [&](size_t Position)
+    {
+        const uint32_t Index = Keys[Position].Index;
+        mOrder[Position] = Index;
+        mKeys[Position] = Keys[Position].Key;
+        mSortedX[Position] = mX[Index];
+        mSortedY[Position] = mY[Index];
+        mSortedZ[Position] = mZ[Index];
+        mSortedMu[Position] = mMu[Index];
+    });
+
+    // Cells are created a level at a time, each cell of a level splitting its range of bodies
+    // by the octant bits of their keys
+    mCells.assign(1, Cell{.Size = Edge, .Begin = 0, .End = static_cast<uint32_t>(Count)});
+    std::vector<size_t> Levels{0, 1};
+    std::vector<std::array<uint32_t, 9>> Splits{};
+    std::vector<uint32_t> Offsets{};
+
+    for (uint64_t Level = 0; Levels[Level] < Levels[Level + 1]; Level++)
+    {
+        const size_t LevelBegin = Levels[Level];
+        const size_t LevelCount = Levels[Level + 1] - LevelBegin;
+        const uint64_t Shift = 3 * (KEY_BITS - 1 - Level);
+        Splits.resize(LevelCount);
+        Offsets.resize(LevelCount + 1);
+
+        Pool.ParallelFor(LevelCount, CELL_GRAIN, [&](size_t Index)
+        {
+            const Cell& Parent = mCells[LevelBegin + Index];
+            std::array<uint32_t, 9>& Split = Splits[Index];
+            Offsets[Index + 1] = 0;
+
+            if ((Parent.End - Parent.Begin <= mSettings.LeafSize) || (Level >= KEY_BITS))
+            {
+                return;
+            }
+
+            Split[0] = Parent.Begin;
+            Split[8] = Parent.End;
+
+            for (uint64_t Octant = 1; Octant < 8; Octant++)
+            {
+                Split[Octant] = static_cast<uint32_t>(std::partition_point(mKeys.begin() + Split[Octant - 1], mKeys.begin() + Parent.End,
+                    [=](uint64_t Key) {return ((Key >> Shift) & 7) < Octant;}) - mKeys.begin());
+            }
+
+            for (size_t Octant = 0; Octant < 8; Octant++)
+            {
+                Offsets[Index + 1] += (Split[Octant + 1] > Split[Octant]) ? 1u : 0u;
+            }
+        });
+
+        Offsets[0] = static_cast<uint32_t>(mCells.size());
+        std::partial_sum(Offsets.begin(), Offsets.end(), Offsets.begin());
+        mCells.resize(Offsets[LevelCount]);
+
+        Pool.ParallelFor(LevelCount, CELL_GRAIN, [&](size_t Index)
+        {
+            Cell& Parent = mCells[LevelBegin + Index];
+            Parent.Child = Offsets[Index];
+            Parent.Children = Offsets[Index + 1] - Offsets[Index];
+            uint32_t Child = Parent.Child;
+
+            for (size_t Octant = 0; (Parent.Children > 0) && (Octant < 8); Octant++)
+            {
+                if (Splits[Index][Octant + 1] > Splits[Index][Octant])
+                {
+                    mCells[Child++] = Cell{.Size = 0.5 * Parent.Size, .Begin = Splits[Index][Octant], .End = Splits[Index][Octant + 1]};
+                }
+            }
+        });
+
+        Levels.push_back(mCells.size());
+    }
+
+    // Centres of mass from the deepest level up, of bodies for leaves and children otherwise
+    for (size_t Level = Levels.size() - 1; Level-- > 0;)
+    {
+        Pool.ParallelFor(Levels[Level + 1] - Levels[Level], CELL_GRAIN, [&](size_t Index)
+        {
+            Cell& Current = mCells[Levels[Level] + Index];
+            double X = 0.0, Y = 0.0, Z = 0.0, Mu = 0.0;
+
+            if (Current.Children == 0)
+            {
+                for (uint32_t Body = Current.Begin; Body < Current.End; Body++)
+                {
+                    X += mSortedMu[Body] * mSortedX[Body];
+                    Y += mSortedMu[Body] * mSortedY[Body];
+                    Z += mSortedMu[Body] * mSortedZ[Body];
+                    Mu += mSortedMu[Body];
+                }
+            }
+            else
+            {
+                for (uint32_t Child = Current.Child; Child < Current.Child + Current.Children; Child++)
+                {
+                    X += mCells[Child].Mu * mCells[Child].X;
+                    Y += mCells[Child].Mu * mCells[Child].Y;
+                    Z += mCells[Child].Mu * mCells[Child].Z;
+                    Mu += mCells[Child].Mu;
+                }
+            }
+
+            Current.Mu = Mu;
+            Current.X = (Mu > 0.0) ? X / Mu : 0.0;
+            Current.Y = (Mu > 0.0) ? Y / Mu : 0.0;
+            Current.Z = (Mu > 0.0) ? Z / Mu : 0.0;
+        });
+    }
+}
+
+void NBodySystem::EvaluateTree(ThreadPool& Pool)
+{
+    if (Size() == 0)
+    {
+        return;
+    }
+
+    BuildTree(Pool);
+
+    const double Opening2 = Square(mSettings.Opening);
+    const double Softening2 = Square(mSettings.Softening);
+
+    Pool.ParallelFor(Size(), WALK_GRAIN, [&](size_t Position)
+    {
+        const double X = mSortedX[Position];
+        const double Y = mSortedY[Position];
+        const double Z = mSortedZ[Position];
+        double AX = 0.0, AY = 0.0, AZ = 0.0;
+
+        // Depth first, each level pushing at most eight children
+        std::array<uint32_t, 8 * KEY_BITS + 1> Stack;
+        size_t Depth = 0;
+        Stack[Depth++] = 0;
+
+        while (Depth > 0)
+        {
+            const Cell& Current = mCells[Stack[--Depth]];
+
+            if (Current.Mu == 0.0)
+            {
+                continue;
+            }
+
+            const double DX = Current.X - X;
+            const double DY = Current.Y - Y;
+            const double DZ = Current.Z - Z;
+            const double Distance2 = DX * DX + DY * DY + DZ * DZ + Softening2;
+
+            // A cell containing the body is always opened, such that it never attracts itself
+            const bool Contains = (Position >= Current.Begin) && (Position < Current.End);
+
+            if ((Contains == false) && (Square(Current.Size) < Opening2 * Distance2))
+            {
+                // Distant cell, approximated by its centre of mass
+                const double Scale = Current.Mu / (Distance2 * Sqrt(Distance2));
+                AX += DX * Scale;
+                AY += DY * Scale;
+                AZ += DZ * Scale;
+            }
+            else if (Current.Children > 0)
+            {
+                for (uint32_t Child = Current.Child + Current.Children; Child-- > Current.Child;)
+                {
+                    Stack[Depth++] = Child;
+                }
+            }
+            else
+            {
+                for (uint32_t Body = Current.Begin; Body < Current.End; Body++)
+                {
+                    const double BX = mSortedX[Body] - X;
+                    const double BY = mSortedY[Body] - Y;
+                    const double BZ = mSortedZ[Body] - Z;
+                    const double BodyDistance2 = BX * BX + BY * BY + BZ * BZ + Softening2;
+                    const double Safe = BodyDistance2 + ((BodyDistance2 > 0.0) ? 0.0 : 1.0);
+                    const double Scale = mSortedMu[Body] / (Safe * Sqrt(Safe));
+
+                    AX += BX * Scale;
+                    AY += BY * Scale;
+                    AZ += BZ * Scale;
+                }
+            }
+        }
+
+        const uint32_t Index = mOrder[Position];
+        mAX[Index] = AX;
+        mAY[Index] = AY;
+        mAZ[Index] = AZ;
+    });
+}
+
+void NBodySystem::Kick(ThreadPool& Pool, double Time)
+{
+    ForEachBody(Pool, [&](size_t Index)
+    {
+        mVX[Index] += Time * mAX[Index];
+        mVY[Index] += Time * mAY[Index];
+        mVZ[Index] += Time * mAZ[Index];
+    });
+}
+
+void NBodySystem::Drift(ThreadPool& Pool, double Time)
+{
+    ForEachBody(Pool, [&](size_t Index)
+    {
+        mX[Index] += Time * mVX[Index];
+        mY[Index] += Time * mVY[Index];
+        mZ[Index] += Time * mVZ[Index];
+    });
+}
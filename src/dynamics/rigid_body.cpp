@@ -0,0 +1,490 @@
+#include "dynamics/rigid_body.hpp"
+
+#include "utils/errors.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    // Initial number of vehicles allocated
+    constexpr size_t INITIAL_CAPACITY = 16;
+
+    // Weights of each stage derivative, and offsets (fraction of step) of the following stage
+    constexpr double STAGE_WEIGHTS[] = {1.0, 2.0, 2.0, 1.0};
+    constexpr double STAGE_OFFSETS[] = {0.5, 0.5, 1.0};
+
+    // Vehicles processed together by each kernel. Kernels operate on local copies (tiles)
+    // of the fields of a group of vehicles, which the compiler knows not to alias, such
+    // that the loop over the group vectorises
+    constexpr size_t LANES = 8;
+
+    // Smallest squared radius (m^2) of gravity models, guards unused lanes against division by zero
+    constexpr double MIN_RADIUS2 = 1.0E-12;
+
+    template <size_t Fields>
+    using Tile = double[Fields][LANES];
+
+    /**
+     * Copies consecutive fields of a group of vehicles into a tile, zeroing unused lanes
+     */
+    template <size_t Fields, typename Source>
+    void Load(const Source& From, size_t First, size_t Begin, size_t Lanes, Tile<Fields>& To) noexcept
+    {
+        // Full groups copy a constant length, which compiles to vector moves rather than calls
+        if (Lanes == LANES)
+        {
+            for (size_t Field = 0; Field < Fields; Field++)
+            {
+                std::copy_n(From[First + Field] + Begin, LANES, To[Field]);
+            }
+            return;
+        }
+
+        for (size_t Field = 0; Field < Fields; Field++)
+        {
+            std::copy_n(From[First + Field] + Begin, Lanes, To[Field]);
+            std::fill(To[Field] + Lanes, To[Field] + LANES, 0.0);
+        }
+    }
+
+    /**
+     * Copies a tile back into consecutive fields of a group of vehicles
+     */
+    template <size_t Fields, typename Destination>
+    void Store(const Tile<Fields>& From, size_t First, size_t Begin, size_t Lanes, Destination& To) noexcept
+    {
+        if (Lanes == LANES)
+        {
+            for (size_t Field = 0; Field < Fields; Field++)
+            {
+                std::copy_n(From[Field], LANES, To[First + Field] + Begin);
+            }
+            return;
+        }
+
+        for (size_t Field = 0; Field < Fields; Field++)
+        {
+            std::copy_n(From[Field], Lanes, To[First + Field] + Begin);
+        }
+    }
+}
+
+void RigidBodySwarm::Block::Resize(size_t Capacity, size_t Count)
+{
+    const size_t Stride = Capacity + PADDING;
+    std::vector<double> Data(mFields * Stride, 0.0);
+
+    for (size_t Field = 0; Field < mFields; Field++)
+    {
+        std::copy_n(mData.data() + Field * mStride, Count, Data.data() + Field * Stride);
+    }
+
+    mData = std::move(Data);
+    mCapacity = Capacity;
+    mStride = Stride;
+}
+
+size_t RigidBodySwarm::Add(const RigidBodyProperties& Properties, const RigidBodyState& State)
+{
+    if (mCount == mState.Capacity())
+    {
+        Reserve(Max(INITIAL_CAPACITY, 2 * mState.Capacity()));
+    }
+
+    const size_t Index = mCount;
+    mCount++;
+
+    try
+    {
+        SetProperties(Index, Properties);
+    }
+    catch (...)
+    {
+        mCount--;
+        throw;
+    }
+
+    SetState(Index, State);
+    return Index;
+}
+
+void RigidBodySwarm::Reserve(size_t Capacity)
+{
+    if (Capacity <= mState.Capacity())
+    {
+        return;
+    }
+
+    mState.Resize(Capacity, mCount);
+    mProperties.Resize(Capacity, mCount);
+    mLoads.Resize(Capacity, mCount);
+    mStart.Resize(Capacity, 0);
+    mSum.Resize(Capacity, 0);
+}
+
+RigidBodyState RigidBodySwarm::GetState(size_t Index) const noexcept
+{
+    return RigidBodyState{
+        .Position = Vector3({mState[PX][Index], mState[PY][Index], mState[PZ][Index]}),
+        .Velocity = Vector3({mState[VX][Index], mState[VY][Index], mState[VZ][Index]}),
+        .Attitude = Quaternion{.X = mState[QX][Index], .Y = mState[QY][Index], .Z = mState[QZ][Index], .S = mState[QS][Index]},
+        .AngularVelocity = Axis3{mState[WX][Index], mState[WY][Index], mState[WZ][Index]}
+    };
+}
+
+void RigidBodySwarm::SetState(size_t Index, const RigidBodyState& State) noexcept
+{
+    const Quaternion Attitude = State.Attitude.Unit();
+
+    mState[PX][Index] = State.Position.X;
+    mState[PY][Index] = State.Position.Y;
+    mState[PZ][Index] = State.Position.Z;
+    mState[VX][Index] = State.Velocity.X;
+    mState[VY][Index] = State.Velocity.Y;
+    mState[VZ][Index] = State.Velocity.Z;
+    mState[QX][Index] = Attitude.X;
+    mState[QY][Index] = Attitude.Y;
+    mState[QZ][Index] = Attitude.Z;
+    mState[QS][Index] = Attitude.S;
+    mState[WX][Index] = State.AngularVelocity.X;
+    mState[WY][Index] = State.AngularVelocity.Y;
+    mState[WZ][Index] = State.AngularVelocity.Z;
+}
+
+RigidBodyProperties RigidBodySwarm::GetProperties(size_t Index) const noexcept
+{
+    const double Ixy = mProperties[IXY][Index];
+    const double Ixz = mProperties[IXZ][Index];
+    const double Iyz = mProperties[IYZ][Index];
+
+    return RigidBodyProperties{
+        .Mass = mProperties[MASS][Index],
+        .Inertia = Matrix3{
+            .XX = mProperties[IXX][Index], .XY = Ixy, .XZ = Ixz,
+            .YX = Ixy, .YY = mProperties[IYY][Index], .YZ = Iyz,
+            .ZX = Ixz, .ZY = Iyz, .ZZ = mProperties[IZZ][Index]}
+    };
+}
+
+void RigidBodySwarm::SetProperties(size_t Index, const RigidBodyProperties& Properties)
+{
+    // Symmetric part of the inertia tensor
+    const Matrix3& I = Properties.Inertia;
+    const double Ixx = I.XX;
+    const double Iyy = I.YY;
+    const double Izz = I.ZZ;
+    const double Ixy = 0.5 * (I.XY + I.YX);
+    const double Ixz = 0.5 * (I.XZ + I.ZX);
+    const double Iyz = 0.5 * (I.YZ + I.ZY);
+
+    // Cofactors of the symmetric tensor
+    const double Cxx = Iyy * Izz - Iyz * Iyz;
+    const double Cyy = Ixx * Izz - Ixz * Ixz;
+    const double Czz = Ixx * Iyy - Ixy * Ixy;
+    const double Cxy = Ixz * Iyz - Ixy * Izz;
+    const double Cxz = Ixy * Iyz - Ixz * Iyy;
+    const double Cyz = Ixy * Ixz - Ixx * Iyz;
+    const double Determinant = Ixx * Cxx + Ixy * Cxy + Ixz * Cxz;
+
+    if ((Properties.Mass > 0.0) == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Rigid body mass must be positive");
+    }
+
+    // A physical inertia tensor is positive definite
+    if ((Determinant > 0.0) == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Rigid body inertia tensor is singular");
+    }
+
+    mProperties[MASS][Index] = Properties.Mass;
+    mProperties[INVERSE_MASS][Index] = 1.0 / Properties.Mass;
+    mProperties[IXX][Index] = Ixx;
+    mProperties[IYY][Index] = Iyy;
+    mProperties[IZZ][Index] = Izz;
+    mProperties[IXY][Index] = Ixy;
+    mProperties[IXZ][Index] = Ixz;
+    mProperties[IYZ][Index] = Iyz;
+    mProperties[JXX][Index] = Cxx / Determinant;
+    mProperties[JYY][Index] = Cyy / Determinant;
+    mProperties[JZZ][Index] = Czz / Determinant;
+    mProperties[JXY][Index] = Cxy / Determinant;
+    mProperties[JXZ][Index] = Cxz / Determinant;
+    mProperties[JYZ][Index] = Cyz / Determinant;
+}
+
+void RigidBodySwarm::AddForce(size_t Index, const Vector3& Force) noexcept
+{
+    const size_t Offset = LoadOffset();
+    mLoads[Offset + 0][Index] += Force.X;
+    mLoads[Offset + 1][Index] += Force.Y;
+    mLoads[Offset + 2][Index] += Force.Z;
+}
+
+void RigidBodySwarm::AddTorque(size_t Index, const Vector3& Torque) noexcept
+{
+    const size_t Offset = LoadOffset();
+    mLoads[Offset + 3][Index] += Torque.X;
+    mLoads[Offset + 4][Index] += Torque.Y;
+    mLoads[Offset + 5][Index] += Torque.Z;
+}
+
+void RigidBodySwarm::AddForceAtPoint(size_t Index, const Vector3& Force, const Vector3& Point) noexcept
+{
+    const Quaternion Attitude{.X = mState[QX][Index], .Y = mState[QY][Index], .Z = mState[QZ][Index], .S = mState[QS][Index]};
+
+    AddForce(Index, Force);
+    AddTorque(Index, Point.Cross(Attitude.Rotate(Force)));
+}
+
+void RigidBodySwarm::AddForces(std::span<const Vector3> Forces)
+{
+    if (Forces.size() != mCount)
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    for (size_t Index = 0; Index < mCount; Index++)
+    {
+        AddForce(Index, Forces[Index]);
+    }
+}
+
+void RigidBodySwarm::AddTorques(std::span<const Vector3> Torques)
+{
+    if (Torques.size() != mCount)
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    for (size_t Index = 0; Index < mCount; Index++)
+    {
+        AddTorque(Index, Torques[Index]);
+    }
+}
+
+void RigidBodySwarm::AddPointMassGravity(double Mu) noexcept
+{
+    const size_t End = GetStageEnd();
+
+    for (size_t Begin = GetStageBegin(); Begin < End; Begin += LANES)
+    {
+        const size_t Lanes = Min(LANES, End - Begin);
+        Tile<3> P, F;
+        Tile<1> M;
+
+        Load(mState, PX, Begin, Lanes, P);
+        Load(mProperties, MASS, Begin, Lanes, M);
+        Load(mLoads, LoadOffset(), Begin, Lanes, F);
+
+        for (size_t Lane = 0; Lane < LANES; Lane++)
+        {
+            // Unused lanes are zero, guard against division by zero
+            const double Radius2 = Max(P[0][Lane] * P[0][Lane] + P[1][Lane] * P[1][Lane] + P[2][Lane] * P[2][Lane], MIN_RADIUS2);
+            const double Scale = -Mu * M[0][Lane] / (Radius2 * Sqrt(Radius2));
+
+            F[0][Lane] += Scale * P[0][Lane];
+            F[1][Lane] += Scale * P[1][Lane];
+            F[2][Lane] += Scale * P[2][Lane];
+        }
+
+        Store(F, LoadOffset(), Begin, Lanes, mLoads);
+    }
+}
+
+void RigidBodySwarm::AddGravityGradientTorque(double Mu) noexcept
+{
+    const size_t End = GetStageEnd();
+
+    for (size_t Begin = GetStageBegin(); Begin < End; Begin += LANES)
+    {
+        const size_t Lanes = Min(LANES, End - Begin);
+        Tile<3> P, T;
+        Tile<4> Q;
+        Tile<6> I;
+
+        Load(mState, PX, Begin, Lanes, P);
+        Load(mState, QX, Begin, Lanes, Q);
+        Load(mProperties, IXX, Begin, Lanes, I);
+        Load(mLoads, LoadOffset() + 3, Begin, Lanes, T);
+
+        for (size_t Lane = 0; Lane < LANES; Lane++)
+        {
+            // Position in the body frame, as Quaternion::Rotate
+            const double Ux = P[0][Lane];
+            const double Uy = P[1][Lane];
+            const double Uz = P[2][Lane];
+            const double Qx = Q[0][Lane];
+            const double Qy = Q[1][Lane];
+            const double Qz = Q[2][Lane];
+            const double Qs = Q[3][Lane];
+            const double Cx = Qz * Uy - Qy * Uz;
+            const double Cy = Qx * Uz - Qz * Ux;
+            const double Cz = Qy * Ux - Qx * Uy;
+            const double Rx = Ux + 2.0 * (Cx * Qs + Cy * Qz - Cz * Qy);
+            const double Ry = Uy + 2.0 * (Cy * Qs + Cz * Qx - Cx * Qz);
+            const double Rz = Uz + 2.0 * (Cz * Qs + Cx * Qy - Cy * Qx);
+
+            // 3 Mu / R^5 (R x I R)
+            const double Hx = I[0][Lane] * Rx + I[3][Lane] * Ry + I[4][Lane] * Rz;
+            const double Hy = I[3][Lane] * Rx + I[1][Lane] * Ry + I[5][Lane] * Rz;
+            const double Hz = I[4][Lane] * Rx + I[5][Lane] * Ry + I[2][Lane] * Rz;
+            const double Radius2 = Max(Ux * Ux + Uy * Uy + Uz * Uz, MIN_RADIUS2);
+            const double Scale = 3.0 * Mu / (Radius2 * Radius2 * Sqrt(Radius2));
+
+            T[0][Lane] += Scale * (Ry * Hz - Rz * Hy);
+            T[1][Lane] += Scale * (Rz * Hx - Rx * Hz);
+            T[2][Lane] += Scale * (Rx * Hy - Ry * Hx);
+        }
+
+        Store(T, LoadOffset() + 3, Begin, Lanes, mLoads);
+    }
+}
+
+Vector3 RigidBodySwarm::GetAppliedForce(size_t Index) const noexcept
+{
+    return Vector3({mLoads[AFX][Index], mLoads[AFY][Index], mLoads[AFZ][Index]});
+}
+
+Vector3 RigidBodySwarm::GetAppliedTorque(size_t Index) const noexcept
+{
+    return Vector3({mLoads[ATX][Index], mLoads[ATY][Index], mLoads[ATZ][Index]});
+}
+
+void RigidBodySwarm::ClearLoads(void) noexcept
+{
+    for (size_t Field = AFX; Field <= ATZ; Field++)
+    {
+        std::fill_n(mLoads[Field], mCount, 0.0);
+    }
+}
+
+void RigidBodySwarm::BeginStage(void) noexcept
+{
+    const size_t Count = mStageEnd - mStageBegin;
+
+    for (size_t Field = 0; Field < FX - AFX; Field++)
+    {
+        std::copy_n(mLoads[AFX + Field] + mStageBegin, Count, mLoads[FX + Field] + mStageBegin);
+    }
+
+    mInStage = true;
+}
+
+void RigidBodySwarm::EndStage(size_t Stage, double Step) noexcept
+{
+    mInStage = false;
+
+    const double Weight = STAGE_WEIGHTS[Stage];
+
+    if (Stage == 0)
+    {
+        AdvanceStage<true, false>(Weight, STAGE_OFFSETS[Stage] * Step);
+    }
+    else if (Stage + 1 < STAGES)
+    {
+        AdvanceStage<false, false>(Weight, STAGE_OFFSETS[Stage] * Step);
+    }
+    else
+    {
+        AdvanceStage<false, true>(Weight, Step / 6.0);
+    }
+}
+
+template <bool First, bool Last>
+void RigidBodySwarm::AdvanceStage(double Weight, double Offset) noexcept
+{
+    // The first stage starts the step from the current state, the last completes it from
+    // the weighted sum of the stage derivatives. Inputs are read in place, outputs are
+    // written to tiles such that they cannot alias the inputs
+    for (size_t Begin = mStageBegin; Begin < mStageEnd; Begin += LANES)
+    {
+        const size_t Lanes = Min(LANES, mStageEnd - Begin);
+        Tile<STATE_FIELDS> Next, Sum;
+
+        const auto State = [&](size_t Field, size_t Lane) noexcept {return mState[Field][Begin + Lane];};
+        const auto Start = [&](size_t Field, size_t Lane) noexcept {return First ? State(Field, Lane) : mStart[Field][Begin + Lane];};
+        const auto P = [&](size_t Field, size_t Lane) noexcept {return mProperties[Field][Begin + Lane];};
+        const auto L = [&](size_t Field, size_t Lane) noexcept {return mLoads[Field][Begin + Lane];};
+
+        for (size_t Lane = 0; Lane < Lanes; Lane++)
+        {
+            double Rate[STATE_FIELDS];
+
+            // Translational
+            Rate[PX] = State(VX, Lane);
+            Rate[PY] = State(VY, Lane);
+            Rate[PZ] = State(VZ, Lane);
+            Rate[VX] = L(FX, Lane) * P(INVERSE_MASS, Lane);
+            Rate[VY] = L(FY, Lane) * P(INVERSE_MASS, Lane);
+            Rate[VZ] = L(FZ, Lane) * P(INVERSE_MASS, Lane);
+
+            // Attitude kinematics, 0.5 Q * (W, 0)
+            const double Qx = State(QX, Lane);
+            const double Qy = State(QY, Lane);
+            const double Qz = State(QZ, Lane);
+            const double Qs = State(QS, Lane);
+            const double Wx = State(WX, Lane);
+            const double Wy = State(WY, Lane);
+            const double Wz = State(WZ, Lane);
+
+            Rate[QX] = 0.5 * (Qs * Wx + Qy * Wz - Qz * Wy);
+            Rate[QY] = 0.5 * (Qs * Wy + Qz * Wx - Qx * Wz);
+            Rate[QZ] = 0.5 * (Qs * Wz + Qx * Wy - Qy * Wx);
+            Rate[QS] = -0.5 * (Qx * Wx + Qy * Wy + Qz * Wz);
+
+            // Euler's equations, I^-1 (T - W x I W)
+            const double Hx = P(IXX, Lane) * Wx + P(IXY, Lane) * Wy + P(IXZ, Lane) * Wz;
+            const double Hy = P(IXY, Lane) * Wx + P(IYY, Lane) * Wy + P(IYZ, Lane) * Wz;
+            const double Hz = P(IXZ, Lane) * Wx + P(IYZ, Lane) * Wy + P(IZZ, Lane) * Wz;
+            const double Mx = L(TX, Lane) - (Wy * Hz - Wz * Hy);
+            const double My = L(TY, Lane) - (Wz * Hx - Wx * Hz);
+            const double Mz = L(TZ, Lane) - (Wx * Hy - Wy * Hx);
+
+            Rate[WX] = P(JXX, Lane) * Mx + P(JXY, Lane) * My + P(JXZ, Lane) * Mz;
+            Rate[WY] = P(JXY, Lane) * Mx + P(JYY, Lane) * My + P(JYZ, Lane) * Mz;
+            Rate[WZ] = P(JXZ, Lane) * Mx + P(JYZ, Lane) * My + P(JZZ, Lane) * Mz;
+
+            for (size_t Field = 0; Field < STATE_FIELDS; Field++)
+            {
+                Sum[Field][Lane] = (First ? 0.0 : mSum[Field][Begin + Lane]) + Weight * Rate[Field];
+                Next[Field][Lane] = Start(Field, Lane) + Offset * (Last ? Sum[Field][Lane] : Rate[Field]);
+            }
+
+            // Attitude drifts from unit norm with truncation error
+            if constexpr (Last)
+            {
+                const double Scale = 1.0 / Sqrt(Next[QX][Lane] * Next[QX][Lane] + Next[QY][Lane] * Next[QY][Lane] +
+                                                Next[QZ][Lane] * Next[QZ][Lane] + Next[QS][Lane] * Next[QS][Lane]);
+
+                for (size_t Field = QX; Field <= QS; Field++)
+                {
+                    Next[Field][Lane] *= Scale;
+                }
+            }
+        }
+
+        if constexpr (First)
+        {
+            for (size_t Field = 0; Field < STATE_FIELDS; Field++)
+            {
+                std::copy_n(mState[Field] + Begin, Lanes, mStart[Field] + Begin);
+            }
+        }
+
+        Store(Next, 0, Begin, Lanes, mState);
+
+        if constexpr (Last == false)
+        {
+            Store(Sum, 0, Begin, Lanes, mSum);
+        }
+    }
+
+    if constexpr (Last)
+    {
+        for (size_t Field = AFX; Field <= ATZ; Field++)
+        {
+            std::fill(mLoads[Field] + mStageBegin, mLoads[Field] + mStageEnd, 0.0);
+        }
+    }
+}
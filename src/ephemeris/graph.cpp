@@ -0,0 +1,122 @@
+#include "ephemeris/graph.hpp"
+
+#include "math/constants.hpp"
+
+#include <limits>
+
+EphemerisGraph::EphemerisGraph(int32_t RootID)
+{
+    mNodes.push_back(Node{
+        .ID = RootID,
+        .Parent = 0,
+        .Eph = nullptr,
+        .CachedEpoch = 0.0,
+        .CachedState = EphemerisState{}
+    });
+
+    mIndex.emplace(RootID, 0);
+}
+
+bool EphemerisGraph::AddBody(int32_t BodyID, int32_t ParentID, const Ephemeris& Eph)
+{
+    const auto Parent = mIndex.find(ParentID);
+
+    if ((Parent == mIndex.end()) || (HasBody(BodyID) == true))
+    {
+        return false;
+    }
+
+    mNodes.push_back(Node{
+        .ID = BodyID,
+        .Parent = Parent->second,
+        .Eph = &Eph,
+        .CachedEpoch = std::numeric_limits<double>::quiet_NaN(),
+        .CachedState = EphemerisState{}
+    });
+
+    mIndex.emplace(BodyID, mNodes.size() - 1);
+
+    return true;
+}
+
+const EphemerisState& EphemerisGraph::EvaluateNode(size_t NodeIndex, double EpochTime) const noexcept
+{
+    const Node& Current = mNodes[NodeIndex];
+
+    // Root is always at the origin, memoised states are reused until the epoch changes
+    if ((Current.Eph == nullptr) || (Current.CachedEpoch == EpochTime))
+    {
+        return Current.CachedState;
+    }
+
+    // Parents always precede their children, so this recursion terminates at the root
+    const EphemerisState& ParentState = EvaluateNode(Current.Parent, EpochTime);
+    const EphemerisState Relative = Current.Eph->GetState(EpochTime);
+
+    Current.CachedState = EphemerisState{
+        .Pos = ParentState.Pos + Relative.Pos,
+        .Vel = ParentState.Vel + Relative.Vel,
+        .LightTime = 0.0
+    };
+    Current.CachedState.LightTime = Current.CachedState.Pos.Norm() / SPEED_LIGHT;
+    Current.CachedEpoch = EpochTime;
+
+    return Current.CachedState;
+}
+
+EphemerisState EphemerisGraph::GetRootState(int32_t BodyID, double EpochTime) const noexcept
+{
+    const auto Body = mIndex.find(BodyID);
+
+    if (Body == mIndex.end())
+    {
+        return EphemerisState{};
+    }
+
+    return EvaluateNode(Body->second, EpochTime);
+}
+
+EphemerisState EphemerisGraph::GetRelativeState(const BodyPair& Pair, double EpochTime) const noexcept
+{
+    const auto Object = mIndex.find(Pair.Object);
+    const auto Observer = mIndex.find(Pair.Observer);
+
+    if ((Object == mIndex.end()) || (Observer == mIndex.end()))
+    {
+        return EphemerisState{};
+    }
+
+    const EphemerisState& ObjectState = EvaluateNode(Object->second, EpochTime);
+    const EphemerisState& ObserverState = EvaluateNode(Observer->second, EpochTime);
+    const Vector3 Pos = ObjectState.Pos - ObserverState.Pos;
+
+    return EphemerisState{
+        .Pos = Pos,
+        .Vel = ObjectState.Vel - ObserverState.Vel,
+        .LightTime = Pos.Norm() / SPEED_LIGHT
+    };
+}
+
+void EphemerisGraph::GetRelativeStates(std::span<const BodyPair> Pairs, double EpochTime, std::span<EphemerisState> Out) const
+{
+    if (Pairs.size() != Out.size())
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    for (size_t Index = 0; Index < Pairs.size(); Index++)
+    {
+        Out[Index] = GetRelativeState(Pairs[Index], EpochTime);
+    }
+}
+
+void EphemerisGraph::ClearCache(void) const noexcept
+{
+    for (const Node& Current : mNodes)
+    {
+        if (Current.Eph != nullptr)
+        {
+            Current.CachedEpoch = std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+}
@@ -0,0 +1,407 @@
+#include "ephemeris/kernel_manager.hpp"
+
+#include "spice_kernel_set.hpp"
+#include "utils/mapped_file.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string_view>
+
+namespace
+{
+    // Size of a DAF record (bytes)
+    constexpr size_t DAF_RECORD = 1024;
+
+    // Longest chain of centres followed from a body, guards against cyclic kernels
+    constexpr size_t MAX_CENTER_DEPTH = 16;
+
+    // Segments separated by less than this (s) are contiguous, boundaries are often
+    // rounded independently by the tools that write them
+    constexpr double CONTIGUOUS_TOLERANCE = 1.0E-6;
+
+    // NAIF ID of the solar system barycentre, the root of every chain
+    constexpr int32_t SOLAR_SYSTEM_BARYCENTRE = 0;
+
+    /**
+     * Reads an unaligned value from a DAF file, swapping the byte order if the file was
+     * written on a host of the opposite endianness
+     */
+    template <typename T>
+    T ReadValue(std::span<const std::byte> Data, size_t Offset, bool Swap) noexcept
+    {
+        std::byte Bytes[sizeof(T)];
+        std::memcpy(Bytes, Data.data() + Offset, sizeof(T));
+
+        if (Swap == true)
+        {
+            std::reverse(std::begin(Bytes), std::end(Bytes));
+        }
+
+        T Value;
+        std::memcpy(&Value, Bytes, sizeof(T));
+        return Value;
+    }
+
+    /**
+     * Parses the summary records of a DAF/SPK file into coverage intervals, adjacent
+     * segments of the same body and centre are merged
+     * @return `false` if the file is not a valid DAF/SPK file
+     */
+    bool ReadCoverage(std::span<const std::byte> Data, size_t Kernel, std::vector<KernelCoverage>& Out)
+    {
+        if (Data.size() < DAF_RECORD)
+        {
+            return false;
+        }
+
+        const auto Text = [&](size_t Offset, size_t Length)
+        {
+            return std::string_view(reinterpret_cast<const char*>(Data.data()) + Offset, Length);
+        };
+
+        if (Text(0, 8) != "DAF/SPK ")
+        {
+            return false;
+        }
+
+        // Files predating the format identifier are assumed to be native
+        const std::string_view Format = Text(88, 8);
+        const bool Swap = ((Format == "BIG-IEEE") && (std::endian::native == std::endian::little)) ||
+                          ((Format == "LTL-IEEE") && (std::endian::native == std::endian::big));
+
+        const int32_t ND = ReadValue<int32_t>(Data, 8, Swap);
+        const int32_t NI = ReadValue<int32_t>(Data, 12, Swap);
+
+        if ((ND != 2) || (NI != 6))
+        {
+            return false;
+        }
+
+        // Summary size in doubles, integer components are packed two per double
+        constexpr size_t SUMMARY_BYTES = (2 + (6 + 1) / 2) * sizeof(double);
+        const size_t RecordCount = Data.size() / DAF_RECORD;
+        const size_t FirstNew = Out.size();
+
+        int32_t Record = ReadValue<int32_t>(Data, 76, Swap);
+
+        for (size_t Visited = 0; (Record > 0) && (Visited < RecordCount); Visited++)
+        {
+            const size_t Offset = (static_cast<size_t>(Record) - 1) * DAF_RECORD;
+
+            if (Offset + DAF_RECORD > Data.size())
+            {
+                return false;
+            }
+
+            const double Next = ReadValue<double>(Data, Offset, Swap);
+            const double Count = ReadValue<double>(Data, Offset + 2 * sizeof(double), Swap);
+            const size_t Summaries = static_cast<size_t>(Clamp(Count, 0.0, double((DAF_RECORD - 24) / SUMMARY_BYTES)));
+
+            for (size_t Index = 0; Index < Summaries; Index++)
+            {
+                const size_t Base = Offset + 3 * sizeof(double) + Index * SUMMARY_BYTES;
+
+                Out.push_back(KernelCoverage{
+                    .Body = ReadValue<int32_t>(Data, Base + 2 * sizeof(double), Swap),
+                    .Center = ReadValue<int32_t>(Data, Base + 2 * sizeof(double) + sizeof(int32_t), Swap),
+                    .Start = ReadValue<double>(Data, Base, Swap),
+                    .End = ReadValue<double>(Data, Base + sizeof(double), Swap),
+                    .Kernel = Kernel
+                });
+            }
+
+            Record = static_cast<int32_t>(Next);
+        }
+
+        // Merge contiguous or overlapping segments of the same body and centre
+        const auto NewBegin = Out.begin() + static_cast<std::ptrdiff_t>(FirstNew);
+        std::sort(NewBegin, Out.end(), [](const KernelCoverage& A, const KernelCoverage& B)
+        {
+            return (A.Body != B.Body) ? (A.Body < B.Body) : (A.Center != B.Center) ? (A.Center < B.Center) : (A.Start < B.Start);
+        });
+
+        auto Merged = NewBegin;
+        for (auto Current = NewBegin; Current != Out.end(); ++Current)
+        {
+            if ((Current != NewBegin) && (Merged->Body == Current->Body) && (Merged->Center == Current->Center) && (Current->Start <= Merged->End + CONTIGUOUS_TOLERANCE))
+            {
+                Merged->End = Max(Merged->End, Current->End);
+            }
+            else if (Current != NewBegin)
+            {
+                *(++Merged) = *Current;
+            }
+        }
+
+        if (NewBegin != Out.end())
+        {
+            Out.erase(Merged + 1, Out.end());
+        }
+
+        return true;
+    }
+
+    /**
+     * Orders the coverage index by body, then by start time
+     */
+    bool CoverageLess(const KernelCoverage& A, const KernelCoverage& B) noexcept
+    {
+        return (A.Body != B.Body) ? (A.Body < B.Body) : (A.Start < B.Start);
+    }
+
+    /**
+     * @return Coverage entries of a single body
+     */
+    std::span<const KernelCoverage> FindBody(std::span<const KernelCoverage> Coverage, int32_t Body) noexcept
+    {
+        const auto Range = std::equal_range(Coverage.begin(), Coverage.end(), KernelCoverage{.Body = Body},
+            [](const KernelCoverage& A, const KernelCoverage& B) {return A.Body < B.Body;});
+
+        return std::span<const KernelCoverage>(Range.first, Range.second);
+    }
+}
+
+KernelManager::KernelManager(size_t MemoryBudget) :
+    mMemoryBudget{MemoryBudget}
+{
+
+}
+
+KernelManager::~KernelManager() = default;
+
+bool KernelManager::Register(const std::string& Path)
+{
+    const MappedFile File(Path);
+
+    if (File.IsOpen() == false)
+    {
+        return false;
+    }
+
+    std::vector<KernelCoverage> Coverage;
+
+    if (ReadCoverage(File.Data(), mKernels.size(), Coverage) == false)
+    {
+        return false;
+    }
+
+    mKernels.push_back(Kernel{.Path = Path, .Bytes = File.Size(), .Set = nullptr, .LastUsed = 0});
+
+    mCoverage.insert(mCoverage.end(), Coverage.begin(), Coverage.end());
+    std::stable_sort(mCoverage.begin(), mCoverage.end(), CoverageLess);
+
+    return true;
+}
+
+void KernelManager::LoadAuxillary(const std::string& Path)
+{
+    if (mAuxillary == nullptr)
+    {
+        mAuxillary = std::make_unique<Spice::KernelSet>();
+    }
+
+    mAuxillary->LoadAuxillary(Path);
+}
+
+bool KernelManager::Require(std::span<const int32_t> Bodies, double Start, double End)
+{
+    mQuery++;
+
+    bool Covered = true;
+
+    for (const int32_t Body : Bodies)
+    {
+        Covered = LoadChain(Body, Start, End) && Covered;
+    }
+
+    EnforceBudget();
+
+    return Covered;
+}
+
+bool KernelManager::IsCovered(int32_t Body, double EpochTime) const noexcept
+{
+    for (const KernelCoverage& Entry : FindBody(mCoverage, Body))
+    {
+        if ((Entry.Start <= EpochTime) && (EpochTime <= Entry.End))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void KernelManager::UnloadAll(void) noexcept
+{
+    for (Kernel& Entry : mKernels)
+    {
+        Entry.Set.reset();
+    }
+
+    mLoadedBytes = 0;
+}
+
+size_t KernelManager::LoadedCount(void) const noexcept
+{
+    return static_cast<size_t>(std::count_if(mKernels.begin(), mKernels.end(), [](const Kernel& Entry)
+    {
+        return Entry.Set != nullptr;
+    }));
+}
+
+bool KernelManager::LoadChain(int32_t Body, double Start, double End)
+{
+    /**
+     * Body whose coverage is loaded over an interval, at a depth in the chain
+     */
+    struct Link
+    {
+        int32_t Body = 0;
+        double Start = 0.0;
+        double End = 0.0;
+        size_t Depth = 0;
+    };
+
+    // The segments of a body may have different centres over the interval, so the centre
+    // of every segment is followed over the part of the interval that segment covers. A
+    // link already followed over an enclosing interval is not followed again
+    std::vector<Link> Pending{Link{.Body = Body, .Start = Start, .End = End}};
+    std::vector<Link> Followed;
+    bool Covered = false;
+
+    while (Pending.empty() == false)
+    {
+        const Link Current = Pending.back();
+        Pending.pop_back();
+
+        const bool Enclosed = std::any_of(Followed.begin(), Followed.end(), [&](const Link& Other)
+        {
+            return (Other.Body == Current.Body) && (Other.Start <= Current.Start) && (Current.End <= Other.End);
+        });
+
+        if (Enclosed == true)
+        {
+            continue;
+        }
+
+        Followed.push_back(Current);
+
+        double Cursor = Current.Start;
+        bool Gap = false;
+        bool Found = false;
+
+        // Entries are ordered by start time, so any gap in coverage is found in order
+        for (const KernelCoverage& Entry : FindBody(mCoverage, Current.Body))
+        {
+            if ((Entry.End < Current.Start) || (Entry.Start > Current.End))
+            {
+                continue;
+            }
+
+            Gap = Gap || (Entry.Start > Cursor + CONTIGUOUS_TOLERANCE);
+            Cursor = Max(Cursor, Entry.End);
+            Found = true;
+
+            Touch(Entry.Kernel);
+
+            // Chains terminate at the root, or at a centre without registered coverage which
+            // is assumed to be provided by an auxillary or externally loaded kernel
+            if ((Entry.Center != SOLAR_SYSTEM_BARYCENTRE) && (Current.Depth + 1 < MAX_CENTER_DEPTH))
+            {
+                Pending.push_back(Link{.Body = Entry.Center, .Start = Max(Current.Start, Entry.Start), .End = Min(Current.End, Entry.End),
+                    .Depth = Current.Depth + 1});
+            }
+        }
+
+        if (Current.Depth == 0)
+        {
+            Covered = Found && (Gap == false) && (Cursor >= End);
+        }
+    }
+
+    return Covered;
+}
+
+void KernelManager::Touch(size_t Index)
+{
+    Kernel& Entry = mKernels[Index];
+    Entry.LastUsed = mQuery;
+
+    if (Entry.Set == nullptr)
+    {
+        // Only a successfully loaded kernel is recorded, should the load throw
+        auto Set = std::make_unique<Spice::KernelSet>();
+        Set->LoadEphemeris(Entry.Path);
+        Entry.Set = std::move(Set);
+        mLoadedBytes += Entry.Bytes;
+    }
+}
+
+void KernelManager::EnforceBudget(void) noexcept
+{
+    while ((mMemoryBudget != UNLIMITED) && (mLoadedBytes > mMemoryBudget))
+    {
+        Kernel* Coldest = nullptr;
+
+        for (Kernel& Entry : mKernels)
+        {
+            if ((Entry.Set != nullptr) && (Entry.LastUsed != mQuery) && ((Coldest == nullptr) || (Entry.LastUsed < Coldest->LastUsed)))
+            {
+                Coldest = &Entry;
+            }
+        }
+
+        if (Coldest == nullptr)
+        {
+            return;
+        }
+
+        Coldest->Set.reset();
+        mLoadedBytes -= Coldest->Bytes;
+    }
+}
+
+EphemerisState LazySpiceEphemeris::GetState(double EpochTime) const noexcept
+{
+    // A kernel failing to load, or to be allocated, is reported as the default state as any
+    // other failure of the scalar query
+    try
+    {
+        const int32_t Bodies[] = {mObjectID, mReferenceID};
+        mManager.Require(Bodies, EpochTime, EpochTime);
+    }
+    catch (...)
+    {
+        return EphemerisState{};
+    }
+
+    return mSpice.GetState(EpochTime);
+}
+
+bool LazySpiceEphemeris::GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const
+{
+    if (Epochs.size() != Out.size())
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    // As the scalar query, a kernel failing to load fails every epoch
+    try
+    {
+        if (Epochs.empty() == false)
+        {
+            const auto [First, Last] = std::minmax_element(Epochs.begin(), Epochs.end());
+            const int32_t Bodies[] = {mObjectID, mReferenceID};
+            mManager.Require(Bodies, *First, *Last);
+        }
+    }
+    catch (...)
+    {
+        std::fill(Out.begin(), Out.end(), EphemerisState{});
+        return false;
+    }
+
+    return mSpice.GetStates(Epochs, Out);
+}
@@ -0,0 +1,132 @@
+#include "ephemeris/light_time.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace
+{
+    // State of each pair in the convergence mask
+    constexpr uint8_t CONVERGED = 0;
+    constexpr uint8_t ACTIVE = 1;
+    constexpr uint8_t FAILED = 2;
+
+    /**
+     * @return True if a state is the default left by a failed evaluation
+     */
+    bool IsDefault(const EphemerisState& State) noexcept
+    {
+        return (State.Pos == Vector3::ZERO()) && (State.Vel == Vector3::ZERO()) && (State.LightTime == 0.0);
+    }
+}
+
+size_t LightTimeSolver::Solve(std::span<const Ephemeris* const> Targets, std::span<const EphemerisState> Observers, double EpochTime, std::span<EphemerisState> Out)
+{
+    if ((Targets.size() != Observers.size()) || (Targets.size() != Out.size()))
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    const size_t Count = Targets.size();
+    const double Sign = (mOptions.Direction == LightTimeDirection::RECEPTION) ? -1.0 : 1.0;
+
+    // Group pairs by target so that each backend is queried once per iteration
+    mOrder.resize(Count);
+    std::iota(mOrder.begin(), mOrder.end(), size_t(0));
+    std::stable_sort(mOrder.begin(), mOrder.end(), [&](size_t A, size_t B)
+    {
+        return std::less<const Ephemeris*>{}(Targets[A], Targets[B]);
+    });
+
+    mLightTime.assign(Count, 0.0);
+    mActive.assign(Count, ACTIVE);
+    mBatchIndex.resize(Count);
+    mBatchEpochs.resize(Count);
+    mBatchStates.resize(Count);
+
+    size_t Remaining = Count;
+    size_t Failed = 0;
+    mIterations = 0;
+
+    // The first pass evaluates the geometric state, each subsequent pass re-evaluates
+    // the target at the epoch offset by the previous light time estimate
+    while ((Remaining > 0) && (mIterations < mOptions.MaxIterations))
+    {
+        mIterations++;
+
+        for (size_t Start = 0, End = 0; Start < Count; Start = End)
+        {
+            const Ephemeris* Target = Targets[mOrder[Start]];
+            size_t Batch = 0;
+
+            for (End = Start; (End < Count) && (Targets[mOrder[End]] == Target); End++)
+            {
+                const size_t Index = mOrder[End];
+
+                if (mActive[Index] == ACTIVE)
+                {
+                    mBatchIndex[Batch] = Index;
+                    mBatchEpochs[Batch] = EpochTime + Sign * mLightTime[Index];
+                    Batch++;
+                }
+            }
+
+            if (Batch == 0)
+            {
+                continue;
+            }
+
+            const bool Evaluated = Target->GetStates(std::span<const double>(mBatchEpochs.data(), Batch),
+                std::span<EphemerisState>(mBatchStates.data(), Batch));
+
+            for (size_t Entry = 0; Entry < Batch; Entry++)
+            {
+                const size_t Index = mBatchIndex[Entry];
+
+                // Epochs which could not be evaluated are left as default states, which are
+                // failed rather than passed through the convergence test
+                if ((Evaluated == false) && (IsDefault(mBatchStates[Entry]) == true))
+                {
+                    Out[Index] = EphemerisState{};
+                    mActive[Index] = FAILED;
+                    Remaining--;
+                    Failed++;
+                    continue;
+                }
+                const EphemerisState& Observer = Observers[Index];
+                const Vector3 Pos = mBatchStates[Entry].Pos - Observer.Pos;
+                const double LightTime = Pos.Norm() / SPEED_LIGHT;
+
+                Out[Index] = EphemerisState{
+                    .Pos = Pos,
+                    .Vel = mBatchStates[Entry].Vel - Observer.Vel,
+                    .LightTime = LightTime
+                };
+
+                // Converged once the target was evaluated at the epoch implied by its own light time
+                if (Abs(LightTime - mLightTime[Index]) <= mOptions.Tolerance)
+                {
+                    mActive[Index] = CONVERGED;
+                    Remaining--;
+                }
+
+                mLightTime[Index] = LightTime;
+            }
+        }
+    }
+
+    if (mOptions.Aberration == true)
+    {
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            if (mActive[Index] == FAILED)
+            {
+                continue;
+            }
+
+            Out[Index].Pos = StellarAberration(Out[Index].Pos, Observers[Index].Vel, mOptions.Direction);
+        }
+    }
+
+    return Remaining + Failed;
+}
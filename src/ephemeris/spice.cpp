@@ -14,7 +14,7 @@ EphemerisState SpiceEphemeris::GetState(double EpochTime) const noexcept
 {
     Spice::EphemerisState Intermediate = Spice::CalcEphemerisState(mParams, EpochTime);
 
-    if (Intermediate.CalculationSuccess == false)    
+    if (Intermediate.CalculationSuccess == false)
     {
         // TODO: Handle Error
         puts(Spice::GetErrorAndReset().c_str());
@@ -26,4 +26,36 @@ EphemerisState SpiceEphemeris::GetState(double EpochTime) const noexcept
         .Vel = Vector3({Intermediate.VelX * 1000.0, Intermediate.VelY * 1000.0, Intermediate.VelZ * 1000.0}),
         .LightTime = Intermediate.LightTime
     };
-}
\ No newline at end of file
+}
+
+bool SpiceEphemeris::GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const
+{
+    if (Epochs.size() != Out.size())
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    bool CalculationSuccess = true;
+    for (size_t Index = 0; Index < Epochs.size(); Index++)
+    {
+        const Spice::EphemerisState Intermediate = Spice::CalcEphemerisState(mParams, Epochs[Index]);
+
+        if (Intermediate.CalculationSuccess == false)
+        {
+            // Spice refuses further queries until its error is reset, the failure being reported
+            // to the caller instead
+            Spice::GetErrorAndReset();
+            CalculationSuccess = false;
+            Out[Index] = EphemerisState{};
+            continue;
+        }
+
+        Out[Index] = EphemerisState{
+            .Pos = Vector3({Intermediate.PosX * 1000.0, Intermediate.PosY * 1000.0, Intermediate.PosZ * 1000.0}),
+            .Vel = Vector3({Intermediate.VelX * 1000.0, Intermediate.VelY * 1000.0, Intermediate.VelZ * 1000.0}),
+            .LightTime = Intermediate.LightTime
+        };
+    }
+
+    return CalculationSuccess;
+}
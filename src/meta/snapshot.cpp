@@ -0,0 +1,389 @@
+#include "meta/snapshot.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+namespace
+{
+    constexpr char MAGIC[4] = {'H', 'S', 'N', 'P'};
+    constexpr uint32_t VERSION = 1;
+
+    // Alignment of every block, such that blocks may be viewed in place
+    constexpr size_t ALIGNMENT = 8;
+
+    /**
+     * @param Offset Offset (bytes)
+     * @return Offset rounded up to the alignment of a block
+     */
+    constexpr size_t Align(size_t Offset) noexcept
+    {
+        return (Offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    /**
+     * Appends the native representation of a value
+     */
+    template <typename T>
+    void Append(std::vector<std::byte>& Out, T Value)
+    {
+        const auto Bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(Value);
+        Out.insert(Out.end(), Bytes.begin(), Bytes.end());
+    }
+
+    /**
+     * Appends a string, preceded by its length
+     */
+    void Append(std::vector<std::byte>& Out, const HString& Value)
+    {
+        Append(Out, static_cast<uint16_t>(Value.Size()));
+        const std::byte* Data = reinterpret_cast<const std::byte*>(Value.Data());
+        Out.insert(Out.end(), Data, Data + Value.Size());
+    }
+
+    /**
+     * Reads the native representation of a value, advancing the offset
+     * @throws Error::GenericException if the value extends beyond the data
+     */
+    template <typename T>
+    T Extract(std::span<const std::byte> Data, size_t& Offset)
+    {
+        if ((Offset > Data.size()) || (Data.size() - Offset < sizeof(T)))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Snapshot file is truncated");
+        }
+
+        T Value{};
+        std::memcpy(&Value, Data.data() + Offset, sizeof(T));
+        Offset += sizeof(T);
+        return Value;
+    }
+
+    /**
+     * Reads a string preceded by its length, advancing the offset
+     * @throws Error::GenericException if the string extends beyond the data
+     */
+    HString ExtractString(std::span<const std::byte> Data, size_t& Offset)
+    {
+        const uint16_t Length = Extract<uint16_t>(Data, Offset);
+
+        if (Data.size() - Offset < Length)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Snapshot file is truncated");
+        }
+
+        HString Value(std::string(reinterpret_cast<const char*>(Data.data() + Offset), Length));
+        Offset += Length;
+        return Value;
+    }
+
+    /**
+     * @return Random non-zero identifier of a new snapshot
+     */
+    uint64_t GenerateId(void)
+    {
+        static std::mt19937_64 Generator{std::random_device{}()};
+        uint64_t Id = 0;
+
+        while (Id == 0)
+        {
+            Id = Generator();
+        }
+
+        return Id;
+    }
+}
+
+SnapshotReader::SnapshotReader(const std::string& Path) : mFile(Path)
+{
+    if (mFile.IsOpen() == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Snapshot file could not be opened");
+    }
+
+    const std::span<const std::byte> Data = mFile.Data();
+    size_t Offset = 0;
+
+    if ((Data.size() < sizeof(MAGIC)) || (std::memcmp(Data.data(), MAGIC, sizeof(MAGIC)) != 0))
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "File is not a snapshot");
+    }
+
+    Offset += sizeof(MAGIC);
+
+    if (Extract<uint32_t>(Data, Offset) != VERSION)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Unsupported snapshot file version");
+    }
+
+    mId = Extract<uint64_t>(Data, Offset);
+    mBase = Extract<uint64_t>(Data, Offset);
+    const uint32_t Types = Extract<uint32_t>(Data, Offset);
+    const uint32_t Objects = Extract<uint32_t>(Data, Offset);
+
+    for (uint32_t Type = 0; Type < Types; Type++)
+    {
+        const uint32_t Version = Extract<uint32_t>(Data, Offset);
+        const uint32_t Bytes = Extract<uint32_t>(Data, Offset);
+        mSchemas.push_back(SnapshotSchema{.Type = ExtractString(Data, Offset), .Version = Version, .Bytes = Bytes});
+    }
+
+    mObjects.reserve(Objects);
+
+    for (uint32_t Index = 0; Index < Objects; Index++)
+    {
+        const uint32_t Type = Extract<uint32_t>(Data, Offset);
+
+        if (Type >= Types)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Snapshot object has an unknown type");
+        }
+
+        mObjects.push_back(Object{.Key = ExtractString(Data, Offset), .Type = Type});
+    }
+
+    // Locate each block
+    for (Object& Entry : mObjects)
+    {
+        Offset = Align(Offset);
+        Entry.Offset = Offset;
+        Offset += mSchemas[Entry.Type].Bytes;
+    }
+
+    if (Offset > Data.size())
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Snapshot file is truncated");
+    }
+}
+
+std::span<const std::byte> SnapshotReader::GetBlock(size_t Index) const noexcept
+{
+    return mFile.Data().subspan(mObjects[Index].Offset, GetSchema(Index).Bytes);
+}
+
+size_t SnapshotReader::Find(const HString& Key) const
+{
+    for (size_t Index = 0; Index < mObjects.size(); Index++)
+    {
+        if (mObjects[Index].Key == Key)
+        {
+            return Index;
+        }
+    }
+
+    throw Error::GenericException(__FILE__, __LINE__, "Object is not held by the snapshot");
+}
+
+void SnapshotSet::Register(const HString& Key, const SnapshotBlock& Block)
+{
+    if (mKeys.contains(Key) == true)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Snapshot object is already registered");
+    }
+
+    const SnapshotSchema Schema{.Type = Block.Type, .Version = Block.Version, .Bytes = static_cast<uint32_t>(Block.Data.size())};
+    size_t Type = 0;
+
+    while ((Type < mTypes.size()) && ((mTypes[Type].Type == Schema.Type) == false))
+    {
+        Type++;
+    }
+
+    if (Type == mTypes.size())
+    {
+        mTypes.push_back(Schema);
+    }
+    else if ((mTypes[Type].Version != Schema.Version) || (mTypes[Type].Bytes != Schema.Bytes))
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Snapshot type is registered with a different layout");
+    }
+
+    mKeys.emplace(Key, mObjects.size());
+    mObjects.push_back(Registration{.Key = Key, .Type = static_cast<uint32_t>(Type), .Data = Block.Data, .Shadow = mShadow.size()});
+    mShadow.resize(mShadow.size() + Block.Data.size());
+}
+
+uint64_t SnapshotSet::Save(const std::string& Path)
+{
+    return Write(Path, false);
+}
+
+uint64_t SnapshotSet::SaveDelta(const std::string& Path)
+{
+    if (mId == 0)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Delta snapshot requires a previous snapshot");
+    }
+
+    return Write(Path, true);
+}
+
+uint64_t SnapshotSet::Write(const std::string& Path, bool Delta)
+{
+    // Objects written, all or those differing from their shadow
+    std::vector<uint32_t> Written;
+    Written.reserve(mObjects.size());
+    size_t Bytes = 0;
+
+    for (size_t Index = 0; Index < mObjects.size(); Index++)
+    {
+        const Registration& Entry = mObjects[Index];
+
+        if ((Delta == false) || (std::memcmp(Entry.Data.data(), mShadow.data() + Entry.Shadow, Entry.Data.size()) != 0))
+        {
+            Written.push_back(static_cast<uint32_t>(Index));
+            Bytes += Align(Entry.Data.size()) + Entry.Key.Size() + 6;
+        }
+    }
+
+    const uint64_t Id = GenerateId();
+    std::vector<std::byte> Out;
+    Out.reserve(Bytes + 1024);
+
+    Out.insert(Out.end(), reinterpret_cast<const std::byte*>(MAGIC), reinterpret_cast<const std::byte*>(MAGIC) + sizeof(MAGIC));
+    Append(Out, VERSION);
+    Append(Out, Id);
+    Append(Out, (Delta == true) ? mId : uint64_t(0));
+    Append(Out, static_cast<uint32_t>(mTypes.size()));
+    Append(Out, static_cast<uint32_t>(Written.size()));
+
+    for (const SnapshotSchema& Schema : mTypes)
+    {
+        Append(Out, Schema.Version);
+        Append(Out, Schema.Bytes);
+        Append(Out, Schema.Type);
+    }
+
+    for (const uint32_t Index : Written)
+    {
+        Append(Out, mObjects[Index].Type);
+        Append(Out, mObjects[Index].Key);
+    }
+
+    for (const uint32_t Index : Written)
+    {
+        const Registration& Entry = mObjects[Index];
+        Out.resize(Align(Out.size()));
+        Out.insert(Out.end(), Entry.Data.begin(), Entry.Data.end());
+    }
+
+    std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+    File.write(reinterpret_cast<const char*>(Out.data()), static_cast<std::streamsize>(Out.size()));
+    File.close();
+
+    if (File.fail() == true)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Snapshot file could not be written");
+    }
+
+    for (const uint32_t Index : Written)
+    {
+        const Registration& Entry = mObjects[Index];
+        std::copy(Entry.Data.begin(), Entry.Data.end(), mShadow.begin() + static_cast<ptrdiff_t>(Entry.Shadow));
+    }
+
+    mId = Id;
+    return Id;
+}
+
+void SnapshotSet::Restore(const std::string& Path, const std::vector<std::string>& Deltas)
+{
+    // Every snapshot of the chain is opened and matched before any state is restored
+    std::vector<SnapshotReader> Chain;
+    std::vector<std::vector<size_t>> Targets;
+    Chain.reserve(Deltas.size() + 1);
+    Targets.reserve(Deltas.size() + 1);
+
+    Chain.emplace_back(Path);
+
+    if (Chain.front().IsDelta() == true)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Restore requires a full snapshot");
+    }
+
+    // Held objects are distinct, so holding as many as are registered holds each exactly once
+    if (Chain.front().Size() != mObjects.size())
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Snapshot does not hold every registered object");
+    }
+
+    Targets.push_back(Match(Chain.front()));
+
+    for (const std::string& DeltaPath : Deltas)
+    {
+        const uint64_t Id = Chain.back().GetId();
+        Chain.emplace_back(DeltaPath);
+
+        if (Chain.back().GetBase() != Id)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Delta snapshot does not follow the previous snapshot");
+        }
+
+        Targets.push_back(Match(Chain.back()));
+    }
+
+    for (size_t Index = 0; Index < Chain.size(); Index++)
+    {
+        Apply(Chain[Index], Targets[Index]);
+    }
+
+    mId = Chain.back().GetId();
+}
+
+std::vector<size_t> SnapshotSet::Match(const SnapshotReader& Snapshot) const
+{
+    // Registered object of each held object, matched by key
+    std::vector<size_t> Targets(Snapshot.Size());
+    std::vector<bool> Matched(mObjects.size(), false);
+
+    for (size_t Index = 0; Index < Snapshot.Size(); Index++)
+    {
+        const HString& Key = Snapshot.GetKey(Index);
+        size_t Target = Index;
+
+        // Objects are usually held in order of registration
+        if ((Target >= mObjects.size()) || ((mObjects[Target].Key == Key) == false))
+        {
+            const auto It = mKeys.find(Key);
+
+            if (It == mKeys.end())
+            {
+                throw Error::GenericException(__FILE__, __LINE__, "Snapshot holds an unregistered object");
+            }
+
+            Target = It->second;
+        }
+
+        const SnapshotSchema& Held = Snapshot.GetSchema(Index);
+        const SnapshotSchema& Registered = mTypes[mObjects[Target].Type];
+
+        if (((Held.Type == Registered.Type) == false) || (Held.Version != Registered.Version) || (Held.Bytes != Registered.Bytes))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Snapshot schema does not match the registered object");
+        }
+
+        if (Matched[Target] == true)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Snapshot holds an object more than once");
+        }
+
+        Matched[Target] = true;
+        Targets[Index] = Target;
+    }
+
+    return Targets;
+}
+
+void SnapshotSet::Apply(const SnapshotReader& Snapshot, std::span<const size_t> Targets) noexcept
+{
+    for (size_t Index = 0; Index < Snapshot.Size(); Index++)
+    {
+        const Registration& Entry = mObjects[Targets[Index]];
+        const std::span<const std::byte> Block = Snapshot.GetBlock(Index);
+        std::memcpy(Entry.Data.data(), Block.data(), Block.size());
+        std::memcpy(mShadow.data() + Entry.Shadow, Block.data(), Block.size());
+    }
+}
@@ -0,0 +1,291 @@
+#include "mission/launch_window.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "coordinates/earth.hpp"
+#include "twobody/mean_elements.hpp"
+
+#include <array>
+
+namespace
+{
+    // Passes of the site through the target plane, ascending then descending
+    constexpr size_t PASSES = 2;
+
+    // Sine of the angle from the target plane within which the site is taken to lie in it,
+    // absorbing the rounding of the site geometry when there is no plane tolerance
+    constexpr double PLANE_EPSILON = 1.0E-12;
+
+    /**
+     * @return Angle wrapped into [0, 2 PI)
+     */
+    double Wrap(double Angle) noexcept
+    {
+        return Angle - 2.0 * PI * Floor(Angle / (2.0 * PI));
+    }
+
+    /**
+     * Launch geometry of a site and target inclination, shared by every node
+     */
+    struct LaunchRow
+    {
+        LaunchStatus Status = LaunchStatus::SUCCESS;
+
+        /// Right ascension of the site at the start of the search (rad)
+        double RightAscension = 0.0;
+
+        /// Rate of the node, and of the right ascension of the site relative to the node (rad/s)
+        double NodeRate = 0.0;
+        double RelativeRate = 0.0;
+
+        /// Right ascension of the site relative to the node at each crossing (rad)
+        std::array<double, PASSES> Phase{};
+
+        /// Half width of the window about each crossing, in relative right ascension (rad)
+        std::array<double, PASSES> HalfWidth{};
+
+        std::array<LaunchVelocityResult, PASSES> Velocity{};
+        std::array<bool, PASSES> Enabled{};
+
+        /// `true` if the site lies within the plane tolerance throughout, as an equatorial
+        /// site and target, such that the search is a single window
+        bool Continuous = false;
+    };
+
+    /**
+     * Carries the site into the inertial frame at the start of the search, and solves the
+     * crossings of the target plane relative to its node
+     */
+    LaunchRow MakeRow(const Mission::LaunchSite& Site, double Inclination, double Altitude, const Mission::LaunchWindowSettings& Settings) noexcept
+    {
+        const LLA Geodetic{.Lat = R2D(Site.Latitude), .Lgt = R2D(Site.Longitude), .Alt = Site.Altitude};
+        const Vector3 Fixed = Earth::LLA2ECEF(Geodetic, Earth::WGS84RadiiComponents(Site.Latitude));
+        const Vector3 Inertial = Earth::ECI2ECEF(Settings.Start).RotateInv(Fixed);
+        const double Equatorial = Sqrt(Square(Inertial.X) + Square(Inertial.Y));
+        const double Declination = Atan2(Inertial.Z, Equatorial);
+        const double SemiMajorAxis = Earth::WGS84::SEMI_MAJOR_AXIS + Altitude;
+
+        LaunchRow Row{.RightAscension = Atan2(Inertial.Y, Inertial.X), .Enabled = {Settings.Ascending, Settings.Descending}};
+
+        if (Settings.NodalRegression == true)
+        {
+            Row.NodeRate = TwoBody::J2SecularRates(TwoBody::KeplerianElements{.SemiParameter = SemiMajorAxis, .SemiMajorAxis = SemiMajorAxis,
+                .Inclination = Inclination, .GravitationalParameter = Earth::GRAVITATIONAL_CONSTANT}).Node;
+        }
+
+        Row.RelativeRate = Earth::ROTATIONAL_RATE - Row.NodeRate;
+
+        for (size_t Pass = 0; Pass < PASSES; Pass++)
+        {
+            Row.Velocity[Pass] = LaunchVelocityComponents({
+                .TargetInclination = Inclination,
+                .SiteLatitude = Declination,
+                .OrbitalVelocity = Sqrt(Earth::GRAVITATIONAL_CONSTANT / SemiMajorAxis),
+                .SiteVelocity = Earth::ROTATIONAL_RATE * Equatorial,
+                .Pass = (Pass == 0) ? LaunchPass::ASCENDING : LaunchPass::DESCENDING});
+        }
+
+        Row.Status = Row.Velocity[0].Status;
+
+        if (Row.Status != LaunchStatus::SUCCESS)
+        {
+            return Row;
+        }
+
+        // The sine of the angle of the site from the plane is Apex - Swing cos(D), with D the
+        // relative right ascension of the site from the apex of the orbit on its side
+        const double Apex = Abs(Sin(Declination) * Cos(Inclination));
+        const double Swing = Abs(Cos(Declination) * Sin(Inclination));
+        const double Tolerance = Max(Sin(Settings.PlaneTolerance), PLANE_EPSILON);
+
+        if (Apex + Swing <= Tolerance)
+        {
+            Row.Continuous = true;
+            return Row;
+        }
+
+        // The site just reaching the plane at the apex, both passes merge into a single crossing
+        // per revolution, its window solved exactly as the first order width vanishes
+        if (Swing - Apex <= Tolerance)
+        {
+            const double Latitude = (Declination < 0.0) ? -0.5 * PI : 0.5 * PI;
+
+            Row.Phase = {Wrap(Atan2(Cos(Inclination) * Sin(Latitude), Cos(Latitude))), 0.0};
+            Row.HalfWidth = {Acos(Clamp((Apex - Sin(Settings.PlaneTolerance)) / Swing, -1.0, 1.0)), 0.0};
+            Row.Enabled = {Settings.Ascending || Settings.Descending, false};
+            return Row;
+        }
+
+        // Argument of latitude of the site on each half of the orbit, and its right ascension from the node
+        const double SinLatitude = Clamp(Sin(Declination) / Sin(Inclination), -1.0, 1.0);
+        const std::array<double, PASSES> Latitude = {Asin(SinLatitude), PI - Asin(SinLatitude)};
+
+        for (size_t Pass = 0; Pass < PASSES; Pass++)
+        {
+            Row.Phase[Pass] = Wrap(Atan2(Cos(Inclination) * Sin(Latitude[Pass]), Cos(Latitude[Pass])));
+        }
+
+        // Rate of the angle of the site from the plane with its relative right ascension, the window
+        // of each pass bounded by half the separation of the passes
+        const double Separation = Wrap(Row.Phase[1] - Row.Phase[0]);
+        const double Bound = 0.5 * Min(Separation, 2.0 * PI - Separation);
+
+        for (size_t Pass = 0; Pass < PASSES; Pass++)
+        {
+            const double Slope = Abs(Sin(Inclination) * Cos(Declination) * Cos(Row.Phase[Pass]));
+            Row.HalfWidth[Pass] = (Sin(Settings.PlaneTolerance) < Slope * Bound) ? Sin(Settings.PlaneTolerance) / Slope : Bound;
+        }
+
+        return Row;
+    }
+
+    /**
+     * @return Time of the first crossing of a pass at or after the start of the search
+     */
+    double FirstCrossing(const LaunchRow& Row, size_t Pass, double Node, const Mission::LaunchWindowSettings& Settings) noexcept
+    {
+        const double Relative = Row.RightAscension - (Node + Row.NodeRate * Settings.Start);
+
+        return Settings.Start + Wrap(Row.Phase[Pass] - Relative) / Row.RelativeRate;
+    }
+
+    /**
+     * @return Opportunity of a pass crossing at a time
+     */
+    Mission::LaunchOpportunity MakeOpportunity(const LaunchRow& Row, size_t Pass, double Time) noexcept
+    {
+        const double HalfWidth = Row.HalfWidth[Pass] / Row.RelativeRate;
+
+        return Mission::LaunchOpportunity{
+            .Time = Time,
+            .Open = Time - HalfWidth,
+            .Close = Time + HalfWidth,
+            .Azimuth = Row.Velocity[Pass].Azimuth,
+            .DeltaV = Sqrt(Square(Row.Velocity[Pass].Vx) + Square(Row.Velocity[Pass].Vy)),
+            .Pass = (Pass == 0) ? LaunchPass::ASCENDING : LaunchPass::DESCENDING};
+    }
+
+    /**
+     * @return Opportunity of a site within the plane tolerance throughout, spanning the search
+     */
+    Mission::LaunchOpportunity MakeContinuous(const LaunchRow& Row, const Mission::LaunchWindowSettings& Settings) noexcept
+    {
+        const size_t Pass = (Row.Enabled[0] == true) ? 0 : 1;
+        Mission::LaunchOpportunity Opportunity = MakeOpportunity(Row, Pass, Settings.Start);
+        Opportunity.Open = Settings.Start;
+        Opportunity.Close = Settings.Start + Settings.Duration;
+
+        return Opportunity;
+    }
+}
+
+Mission::LaunchWindowResult Mission::FindLaunchOpportunities(const LaunchSite& Site, const TargetOrbit& Target, const LaunchWindowSettings& Settings,
+    std::span<LaunchOpportunity> Opportunities) noexcept
+{
+    const LaunchRow Row = MakeRow(Site, Target.Inclination, Target.Altitude, Settings);
+    LaunchWindowResult Result{.Status = Row.Status};
+
+    if (Row.Status != LaunchStatus::SUCCESS)
+    {
+        return Result;
+    }
+
+    if (Row.Continuous == true)
+    {
+        Result.Count = ((Row.Enabled[0] == true) || (Row.Enabled[1] == true)) ? 1 : 0;
+
+        if ((Result.Count > 0) && (Opportunities.empty() == false))
+        {
+            Opportunities[0] = MakeContinuous(Row, Settings);
+        }
+
+        return Result;
+    }
+
+    // Each pass recurs once per revolution of the site relative to the node, merged in time order
+    const double Period = 2.0 * PI / Row.RelativeRate;
+    const double End = Settings.Start + Settings.Duration;
+    std::array<double, PASSES> Next{};
+
+    for (size_t Pass = 0; Pass < PASSES; Pass++)
+    {
+        Next[Pass] = (Row.Enabled[Pass] == true) ? FirstCrossing(Row, Pass, Target.Node, Settings) : End + Period;
+    }
+
+    while (Min(Next[0], Next[1]) <= End)
+    {
+        const size_t Pass = (Next[1] < Next[0]) ? 1 : 0;
+
+        if (Result.Count < Opportunities.size())
+        {
+            Opportunities[Result.Count] = MakeOpportunity(Row, Pass, Next[Pass]);
+        }
+
+        Result.Count++;
+        Next[Pass] += Period;
+    }
+
+    return Result;
+}
+
+void Mission::EvaluateLaunchGrid(ThreadPool& Pool, const LaunchGrid& Grid, const LaunchWindowSettings& Settings, std::span<LaunchCell> Cells) noexcept
+{
+    const size_t Nodes = Grid.Nodes.size();
+
+    Pool.ParallelFor(Grid.Sites.size() * Grid.Inclinations.size(), [&](size_t RowIndex)
+    {
+        const size_t Site = RowIndex / Grid.Inclinations.size();
+        const size_t Inclination = RowIndex % Grid.Inclinations.size();
+        const LaunchRow Row = MakeRow(Grid.Sites[Site], Grid.Inclinations[Inclination], Grid.Altitude, Settings);
+        LaunchCell* Output = &Cells[Grid.Index(Site, Inclination, 0)];
+
+        if (Row.Status != LaunchStatus::SUCCESS)
+        {
+            for (size_t Node = 0; Node < Nodes; Node++)
+            {
+                Output[Node] = LaunchCell{.Status = Row.Status};
+            }
+
+            return;
+        }
+
+        if (Row.Continuous == true)
+        {
+            const bool Enabled = (Row.Enabled[0] == true) || (Row.Enabled[1] == true);
+
+            for (size_t Node = 0; Node < Nodes; Node++)
+            {
+                Output[Node] = Enabled ? LaunchCell{.Count = 1, .First = MakeContinuous(Row, Settings)} : LaunchCell{};
+            }
+
+            return;
+        }
+
+        const double Period = 2.0 * PI / Row.RelativeRate;
+        const double End = Settings.Start + Settings.Duration;
+
+        for (size_t Node = 0; Node < Nodes; Node++)
+        {
+            LaunchCell Cell{};
+            double First = End + Period;
+            size_t FirstPass = 0;
+
+            for (size_t Pass = 0; Pass < PASSES; Pass++)
+            {
+                const double Time = FirstCrossing(Row, Pass, Grid.Nodes[Node], Settings);
+
+                if ((Row.Enabled[Pass] == true) && (Time <= End))
+                {
+                    Cell.Count += static_cast<uint32_t>(Floor((End - Time) / Period)) + 1;
+                    FirstPass = (Time < First) ? Pass : FirstPass;
+                    First = Min(First, Time);
+                }
+            }
+
+            if (Cell.Count > 0)
+            {
+                Cell.First = MakeOpportunity(Row, FirstPass, First);
+            }
+
+            Output[Node] = Cell;
+        }
+    });
+}
@@ -0,0 +1,633 @@
+#include "mission/transfer.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "utils/errors.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+    // Golden section iterations of the split of a plane change, to a bracket of 1.0E-5 of the angle,
+    // the delta v being stationary in the split
+    constexpr uint32_t SPLIT_ITERATIONS = 24;
+
+    // Sine of the angle between planes below which they are coplanar, and the line of nodes undefined
+    constexpr double COPLANAR_TOLERANCE = 1.0E-12;
+
+    // Phase angle below which a transfer arrives at its target (rad)
+    constexpr double PHASE_TOLERANCE = 1.0E-12;
+
+    constexpr double GOLDEN = 0.6180339887498948482;
+
+    constexpr double INFEASIBLE = std::numeric_limits<double>::infinity();
+
+    /**
+     * @return Angle wrapped into [0, 2 PI)
+     */
+    double Wrap(double Angle) noexcept
+    {
+        return Angle - 2.0 * PI * Floor(Angle / (2.0 * PI));
+    }
+
+    /**
+     * @return Speed on a conic of a semi-major axis at a radius (m/s)
+     */
+    double VisViva(double Radius, double SemiMajorAxis, double GravitationalParameter) noexcept
+    {
+        return Sqrt(GravitationalParameter * (2.0 / Radius - 1.0 / SemiMajorAxis));
+    }
+
+    /**
+     * @return Time of flight of half of an ellipse (s)
+     */
+    double HalfPeriod(double SemiMajorAxis, double GravitationalParameter) noexcept
+    {
+        return PI * Sqrt(Cube(SemiMajorAxis) / GravitationalParameter);
+    }
+
+    /**
+     * Horizontal speeds before and after an impulse
+     */
+    struct Leg
+    {
+        double Before = 0.0;
+        double After = 0.0;
+
+        /** @return Magnitude of the impulse rotating the velocity by an angle (m/s) */
+        double Impulse(double Angle) const noexcept
+        {
+            return Sqrt(Max(0.0, Square(Before) + Square(After) - 2.0 * Before * After * Cos(Angle)));
+        }
+    };
+
+    /**
+     * @return Point of a bracket minimising a unimodal function by golden sections
+     */
+    template <typename Func>
+    double GoldenSection(Func&& Function, double Lower, double Upper, uint32_t Iterations) noexcept
+    {
+        double Left = Upper - GOLDEN * (Upper - Lower);
+        double Right = Lower + GOLDEN * (Upper - Lower);
+        double FLeft = Function(Left);
+        double FRight = Function(Right);
+
+        for (uint32_t Index = 0; Index < Iterations; Index++)
+        {
+            if (FLeft < FRight)
+            {
+                Upper = Right;
+                Right = Left;
+                FRight = FLeft;
+                Left = Upper - GOLDEN * (Upper - Lower);
+                FLeft = Function(Left);
+            }
+            else
+            {
+                Lower = Left;
+                Left = Right;
+                FLeft = FRight;
+                Right = Lower + GOLDEN * (Upper - Lower);
+                FRight = Function(Right);
+            }
+        }
+
+        return (FLeft < FRight) ? Left : Right;
+    }
+
+    /**
+     * @return Plane change of the first of two impulses minimising their sum
+     */
+    double SplitPlaneChange(const Leg& First, const Leg& Second, double PlaneChange) noexcept
+    {
+        if (PlaneChange == 0.0)
+        {
+            return 0.0;
+        }
+
+        return GoldenSection([&](double Angle) {return First.Impulse(Angle) + Second.Impulse(PlaneChange - Angle);}, 0.0, PlaneChange,
+            SPLIT_ITERATIONS);
+    }
+
+    /**
+     * Speeds and times of the impulses of a Hohmann or bi-elliptic transfer, and the split of
+     * its plane change
+     */
+    struct TransferShape
+    {
+        std::array<Leg, 3> Legs{};
+        std::array<double, 3> Times{};
+        std::array<double, 3> Angles{};
+        size_t Count = 0;
+        double PlaneChange = 0.0;
+    };
+
+    /**
+     * Splits the plane change of a shape between its impulses to minimise their sum. Of three
+     * impulses, the plane change of the intermediate impulse, the remainder split between the outer two
+     */
+    void SplitShape(TransferShape& Shape) noexcept
+    {
+        const double PlaneChange = Shape.PlaneChange;
+
+        if (Shape.Count == 2)
+        {
+            Shape.Angles[0] = SplitPlaneChange(Shape.Legs[0], Shape.Legs[1], PlaneChange);
+            Shape.Angles[1] = PlaneChange - Shape.Angles[0];
+            return;
+        }
+
+        if (PlaneChange != 0.0)
+        {
+            const auto Outer = [&](double Middle) {return SplitPlaneChange(Shape.Legs[0], Shape.Legs[2], PlaneChange - Middle);};
+
+            Shape.Angles[1] = GoldenSection([&](double Middle)
+            {
+                const double Angle = Outer(Middle);
+                return Shape.Legs[0].Impulse(Angle) + Shape.Legs[1].Impulse(Middle) + Shape.Legs[2].Impulse(PlaneChange - Middle - Angle);
+            }, 0.0, PlaneChange, SPLIT_ITERATIONS);
+
+            Shape.Angles[0] = Outer(Shape.Angles[1]);
+            Shape.Angles[2] = PlaneChange - Shape.Angles[1] - Shape.Angles[0];
+        }
+    }
+
+    /**
+     * @return Sum of the magnitudes of the impulses of a shape (m/s)
+     */
+    double ShapeDeltaV(const TransferShape& Shape) noexcept
+    {
+        double DeltaV = 0.0;
+
+        for (size_t Index = 0; Index < Shape.Count; Index++)
+        {
+            DeltaV += Shape.Legs[Index].Impulse(Shape.Angles[Index]);
+        }
+
+        return DeltaV;
+    }
+
+    TransferShape HohmannShape(double InitialRadius, double FinalRadius, double GravitationalParameter, double PlaneChange) noexcept
+    {
+        const double SemiMajorAxis = 0.5 * (InitialRadius + FinalRadius);
+        TransferShape Shape{.Count = 2, .PlaneChange = PlaneChange};
+
+        Shape.Legs[0] = Leg{.Before = VisViva(InitialRadius, InitialRadius, GravitationalParameter), .After = VisViva(InitialRadius, SemiMajorAxis,
+            GravitationalParameter)};
+        Shape.Legs[1] = Leg{.Before = VisViva(FinalRadius, SemiMajorAxis, GravitationalParameter), .After = VisViva(FinalRadius, FinalRadius,
+            GravitationalParameter)};
+        Shape.Times[1] = HalfPeriod(SemiMajorAxis, GravitationalParameter);
+        SplitShape(Shape);
+
+        return Shape;
+    }
+
+    TransferShape BiEllipticShape(double InitialRadius, double FinalRadius, double IntermediateRadius, double GravitationalParameter,
+        double PlaneChange) noexcept
+    {
+        const double First = 0.5 * (InitialRadius + IntermediateRadius);
+        const double Second = 0.5 * (FinalRadius + IntermediateRadius);
+        TransferShape Shape{.Count = 3, .PlaneChange = PlaneChange};
+
+        Shape.Legs[0] = Leg{.Before = VisViva(InitialRadius, InitialRadius, GravitationalParameter), .After = VisViva(InitialRadius, First,
+            GravitationalParameter)};
+        Shape.Legs[1] = Leg{.Before = VisViva(IntermediateRadius, First, GravitationalParameter), .After = VisViva(IntermediateRadius, Second,
+            GravitationalParameter)};
+        Shape.Legs[2] = Leg{.Before = VisViva(FinalRadius, Second, GravitationalParameter), .After = VisViva(FinalRadius, FinalRadius,
+            GravitationalParameter)};
+        Shape.Times[1] = HalfPeriod(First, GravitationalParameter);
+        Shape.Times[2] = Shape.Times[1] + HalfPeriod(Second, GravitationalParameter);
+        SplitShape(Shape);
+
+        return Shape;
+    }
+
+    /**
+     * @return Impulse of a leg rotating the plane by an angle, positively about the direction
+     * of the position if `Sign` is positive
+     */
+    Mission::Impulse MakeImpulse(double Time, const Leg& Speeds, double Angle, double Sign) noexcept
+    {
+        return Mission::Impulse{
+            .Time = Time,
+            .DeltaV = Vector3({0.0, Speeds.After * Cos(Angle) - Speeds.Before, Sign * Speeds.After * Sin(Angle)}),
+            .PlaneChange = Angle};
+    }
+
+    void Append(Mission::TransferPlan& Plan, const Mission::Impulse& Burn) noexcept
+    {
+        Plan.Impulses[Plan.Count++] = Burn;
+        Plan.DeltaV += Burn.DeltaV.Norm();
+        Plan.Duration = Burn.Time;
+    }
+
+    /**
+     * @return Plan of the impulses of a shape. Successive impulses lie on opposite sides of the
+     * line of nodes, about which the plane rotates in a single sense
+     */
+    Mission::TransferPlan MakePlan(const TransferShape& Shape) noexcept
+    {
+        Mission::TransferPlan Plan{};
+
+        for (size_t Index = 0; Index < Shape.Count; Index++)
+        {
+            Append(Plan, MakeImpulse(Shape.Times[Index], Shape.Legs[Index], Shape.Angles[Index], (Index % 2 == 0) ? 1.0 : -1.0));
+        }
+
+        return Plan;
+    }
+
+    /**
+     * Relative geometry of a chaser and target at the start of a rendezvous
+     */
+    struct Geometry
+    {
+        double GravitationalParameter = 0.0;
+        double ChaserRadius = 0.0;
+        double TargetRadius = 0.0;
+        double TargetRate = 0.0;
+        double PlaneChange = 0.0;
+
+        /// Time to the first crossing of the line of nodes by the chaser, and half its period (s)
+        double Departure = 0.0;
+        double Crossing = 0.0;
+
+        /// Sense of the rotation of the plane at the first departure
+        double Sign = 1.0;
+
+        /// Angle by which the target leads the first departure point, in its plane (rad)
+        double Lead = 0.0;
+    };
+
+    Geometry MakeGeometry(const TwoBody::Orbit& Chaser, const TwoBody::Orbit& Target) noexcept
+    {
+        const TwoBody::KeplerianElements& ChaserElements = Chaser.GetElements();
+        const TwoBody::KeplerianElements& TargetElements = Target.GetElements();
+        const EphemerisState ChaserState = TwoBody::Kepler2Newtonian(ChaserElements);
+        const EphemerisState TargetState = TwoBody::Kepler2Newtonian(TargetElements);
+
+        const Vector3 ChaserNormal = ChaserState.Pos.Cross(ChaserState.Vel).Unit();
+        const Vector3 TargetNormal = TargetState.Pos.Cross(TargetState.Vel).Unit();
+        const Vector3 Nodes = ChaserNormal.Cross(TargetNormal);
+        const double Sine = Nodes.Norm();
+        const double ChaserRate = Sqrt(ChaserElements.GravitationalParameter / Cube(ChaserElements.SemiMajorAxis));
+
+        Geometry Result{
+            .GravitationalParameter = ChaserElements.GravitationalParameter,
+            .ChaserRadius = ChaserElements.SemiMajorAxis,
+            .TargetRadius = TargetElements.SemiMajorAxis,
+            .TargetRate = Sqrt(TargetElements.GravitationalParameter / Cube(TargetElements.SemiMajorAxis)),
+            .PlaneChange = Atan2(Sine, ChaserNormal.Dot(TargetNormal)),
+            .Crossing = PI / ChaserRate};
+
+        // Coplanar orbits may depart immediately, otherwise at the first crossing of the line of nodes
+        Vector3 Point = ChaserState.Pos.Unit();
+
+        if (Sine > COPLANAR_TOLERANCE)
+        {
+            const Vector3 Line = Nodes / Sine;
+            double Angle = Wrap(Atan2(Point.Cross(Line).Dot(ChaserNormal), Point.Dot(Line)));
+            Point = Line;
+
+            if (Angle >= PI)
+            {
+                Angle -= PI;
+                Point = -Line;
+                Result.Sign = -1.0;
+            }
+
+            Result.Departure = Angle / ChaserRate;
+        }
+
+        const Vector3 TargetPoint = TargetState.Pos.Unit();
+        Result.Lead = Wrap(Atan2(Point.Cross(TargetPoint).Dot(TargetNormal), Point.Dot(TargetPoint)));
+
+        return Result;
+    }
+
+    /**
+     * Best departure and phasing of a transfer shape
+     */
+    struct Candidate
+    {
+        double DeltaV = INFEASIBLE;
+        Mission::TransferKind Kind = Mission::TransferKind::HOHMANN;
+        double IntermediateRadius = 0.0;
+        uint32_t Departure = 0;
+        uint32_t Revolutions = 0;
+
+        /// Revolutions of the target while the chaser phases
+        uint32_t TargetRevolutions = 0;
+    };
+
+    /**
+     * @return Semi-major axis of the phasing orbit of a candidate (m)
+     */
+    double PhasingAxis(const Geometry& Relative, double PhaseAngle, uint32_t Revolutions, uint32_t TargetRevolutions) noexcept
+    {
+        const double Period = (2.0 * PI * static_cast<double>(TargetRevolutions) - PhaseAngle) / (static_cast<double>(Revolutions) * Relative.TargetRate);
+        return Cbrt(Relative.GravitationalParameter * Square(Period / (2.0 * PI)));
+    }
+
+    /**
+     * @return Angle by which the target leads the arrival of a departure (rad)
+     */
+    double ArrivalPhase(const Geometry& Relative, const TransferShape& Shape, uint32_t Departure) noexcept
+    {
+        // Arrival opposite the departure point after an odd number of half ellipses
+        const bool Opposite = ((Departure + Shape.Count - 1) % 2) == 1;
+        const double Arrival = Relative.Departure + Relative.Crossing * static_cast<double>(Departure) + Shape.Times[Shape.Count - 1];
+
+        return Wrap(Relative.Lead - (Opposite ? PI : 0.0) + Relative.TargetRate * Arrival);
+    }
+
+    /**
+     * @return Shape with its last impulse entering a phasing orbit of a speed at the target
+     * radius, the plane change split again against the merged impulse
+     */
+    TransferShape MergePhasing(const TransferShape& Shape, double Speed) noexcept
+    {
+        TransferShape Merged = Shape;
+        Merged.Legs[Merged.Count - 1].After = Speed;
+        SplitShape(Merged);
+
+        return Merged;
+    }
+
+    /**
+     * Evaluates every departure and phasing of a transfer shape, the last impulse of the transfer
+     * merged with the entry to the phasing orbit
+     */
+    Candidate Evaluate(const Geometry& Relative, const TransferShape& Shape, Mission::TransferKind Kind, double IntermediateRadius,
+        const Mission::RendezvousSettings& Settings) noexcept
+    {
+        Candidate Best{.Kind = Kind, .IntermediateRadius = IntermediateRadius};
+        const Leg& Last = Shape.Legs[Shape.Count - 1];
+
+        // The transfer ellipses span the radii of the chaser and target, and any intermediate radius
+        const double Highest = Max(Relative.ChaserRadius, Relative.TargetRadius, IntermediateRadius);
+        const double Lowest = Min(Relative.ChaserRadius, Relative.TargetRadius);
+
+        if ((Lowest < Settings.MinRadius) || (Highest > Settings.MaxRadius))
+        {
+            return Best;
+        }
+
+        for (uint32_t Departure = 0; Departure < Settings.Departures; Departure++)
+        {
+            const double Arrival = Relative.Departure + Relative.Crossing * static_cast<double>(Departure) + Shape.Times[Shape.Count - 1];
+
+            if (Arrival > Settings.MaxDuration)
+            {
+                break;
+            }
+
+            const double Phase = ArrivalPhase(Relative, Shape, Departure);
+
+            if ((Phase < PHASE_TOLERANCE) || (2.0 * PI - Phase < PHASE_TOLERANCE))
+            {
+                const double DeltaV = ShapeDeltaV(Shape);
+                Best = (DeltaV < Best.DeltaV) ? Candidate{.DeltaV = DeltaV, .Kind = Kind, .IntermediateRadius = IntermediateRadius,
+                    .Departure = Departure} : Best;
+                continue;
+            }
+
+            // Catching up in a lower orbit, or falling back in a higher one. Either phasing orbit nears
+            // the target orbit with more revolutions, lowering the delta v and relaxing its apsis, so the
+            // most revolutions ending as the target completes its own within the duration are the best
+            const double Completed = Floor(((Settings.MaxDuration - Arrival) * Relative.TargetRate + Phase) / (2.0 * PI));
+
+            for (const uint32_t Behind : {0u, 1u})
+            {
+                const double Most = Min(static_cast<double>(Settings.Revolutions), Completed - static_cast<double>(Behind));
+
+                if (Most < 1.0)
+                {
+                    continue;
+                }
+
+                const uint32_t Phasing = static_cast<uint32_t>(Most);
+                const double SemiMajorAxis = PhasingAxis(Relative, Phase, Phasing, Phasing + Behind);
+                const double Apsis = 2.0 * SemiMajorAxis - Relative.TargetRadius;
+
+                if ((Apsis < Settings.MinRadius) || (Apsis > Settings.MaxRadius))
+                {
+                    continue;
+                }
+
+                const double Speed = VisViva(Relative.TargetRadius, SemiMajorAxis, Relative.GravitationalParameter);
+                const double DeltaV = ShapeDeltaV(MergePhasing(Shape, Speed)) + Abs(Last.After - Speed);
+
+                if (DeltaV < Best.DeltaV)
+                {
+                    Best = Candidate{.DeltaV = DeltaV, .Kind = Kind, .IntermediateRadius = IntermediateRadius, .Departure = Departure,
+                        .Revolutions = Phasing, .TargetRevolutions = Phasing + Behind};
+                }
+            }
+        }
+
+        return Best;
+    }
+
+    /**
+     * @return Shape of the transfer of a candidate
+     */
+    TransferShape MakeShape(const Geometry& Relative, Mission::TransferKind Kind, double IntermediateRadius) noexcept
+    {
+        return (Kind == Mission::TransferKind::HOHMANN) ?
+            HohmannShape(Relative.ChaserRadius, Relative.TargetRadius, Relative.GravitationalParameter, Relative.PlaneChange) :
+            BiEllipticShape(Relative.ChaserRadius, Relative.TargetRadius, IntermediateRadius, Relative.GravitationalParameter, Relative.PlaneChange);
+    }
+
+    /**
+     * Searches a start, the Hohmann transfer first then each cell of the logarithm of the
+     * intermediate radius, refined by golden sections within the cell
+     */
+    Candidate Search(const Geometry& Relative, size_t Start, const Mission::RendezvousSettings& Settings) noexcept
+    {
+        if (Start == 0)
+        {
+            return Evaluate(Relative, MakeShape(Relative, Mission::TransferKind::HOHMANN, 0.0), Mission::TransferKind::HOHMANN, 0.0, Settings);
+        }
+
+        const double Lower = Log(Max(Relative.ChaserRadius, Relative.TargetRadius));
+        const double Upper = Log(Settings.MaxRadius);
+
+        if (Upper <= Lower)
+        {
+            return Candidate{};
+        }
+
+        const double Width = (Upper - Lower) / static_cast<double>(Settings.Starts);
+        const double Cell = Lower + Width * static_cast<double>(Start - 1);
+
+        const auto Cost = [&](double Logarithm)
+        {
+            const double Radius = Exp(Logarithm);
+            return Evaluate(Relative, MakeShape(Relative, Mission::TransferKind::BI_ELLIPTIC, Radius), Mission::TransferKind::BI_ELLIPTIC, Radius,
+                Settings);
+        };
+
+        const Candidate Centre = Cost(Cell + 0.5 * Width);
+        const Candidate Refined = Cost(GoldenSection([&](double Logarithm) {return Cost(Logarithm).DeltaV;}, Cell, Cell + Width, Settings.Iterations));
+
+        return (Refined.DeltaV < Centre.DeltaV) ? Refined : Centre;
+    }
+
+    /**
+     * @return Plan of the best candidate of a rendezvous
+     */
+    Mission::RendezvousPlan MakeRendezvous(const Geometry& Relative, const Candidate& Best) noexcept
+    {
+        if (Best.DeltaV == INFEASIBLE)
+        {
+            return Mission::RendezvousPlan{};
+        }
+
+        TransferShape Shape = MakeShape(Relative, Best.Kind, Best.IntermediateRadius);
+        const double Final = Shape.Legs[Shape.Count - 1].After;
+        const double Wait = Relative.Departure + Relative.Crossing * static_cast<double>(Best.Departure);
+        const double Sign = (Best.Departure % 2 == 0) ? Relative.Sign : -Relative.Sign;
+
+        Mission::RendezvousPlan Plan{
+            .Status = Mission::RendezvousStatus::SUCCESS,
+            .Kind = Best.Kind,
+            .Wait = Wait,
+            .IntermediateRadius = Best.IntermediateRadius,
+            .Revolutions = Best.Revolutions};
+
+        // The last impulse of the transfer enters the phasing orbit, if any
+        double Phasing = 0.0;
+        double Period = 0.0;
+
+        if (Best.Revolutions > 0)
+        {
+            const double SemiMajorAxis = PhasingAxis(Relative, ArrivalPhase(Relative, Shape, Best.Departure), Best.Revolutions, Best.TargetRevolutions);
+            Phasing = VisViva(Relative.TargetRadius, SemiMajorAxis, Relative.GravitationalParameter);
+            Period = 2.0 * PI * Sqrt(Cube(SemiMajorAxis) / Relative.GravitationalParameter);
+            Shape = MergePhasing(Shape, Phasing);
+        }
+
+        for (size_t Index = 0; Index < Shape.Count; Index++)
+        {
+            Append(Plan.Transfer, MakeImpulse(Wait + Shape.Times[Index], Shape.Legs[Index], Shape.Angles[Index], (Index % 2 == 0) ? Sign : -Sign));
+        }
+
+        if (Best.Revolutions > 0)
+        {
+            Append(Plan.Transfer, MakeImpulse(Plan.Transfer.Duration + static_cast<double>(Best.Revolutions) * Period, Leg{.Before = Phasing, .After = Final},
+                0.0, 1.0));
+        }
+
+        return Plan;
+    }
+}
+
+Mission::TransferPlan Mission::Hohmann(double InitialRadius, double FinalRadius, double GravitationalParameter, double PlaneChange) noexcept
+{
+    return MakePlan(HohmannShape(InitialRadius, FinalRadius, GravitationalParameter, PlaneChange));
+}
+
+Mission::TransferPlan Mission::BiElliptic(double InitialRadius, double FinalRadius, double IntermediateRadius, double GravitationalParameter,
+    double PlaneChange) noexcept
+{
+    return MakePlan(BiEllipticShape(InitialRadius, FinalRadius, IntermediateRadius, GravitationalParameter, PlaneChange));
+}
+
+Mission::TransferPlan Mission::Phasing(double Radius, double PhaseAngle, uint32_t Revolutions, double GravitationalParameter) noexcept
+{
+    TransferPlan Plan{};
+
+    if ((Revolutions == 0) || (PhaseAngle >= 2.0 * PI * static_cast<double>(Revolutions)))
+    {
+        return Plan;
+    }
+
+    const double Period = (2.0 * PI * static_cast<double>(Revolutions) - PhaseAngle) / (static_cast<double>(Revolutions) *
+        Sqrt(GravitationalParameter / Cube(Radius)));
+
+    const double SemiMajorAxis = Cbrt(GravitationalParameter * Square(Period / (2.0 * PI)));
+
+    // A phasing orbit too short to contain its starting point has no speed there
+    if (2.0 * SemiMajorAxis <= Radius)
+    {
+        return Plan;
+    }
+
+    const double Circular = VisViva(Radius, Radius, GravitationalParameter);
+    const double Speed = VisViva(Radius, SemiMajorAxis, GravitationalParameter);
+
+    Append(Plan, MakeImpulse(0.0, Leg{.Before = Circular, .After = Speed}, 0.0, 1.0));
+    Append(Plan, MakeImpulse(static_cast<double>(Revolutions) * Period, Leg{.Before = Speed, .After = Circular}, 0.0, 1.0));
+
+    return Plan;
+}
+
+double Mission::PlaneAngle(const TwoBody::KeplerianElements& Initial, const TwoBody::KeplerianElements& Final) noexcept
+{
+    const double Cosine = Cos(Initial.Inclination) * Cos(Final.Inclination) +
+        Sin(Initial.Inclination) * Sin(Final.Inclination) * Cos(Final.Node - Initial.Node);
+
+    return Acos(Clamp(Cosine, -1.0, 1.0));
+}
+
+Mission::TransferPlan Mission::Hohmann(const TwoBody::KeplerianElements& Initial, const TwoBody::KeplerianElements& Final) noexcept
+{
+    return Hohmann(Initial.SemiMajorAxis, Final.SemiMajorAxis, Initial.GravitationalParameter, PlaneAngle(Initial, Final));
+}
+
+Mission::TransferPlan Mission::BiElliptic(const TwoBody::KeplerianElements& Initial, const TwoBody::KeplerianElements& Final,
+    double IntermediateRadius) noexcept
+{
+    return BiElliptic(Initial.SemiMajorAxis, Final.SemiMajorAxis, IntermediateRadius, Initial.GravitationalParameter, PlaneAngle(Initial, Final));
+}
+
+Mission::RendezvousPlan Mission::PlanRendezvous(const TwoBody::Orbit& Chaser, const TwoBody::Orbit& Target, const RendezvousSettings& Settings) noexcept
+{
+    const Geometry Relative = MakeGeometry(Chaser, Target);
+    Candidate Best{};
+
+    for (size_t Start = 0; Start <= Settings.Starts; Start++)
+    {
+        const Candidate Result = Search(Relative, Start, Settings);
+        Best = (Result.DeltaV < Best.DeltaV) ? Result : Best;
+    }
+
+    return MakeRendezvous(Relative, Best);
+}
+
+void Mission::PlanRendezvous(ThreadPool& Pool, const TwoBody::Orbit& Chaser, std::span<const TwoBody::Orbit> Targets, const RendezvousSettings& Settings,
+    std::span<RendezvousPlan> Plans)
+{
+    if (Plans.size() != Targets.size())
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    // Every start of every target is independent, the best of each target chosen in order of start
+    const size_t Starts = Settings.Starts + 1;
+    std::vector<Geometry> Relative(Targets.size());
+    std::vector<Candidate> Candidates(Targets.size() * Starts);
+
+    Pool.ParallelFor(Targets.size(), [&](size_t Index)
+    {
+        Relative[Index] = MakeGeometry(Chaser, Targets[Index]);
+    });
+
+    Pool.ParallelFor(Candidates.size(), [&](size_t Index)
+    {
+        Candidates[Index] = Search(Relative[Index / Starts], Index % Starts, Settings);
+    });
+
+    Pool.ParallelFor(Targets.size(), [&](size_t Index)
+    {
+        Candidate Best{};
+
+        for (size_t Start = 0; Start < Starts; Start++)
+        {
+            const Candidate& Result = Candidates[Index * Starts + Start];
+            Best = (Result.DeltaV < Best.DeltaV) ? Result : Best;
+        }
+
+        Plans[Index] = MakeRendezvous(Relative[Index], Best);
+    });
+}
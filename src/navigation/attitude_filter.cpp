@@ -0,0 +1,125 @@
+#include "navigation/attitude_filter.hpp"
+
+namespace
+{
+    // Smallest rotation (rad) of a step whose axis is resolved, below which the attitude is unchanged
+    constexpr double MIN_ANGLE = 1.0E-15;
+
+    /**
+     * Sets a block of a matrix to the cross product matrix of a vector, such that the block
+     * multiplied by W is U x W
+     */
+    template <size_t Rows, size_t Cols>
+    void SetSkew(MatrixN<Rows, Cols>& Matrix, size_t Row, size_t Col, const Vector3& U) noexcept
+    {
+        Matrix(Row + 0, Col + 1) = -U.Z;
+        Matrix(Row + 0, Col + 2) =  U.Y;
+        Matrix(Row + 1, Col + 0) =  U.Z;
+        Matrix(Row + 1, Col + 2) = -U.X;
+        Matrix(Row + 2, Col + 0) = -U.Y;
+        Matrix(Row + 2, Col + 1) =  U.X;
+    }
+}
+
+Navigation::AttitudeFilter::AttitudeFilter(const Quaternion& Attitude, const Vector3& Bias, const ErrorCovariance& Covariance, const GyroNoise& Noise) :
+    mAttitude(Attitude.Unit()), mBias(Bias), mNoise(Noise), mFilter(VectorN<6>{}, Covariance)
+{
+}
+
+void Navigation::AttitudeFilter::Predict(const Vector3& Rate, double Step) noexcept
+{
+    const Vector3 Omega = Rate - mBias;
+    const double Angle = Omega.Norm() * Step;
+
+    if (Angle > MIN_ANGLE)
+    {
+        mAttitude = (mAttitude * Quaternion::FromVectorAngle(Omega.Unit(), Angle)).Unit();
+    }
+
+    // First order transition of the errors, d(Theta)/dt = -Omega x Theta - dBias
+    MatrixN<6, 6> Transition = MatrixN<6, 6>::IDENTITY();
+    SetSkew(Transition, 0, 0, Omega * -Step);
+
+    for (size_t Axis = 0; Axis < 3; Axis++)
+    {
+        Transition(Axis, Axis + 3) = -Step;
+    }
+
+    // Angle and rate random walks integrated over the step
+    const double AngleVariance = Square(mNoise.AngleRandomWalk);
+    const double RateVariance = Square(mNoise.RateRandomWalk);
+
+    MatrixN<6, 6> ProcessNoise{};
+
+    for (size_t Axis = 0; Axis < 3; Axis++)
+    {
+        ProcessNoise(Axis, Axis) = AngleVariance * Step + RateVariance * Cube(Step) / 3.0;
+        ProcessNoise(Axis, Axis + 3) = -RateVariance * Square(Step) / 2.0;
+        ProcessNoise(Axis + 3, Axis) = -RateVariance * Square(Step) / 2.0;
+        ProcessNoise(Axis + 3, Axis + 3) = RateVariance * Step;
+    }
+
+    mFilter.Predict([&Transition](const VectorN<6>& Error, MatrixN<6, 6>& Jacobian)
+    {
+        Jacobian = Transition;
+        return Transition * Error;
+    }, ProcessNoise);
+}
+
+Navigation::UpdateStatus Navigation::AttitudeFilter::UpdateVector(const Vector3& Reference, const Vector3& Measured, double Sigma, double Gate) noexcept
+{
+    // Predicted direction, perturbed by a small attitude error as B + B x Theta
+    const Vector3 Predicted = mAttitude.Rotate(Reference);
+    const VectorN<3> Measurement{.Data = {Measured.X, Measured.Y, Measured.Z}};
+    const MatrixN<3, 3> Noise = MatrixN<3, 3>::IDENTITY() * Square(Sigma);
+
+    const UpdateStatus Status = mFilter.Update(Measurement, Noise, [&Predicted](const VectorN<6>& Error, MatrixN<3, 6>& Jacobian)
+    {
+        SetSkew(Jacobian, 0, 0, Predicted);
+        return VectorN<3>{.Data = {Predicted.X, Predicted.Y, Predicted.Z}} + Jacobian * Error;
+    }, Gate);
+
+    if (Status == UpdateStatus::ACCEPTED)
+    {
+        Reset();
+    }
+
+    return Status;
+}
+
+Navigation::UpdateStatus Navigation::AttitudeFilter::UpdateAttitude(const Quaternion& Measured, double Sigma, double Gate) noexcept
+{
+    // Small rotation from the estimated to the measured attitude, of the shorter direction
+    Quaternion Difference = mAttitude.Inverse() * Measured.Unit();
+
+    if (Difference.S < 0.0)
+    {
+        Difference = -Difference;
+    }
+
+    const VectorN<3> Measurement{.Data = {2.0 * Difference.X, 2.0 * Difference.Y, 2.0 * Difference.Z}};
+    const MatrixN<3, 3> Noise = MatrixN<3, 3>::IDENTITY() * Square(Sigma);
+
+    const UpdateStatus Status = mFilter.Update(Measurement, Noise, [](const VectorN<6>& Error, MatrixN<3, 6>& Jacobian)
+    {
+        Jacobian.SetBlock(0, 0, MatrixN<3, 3>::IDENTITY());
+        return Error.Block<3, 1>(0, 0);
+    }, Gate);
+
+    if (Status == UpdateStatus::ACCEPTED)
+    {
+        Reset();
+    }
+
+    return Status;
+}
+
+void Navigation::AttitudeFilter::Reset(void) noexcept
+{
+    const VectorN<6>& Error = mFilter.GetState();
+    const Quaternion Correction{.X = 0.5 * Error[0], .Y = 0.5 * Error[1], .Z = 0.5 * Error[2], .S = 1.0};
+
+    mAttitude = (mAttitude * Correction).Unit();
+    mBias = mBias + Vector3({Error[3], Error[4], Error[5]});
+    mFilter.SetState(VectorN<6>{});
+}
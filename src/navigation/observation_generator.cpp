@@ -0,0 +1,276 @@
+#include "navigation/observation_generator.hpp"
+#include "coordinates/earth.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/random.hpp"
+#include "utils/errors.hpp"
+
+#include <cstring>
+
+namespace
+{
+    constexpr char MAGIC[4] = {'H', 'O', 'B', 'S'};
+    constexpr uint32_t VERSION = 1;
+
+    // Target, station and time combinations evaluated in sequence by each thread
+    constexpr size_t SLOT_GRAIN = 64;
+
+    /**
+     * Rotation of the Earth, in the inertial frame
+     */
+    const Vector3 EARTH_ROTATION = Vector3::UNIT_Z() * Earth::ROTATIONAL_RATE;
+
+    /**
+     * Whether a state is the default left by a trajectory source for a time it could not evaluate
+     */
+    bool IsDefault(const EphemerisState& State) noexcept
+    {
+        return (State.Pos == Vector3::ZERO()) && (State.Vel == Vector3::ZERO()) && (State.LightTime == 0.0);
+    }
+}
+
+Navigation::ObservationWriter::ObservationWriter(const std::string& Path) : mFile(Path, std::ios::binary | std::ios::trunc)
+{
+    const uint32_t Header[2] = {VERSION, static_cast<uint32_t>(sizeof(ObservationRecord))};
+    mFile.write(MAGIC, sizeof(MAGIC));
+    mFile.write(reinterpret_cast<const char*>(Header), sizeof(Header));
+
+    if (mFile.good() == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Observation file could not be written");
+    }
+}
+
+void Navigation::ObservationWriter::Write(std::span<const ObservationRecord> Records)
+{
+    mFile.write(reinterpret_cast<const char*>(Records.data()), static_cast<std::streamsize>(Records.size_bytes()));
+
+    if (mFile.good() == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Observation file could not be written");
+    }
+
+    mRecords += Records.size();
+}
+
+void Navigation::ObservationWriter::Close(void)
+{
+    if (mFile.is_open() == false)
+    {
+        return;
+    }
+
+    mFile.close();
+
+    if (mFile.fail() == true)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Observation file could not be written");
+    }
+}
+
+Navigation::ObservationReader::ObservationReader(const std::string& Path) : mFile(Path, std::ios::binary)
+{
+    if (mFile.is_open() == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Observation file could not be opened");
+    }
+
+    char Magic[sizeof(MAGIC)] = {};
+    uint32_t Header[2] = {};
+    mFile.read(Magic, sizeof(Magic));
+    mFile.read(reinterpret_cast<char*>(Header), sizeof(Header));
+
+    if ((mFile.good() == false) || (std::memcmp(Magic, MAGIC, sizeof(MAGIC)) != 0))
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "File is not an observation stream");
+    }
+
+    if ((Header[0] != VERSION) || (Header[1] != sizeof(ObservationRecord)))
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Unsupported observation file version");
+    }
+}
+
+size_t Navigation::ObservationReader::Read(std::span<ObservationRecord> Records)
+{
+    mFile.read(reinterpret_cast<char*>(Records.data()), static_cast<std::streamsize>(Records.size_bytes()));
+    const size_t Bytes = static_cast<size_t>(mFile.gcount());
+
+    if (Bytes % sizeof(ObservationRecord) != 0)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Observation file is truncated");
+    }
+
+    return Bytes / sizeof(ObservationRecord);
+}
+
+Navigation::ObservationGenerator::ObservationGenerator(const GeneratorSettings& Settings) : mSettings(Settings)
+{
+    if (((mSettings.Interval > 0.0) == false) || (mSettings.BatchEpochs == 0))
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Observation interval and batch size must be positive");
+    }
+}
+
+size_t Navigation::ObservationGenerator::AddStation(const GroundStation& Station)
+{
+    mStations.push_back(StationGeometry{
+        .Station = Station,
+        .Position = Earth::LLA2ECEF(Station.Location, Earth::WGS84RadiiComponents(D2R(Station.Location.Lat))),
+        .FixedToENU = Earth::QuatECEF2ENU(Station.Location)
+    });
+
+    return mStations.size() - 1;
+}
+
+size_t Navigation::ObservationGenerator::AddTarget(const Ephemeris& Target)
+{
+    mTargets.push_back(&Target);
+    return mTargets.size() - 1;
+}
+
+uint64_t Navigation::ObservationGenerator::Generate(ThreadPool& Pool, ObservationWriter& Writer)
+{
+    if ((mSettings.End < mSettings.Start) || (mTargets.empty() == true) || (mStations.empty() == true))
+    {
+        return 0;
+    }
+
+    const size_t Epochs = static_cast<size_t>(Floor((mSettings.End - mSettings.Start) / mSettings.Interval)) + 1;
+    const size_t Batch = mSettings.BatchEpochs;
+    const size_t Targets = mTargets.size();
+    const size_t Stations = mStations.size();
+    const size_t Types = mSettings.Types.size();
+
+    // Storage of one batch, reused by every batch
+    std::vector<double> Times(Batch);
+    std::vector<EphemerisState> States(Batch * Targets);
+    std::vector<uint8_t> Evaluated(Batch * Targets);
+    std::vector<ObservationRecord> Candidates(Batch * Targets * Stations * Types);
+    std::vector<size_t> Counts(Batch * Targets * Stations);
+    std::vector<ObservationRecord> Visible{};
+    Visible.reserve(Candidates.size());
+
+    uint64_t Generated = 0;
+    mSkipped = 0;
+
+    for (size_t First = 0; First < Epochs; First += Batch)
+    {
+        const size_t Count = Min(Batch, Epochs - First);
+
+        for (size_t Epoch = 0; Epoch < Count; Epoch++)
+        {
+            Times[Epoch] = mSettings.Start + mSettings.Interval * static_cast<double>(First + Epoch);
+        }
+
+        // Trajectory sources are evaluated in ascending batches, which backends may exploit
+        for (size_t Target = 0; Target < Targets; Target++)
+        {
+            const std::span<EphemerisState> Out = std::span(States).subspan(Target * Batch, Count);
+            const bool Complete = mTargets[Target]->GetStates(std::span<const double>(Times).first(Count), Out);
+
+            // Times which could not be evaluated are left as the default state, and are not observed
+            for (size_t Epoch = 0; Epoch < Count; Epoch++)
+            {
+                Evaluated[Target * Batch + Epoch] = ((Complete == true) || (IsDefault(Out[Epoch]) == false)) ? 1 : 0;
+                mSkipped += (Evaluated[Target * Batch + Epoch] == 0) ? 1u : 0u;
+            }
+        }
+
+        Pool.ParallelFor(Count * Targets * Stations, SLOT_GRAIN, [&](size_t Slot)
+        {
+            const size_t Epoch = Slot / (Targets * Stations);
+            const size_t Target = (Slot / Stations) % Targets;
+            const size_t Station = Slot % Stations;
+
+            if (Evaluated[Target * Batch + Epoch] == 0)
+            {
+                Counts[Slot] = 0;
+                return;
+            }
+
+            Counts[Slot] = EvaluateSlot(Target, Station, static_cast<uint32_t>(First + Epoch), Times[Epoch], States[Target * Batch + Epoch],
+                &Candidates[Slot * Types]);
+        });
+
+        Visible.clear();
+
+        for (size_t Slot = 0; Slot < Count * Targets * Stations; Slot++)
+        {
+            Visible.insert(Visible.end(), Candidates.begin() + static_cast<std::ptrdiff_t>(Slot * Types),
+                Candidates.begin() + static_cast<std::ptrdiff_t>(Slot * Types + Counts[Slot]));
+        }
+
+        Writer.Write(Visible);
+        Generated += Visible.size();
+    }
+
+    return Generated;
+}
+
+size_t Navigation::ObservationGenerator::EvaluateSlot(size_t Target, size_t Station, uint32_t Epoch, double Time, const EphemerisState& State,
+    ObservationRecord* Out) const noexcept
+{
+    const StationGeometry& Geometry = mStations[Station];
+
+    // Target relative to the station in the Earth fixed frame, in which the station is stationary
+    const Quaternion InertialToFixed = Earth::ECI2ECEF(Time);
+    const Vector3 Position = InertialToFixed.Rotate(State.Pos);
+    const Spherical Look = CalculateLTPRange(Geometry.Position, Position, Geometry.FixedToENU);
+
+    if (Look.Inc < Geometry.Station.MinElevation)
+    {
+        return 0;
+    }
+
+    const Vector3 Velocity = InertialToFixed.Rotate(State.Vel - EARTH_ROTATION.Cross(State.Pos));
+    const double RangeRate = (Position - Geometry.Position).Dot(Velocity) / Look.Rad;
+    const size_t StreamId = Target * mStations.size() + Station;
+
+    for (size_t Index = 0; Index < mSettings.Types.size(); Index++)
+    {
+        const ObservationType Type = mSettings.Types[Index];
+        const double Sigma = Geometry.Station.Sigmas[static_cast<size_t>(Type)];
+        double Value = 0.0;
+
+        switch (Type)
+        {
+            case ObservationType::RANGE:        Value = Look.Rad; break;
+            case ObservationType::RANGE_RATE:   Value = RangeRate; break;
+            case ObservationType::AZIMUTH:      Value = Look.Azm; break;
+            case ObservationType::ELEVATION:    Value = Look.Inc; break;
+            case ObservationType::DOPPLER:      Value = -RangeRate / SPEED_LIGHT; break;
+        }
+
+        // Noise depends only upon the seed, target, station, type and time
+        Random::Stream Noise(mSettings.Seed, StreamId, static_cast<uint32_t>(Type));
+        Noise.Seek(Epoch);
+
+        Out[Index] = ObservationRecord{
+            .Time = Time,
+            .Value = Value + Noise.Normal(0.0, Sigma),
+            .Sigma = Sigma,
+            .Target = static_cast<uint32_t>(Target),
+            .Station = static_cast<uint32_t>(Station),
+            .Type = Type
+        };
+    }
+
+    return mSettings.Types.size();
+}
+
+Navigation::Observation Navigation::ObservationGenerator::MakeObservation(const ObservationRecord& Record) const noexcept
+{
+    const StationGeometry& Geometry = mStations[Record.Station];
+    const Quaternion InertialToFixed = Earth::ECI2ECEF(Record.Time);
+    const Vector3 Position = InertialToFixed.RotateInv(Geometry.Position);
+
+    return Observation{
+        .Time = Record.Time,
+        .Type = Record.Type,
+        .Value = Record.Value,
+        .Sigma = Record.Sigma,
+        .StationPosition = Position,
+        .StationVelocity = EARTH_ROTATION.Cross(Position),
+        .InertialToENU = InertialToFixed * Geometry.FixedToENU
+    };
+}
@@ -0,0 +1,227 @@
+#include "navigation/orbit_determination.hpp"
+#include "coordinates/general.hpp"
+#include "math/constants.hpp"
+#include "concurrency/thread_pool.hpp"
+
+namespace
+{
+    constexpr size_t DIMENSION = 6;
+
+    // Groups of observations evaluated in sequence by each thread, and accumulated together
+    constexpr size_t GROUP_GRAIN = 64;
+
+    // Cosine of the elevation below which an object is at the zenith, where the azimuth is
+    // undefined and neither angle is differentiable
+    constexpr double ZENITH_TOLERANCE = 1.0E-4;
+
+    /**
+     * Sets the partial derivatives of a measurement with respect to the position and velocity
+     */
+    void SetPartials(MatrixN<1, 6>& Partials, const Vector3& Position, const Vector3& Velocity) noexcept
+    {
+        Partials = MatrixN<1, 6>{.Data = {Position.X, Position.Y, Position.Z, Velocity.X, Velocity.Y, Velocity.Z}};
+    }
+}
+
+size_t Navigation::OrbitDetermination::Add(const Observation& Measurement)
+{
+    if ((mObservations.empty() == true) || (mObservations.back().Time != Measurement.Time))
+    {
+        mGroups.push_back(mObservations.size());
+    }
+
+    mObservations.push_back(Measurement);
+    mResiduals.push_back(0.0);
+    mEdited.push_back(0);
+    return mObservations.size() - 1;
+}
+
+void Navigation::OrbitDetermination::Reserve(size_t Capacity)
+{
+    mObservations.reserve(Capacity);
+    mResiduals.reserve(Capacity);
+    mEdited.reserve(Capacity);
+}
+
+double Navigation::OrbitDetermination::Evaluate(const Observation& Measurement, const TwoBody::StateVector& State, MatrixN<1, 6>& Partials) noexcept
+{
+    const Vector3 Position = Vector3({State[0], State[1], State[2]});
+    const Vector3 Relative = Position - Measurement.StationPosition;
+    const Vector3 RelativeVelocity = Vector3({State[3], State[4], State[5]}) - Measurement.StationVelocity;
+    const double Range = Relative.Norm();
+    const Vector3 LineOfSight = Relative / Range;
+
+    if (Measurement.Type == ObservationType::RANGE)
+    {
+        SetPartials(Partials, LineOfSight, Vector3::ZERO());
+        return Range;
+    }
+
+    if (Measurement.Type == ObservationType::RANGE_RATE)
+    {
+        const double RangeRate = LineOfSight.Dot(RelativeVelocity);
+        SetPartials(Partials, (RelativeVelocity - LineOfSight * RangeRate) / Range, LineOfSight);
+        return RangeRate;
+    }
+
+    if (Measurement.Type == ObservationType::DOPPLER)
+    {
+        const double RangeRate = LineOfSight.Dot(RelativeVelocity);
+        SetPartials(Partials, (RelativeVelocity - LineOfSight * RangeRate) / (-SPEED_LIGHT * Range), LineOfSight / -SPEED_LIGHT);
+        return -RangeRate / SPEED_LIGHT;
+    }
+
+    // Angles in the local tangent plane, differentiated in the plane then rotated back
+    const Spherical Look = CalculateLTPRange(Measurement.StationPosition, Position, Measurement.InertialToENU);
+    const Vector3 Local = Measurement.InertialToENU.Rotate(Relative);
+    const double Horizontal2 = Square(Local.X) + Square(Local.Y);
+
+    if (Horizontal2 < Square(ZENITH_TOLERANCE * Range))
+    {
+        Partials = MatrixN<1, 6>{};
+        return (Measurement.Type == ObservationType::AZIMUTH) ? Look.Azm : Look.Inc;
+    }
+
+    if (Measurement.Type == ObservationType::AZIMUTH)
+    {
+        const Vector3 Gradient = Vector3({-Local.Y, Local.X, 0.0}) / Horizontal2;
+        SetPartials(Partials, Measurement.InertialToENU.RotateInv(Gradient), Vector3::ZERO());
+        return Look.Azm;
+    }
+
+    const Vector3 Gradient = Vector3({-Local.X * Local.Z, -Local.Y * Local.Z, Horizontal2}) / (Square(Range) * Sqrt(Horizontal2));
+    SetPartials(Partials, Measurement.InertialToENU.RotateInv(Gradient), Vector3::ZERO());
+    return Look.Inc;
+}
+
+void Navigation::OrbitDetermination::EvaluateGroup(size_t Group, const TwoBody::StateVector& Epoch, double Threshold, Accumulator& Sums) noexcept
+{
+    const size_t Begin = mGroups[Group];
+    const size_t End = (Group + 1 < mGroups.size()) ? mGroups[Group + 1] : mObservations.size();
+    const double Time = mObservations[Begin].Time;
+
+    const TwoBody::StateVector State = TwoBody::Propagate(Epoch, mGravitationalParameter, Time);
+    const MatrixN<6, 6> Transition = TwoBody::StateTransition(Epoch, mGravitationalParameter, Time);
+
+    for (size_t Index = Begin; Index < End; Index++)
+    {
+        const Observation& Measurement = mObservations[Index];
+
+        MatrixN<1, 6> Partials{};
+        double Residual = Measurement.Value - Evaluate(Measurement, State, Partials);
+
+        if (Measurement.Type == ObservationType::AZIMUTH)
+        {
+            Residual -= 2.0 * PI * Floor((Residual + PI) / (2.0 * PI));
+        }
+
+        mResiduals[Index] = Residual;
+
+        const double Weighted = Residual / Measurement.Sigma;
+
+        // Observations without partials, the angles at the zenith, carry no information
+        if ((Abs(Weighted) > Threshold) || (Partials == MatrixN<1, 6>{}))
+        {
+            mEdited[Index] = 1;
+            Sums.Edited++;
+            continue;
+        }
+
+        mEdited[Index] = 0;
+
+        // Partials with respect to the state at the epoch, scaled by the noise
+        const MatrixN<1, 6> Row = (Partials * Transition) / Measurement.Sigma;
+
+        for (size_t I = 0; I < DIMENSION; I++)
+        {
+            for (size_t J = 0; J < DIMENSION; J++)
+            {
+                Sums.Normal(I, J) += Row[I] * Row[J];
+            }
+
+            Sums.Information[I] += Row[I] * Weighted;
+        }
+
+        Sums.SquaredResiduals += Square(Weighted);
+        Sums.Accepted++;
+    }
+}
+
+Navigation::FitResult Navigation::OrbitDetermination::Solve(ThreadPool& Pool, const TwoBody::StateVector& InitialState, const FitSettings& Settings)
+{
+    FitResult Result{.State = InitialState};
+
+    if (mObservations.size() < DIMENSION)
+    {
+        return Result;
+    }
+
+    TwoBody::StateVector Estimate = InitialState;
+    double PreviousRMS = 0.0;
+
+    for (size_t Iteration = 1; Iteration <= Settings.MaxIterations; Iteration++)
+    {
+        const double Threshold = (Iteration == 1) ? Settings.InitialEdit : Settings.EditMultiplier * Max(PreviousRMS, 1.0);
+
+        const Accumulator Sums = Pool.ParallelReduce(mGroups.size(), GROUP_GRAIN, Accumulator{},
+            [&](size_t Begin, size_t End)
+            {
+                Accumulator Chunk{};
+
+                for (size_t Group = Begin; Group < End; Group++)
+                {
+                    EvaluateGroup(Group, Estimate, Threshold, Chunk);
+                }
+
+                return Chunk;
+            },
+            [](const Accumulator& A, const Accumulator& B)
+            {
+                return Accumulator{
+                    .Normal = A.Normal + B.Normal,
+                    .Information = A.Information + B.Information,
+                    .SquaredResiduals = A.SquaredResiduals + B.SquaredResiduals,
+                    .Accepted = A.Accepted + B.Accepted,
+                    .Edited = A.Edited + B.Edited
+                };
+            });
+
+        Result.Iterations = Iteration;
+        Result.Accepted = Sums.Accepted;
+        Result.Edited = Sums.Edited;
+
+        if (Sums.Accepted < DIMENSION)
+        {
+            Result.Status = FitStatus::INSUFFICIENT_OBSERVATIONS;
+            return Result;
+        }
+
+        VectorN<6> Correction{};
+        MatrixN<6, 6> Covariance{};
+
+        if ((Sums.Normal.SolveSymmetric(Sums.Information, Correction) == false) ||
+            (Sums.Normal.SolveSymmetric(MatrixN<6, 6>::IDENTITY(), Covariance) == false))
+        {
+            Result.Status = FitStatus::SINGULAR;
+            return Result;
+        }
+
+        const double RMS = Sqrt(Sums.SquaredResiduals / static_cast<double>(Sums.Accepted));
+
+        Estimate = Estimate + Correction;
+        Result.State = Estimate;
+        Result.Covariance = Covariance.Symmetric();
+        Result.WeightedRMS = RMS;
+
+        if ((Iteration > 1) && (Abs(RMS - PreviousRMS) <= Settings.Tolerance * Max(RMS, 1.0)))
+        {
+            Result.Status = FitStatus::CONVERGED;
+            return Result;
+        }
+
+        PreviousRMS = RMS;
+    }
+
+    Result.Status = FitStatus::MAX_ITERATIONS;
+    return Result;
+}
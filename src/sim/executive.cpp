@@ -0,0 +1,311 @@
+#include "sim/executive.hpp"
+
+#include "math/core_math.hpp"
+#include "utils/errors.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <string>
+
+namespace
+{
+    /**
+     * @return Number of dependencies declared by a set of components
+     */
+    size_t CountDependencies(std::span<Component* const> Components) noexcept
+    {
+        size_t Count = 0;
+
+        for (const Component* Member : Components)
+        {
+            Count += Member->GetDependencies().size();
+        }
+
+        return Count;
+    }
+
+    // Largest supported major frame (base frames), bounds the size of the static schedule
+    constexpr uint64_t MAX_MAJOR_FRAME = uint64_t(1) << 20;
+
+    // Relative tolerance on a component rate being an integer divisor of the base rate
+    constexpr double RATE_TOLERANCE = 1.0E-9;
+
+    // Executes a level on the pool when given, otherwise on the calling thread
+    template <typename Func>
+    void ExecuteUpdates(ThreadPool* Pool, size_t Count, const Func& Body)
+    {
+        if (Pool != nullptr)
+        {
+            Pool->ParallelFor(Count, Body);
+            return;
+        }
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            Body(Index);
+        }
+    }
+}
+
+Executive::Executive(double BaseRate, size_t Workers) :
+    mBaseRate{BaseRate},
+    mPool{(Workers > 0) ? std::make_unique<ThreadPool>(Workers) : nullptr}
+{
+
+}
+
+void Executive::Add(Component& Member)
+{
+    mComponents.push_back(&Member);
+    mBuilt = false;
+}
+
+void Executive::Build(void)
+{
+    mBuilt = false;
+    mSchedule.clear();
+    mLevels.clear();
+    mFrames.clear();
+
+    std::map<std::string, size_t> Names;
+    std::map<const Component*, size_t> Indices;
+
+    for (size_t Index = 0; Index < mComponents.size(); Index++)
+    {
+        Component& Member = *mComponents[Index];
+
+        if (Names.emplace(Member.mName, Index).second == false)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Component names must be unique");
+        }
+
+        Indices.emplace(&Member, Index);
+
+        // Rate groups must be integer multiples of the base frame
+        const double Ratio = mBaseRate / Member.mRate;
+        const double Divisor = std::round(Ratio);
+
+        if ((std::isfinite(Ratio) == false) || (Divisor < 1.0) || (Abs(Ratio - Divisor) > RATE_TOLERANCE * Ratio) ||
+            (Divisor > static_cast<double>(MAX_MAJOR_FRAME)))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Component rate is not an integer divisor of the base rate");
+        }
+
+        Member.mDivisor = static_cast<uint32_t>(Divisor);
+    }
+
+    // Level of each component is one greater than the deepest of its dependencies
+    std::vector<size_t> Levels(mComponents.size(), 0);
+    std::vector<uint8_t> Visited(mComponents.size(), 0);
+
+    std::function<size_t(size_t)> Visit = [&](size_t Index) -> size_t
+    {
+        if (Visited[Index] == 2)
+        {
+            return Levels[Index];
+        }
+
+        if (Visited[Index] == 1)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Component dependencies are cyclic");
+        }
+
+        Visited[Index] = 1;
+        size_t Level = 0;
+
+        for (const Component* Dependency : mComponents[Index]->mDependencies)
+        {
+            const auto Found = Indices.find(Dependency);
+
+            if (Found == Indices.end())
+            {
+                throw Error::GenericException(__FILE__, __LINE__, "Component dependency has not been added to the executive");
+            }
+
+            Level = Max(Level, Visit(Found->second) + 1);
+        }
+
+        Visited[Index] = 2;
+        Levels[Index] = Level;
+        return Level;
+    };
+
+    uint64_t MajorFrame = 1;
+    size_t LevelCount = 0;
+
+    for (size_t Index = 0; Index < mComponents.size(); Index++)
+    {
+        LevelCount = Max(LevelCount, Visit(Index) + 1);
+        MajorFrame = std::lcm(MajorFrame, uint64_t(mComponents[Index]->mDivisor));
+
+        if (MajorFrame > MAX_MAJOR_FRAME)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Major frame is too long, rates share too few common factors");
+        }
+    }
+
+    // Components of each level in the order they were added
+    std::vector<std::vector<Component*>> ByLevel(LevelCount);
+
+    for (size_t Index = 0; Index < mComponents.size(); Index++)
+    {
+        ByLevel[Levels[Index]].push_back(mComponents[Index]);
+    }
+
+    for (uint64_t Frame = 0; Frame < MajorFrame; Frame++)
+    {
+        const size_t FirstLevel = mLevels.size();
+
+        for (const std::vector<Component*>& Level : ByLevel)
+        {
+            const size_t Begin = mSchedule.size();
+
+            for (Component* Member : Level)
+            {
+                if (Frame % Member->mDivisor == 0)
+                {
+                    mSchedule.push_back(Member);
+                }
+            }
+
+            if (mSchedule.size() > Begin)
+            {
+                mLevels.push_back(Range{.Begin = Begin, .End = mSchedule.size()});
+            }
+        }
+
+        mFrames.push_back(Range{.Begin = FirstLevel, .End = mLevels.size()});
+    }
+
+    mDurations.assign(mSchedule.size(), 0);
+
+    for (const std::vector<Component*>& Level : ByLevel)
+    {
+        for (Component* Member : Level)
+        {
+            Member->Initialise();
+        }
+    }
+
+    // Telemetry of every component is reachable through the executive
+    std::map<HString, const Indexable*> Telemetry;
+
+    for (const Component* Member : mComponents)
+    {
+        if (Member->GetDynamicIndexMap() != nullptr)
+        {
+            Telemetry.emplace(HString(Member->mName), Member->GetDynamicIndexMap());
+        }
+    }
+
+    mDynamicIndex = std::make_unique<Indexable>(IndexMap{
+        .PtrMapIndexable = Telemetry,
+        .PtrMapDouble = {{"Time", &mTime}}
+    });
+
+    mDependencies = CountDependencies(mComponents);
+    mFrame = 0;
+    mTime = 0.0;
+    mBuilt = true;
+}
+
+bool Executive::IsBuilt(void) const noexcept
+{
+    return (mBuilt == true) && (CountDependencies(mComponents) == mDependencies);
+}
+
+void Executive::Step(void)
+{
+    if (IsBuilt() == false)
+    {
+        Build();
+    }
+
+    const Range& Frame = mFrames[mFrame % mFrames.size()];
+
+    for (size_t Level = Frame.Begin; Level < Frame.End; Level++)
+    {
+        ExecuteLevel(mLevels[Level]);
+    }
+
+    // Derived from the frame count rather than accumulated, to avoid drift
+    mFrame++;
+    mTime = static_cast<double>(mFrame) / mBaseRate;
+}
+
+void Executive::Run(uint64_t Frames)
+{
+    for (uint64_t Frame = 0; Frame < Frames; Frame++)
+    {
+        Step();
+    }
+}
+
+std::span<const Executive::Range> Executive::GetLevels(size_t Frame) const noexcept
+{
+    const Range& Levels = mFrames[Frame];
+    return std::span<const Range>(mLevels.data() + Levels.Begin, Levels.End - Levels.Begin);
+}
+
+std::span<Component* const> Executive::GetComponents(const Range& Level) const noexcept
+{
+    return std::span<Component* const>(mSchedule.data() + Level.Begin, Level.End - Level.Begin);
+}
+
+Executive::Range Executive::GetFrameSchedule(size_t Frame) const noexcept
+{
+    const Range& Levels = mFrames[Frame];
+
+    if (Levels.Begin == Levels.End)
+    {
+        return Range{};
+    }
+
+    // Levels of a frame are contiguous in the schedule
+    return Range{.Begin = mLevels[Levels.Begin].Begin, .End = mLevels[Levels.End - 1].End};
+}
+
+void Executive::ExecuteLevel(const Range& Level)
+{
+    Component* const* Members = mSchedule.data() + Level.Begin;
+    const size_t Count = Level.End - Level.Begin;
+    const double Time = mTime;
+
+    const auto Update = [&](size_t Index)
+    {
+        Component* Member = Members[Index];
+        Member->Update(Time, static_cast<double>(Member->mDivisor) / mBaseRate);
+    };
+
+    const auto ProfiledUpdate = [&](size_t Index)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const Clock::time_point Start = Clock::now();
+        Update(Index);
+        mDurations[Level.Begin + Index] = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Start).count();
+    };
+
+    ThreadPool* Pool = (Count >= mParallelThreshold) ? mPool.get() : nullptr;
+
+    if (mProfiling == true)
+    {
+        ExecuteUpdates(Pool, Count, ProfiledUpdate);
+    }
+    else
+    {
+        ExecuteUpdates(Pool, Count, Update);
+    }
+
+    // Every update of the level has completed, publish their outputs together
+    for (size_t Index = 0; Index < Count; Index++)
+    {
+        for (SignalBase* Output : Members[Index]->mOutputs)
+        {
+            Output->Flip();
+        }
+    }
+}
@@ -0,0 +1,161 @@
+#include "sim/monte_carlo.hpp"
+
+#include "utils/errors.hpp"
+
+#include <map>
+
+namespace
+{
+    // Sub-streams of the model are distinct from those of the dispersions
+    constexpr uint32_t MODEL_STREAMS = 0x80000000;
+}
+
+void DispersionSet::AddUniform(const HString& Key, double Min, double Max)
+{
+    if ((Min <= Max) == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Uniform dispersion bounds are reversed");
+    }
+
+    Add(Dispersion{.Key = Key, .Type = DistributionType::UNIFORM, .A = Min, .B = Max});
+}
+
+void DispersionSet::AddNormal(const HString& Key, double Mean, double Sigma)
+{
+    if ((Sigma >= 0.0) == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Normal dispersion standard deviation is negative");
+    }
+
+    Add(Dispersion{.Key = Key, .Type = DistributionType::NORMAL, .A = Mean, .B = Sigma});
+}
+
+void DispersionSet::AddNormal(const HString& Key, const Indexable& Nominal, double Sigma)
+{
+    const double* Mean = Nominal.GetPtrDouble(Key);
+
+    if (Mean == nullptr)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Dispersed parameter is not indexed by the nominal object");
+    }
+
+    AddNormal(Key, *Mean, Sigma);
+}
+
+size_t DispersionSet::Find(const HString& Key) const
+{
+    for (size_t Index = 0; Index < mDispersions.size(); Index++)
+    {
+        if (mDispersions[Index].Key == Key)
+        {
+            return Index;
+        }
+    }
+
+    throw Error::GenericException(__FILE__, __LINE__, "Parameter is not dispersed");
+}
+
+double DispersionSet::Sample(uint64_t Seed, uint64_t Case, size_t Parameter) const noexcept
+{
+    const Dispersion& Parameters = mDispersions[Parameter];
+    Random::Stream Samples(Seed, Case, static_cast<uint32_t>(Parameter));
+
+    switch (Parameters.Type)
+    {
+        case DistributionType::UNIFORM:
+            return Samples.Uniform(Parameters.A, Parameters.B);
+        case DistributionType::NORMAL:
+            return Samples.Normal(Parameters.A, Parameters.B);
+    }
+
+    return Parameters.A;
+}
+
+void DispersionSet::Add(const Dispersion& Parameter)
+{
+    for (const Dispersion& Existing : mDispersions)
+    {
+        if (Existing.Key == Parameter.Key)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Parameter is already dispersed");
+        }
+    }
+
+    if (mDispersions.size() >= MODEL_STREAMS)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Too many dispersed parameters");
+    }
+
+    mDispersions.push_back(Parameter);
+}
+
+MonteCarloCase::MonteCarloCase(const DispersionSet& Dispersions, uint64_t Seed) :
+    mDispersions{Dispersions},
+    mSeed{Seed},
+    mSamples(Dispersions.Size(), 0.0)
+{
+    std::map<HString, const double*> Samples;
+
+    for (size_t Parameter = 0; Parameter < mSamples.size(); Parameter++)
+    {
+        Samples.emplace(Dispersions.GetDispersions()[Parameter].Key, &mSamples[Parameter]);
+    }
+
+    mDynamicIndex = std::make_unique<Indexable>(IndexMap{.PtrMapDouble = Samples});
+}
+
+void MonteCarloCase::Reset(uint64_t Index) noexcept
+{
+    mIndex = Index;
+
+    for (size_t Parameter = 0; Parameter < mSamples.size(); Parameter++)
+    {
+        mSamples[Parameter] = mDispersions.Sample(mSeed, Index, Parameter);
+    }
+}
+
+double MonteCarloCase::Get(const HString& Key) const
+{
+    return mSamples[mDispersions.Find(Key)];
+}
+
+Random::Stream MonteCarloCase::GetStream(uint32_t Sub) const noexcept
+{
+    return Random::Stream(mSeed, mIndex, MODEL_STREAMS | Sub);
+}
+
+const Statistics::Accumulator& MonteCarloResult::Get(const HString& Output) const
+{
+    for (size_t Index = 0; Index < Outputs.size(); Index++)
+    {
+        if (Outputs[Index] == Output)
+        {
+            return Statistics[Index];
+        }
+    }
+
+    throw Error::GenericException(__FILE__, __LINE__, "Monte Carlo output does not exist");
+}
+
+MonteCarlo::MonteCarlo(const DispersionSet& Dispersions, const std::vector<HString>& Outputs, const MonteCarloOptions& Options) :
+    mDispersions{Dispersions},
+    mOutputs(Outputs),
+    mOptions{Options}
+{
+    if (Options.ChunkSize == 0)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Monte Carlo chunk size must be positive");
+    }
+}
+
+MonteCarloResult MonteCarlo::Reduce(const std::vector<Statistics::Accumulator>& Partial) const
+{
+    MonteCarloResult Result{.Outputs = mOutputs, .Statistics = std::vector<Statistics::Accumulator>(mOutputs.size())};
+
+    for (size_t Index = 0; Index < Partial.size(); Index++)
+    {
+        Result.Statistics[Index % mOutputs.size()].Merge(Partial[Index]);
+    }
+
+    return Result;
+}
@@ -0,0 +1,324 @@
+#include "sim/real_time.hpp"
+
+#include "concurrency/affinity.hpp"
+#include "math/core_math.hpp"
+
+#include <map>
+#include <thread>
+
+#if !defined(_WIN32) && !defined(WIN32) && !defined(__CYGWIN__)
+    #include <sys/mman.h>
+#endif
+
+namespace
+{
+    // Stack touched by each level of the prefault recursion
+    constexpr size_t PREFAULT_PAGE = 4096;
+
+    /**
+     * Touches a region of stack below the caller, one page per level of recursion
+     */
+    void PrefaultStack(size_t Bytes) noexcept
+    {
+        volatile uint8_t Page[PREFAULT_PAGE];
+        Page[0] = 0;
+        Page[PREFAULT_PAGE - 1] = 0;
+
+        if (Bytes > PREFAULT_PAGE)
+        {
+            PrefaultStack(Bytes - PREFAULT_PAGE);
+        }
+
+        // Use of the page after the call prevents the recursion becoming a loop
+        Page[0] = Page[PREFAULT_PAGE - 1];
+    }
+
+    /**
+     * Locks current and future pages of the process into memory
+     * @return True if locked, false if unsupported or not permitted
+     */
+    bool LockMemory(void) noexcept
+    {
+#if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__)
+        // Windows only supports locking explicit ranges within the working set
+        return false;
+#else
+        return mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+#endif
+    }
+
+    /**
+     * Unlocks every page of the process
+     */
+    void UnlockMemory(void) noexcept
+    {
+#if !defined(_WIN32) && !defined(WIN32) && !defined(__CYGWIN__)
+        munlockall();
+#endif
+    }
+
+    /**
+     * Publishes the statistics of a histogram (ns) in seconds
+     */
+    void Summarise(const LatencyHistogram& Histogram, LatencyStatistics& Statistics) noexcept
+    {
+        Statistics.Count = static_cast<int>(Histogram.Count());
+        Statistics.Mean = Histogram.Mean() * 1.0E-9;
+        Statistics.P50 = static_cast<double>(Histogram.Percentile(0.5)) * 1.0E-9;
+        Statistics.P99 = static_cast<double>(Histogram.Percentile(0.99)) * 1.0E-9;
+        Statistics.P999 = static_cast<double>(Histogram.Percentile(0.999)) * 1.0E-9;
+        Statistics.Max = static_cast<double>(Histogram.Max()) * 1.0E-9;
+    }
+
+    /**
+     * @return Dynamic index of published latency statistics
+     */
+    std::unique_ptr<Indexable> MakeStatisticsIndex(const LatencyStatistics& Statistics)
+    {
+        return std::make_unique<Indexable>(IndexMap{
+            .PtrMapInt = {{"Count", &Statistics.Count}},
+            .PtrMapDouble = {
+                {"Mean", &Statistics.Mean},
+                {"P50", &Statistics.P50},
+                {"P99", &Statistics.P99},
+                {"P999", &Statistics.P999},
+                {"Max", &Statistics.Max}
+            }
+        });
+    }
+}
+
+RealTimeRunner::RealTimeRunner(Executive& Exec, const RealTimeOptions& Options) :
+    mExecutive{Exec},
+    mOptions{Options}
+{
+
+}
+
+RealTimeRunner::~RealTimeRunner()
+{
+    if (mMemoryLocked == true)
+    {
+        UnlockMemory();
+    }
+}
+
+void RealTimeRunner::Start(void)
+{
+    if (mExecutive.IsBuilt() == false)
+    {
+        mExecutive.Build();
+    }
+
+    // Pin first, such that locked and prefaulted pages are local to the pinned CPU
+    mPinned = (mOptions.Cpus.empty() == false);
+
+    for (size_t Index = 0; Index < mOptions.Cpus.size(); Index++)
+    {
+        ThreadPool* Pool = mExecutive.GetThreadPool();
+
+        if (Index == 0)
+        {
+            mPinned = PinCurrentThread(mOptions.Cpus[Index]) && mPinned;
+        }
+        else if (Pool != nullptr)
+        {
+            mPinned = Pool->PinWorker(Index - 1, mOptions.Cpus[Index]) && mPinned;
+        }
+    }
+
+    // Restarts keep an existing lock, which is released when the runner is destroyed
+    if ((mOptions.LockMemory == true) && (mMemoryLocked == false))
+    {
+        mMemoryLocked = LockMemory();
+    }
+
+    if (mOptions.PrefaultStack > 0)
+    {
+        PrefaultStack(mOptions.PrefaultStack);
+    }
+
+    // Component index of every scheduled update
+    const std::span<Component* const> Components = mExecutive.GetComponents();
+    std::map<const Component*, size_t> Indices;
+
+    for (size_t Index = 0; Index < Components.size(); Index++)
+    {
+        Indices.emplace(Components[Index], Index);
+    }
+
+    mScheduleComponents.clear();
+
+    for (size_t Frame = 0; Frame < mExecutive.GetMajorFrame(); Frame++)
+    {
+        for (const Executive::Range& Level : mExecutive.GetLevels(Frame))
+        {
+            for (const Component* Member : mExecutive.GetComponents(Level))
+            {
+                mScheduleComponents.push_back(Indices.at(Member));
+            }
+        }
+    }
+
+    // Histograms and telemetry are sized once, allocated after locking so are resident
+    mJitter.Reset();
+    mFrameDurations.Reset();
+    mComponentDurations.assign(Components.size(), LatencyHistogram{});
+    mComponentStatistics.assign(Components.size(), LatencyStatistics{});
+    mJitterStatistics = LatencyStatistics{};
+    mFrameStatistics = LatencyStatistics{};
+    mStatisticsIndices.clear();
+
+    std::map<HString, const Indexable*> ComponentMap;
+
+    for (size_t Index = 0; Index < Components.size(); Index++)
+    {
+        mStatisticsIndices.push_back(MakeStatisticsIndex(mComponentStatistics[Index]));
+        ComponentMap.emplace(HString(Components[Index]->GetName()), mStatisticsIndices.back().get());
+    }
+
+    mStatisticsIndices.push_back(MakeStatisticsIndex(mJitterStatistics));
+    mStatisticsIndices.push_back(MakeStatisticsIndex(mFrameStatistics));
+    mComponentIndex = std::make_unique<Indexable>(IndexMap{.PtrMapIndexable = ComponentMap});
+
+    mDynamicIndex = std::make_unique<Indexable>(IndexMap{
+        .PtrMapIndexable = {
+            {"Jitter", mStatisticsIndices[Components.size()].get()},
+            {"Frame", mStatisticsIndices[Components.size() + 1].get()},
+            {"Components", mComponentIndex.get()},
+            {"Executive", mExecutive.GetDynamicIndexMap()}
+        },
+        .PtrMapInt = {
+            {"Frames", &mFrames},
+            {"Overruns", &mOverruns},
+            {"Skipped", &mSkipped}
+        },
+        .PtrMapBool = {
+            {"MemoryLocked", &mMemoryLocked},
+            {"Pinned", &mPinned}
+        }
+    });
+
+    if (mOptions.PublishInterval == 0)
+    {
+        mOptions.PublishInterval = Max(uint64_t(1), static_cast<uint64_t>(mExecutive.GetBaseRate()));
+    }
+
+    mExecutive.SetProfiling(true);
+
+    mFrameCount = 0;
+    mOverrunCount = 0;
+    mSkippedCount = 0;
+    mReleaseCount = 0;
+    mEpoch = Clock::now();
+    mStarted = true;
+    Publish();
+}
+
+bool RealTimeRunner::Step(void)
+{
+    // A schedule invalidated since the start is rebuilt, restarting the runner with it
+    if ((mStarted == false) || (mExecutive.IsBuilt() == false))
+    {
+        Start();
+    }
+
+    // Releases are derived from the epoch rather than accumulated, to avoid drift
+    const auto ReleaseTime = [&](uint64_t Release)
+    {
+        const std::chrono::duration<double> Offset(static_cast<double>(Release) / mExecutive.GetBaseRate());
+        return mEpoch + std::chrono::duration_cast<Clock::duration>(Offset);
+    };
+
+    const Clock::time_point Release = ReleaseTime(mReleaseCount);
+    const Clock::time_point Deadline = ReleaseTime(mReleaseCount + 1);
+    WaitUntil(Release);
+
+    const Clock::time_point Begin = Clock::now();
+    const size_t Frame = mExecutive.GetFrame() % mExecutive.GetMajorFrame();
+    mExecutive.Step();
+    const Clock::time_point End = Clock::now();
+
+    mJitter.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(Begin - Release).count());
+    mFrameDurations.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Begin).count());
+    RecordComponents(Frame);
+
+    const bool Overrun = (End > Deadline);
+    mFrameCount++;
+    mReleaseCount++;
+
+    if (Overrun == true)
+    {
+        mOverrunCount++;
+
+        // Skip every release that has already passed
+        if (mOptions.Policy == OverrunPolicy::SKIP)
+        {
+            while (ReleaseTime(mReleaseCount) < End)
+            {
+                mReleaseCount++;
+                mSkippedCount++;
+            }
+        }
+    }
+
+    if (mFrameCount % mOptions.PublishInterval == 0)
+    {
+        Publish();
+    }
+
+    return (Overrun == false);
+}
+
+void RealTimeRunner::Run(uint64_t Frames)
+{
+    for (uint64_t Frame = 0; Frame < Frames; Frame++)
+    {
+        Step();
+    }
+
+    Publish();
+}
+
+void RealTimeRunner::Publish(void)
+{
+    mFrames = static_cast<int>(mFrameCount);
+    mOverruns = static_cast<int>(mOverrunCount);
+    mSkipped = static_cast<int>(mSkippedCount);
+
+    Summarise(mJitter, mJitterStatistics);
+    Summarise(mFrameDurations, mFrameStatistics);
+
+    for (size_t Index = 0; Index < mComponentDurations.size(); Index++)
+    {
+        Summarise(mComponentDurations[Index], mComponentStatistics[Index]);
+    }
+}
+
+void RealTimeRunner::WaitUntil(Clock::time_point Release) const noexcept
+{
+    const Clock::duration SpinThreshold = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(mOptions.SpinThreshold));
+
+    // Sleep resolution is coarse, so wake early and spin for the remainder
+    if (Release - Clock::now() > SpinThreshold)
+    {
+        std::this_thread::sleep_until(Release - SpinThreshold);
+    }
+
+    while (Clock::now() < Release)
+    {
+
+    }
+}
+
+void RealTimeRunner::RecordComponents(size_t Frame) noexcept
+{
+    const Executive::Range Schedule = mExecutive.GetFrameSchedule(Frame);
+    const std::span<const int64_t> Durations = mExecutive.GetDurations();
+
+    for (size_t Index = Schedule.Begin; Index < Schedule.End; Index++)
+    {
+        mComponentDurations[mScheduleComponents[Index]].Record(Durations[Index]);
+    }
+}
@@ -0,0 +1,504 @@
+#include "sim/recorder.hpp"
+
+#include "math/axis3.hpp"
+#include "math/quaternion.hpp"
+#include "utils/errors.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    constexpr char MAGIC[4] = {'H', 'T', 'L', 'M'};
+    constexpr uint32_t VERSION = 1;
+
+    // Interval at which the writer polls an empty buffer
+    constexpr std::chrono::microseconds POLL_INTERVAL{500};
+
+    // Control byte of a value equal to its predecessor
+    constexpr uint8_t REPEAT = 8 << 4;
+
+    /**
+     * Appends the native representation of a value
+     */
+    template <typename T>
+    void Append(std::vector<std::byte>& Out, T Value)
+    {
+        const auto Bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(Value);
+        Out.insert(Out.end(), Bytes.begin(), Bytes.end());
+    }
+
+    /**
+     * Reads the native representation of a value, advancing the offset
+     * @throws Error::GenericException if the value extends beyond the data
+     */
+    template <typename T>
+    T Extract(std::span<const std::byte> Data, size_t& Offset)
+    {
+        if ((Offset > Data.size()) || (Data.size() - Offset < sizeof(T)))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Telemetry file is truncated");
+        }
+
+        T Value{};
+        std::memcpy(&Value, Data.data() + Offset, sizeof(T));
+        Offset += sizeof(T);
+        return Value;
+    }
+
+    /**
+     * Compresses a column, each value XOR its predecessor as a control byte (leading zero
+     * bytes << 4 | trailing zero bytes) followed by the remaining bytes, least significant first
+     */
+    void Encode(const double* Values, size_t Count, std::vector<std::byte>& Out)
+    {
+        Out.clear();
+        uint64_t Previous = 0;
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            const uint64_t Bits = std::bit_cast<uint64_t>(Values[Index]);
+            const uint64_t Delta = Bits ^ Previous;
+            Previous = Bits;
+
+            if (Delta == 0)
+            {
+                Out.push_back(std::byte{REPEAT});
+                continue;
+            }
+
+            const unsigned Leading = static_cast<unsigned>(std::countl_zero(Delta)) / 8;
+            const unsigned Trailing = static_cast<unsigned>(std::countr_zero(Delta)) / 8;
+            Out.push_back(static_cast<std::byte>((Leading << 4) | Trailing));
+
+            for (unsigned Byte = Trailing; Byte < 8 - Leading; Byte++)
+            {
+                Out.push_back(static_cast<std::byte>(Delta >> (8 * Byte)));
+            }
+        }
+    }
+
+    /**
+     * Decompresses a column written by Encode
+     * @throws Error::GenericException if the data is malformed, or holds more or fewer values
+     */
+    void Decode(std::span<const std::byte> Data, size_t Count, double* Values)
+    {
+        uint64_t Previous = 0;
+        size_t Offset = 0;
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            if (Offset >= Data.size())
+            {
+                throw Error::GenericException(__FILE__, __LINE__, "Telemetry column is truncated");
+            }
+
+            const unsigned Control = std::to_integer<unsigned>(Data[Offset++]);
+            const unsigned Leading = Control >> 4;
+            const unsigned Trailing = Control & 0xF;
+
+            if ((Leading + Trailing > 8) || (8 - Leading - Trailing > Data.size() - Offset))
+            {
+                throw Error::GenericException(__FILE__, __LINE__, "Telemetry column is malformed");
+            }
+
+            uint64_t Delta = 0;
+
+            for (unsigned Byte = Trailing; Byte < 8 - Leading; Byte++)
+            {
+                Delta |= std::to_integer<uint64_t>(Data[Offset++]) << (8 * Byte);
+            }
+
+            Previous ^= Delta;
+            Values[Index] = std::bit_cast<double>(Previous);
+        }
+
+        if (Offset != Data.size())
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Telemetry column does not match the frames of its chunk");
+        }
+    }
+}
+
+Recorder::Recorder(const std::string& Path, const RecorderOptions& Options) :
+    mPath{Path},
+    mOptions{Options}
+{
+
+}
+
+Recorder::~Recorder()
+{
+    try
+    {
+        Stop();
+    }
+    catch (...)
+    {
+        // Failures are only reported by an explicit Stop
+    }
+}
+
+void Recorder::Bind(const Indexable& Source, const HString& Key)
+{
+    if (mRing != nullptr)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Parameters cannot be bound once recording has started");
+    }
+
+    if (const double* Value = Source.GetPtrDouble(Key); Value != nullptr)
+    {
+        AddName(mDoubleNames, Key);
+        mDoubles.push_back(Value);
+    }
+    else if (const int* Integer = Source.GetPtrInt(Key); Integer != nullptr)
+    {
+        AddName(mIntNames, Key);
+        mInts.push_back(Integer);
+    }
+    else if (const bool* Flag = Source.GetPtrBool(Key); Flag != nullptr)
+    {
+        AddName(mBoolNames, Key);
+        mBools.push_back(Flag);
+    }
+    else if (const Axis3* Axis = Source.GetPtrAxis3(Key); Axis != nullptr)
+    {
+        AddName(mDoubleNames, Key + ".X");
+        AddName(mDoubleNames, Key + ".Y");
+        AddName(mDoubleNames, Key + ".Z");
+        mDoubles.insert(mDoubles.end(), {&Axis->X, &Axis->Y, &Axis->Z});
+    }
+    else if (const Quaternion* Attitude = Source.GetPtrQuaternion(Key); Attitude != nullptr)
+    {
+        AddName(mDoubleNames, Key + ".X");
+        AddName(mDoubleNames, Key + ".Y");
+        AddName(mDoubleNames, Key + ".Z");
+        AddName(mDoubleNames, Key + ".S");
+        mDoubles.insert(mDoubles.end(), {&Attitude->X, &Attitude->Y, &Attitude->Z, &Attitude->S});
+    }
+    else
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Recorded parameter is not indexed");
+    }
+}
+
+void Recorder::AddName(std::vector<HString>& Names, const HString& Name)
+{
+    for (const std::vector<HString>* Group : {&mDoubleNames, &mIntNames, &mBoolNames})
+    {
+        if ((Name == "Time") || (std::find(Group->begin(), Group->end(), Name) != Group->end()))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Recorded parameter is already bound");
+        }
+    }
+
+    Names.push_back(Name);
+}
+
+void Recorder::Start(void)
+{
+    if (mRing != nullptr)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Recording has already started");
+    }
+
+    // Schema, with columns in the order of each frame
+    std::vector<std::byte> Header;
+    Header.insert(Header.end(), reinterpret_cast<const std::byte*>(MAGIC), reinterpret_cast<const std::byte*>(MAGIC) + sizeof(MAGIC));
+    Append(Header, VERSION);
+    Append(Header, static_cast<uint32_t>(Columns()));
+
+    const auto AppendColumn = [&](TelemetryType Type, const HString& Name)
+    {
+        Append(Header, Type);
+        Append(Header, static_cast<uint16_t>(Name.Size()));
+        Header.insert(Header.end(), reinterpret_cast<const std::byte*>(Name.Data()), reinterpret_cast<const std::byte*>(Name.Data()) + Name.Size());
+    };
+
+    AppendColumn(TelemetryType::DOUBLE, "Time");
+
+    for (const HString& Name : mDoubleNames)
+    {
+        AppendColumn(TelemetryType::DOUBLE, Name);
+    }
+
+    for (const HString& Name : mIntNames)
+    {
+        AppendColumn(TelemetryType::INT, Name);
+    }
+
+    for (const HString& Name : mBoolNames)
+    {
+        AppendColumn(TelemetryType::BOOL, Name);
+    }
+
+    mFile.open(mPath, std::ios::binary | std::ios::trunc);
+
+    if (mFile.is_open() == false)
+    {
+        mFile.clear();
+        throw Error::GenericException(__FILE__, __LINE__, "Telemetry file could not be opened");
+    }
+
+    mFile.write(reinterpret_cast<const char*>(Header.data()), static_cast<std::streamsize>(Header.size()));
+
+    if (mFile.good() == false)
+    {
+        mFile.close();
+        mFile.clear();
+        throw Error::GenericException(__FILE__, __LINE__, "Telemetry file could not be written");
+    }
+
+    mRing = std::make_unique<SpscRing<double>>(mOptions.RingFrames, Columns());
+    mStop.store(false);
+    mFailed.store(false);
+    mFrames = 0;
+    mDropped = 0;
+    mWriter = std::thread([this]() {WriterLoop();});
+}
+
+void Recorder::Record(double Time) noexcept
+{
+    if (mRing == nullptr)
+    {
+        return;
+    }
+
+    std::span<double> Slot = mRing->BeginPush();
+
+    while (Slot.empty() == true)
+    {
+        if (mOptions.Block == false)
+        {
+            mDropped++;
+            return;
+        }
+
+        std::this_thread::yield();
+        Slot = mRing->BeginPush();
+    }
+
+    double* Value = Slot.data();
+    *Value++ = Time;
+
+    for (const double* Parameter : mDoubles)
+    {
+        *Value++ = *Parameter;
+    }
+
+    for (const int* Parameter : mInts)
+    {
+        *Value++ = static_cast<double>(*Parameter);
+    }
+
+    for (const bool* Parameter : mBools)
+    {
+        *Value++ = (*Parameter == true) ? 1.0 : 0.0;
+    }
+
+    mRing->EndPush();
+    mFrames++;
+}
+
+void Recorder::Stop(void)
+{
+    if (mRing == nullptr)
+    {
+        return;
+    }
+
+    mStop.store(true, std::memory_order_release);
+    mWriter.join();
+    mRing.reset();
+
+    if (mFailed.load() == true)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Telemetry file could not be written");
+    }
+}
+
+void Recorder::WriterLoop(void)
+{
+    const size_t Width = Columns();
+    const size_t Capacity = Max(mOptions.ChunkFrames, size_t(1));
+
+    // Column major frames of the current chunk, and the compressed columns
+    std::vector<double> Chunk(Width * Capacity);
+    std::vector<std::vector<std::byte>> Compressed(Width);
+    std::vector<std::byte> Header;
+    size_t Frames = 0;
+
+    // Once a write fails the file is abandoned, the buffer still drained such that recording never blocks
+    const auto Flush = [&]()
+    {
+        if (mFile.good() == false)
+        {
+            Frames = 0;
+            return;
+        }
+
+        Header.clear();
+        Append(Header, static_cast<uint32_t>(Frames));
+
+        for (size_t Column = 0; Column < Width; Column++)
+        {
+            Encode(Chunk.data() + Column * Capacity, Frames, Compressed[Column]);
+            Append(Header, static_cast<uint32_t>(Compressed[Column].size()));
+        }
+
+        mFile.write(reinterpret_cast<const char*>(Header.data()), static_cast<std::streamsize>(Header.size()));
+
+        for (const std::vector<std::byte>& Column : Compressed)
+        {
+            mFile.write(reinterpret_cast<const char*>(Column.data()), static_cast<std::streamsize>(Column.size()));
+        }
+
+        Frames = 0;
+    };
+
+    while (true)
+    {
+        // Observe the stop request before the buffer, such that no frame is left behind
+        const bool Stopping = mStop.load(std::memory_order_acquire);
+        std::span<const double> Frame = mRing->Front();
+
+        if (Frame.empty() == true)
+        {
+            if (Stopping == true)
+            {
+                break;
+            }
+
+            std::this_thread::sleep_for(POLL_INTERVAL);
+            continue;
+        }
+
+        for (size_t Column = 0; Column < Width; Column++)
+        {
+            Chunk[Column * Capacity + Frames] = Frame[Column];
+        }
+
+        mRing->Pop();
+
+        if (++Frames == Capacity)
+        {
+            Flush();
+        }
+    }
+
+    if (Frames > 0)
+    {
+        Flush();
+    }
+
+    mFile.close();
+
+    if (mFile.fail() == true)
+    {
+        mFailed.store(true);
+    }
+
+    mFile.clear();
+}
+
+TelemetryReader::TelemetryReader(const std::string& Path) : mFile(Path)
+{
+    if (mFile.IsOpen() == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Telemetry file could not be opened");
+    }
+
+    const std::span<const std::byte> Data = mFile.Data();
+    size_t Offset = 0;
+
+    if ((Data.size() < sizeof(MAGIC)) || (std::memcmp(Data.data(), MAGIC, sizeof(MAGIC)) != 0))
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "File is not a telemetry recording");
+    }
+
+    Offset += sizeof(MAGIC);
+
+    if (Extract<uint32_t>(Data, Offset) != VERSION)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Unsupported telemetry file version");
+    }
+
+    const uint32_t Columns = Extract<uint32_t>(Data, Offset);
+
+    for (uint32_t Column = 0; Column < Columns; Column++)
+    {
+        mTypes.push_back(Extract<TelemetryType>(Data, Offset));
+        const uint16_t Length = Extract<uint16_t>(Data, Offset);
+
+        if (Data.size() - Offset < Length)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Telemetry file is truncated");
+        }
+
+        mNames.emplace_back(std::string(reinterpret_cast<const char*>(Data.data() + Offset), Length));
+        Offset += Length;
+    }
+
+    // Index the blocks of every chunk
+    while (Offset < Data.size())
+    {
+        const uint32_t Frames = Extract<uint32_t>(Data, Offset);
+        const size_t First = mBlocks.size();
+
+        for (uint32_t Column = 0; Column < Columns; Column++)
+        {
+            mBlocks.push_back(Block{.Offset = 0, .Bytes = Extract<uint32_t>(Data, Offset)});
+        }
+
+        for (size_t Index = First; Index < mBlocks.size(); Index++)
+        {
+            if (Data.size() - Offset < mBlocks[Index].Bytes)
+            {
+                throw Error::GenericException(__FILE__, __LINE__, "Telemetry file is truncated");
+            }
+
+            mBlocks[Index].Offset = Offset;
+            Offset += mBlocks[Index].Bytes;
+        }
+
+        mChunkFrames.push_back(Frames);
+        mFrames += Frames;
+    }
+}
+
+size_t TelemetryReader::Find(const HString& Name) const
+{
+    const auto It = std::find(mNames.begin(), mNames.end(), Name);
+
+    if (It == mNames.end())
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Telemetry column does not exist");
+    }
+
+    return static_cast<size_t>(It - mNames.begin());
+}
+
+std::vector<double> TelemetryReader::ReadColumn(size_t Column) const
+{
+    if (Column >= mNames.size())
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Telemetry column does not exist");
+    }
+
+    std::vector<double> Values(mFrames);
+    size_t Frame = 0;
+
+    for (size_t Chunk = 0; Chunk < mChunkFrames.size(); Chunk++)
+    {
+        const Block& Location = mBlocks[Chunk * mNames.size() + Column];
+        Decode(mFile.Data().subspan(Location.Offset, Location.Bytes), mChunkFrames[Chunk], Values.data() + Frame);
+        Frame += mChunkFrames[Chunk];
+    }
+
+    return Values;
+}
@@ -0,0 +1,174 @@
+#include "time/leap_seconds.hpp"
+
+#include "utils/errors.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    /**
+     * @return Concatenation of all data sections (\begindata ... \begintext) of a text kernel
+     */
+    std::string ExtractData(const std::string& Text)
+    {
+        constexpr std::string_view BEGIN_DATA = "\\begindata";
+        constexpr std::string_view BEGIN_TEXT = "\\begintext";
+
+        std::string Data;
+        size_t Start = Text.find(BEGIN_DATA);
+
+        while (Start != std::string::npos)
+        {
+            Start += BEGIN_DATA.size();
+            const size_t End = Text.find(BEGIN_TEXT, Start);
+            Data.append(Text, Start, (End == std::string::npos) ? std::string::npos : End - Start);
+            Data.push_back('\n');
+            Start = (End == std::string::npos) ? End : Text.find(BEGIN_DATA, End);
+        }
+
+        return Data;
+    }
+
+    /**
+     * @return Whitespace/comma separated tokens assigned to a kernel variable, the
+     * surrounding parentheses are removed
+     */
+    std::vector<std::string> GetValues(const std::string& Data, std::string_view Name)
+    {
+        size_t Start = Data.find(Name);
+
+        if (Start == std::string::npos)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Leap second kernel variable missing");
+        }
+
+        Start = Data.find('=', Start + Name.size());
+        size_t End = (Start == std::string::npos) ? Start : Data.find_first_not_of(" \t\r\n", Start + 1);
+
+        if (End == std::string::npos)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Leap second kernel variable has no value");
+        }
+
+        if (Data[End] == '(')
+        {
+            Start = End + 1;
+            End = Data.find(')', Start);
+        }
+        else
+        {
+            Start = End;
+            End = Data.find_first_of(" \t\r\n", Start);
+        }
+
+        std::string Values = Data.substr(Start, End - Start);
+        std::replace(Values.begin(), Values.end(), ',', ' ');
+
+        std::vector<std::string> Tokens;
+        std::istringstream Stream(Values);
+
+        for (std::string Token; Stream >> Token;)
+        {
+            Tokens.push_back(Token);
+        }
+
+        return Tokens;
+    }
+
+    /**
+     * @return Value of a fortran style double precision token (i.e 1.657D-3)
+     */
+    double ParseDouble(std::string Token)
+    {
+        std::replace(Token.begin(), Token.end(), 'D', 'E');
+        std::replace(Token.begin(), Token.end(), 'd', 'e');
+
+        char* End = nullptr;
+        const double Value = std::strtod(Token.c_str(), &End);
+
+        if (End == Token.c_str())
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Malformed leap second kernel value");
+        }
+
+        return Value;
+    }
+
+    /**
+     * @return Calendar date of a kernel date token (i.e @1972-JAN-1)
+     */
+    Time::CalendarDate ParseDate(const std::string& Token)
+    {
+        constexpr std::string_view MONTHS[12] = {
+            "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"
+        };
+
+        const size_t First = Token.find('-');
+        const size_t Second = Token.find('-', First + 1);
+
+        if ((Token.empty() == true) || (Token[0] != '@') || (First == std::string::npos) || (Second == std::string::npos))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Malformed leap second kernel date");
+        }
+
+        const std::string_view Month = std::string_view(Token).substr(First + 1, Second - First - 1);
+        const auto Match = std::find(std::begin(MONTHS), std::end(MONTHS), Month);
+
+        if (Match == std::end(MONTHS))
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Malformed leap second kernel month");
+        }
+
+        return Time::CalendarDate{
+            .Year = std::strtoll(Token.c_str() + 1, nullptr, 10),
+            .Month = static_cast<int>(Match - std::begin(MONTHS)) + 1,
+            .Day = static_cast<int>(std::strtol(Token.c_str() + Second + 1, nullptr, 10))
+        };
+    }
+}
+
+Time::LeapSecondTable Time::LoadLeapSecondKernel(const std::string& Path)
+{
+    std::ifstream File(Path, std::ios::binary);
+
+    if (File.is_open() == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Unable to open leap second kernel");
+    }
+
+    std::ostringstream Contents;
+    Contents << File.rdbuf();
+
+    const std::string Data = ExtractData(Contents.str());
+
+    LeapSecondTable Table{};
+    Table.SetTDBModel(TDBModel{
+        .DeltaTA = ParseDouble(GetValues(Data, "DELTET/DELTA_T_A").at(0)),
+        .K = ParseDouble(GetValues(Data, "DELTET/K").at(0)),
+        .EB = ParseDouble(GetValues(Data, "DELTET/EB").at(0)),
+        .M0 = ParseDouble(GetValues(Data, "DELTET/M").at(0)),
+        .M1 = ParseDouble(GetValues(Data, "DELTET/M").at(1))
+    });
+
+    const std::vector<std::string> Entries = GetValues(Data, "DELTET/DELTA_AT");
+
+    if ((Entries.empty() == true) || (Entries.size() % 2 != 0))
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Malformed leap second kernel table");
+    }
+
+    for (size_t Index = 0; Index < Entries.size(); Index += 2)
+    {
+        if (Table.AddEntry(ParseDate(Entries[Index + 1]), ParseDouble(Entries[Index])) == false)
+        {
+            throw Error::GenericException(__FILE__, __LINE__, "Leap second kernel table unordered or too large");
+        }
+    }
+
+    return Table;
+}
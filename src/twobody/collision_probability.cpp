@@ -0,0 +1,346 @@
+#include "twobody/collision_probability.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "math/matrixn.hpp"
+#include "numerics/random.hpp"
+#include "utils/errors.hpp"
+
+namespace
+{
+    // Conjunctions evaluated in sequence by each thread of a batch
+    constexpr size_t EVENT_GRAIN = 64;
+
+    // Monte Carlo samples drawn from each random stream
+    constexpr uint64_t SAMPLE_BLOCK = 1 << 16;
+
+    // Panels of the initial integration across the hard body disc, and the deepest bisection
+    // of each panel by the adaptive integration
+    constexpr size_t FOSTER_PANELS = 16;
+    constexpr int FOSTER_DEPTH = 16;
+
+    // Golden section iterations of the maximum probability, the range of covariance scalings
+    // searched about the maximum of a small hard body, and the tolerance of each probability
+    constexpr int ALFANO_ITERATIONS = 40;
+    constexpr double ALFANO_RANGE = 1.0E3;
+    constexpr double ALFANO_TOLERANCE = 1.0E-7;
+
+    /**
+     * Adaptive Simpson's rule over [A, B], given the integrand at the ends and midpoint
+     */
+    template <typename Func>
+    double AdaptiveSimpson(const Func& F, double A, double B, double FA, double FM, double FB, double Whole, double Tolerance, int Depth) noexcept
+    {
+        const double M = 0.5 * (A + B);
+        const double FLeft = F(0.5 * (A + M));
+        const double FRight = F(0.5 * (M + B));
+        const double Left = (M - A) / 6.0 * (FA + 4.0 * FLeft + FM);
+        const double Right = (B - M) / 6.0 * (FM + 4.0 * FRight + FB);
+        const double Error = Left + Right - Whole;
+
+        if ((Depth <= 0) || (Abs(Error) <= 15.0 * Tolerance))
+        {
+            return Left + Right + Error / 15.0;
+        }
+
+        return AdaptiveSimpson(F, A, M, FA, FLeft, FM, Left, 0.5 * Tolerance, Depth - 1) +
+               AdaptiveSimpson(F, M, B, FM, FRight, FB, Right, 0.5 * Tolerance, Depth - 1);
+    }
+}
+
+TwoBody::EncounterPlane TwoBody::ProjectEncounter(const Conjunction& Event) noexcept
+{
+    const Vector3 Along = Event.RelativeVelocity.Unit();
+    const Vector3 Miss = Event.RelativePosition - Along * Event.RelativePosition.Dot(Along);
+    const double Distance = Miss.Norm();
+
+    // Axes of the encounter plane, the first along the miss, or arbitrary for a direct hit
+    const Vector3 Arbitrary = (Abs(Along.X) < 0.9) ? Vector3::UNIT_X() : Vector3::UNIT_Y();
+    const Vector3 X = (Distance > 0.0) ? Miss / Distance : Along.Cross(Arbitrary).Unit();
+    const Vector3 Y = Along.Cross(X);
+
+    const Vector3 CX = Event.Covariance * X;
+    const Vector3 CY = Event.Covariance * Y;
+    const double XX = X.Dot(CX);
+    const double XY = 0.5 * (X.Dot(CY) + Y.Dot(CX));
+    const double YY = Y.Dot(CY);
+
+    // Principal axes of the projected covariance, the miss lying along the first axis
+    const double Mean = 0.5 * (XX + YY);
+    const double Deviation = Sqrt(Square(0.5 * (XX - YY)) + Square(XY));
+    const double Angle = 0.5 * Atan2(2.0 * XY, XX - YY);
+
+    return EncounterPlane{
+        .MissX = Distance * Cos(Angle),
+        .MissY = -Distance * Sin(Angle),
+        .SigmaX = Sqrt(Mean + Deviation),
+        .SigmaY = Sqrt(Max(Mean - Deviation, 0.0)),
+        .HardBodyRadius = Event.HardBodyRadius};
+}
+
+double TwoBody::FosterProbability(const EncounterPlane& Plane, double Tolerance) noexcept
+{
+    const double Radius = Plane.HardBodyRadius;
+    const double NormalX = 1.0 / (Sqrt(2.0 * PI) * Plane.SigmaX);
+    const double ScaleY = 1.0 / (Sqrt(2.0) * Plane.SigmaY);
+
+    // Across the disc along the major axis as X = R sin(T), such that the integrand is
+    // smooth at the edges of the disc, the minor axis integrated analytically over the chord
+    const auto Integrand = [&](double T)
+    {
+        const double Chord = Radius * Cos(T);
+        const double X = Radius * Sin(T);
+        const double DensityX = NormalX * Exp(-0.5 * Square((X - Plane.MissX) / Plane.SigmaX));
+        const double Lower = (Chord - Abs(Plane.MissY)) * ScaleY;
+        const double Upper = (Chord + Abs(Plane.MissY)) * ScaleY;
+
+        // Beyond the chord the sum of the error functions cancels, their complements do not
+        const double FractionY = (Lower < 0.0) ? 0.5 * (Erfc(-Lower) - Erfc(Upper)) : 0.5 * (Erf(Lower) + Erf(Upper));
+
+        return Chord * DensityX * FractionY;
+    };
+
+    // Initial estimate over panels, scaling the tolerance of the adaptive integration
+    const double Width = PI / static_cast<double>(FOSTER_PANELS);
+    double Estimate = 0.0;
+
+    for (size_t Panel = 0; Panel <= 2 * FOSTER_PANELS; Panel++)
+    {
+        const double Weight = ((Panel == 0) || (Panel == 2 * FOSTER_PANELS)) ? 1.0 : ((Panel % 2 == 1) ? 4.0 : 2.0);
+        Estimate += Weight * Integrand(-0.5 * PI + 0.5 * Width * static_cast<double>(Panel));
+    }
+
+    Estimate *= Width / 6.0;
+
+    const double PanelTolerance = Tolerance * Estimate / static_cast<double>(FOSTER_PANELS);
+    double Probability = 0.0;
+
+    for (size_t Panel = 0; Panel < FOSTER_PANELS; Panel++)
+    {
+        const double A = -0.5 * PI + Width * static_cast<double>(Panel);
+        const double B = A + Width;
+        const double FA = Integrand(A);
+        const double FM = Integrand(0.5 * (A + B));
+        const double FB = Integrand(B);
+
+        Probability += AdaptiveSimpson(Integrand, A, B, FA, FM, FB, Width / 6.0 * (FA + 4.0 * FM + FB), PanelTolerance, FOSTER_DEPTH);
+    }
+
+    return Clamp(Probability, 0.0, 1.0);
+}
+
+double TwoBody::ChanProbability(const EncounterPlane& Plane, size_t Terms) noexcept
+{
+    // Equivalent disc and isotropic density, in the squared radius of the disc and squared
+    // miss distance, both in units of the variance
+    const double U = 0.5 * Square(Plane.HardBodyRadius) / (Plane.SigmaX * Plane.SigmaY);
+    const double V = 0.5 * (Square(Plane.MissX / Plane.SigmaX) + Square(Plane.MissY / Plane.SigmaY));
+
+    // Poisson weights of the miss, against the upper tails of the Poisson distribution of the
+    // disc, the first tail accurate for a small disc
+    double Weight = Exp(-V);
+    double Term = Exp(-U);
+    double Tail = -Expm1(-U);
+    double Probability = Weight * Tail;
+
+    for (size_t Index = 1; Index < Terms; Index++)
+    {
+        const double Order = static_cast<double>(Index);
+        Weight *= V / Order;
+        Term *= U / Order;
+        Tail = Max(Tail - Term, 0.0);
+        Probability += Weight * Tail;
+    }
+
+    return Min(Probability, 1.0);
+}
+
+double TwoBody::AlfanoMaximumProbability(const EncounterPlane& Plane) noexcept
+{
+    const double Miss2 = Square(Plane.MissX) + Square(Plane.MissY);
+
+    if (Plane.HardBodyRadius <= 0.0)
+    {
+        return 0.0;
+    }
+
+    // A vanishing covariance about a miss within the hard body collides
+    if (Miss2 < Square(Plane.HardBodyRadius))
+    {
+        return 1.0;
+    }
+
+    // Probability with the covariance scaled by 1 / Scale, a small hard body being most
+    // likely to collide when the scaled Mahalanobis distance of the miss is sqrt(2)
+    const double Mahalanobis2 = Square(Plane.MissX / Plane.SigmaX) + Square(Plane.MissY / Plane.SigmaY);
+    const auto Scaled = [&](double LogScale)
+    {
+        const double Scale = Sqrt(Exp(LogScale));
+        return FosterProbability(EncounterPlane{.MissX = Plane.MissX, .MissY = Plane.MissY, .SigmaX = Plane.SigmaX / Scale,
+            .SigmaY = Plane.SigmaY / Scale, .HardBodyRadius = Plane.HardBodyRadius}, ALFANO_TOLERANCE);
+    };
+
+    const double Golden = 0.5 * (Sqrt(5.0) - 1.0);
+    const double Centre = Log(2.0 / Mahalanobis2);
+    double Lower = Centre - Log(ALFANO_RANGE);
+    double Upper = Centre + Log(ALFANO_RANGE);
+    double Left = Upper - Golden * (Upper - Lower);
+    double Right = Lower + Golden * (Upper - Lower);
+    double FLeft = Scaled(Left);
+    double FRight = Scaled(Right);
+
+    for (int Iteration = 0; Iteration < ALFANO_ITERATIONS; Iteration++)
+    {
+        if (FLeft < FRight)
+        {
+            Lower = Left;
+            Left = Right;
+            FLeft = FRight;
+            Right = Lower + Golden * (Upper - Lower);
+            FRight = Scaled(Right);
+        }
+        else
+        {
+            Upper = Right;
+            Right = Left;
+            FRight = FLeft;
+            Left = Upper - Golden * (Upper - Lower);
+            FLeft = Scaled(Left);
+        }
+    }
+
+    return Max(FLeft, FRight);
+}
+
+double TwoBody::CollisionProbability(const Conjunction& Event, CollisionMethod Method) noexcept
+{
+    const EncounterPlane Plane = ProjectEncounter(Event);
+
+    switch (Method)
+    {
+        case CollisionMethod::FOSTER:
+            return FosterProbability(Plane);
+        case CollisionMethod::CHAN:
+            return ChanProbability(Plane);
+        case CollisionMethod::ALFANO_MAXIMUM:
+            return AlfanoMaximumProbability(Plane);
+    }
+
+    return 0.0;
+}
+
+void TwoBody::CollisionProbability(ThreadPool& Pool, std::span<const Conjunction> Events, CollisionMethod Method,
+    std::span<double> Probabilities)
+{
+    if (Events.size() != Probabilities.size())
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    if (Method == CollisionMethod::CHAN)
+    {
+        const size_t Chunks = (Events.size() + EVENT_GRAIN - 1) / EVENT_GRAIN;
+
+        // The Chan series of a chunk in structure of arrays, each term advancing every
+        // conjunction of the chunk in a loop without branches, which the compiler vectorises
+        Pool.ParallelFor(Chunks, [&](size_t Chunk)
+        {
+            const size_t Begin = Chunk * EVENT_GRAIN;
+            const size_t Count = Min(EVENT_GRAIN, Events.size() - Begin);
+            double U[EVENT_GRAIN];
+            double V[EVENT_GRAIN];
+            double Weight[EVENT_GRAIN];
+            double Term[EVENT_GRAIN];
+            double Tail[EVENT_GRAIN];
+            double Probability[EVENT_GRAIN];
+
+            for (size_t Lane = 0; Lane < Count; Lane++)
+            {
+                const EncounterPlane Plane = ProjectEncounter(Events[Begin + Lane]);
+                U[Lane] = 0.5 * Square(Plane.HardBodyRadius) / (Plane.SigmaX * Plane.SigmaY);
+                V[Lane] = 0.5 * (Square(Plane.MissX / Plane.SigmaX) + Square(Plane.MissY / Plane.SigmaY));
+                Weight[Lane] = Exp(-V[Lane]);
+                Term[Lane] = Exp(-U[Lane]);
+                Tail[Lane] = -Expm1(-U[Lane]);
+                Probability[Lane] = Weight[Lane] * Tail[Lane];
+            }
+
+            for (size_t Index = 1; Index < CHAN_TERMS; Index++)
+            {
+                const double Order = static_cast<double>(Index);
+
+                for (size_t Lane = 0; Lane < Count; Lane++)
+                {
+                    Weight[Lane] *= V[Lane] / Order;
+                    Term[Lane] *= U[Lane] / Order;
+                    Tail[Lane] = Max(Tail[Lane] - Term[Lane], 0.0);
+                    Probability[Lane] += Weight[Lane] * Tail[Lane];
+                }
+            }
+
+            for (size_t Lane = 0; Lane < Count; Lane++)
+            {
+                Probabilities[Begin + Lane] = Min(Probability[Lane], 1.0);
+            }
+        });
+
+        return;
+    }
+
+    Pool.ParallelFor(Events.size(), EVENT_GRAIN, [&](size_t Index)
+    {
+        Probabilities[Index] = CollisionProbability(Events[Index], Method);
+    });
+}
+
+TwoBody::MonteCarloCollision TwoBody::MonteCarloProbability(ThreadPool& Pool, const Conjunction& Event, uint64_t Samples, uint64_t Seed)
+{
+    const Matrix3& C = Event.Covariance;
+    const MatrixN<3, 3> Covariance{.Data = {C.XX, C.XY, C.XZ, C.YX, C.YY, C.YZ, C.ZX, C.ZY, C.ZZ}};
+    MatrixN<3, 3> Lower{};
+
+    if (Covariance.Cholesky(Lower) == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Covariance of a conjunction must be positive definite");
+    }
+
+    const Vector3 Along = Event.RelativeVelocity.Unit();
+    const double Radius2 = Square(Event.HardBodyRadius);
+    const uint64_t Blocks = (Samples + SAMPLE_BLOCK - 1) / SAMPLE_BLOCK;
+
+    // Samples colliding, each on its rectilinear path passing within the hard body radius
+    const uint64_t Hits = Pool.ParallelReduce(Blocks, 1, uint64_t(0), [&](size_t Begin, size_t End)
+    {
+        uint64_t Count = 0;
+
+        for (size_t Block = Begin; Block < End; Block++)
+        {
+            Random::Stream Stream(Seed, Block);
+            const uint64_t BlockSamples = Min(SAMPLE_BLOCK, Samples - Block * SAMPLE_BLOCK);
+
+            for (uint64_t Sample = 0; Sample < BlockSamples; Sample++)
+            {
+                const double Z0 = Stream.Normal();
+                const double Z1 = Stream.Normal();
+                const double Z2 = Stream.Normal();
+                const Vector3 Position = Event.RelativePosition + Vector3({
+                    Lower(0, 0) * Z0,
+                    Lower(1, 0) * Z0 + Lower(1, 1) * Z1,
+                    Lower(2, 0) * Z0 + Lower(2, 1) * Z1 + Lower(2, 2) * Z2});
+
+                Count += ((Position - Along * Position.Dot(Along)).NormSquared() < Radius2) ? 1u : 0u;
+            }
+        }
+
+        return Count;
+    },
+    [](uint64_t A, uint64_t B) {return A + B;});
+
+    MonteCarloCollision Result{.Samples = Samples, .Hits = Hits};
+
+    if (Samples > 0)
+    {
+        Result.Probability = static_cast<double>(Hits) / static_cast<double>(Samples);
+        Result.StandardError = Sqrt(Result.Probability * (1.0 - Result.Probability) / static_cast<double>(Samples));
+    }
+
+    return Result;
+}
@@ -0,0 +1,154 @@
+#include "twobody/covariance.hpp"
+#include "twobody/kepler.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "utils/errors.hpp"
+
+#include <array>
+#include <span>
+
+namespace
+{
+    constexpr size_t DIMENSION = 6;
+
+    // Objects handled in sequence by each thread of a batch
+    constexpr size_t OBJECT_GRAIN = 16;
+
+    // Sigma points propagated in sequence by each thread of a batch
+    constexpr size_t SIGMA_GRAIN = 64;
+
+    // Central difference steps relative to the magnitude of the position and velocity
+    constexpr double RELATIVE_STEP = 1.0E-6;
+
+    // Least central difference steps, for a state at rest or at the origin (m, m/s)
+    constexpr double ABSOLUTE_POSITION_STEP = 1.0E-3;
+    constexpr double ABSOLUTE_VELOCITY_STEP = 1.0E-6;
+}
+
+TwoBody::StateVector TwoBody::Propagate(const StateVector& State, double GravitationalParameter, double DeltaTime) noexcept
+{
+    const EphemerisState Result = PropagateUniversal(
+        Vector3({State[0], State[1], State[2]}),
+        Vector3({State[3], State[4], State[5]}),
+        GravitationalParameter,
+        DeltaTime);
+
+    return MakeStateVector(Result.Pos, Result.Vel);
+}
+
+MatrixN<6, 6> TwoBody::StateTransition(const StateVector& State, double GravitationalParameter, double DeltaTime) noexcept
+{
+    const double PositionStep = Max(RELATIVE_STEP * Vector3({State[0], State[1], State[2]}).Norm(), ABSOLUTE_POSITION_STEP);
+    const double VelocityStep = Max(RELATIVE_STEP * Vector3({State[3], State[4], State[5]}).Norm(), ABSOLUTE_VELOCITY_STEP);
+
+    MatrixN<6, 6> Result{};
+
+    for (size_t Col = 0; Col < DIMENSION; Col++)
+    {
+        const double Step = (Col < 3) ? PositionStep : VelocityStep;
+
+        StateVector Upper = State;
+        StateVector Lower = State;
+        Upper[Col] += Step;
+        Lower[Col] -= Step;
+
+        const StateVector Derivative = (Propagate(Upper, GravitationalParameter, DeltaTime) - Propagate(Lower, GravitationalParameter, DeltaTime)) / (2.0 * Step);
+
+        for (size_t Row = 0; Row < DIMENSION; Row++)
+        {
+            Result(Row, Col) = Derivative[Row];
+        }
+    }
+
+    return Result;
+}
+
+TwoBody::StateCovariance TwoBody::PropagateLinear(const StateVector& State, const StateCovariance& Covariance, double GravitationalParameter, double DeltaTime) noexcept
+{
+    const MatrixN<6, 6> Transition = StateTransition(State, GravitationalParameter, DeltaTime);
+    return (Transition * Covariance * Transition.Transpose()).Symmetric();
+}
+
+void TwoBody::PropagateUnscented(StateVector& State, StateCovariance& Covariance, double GravitationalParameter, double DeltaTime, const Unscented::Parameters& Parameters)
+{
+    const Unscented::Weights Weights = Unscented::CalculateWeights<DIMENSION>(Parameters);
+    std::array<StateVector, SIGMA_POINTS> Points{};
+
+    if (Unscented::GenerateSigmaPoints<DIMENSION>(State, Covariance, Weights, Points) == false)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Covariance is not positive definite");
+    }
+
+    for (StateVector& Point : Points)
+    {
+        Point = Propagate(Point, GravitationalParameter, DeltaTime);
+    }
+
+    State = Unscented::Mean<DIMENSION, SIGMA_POINTS>(Points, Weights);
+    Covariance = Unscented::CrossCovariance<DIMENSION, DIMENSION, SIGMA_POINTS>(Points, State, Points, State, Weights);
+}
+
+size_t TwoBody::CovarianceBatch::Add(const StateVector& State, const StateCovariance& Covariance)
+{
+    mStates.push_back(State);
+    mCovariances.push_back(Covariance);
+    return mStates.size() - 1;
+}
+
+void TwoBody::CovarianceBatch::Reserve(size_t Capacity)
+{
+    mStates.reserve(Capacity);
+    mCovariances.reserve(Capacity);
+}
+
+void TwoBody::CovarianceBatch::PropagateLinear(ThreadPool& Pool, double DeltaTime) noexcept
+{
+    Pool.ParallelFor(mStates.size(), OBJECT_GRAIN, [&](size_t Index)
+    {
+        mCovariances[Index] = TwoBody::PropagateLinear(mStates[Index], mCovariances[Index], mGravitationalParameter, DeltaTime);
+        mStates[Index] = Propagate(mStates[Index], mGravitationalParameter, DeltaTime);
+    });
+}
+
+void TwoBody::CovarianceBatch::PropagateUnscented(ThreadPool& Pool, double DeltaTime)
+{
+    const Unscented::Weights Weights = Unscented::CalculateWeights<DIMENSION>(mParameters);
+    const size_t Count = mStates.size();
+    mSigmaPoints.resize(Count * SIGMA_POINTS);
+
+    const auto Points = [this](size_t Index) {return std::span<StateVector, SIGMA_POINTS>(&mSigmaPoints[Index * SIGMA_POINTS], SIGMA_POINTS);};
+
+    // Every covariance is decomposed before any object is propagated
+    const size_t Invalid = Pool.ParallelReduce(Count, OBJECT_GRAIN, size_t(0),
+        [&](size_t Begin, size_t End)
+        {
+            size_t Failures = 0;
+
+            for (size_t Index = Begin; Index < End; Index++)
+            {
+                if (Unscented::GenerateSigmaPoints<DIMENSION>(mStates[Index], mCovariances[Index], Weights, Points(Index)) == false)
+                {
+                    Failures++;
+                }
+            }
+
+            return Failures;
+        },
+        [](size_t A, size_t B) {return A + B;});
+
+    if (Invalid > 0)
+    {
+        throw Error::GenericException(__FILE__, __LINE__, "Covariance is not positive definite");
+    }
+
+    Pool.ParallelFor(mSigmaPoints.size(), SIGMA_GRAIN, [&](size_t Index)
+    {
+        mSigmaPoints[Index] = Propagate(mSigmaPoints[Index], mGravitationalParameter, DeltaTime);
+    });
+
+    Pool.ParallelFor(Count, OBJECT_GRAIN, [&](size_t Index)
+    {
+        const std::span<const StateVector, SIGMA_POINTS> Propagated = Points(Index);
+        mStates[Index] = Unscented::Mean(Propagated, Weights);
+        mCovariances[Index] = Unscented::CrossCovariance(Propagated, mStates[Index], Propagated, mStates[Index], Weights);
+    });
+}
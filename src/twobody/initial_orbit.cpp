@@ -0,0 +1,629 @@
+#include "twobody/initial_orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "utils/errors.hpp"
+
+namespace
+{
+    // Triplets solved in sequence by each thread of a batch
+    constexpr size_t TRIPLET_GRAIN = 32;
+
+    // Largest separation (rad) of positions solved by Herrick-Gibbs when automatic
+    constexpr double HERRICK_GIBBS_SEPARATION = 3.0 * PI / 180.0;
+
+    // Smallest triple product of unit lines of sight, below which they are considered coplanar
+    constexpr double MIN_LINE_OF_SIGHT_VOLUME = 1.0E-12;
+
+    // Ratio between successive radii scanned for roots of the range polynomial
+    constexpr double ROOT_SCAN_RATIO = 1.02;
+
+    constexpr int MAX_ROOT_ITERATIONS = 100;
+    constexpr int MAX_LAMBERT_ITERATIONS = 100;
+    constexpr int MAX_LAMBERT_EXPANSIONS = 60;
+
+    // Refinement of the Gauss ranges by exact Lagrange coefficients
+    constexpr int MAX_GAUSS_ITERATIONS = 50;
+    constexpr double GAUSS_TOLERANCE = 1.0E-10;
+    constexpr double GAUSS_RELAXATION = 0.5;
+
+    // Newton solution of the Gooding end ranges
+    constexpr int MAX_GOODING_ITERATIONS = 30;
+    constexpr double GOODING_TOLERANCE = 1.0E-11;
+    constexpr double GOODING_STEP = 1.0E-6;
+
+    /**
+     * @return `true` if the times of a triplet are strictly increasing
+     */
+    bool IsIncreasing(const std::array<double, 3>& Times) noexcept
+    {
+        return (Times[0] < Times[1]) && (Times[1] < Times[2]);
+    }
+
+    /**
+     * Completes a solution with the elements of the state, and screens it against the limits
+     */
+    TwoBody::InitialOrbitSolution Finalise(double Time, const Vector3& Position, const Vector3& Velocity, double GravitationalParameter,
+        const TwoBody::InitialOrbitLimits& Limits) noexcept
+    {
+        TwoBody::InitialOrbitSolution Solution{.Time = Time, .Position = Position, .Velocity = Velocity};
+        const double Radius = Position.Norm();
+
+        if ((IsFinite(Radius) == false) || (IsFinite(Velocity.Norm()) == false))
+        {
+            Solution.Status = TwoBody::InitialOrbitStatus::NO_SOLUTION;
+            return Solution;
+        }
+
+        Solution.Elements = TwoBody::Newtonian2Kepler(Position, Velocity, GravitationalParameter);
+
+        const bool Plausible = (Radius >= Limits.MinRadius) && (Radius <= Limits.MaxRadius) &&
+                               (Solution.Elements.Eccentricity <= Limits.MaxEccentricity);
+
+        Solution.Status = Plausible ? TwoBody::InitialOrbitStatus::SUCCESS : TwoBody::InitialOrbitStatus::REJECTED;
+        return Solution;
+    }
+
+    /**
+     * @return Angle (rad) of the first position from the plane of the second and third
+     */
+    double Coplanarity(const TwoBody::PositionTriplet& Triplet) noexcept
+    {
+        const Vector3 Normal = Triplet.Positions[1].Cross(Triplet.Positions[2]);
+        const double Sine = Normal.Dot(Triplet.Positions[0]) / (Normal.Norm() * Triplet.Positions[0].Norm());
+        return Asin(Min(Abs(Sine), 1.0));
+    }
+
+    /**
+     * Lagrange coefficients f and g relating a state to the position a time later, as
+     * R(T) = f R + g V, from the exact two body propagation of the state
+     */
+    void LagrangeCoefficients(const Vector3& Position, const Vector3& Velocity, double GravitationalParameter, double DeltaTime,
+        double& F, double& G) noexcept
+    {
+        const Vector3 Propagated = TwoBody::PropagateUniversal(Position, Velocity, GravitationalParameter, DeltaTime).Pos;
+
+        // Least squares projection onto the plane of the position and velocity, exact for two body motion
+        const double A11 = Position.Dot(Position);
+        const double A12 = Position.Dot(Velocity);
+        const double A22 = Velocity.Dot(Velocity);
+        const double B1 = Position.Dot(Propagated);
+        const double B2 = Velocity.Dot(Propagated);
+        const double Determinant = A11 * A22 - Square(A12);
+
+        F = (A22 * B1 - A12 * B2) / Determinant;
+        G = (A11 * B2 - A12 * B1) / Determinant;
+    }
+
+    /**
+     * Intermediate quantities of the Gauss method
+     */
+    struct GaussGeometry
+    {
+        double Tau1 = 0.0;
+        double Tau3 = 0.0;
+        double D0 = 0.0;
+
+        // D[M][N] = Site M . P N
+        double D[3][3] = {};
+    };
+
+    /**
+     * Smallest root of x^8 + A x^6 + B x^3 + C within a band of radii
+     * @return `false` if there is no root within the band
+     */
+    bool RangePolynomialRoot(double A, double B, double C, double MinRadius, double MaxRadius, double& Root) noexcept
+    {
+        const auto Polynomial = [=](double X) {return Square(Square(Square(X))) + A * Square(Cube(X)) + B * Cube(X) + C;};
+        const auto Derivative = [=](double X) {return 8.0 * Cube(X) * Cube(X) * X + 6.0 * A * Cube(X) * Square(X) + 3.0 * B * Square(X);};
+
+        double Lower = MinRadius;
+        double LowerValue = Polynomial(Lower);
+
+        while (Lower < MaxRadius)
+        {
+            const double Upper = Min(Lower * ROOT_SCAN_RATIO, MaxRadius);
+            const double UpperValue = Polynomial(Upper);
+
+            if (Signum(UpperValue) != Signum(LowerValue))
+            {
+                // Newton steps safeguarded by bisection of the bracket
+                double Low = Lower;
+                double High = Upper;
+                double X = 0.5 * (Low + High);
+
+                for (int Iteration = 0; Iteration < MAX_ROOT_ITERATIONS; Iteration++)
+                {
+                    const double Value = Polynomial(X);
+
+                    if (Signum(Value) == Signum(LowerValue))
+                    {
+                        Low = X;
+                    }
+                    else
+                    {
+                        High = X;
+                    }
+
+                    double Next = X - Value / Derivative(X);
+
+                    if ((Next <= Low) || (Next >= High))
+                    {
+                        Next = 0.5 * (Low + High);
+                    }
+
+                    if (Abs(Next - X) <= 1.0E-14 * X)
+                    {
+                        X = Next;
+                        break;
+                    }
+
+                    X = Next;
+                }
+
+                Root = X;
+                return true;
+            }
+
+            Lower = Upper;
+            LowerValue = UpperValue;
+        }
+
+        return false;
+    }
+
+    /**
+     * Positions of the three observations of a triplet at the given ranges
+     */
+    std::array<Vector3, 3> Positions(const TwoBody::AnglesTriplet& Triplet, const std::array<double, 3>& Ranges) noexcept
+    {
+        return {Triplet.Sites[0] + Triplet.Directions[0] * Ranges[0],
+                Triplet.Sites[1] + Triplet.Directions[1] * Ranges[1],
+                Triplet.Sites[2] + Triplet.Directions[2] * Ranges[2]};
+    }
+
+    /**
+     * Gauss solution of the ranges of a triplet and the velocity at the middle observation
+     */
+    TwoBody::InitialOrbitStatus SolveGauss(const TwoBody::AnglesTriplet& Triplet, double GravitationalParameter, const TwoBody::InitialOrbitLimits& Limits,
+        std::array<double, 3>& Ranges, Vector3& Velocity) noexcept
+    {
+        if (IsIncreasing(Triplet.Times) == false)
+        {
+            return TwoBody::InitialOrbitStatus::DEGENERATE_GEOMETRY;
+        }
+
+        const std::array<Vector3, 3>& L = Triplet.Directions;
+        const std::array<Vector3, 3>& R = Triplet.Sites;
+        const std::array<Vector3, 3> P = {L[1].Cross(L[2]), L[0].Cross(L[2]), L[0].Cross(L[1])};
+
+        GaussGeometry G{.Tau1 = Triplet.Times[0] - Triplet.Times[1], .Tau3 = Triplet.Times[2] - Triplet.Times[1], .D0 = L[0].Dot(P[0])};
+
+        if (Abs(G.D0) < MIN_LINE_OF_SIGHT_VOLUME)
+        {
+            return TwoBody::InitialOrbitStatus::DEGENERATE_GEOMETRY;
+        }
+
+        for (size_t M = 0; M < 3; M++)
+        {
+            for (size_t N = 0; N < 3; N++)
+            {
+                G.D[M][N] = R[M].Dot(P[N]);
+            }
+        }
+
+        const double Mu = GravitationalParameter;
+        const double Tau = G.Tau3 - G.Tau1;
+        const double A = (-G.D[0][1] * G.Tau3 / Tau + G.D[1][1] + G.D[2][1] * G.Tau1 / Tau) / G.D0;
+        const double B = (G.D[0][1] * (Square(G.Tau3) - Square(Tau)) * G.Tau3 / Tau + G.D[2][1] * (Square(Tau) - Square(G.Tau1)) * G.Tau1 / Tau) / (6.0 * G.D0);
+        const double E = R[1].Dot(L[1]);
+
+        // Radius of the middle position, the root of the range polynomial
+        double Radius = 0.0;
+
+        if (RangePolynomialRoot(-(Square(A) + 2.0 * A * E + R[1].NormSquared()), -2.0 * Mu * B * (A + E), -Square(Mu * B),
+            Limits.MinRadius, Limits.MaxRadius, Radius) == false)
+        {
+            return TwoBody::InitialOrbitStatus::NO_SOLUTION;
+        }
+
+        const double Radius3 = Cube(Radius);
+
+        Ranges[0] = ((6.0 * (G.D[2][0] * G.Tau1 / G.Tau3 + G.D[1][0] * Tau / G.Tau3) * Radius3 + Mu * G.D[2][0] * (Square(Tau) - Square(G.Tau1)) * G.Tau1 / G.Tau3) /
+                     (6.0 * Radius3 + Mu * (Square(Tau) - Square(G.Tau3))) - G.D[0][0]) / G.D0;
+        Ranges[1] = A + Mu * B / Radius3;
+        Ranges[2] = ((6.0 * (G.D[0][2] * G.Tau3 / G.Tau1 - G.D[1][2] * Tau / G.Tau1) * Radius3 + Mu * G.D[0][2] * (Square(Tau) - Square(G.Tau3)) * G.Tau3 / G.Tau1) /
+                     (6.0 * Radius3 + Mu * (Square(Tau) - Square(G.Tau1))) - G.D[2][2]) / G.D0;
+
+        // Truncated series of the Lagrange coefficients
+        double F1 = 1.0 - 0.5 * Mu * Square(G.Tau1) / Radius3;
+        double F3 = 1.0 - 0.5 * Mu * Square(G.Tau3) / Radius3;
+        double G1 = G.Tau1 - Mu * Cube(G.Tau1) / (6.0 * Radius3);
+        double G3 = G.Tau3 - Mu * Cube(G.Tau3) / (6.0 * Radius3);
+
+        std::array<Vector3, 3> Position = Positions(Triplet, Ranges);
+        Velocity = (Position[2] * F1 - Position[0] * F3) / (F1 * G3 - F3 * G1);
+
+        // Refinement with exact Lagrange coefficients
+        for (int Iteration = 0; Iteration < MAX_GAUSS_ITERATIONS; Iteration++)
+        {
+            LagrangeCoefficients(Position[1], Velocity, Mu, G.Tau1, F1, G1);
+            LagrangeCoefficients(Position[1], Velocity, Mu, G.Tau3, F3, G3);
+
+            const double Denominator = F1 * G3 - F3 * G1;
+            const double C1 = G3 / Denominator;
+            const double C3 = -G1 / Denominator;
+
+            // The iteration oscillates about the solution, which averaging successive ranges damps
+            const std::array<double, 3> Previous = Ranges;
+            Ranges[0] = GAUSS_RELAXATION * (-G.D[0][0] + G.D[1][0] / C1 - G.D[2][0] * C3 / C1) / G.D0 + (1.0 - GAUSS_RELAXATION) * Previous[0];
+            Ranges[1] = GAUSS_RELAXATION * (-C1 * G.D[0][1] + G.D[1][1] - C3 * G.D[2][1]) / G.D0 + (1.0 - GAUSS_RELAXATION) * Previous[1];
+            Ranges[2] = GAUSS_RELAXATION * (-C1 * G.D[0][2] / C3 + G.D[1][2] / C3 - G.D[2][2]) / G.D0 + (1.0 - GAUSS_RELAXATION) * Previous[2];
+
+            Position = Positions(Triplet, Ranges);
+            Velocity = (Position[2] * F1 - Position[0] * F3) / Denominator;
+
+            double Change = 0.0;
+
+            for (size_t Index = 0; Index < 3; Index++)
+            {
+                Change = Max(Change, Abs(Ranges[Index] - Previous[Index]) / Max(Abs(Ranges[Index]), 1.0));
+            }
+
+            if ((IsFinite(Change) == false) || (Ranges[1] <= 0.0))
+            {
+                return TwoBody::InitialOrbitStatus::NOT_CONVERGED;
+            }
+
+            if (Change < GAUSS_TOLERANCE)
+            {
+                return TwoBody::InitialOrbitStatus::SUCCESS;
+            }
+        }
+
+        return TwoBody::InitialOrbitStatus::NOT_CONVERGED;
+    }
+
+    /**
+     * Miss of the middle line of sight by the Lambert transfer between the end positions,
+     * resolved along two directions perpendicular to the line of sight
+     */
+    bool GoodingMiss(const TwoBody::AnglesTriplet& Triplet, double GravitationalParameter, const Vector3& Normal, const Vector3& Across,
+        const Vector3& Along, double Range1, double Range3, double Miss[2], Vector3& Position, Vector3& Velocity) noexcept
+    {
+        const Vector3 Initial = Triplet.Sites[0] + Triplet.Directions[0] * Range1;
+        const Vector3 Final = Triplet.Sites[2] + Triplet.Directions[2] * Range3;
+
+        Vector3 InitialVelocity = Vector3::ZERO();
+        Vector3 FinalVelocity = Vector3::ZERO();
+
+        if (TwoBody::Lambert(Initial, Final, Triplet.Times[2] - Triplet.Times[0], GravitationalParameter, Normal, InitialVelocity, FinalVelocity) == false)
+        {
+            return false;
+        }
+
+        const EphemerisState Middle = TwoBody::PropagateUniversal(Initial, InitialVelocity, GravitationalParameter, Triplet.Times[1] - Triplet.Times[0]);
+        const Vector3 Relative = Middle.Pos - Triplet.Sites[1];
+
+        Position = Middle.Pos;
+        Velocity = Middle.Vel;
+        Miss[0] = Relative.Dot(Across) / Relative.Norm();
+        Miss[1] = Relative.Dot(Along) / Relative.Norm();
+        return true;
+    }
+}
+
+bool TwoBody::Lambert(const Vector3& Initial, const Vector3& Final, double TimeOfFlight, double GravitationalParameter, const Vector3& Normal,
+    Vector3& InitialVelocity, Vector3& FinalVelocity) noexcept
+{
+    const double Radius1 = Initial.Norm();
+    const double Radius2 = Final.Norm();
+    const double CosTransfer = Initial.Dot(Final) / (Radius1 * Radius2);
+
+    // Short or long way, such that the motion is about the normal
+    const double Direction = (Initial.Cross(Final).Dot(Normal) >= 0.0) ? 1.0 : -1.0;
+    const double A = Direction * Sqrt(Radius1 * Radius2 * (1.0 + CosTransfer));
+
+    if ((Initial.Cross(Final).Norm() < 1.0E-12 * Radius1 * Radius2) || (TimeOfFlight <= 0.0))
+    {
+        return false;
+    }
+
+    const double SqrtMu = Sqrt(GravitationalParameter);
+
+    const auto Y = [=](double Z, const CCoefficents& C) {return Radius1 + Radius2 + A * (Z * C.C3 - 1.0) / Sqrt(C.C2);};
+
+    // Time of flight error, negative where the auxiliary variable is invalid (transfers too short)
+    const auto TimeError = [&](double Z)
+    {
+        const CCoefficents C = CalculateCoefficients(Z);
+        const double YValue = Y(Z, C);
+
+        if (YValue < 0.0)
+        {
+            return -Infinity<double>();
+        }
+
+        return (Sqrt(Cube(YValue / C.C2)) * C.C3 + A * Sqrt(YValue)) / SqrtMu - TimeOfFlight;
+    };
+
+    // Bracket of less than one revolution, time of flight increasing with Z. The upper bound
+    // stops short of a whole revolution, where the coefficients lose precision
+    double Low = -4.0 * PI;
+    double High = 4.0 * Square(PI) * (1.0 - 1.0E-5);
+
+    for (int Expansion = 0; (TimeError(Low) > 0.0) && (Expansion < MAX_LAMBERT_EXPANSIONS); Expansion++)
+    {
+        Low *= 2.0;
+    }
+
+    if ((TimeError(Low) > 0.0) || (TimeError(High) < 0.0))
+    {
+        return false;
+    }
+
+    double Z = 0.0;
+    bool Converged = false;
+
+    for (int Iteration = 0; Iteration < MAX_LAMBERT_ITERATIONS; Iteration++)
+    {
+        const double Error = TimeError(Z);
+
+        if (Abs(Error) <= 1.0E-12 * TimeOfFlight)
+        {
+            Converged = true;
+            break;
+        }
+
+        if (Error < 0.0)
+        {
+            Low = Z;
+        }
+        else
+        {
+            High = Z;
+        }
+
+        // Newton step from the derivative of the time of flight, safeguarded by bisection
+        const CCoefficents C = CalculateCoefficients(Z);
+        const double YValue = Y(Z, C);
+        double Derivative = 0.0;
+
+        if (Abs(Z) > 1.0E-6)
+        {
+            Derivative = Sqrt(Cube(YValue / C.C2)) * ((C.C2 - 1.5 * C.C3 / C.C2) / (2.0 * Z) + 0.75 * Square(C.C3) / C.C2) +
+                         A / 8.0 * (3.0 * C.C3 / C.C2 * Sqrt(YValue) + A * Sqrt(C.C2 / YValue));
+        }
+        else
+        {
+            Derivative = Sqrt(2.0) / 40.0 * Sqrt(Cube(YValue)) + A / 8.0 * (Sqrt(YValue) + A * Sqrt(0.5 / YValue));
+        }
+
+        double Next = Z - Error * SqrtMu / Derivative;
+
+        if ((IsFinite(Next) == false) || (Next <= Low) || (Next >= High))
+        {
+            Next = 0.5 * (Low + High);
+        }
+
+        if (Abs(Next - Z) <= 1.0E-15 * Max(1.0, Abs(Z)))
+        {
+            Converged = true;
+            break;
+        }
+
+        Z = Next;
+    }
+
+    if (Converged == false)
+    {
+        return false;
+    }
+
+    const double YValue = Y(Z, CalculateCoefficients(Z));
+    const double F = 1.0 - YValue / Radius1;
+    const double G = A * Sqrt(YValue / GravitationalParameter);
+    const double GDot = 1.0 - YValue / Radius2;
+
+    InitialVelocity = (Final - Initial * F) / G;
+    FinalVelocity = (Final * GDot - Initial) / G;
+    return true;
+}
+
+TwoBody::InitialOrbitSolution TwoBody::Gibbs(const PositionTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits) noexcept
+{
+    if (IsIncreasing(Triplet.Times) == false)
+    {
+        return InitialOrbitSolution{.Status = InitialOrbitStatus::DEGENERATE_GEOMETRY};
+    }
+
+    if (Coplanarity(Triplet) > Limits.MaxCoplanarity)
+    {
+        return InitialOrbitSolution{.Status = InitialOrbitStatus::NOT_COPLANAR};
+    }
+
+    const Vector3& R1 = Triplet.Positions[0];
+    const Vector3& R2 = Triplet.Positions[1];
+    const Vector3& R3 = Triplet.Positions[2];
+    const double Radius1 = R1.Norm();
+    const double Radius2 = R2.Norm();
+    const double Radius3 = R3.Norm();
+
+    const Vector3 Z12 = R1.Cross(R2);
+    const Vector3 Z23 = R2.Cross(R3);
+    const Vector3 Z31 = R3.Cross(R1);
+
+    const Vector3 N = Z23 * Radius1 + Z31 * Radius2 + Z12 * Radius3;
+    const Vector3 D = Z12 + Z23 + Z31;
+    const Vector3 S = R1 * (Radius2 - Radius3) + R2 * (Radius3 - Radius1) + R3 * (Radius1 - Radius2);
+    const double ND = N.Norm() * D.Norm();
+
+    if ((ND <= 0.0) || (N.Dot(D) <= 0.0))
+    {
+        return InitialOrbitSolution{.Status = InitialOrbitStatus::NO_SOLUTION};
+    }
+
+    const Vector3 Velocity = (D.Cross(R2) / Radius2 + S) * Sqrt(GravitationalParameter / ND);
+    return Finalise(Triplet.Times[1], R2, Velocity, GravitationalParameter, Limits);
+}
+
+TwoBody::InitialOrbitSolution TwoBody::HerrickGibbs(const PositionTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits) noexcept
+{
+    if (IsIncreasing(Triplet.Times) == false)
+    {
+        return InitialOrbitSolution{.Status = InitialOrbitStatus::DEGENERATE_GEOMETRY};
+    }
+
+    if (Coplanarity(Triplet) > Limits.MaxCoplanarity)
+    {
+        return InitialOrbitSolution{.Status = InitialOrbitStatus::NOT_COPLANAR};
+    }
+
+    const double Dt21 = Triplet.Times[1] - Triplet.Times[0];
+    const double Dt32 = Triplet.Times[2] - Triplet.Times[1];
+    const double Dt31 = Triplet.Times[2] - Triplet.Times[0];
+    const double Mu = GravitationalParameter / 12.0;
+
+    const Vector3& R1 = Triplet.Positions[0];
+    const Vector3& R2 = Triplet.Positions[1];
+    const Vector3& R3 = Triplet.Positions[2];
+
+    const Vector3 Velocity = R1 * (-Dt32 * (1.0 / (Dt21 * Dt31) + Mu / Cube(R1.Norm()))) +
+                             R2 * ((Dt32 - Dt21) * (1.0 / (Dt21 * Dt32) + Mu / Cube(R2.Norm()))) +
+                             R3 * (Dt21 * (1.0 / (Dt32 * Dt31) + Mu / Cube(R3.Norm())));
+
+    return Finalise(Triplet.Times[1], R2, Velocity, GravitationalParameter, Limits);
+}
+
+TwoBody::InitialOrbitSolution TwoBody::Gauss(const AnglesTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits) noexcept
+{
+    std::array<double, 3> Ranges{};
+    Vector3 Velocity = Vector3::ZERO();
+
+    const InitialOrbitStatus Status = SolveGauss(Triplet, GravitationalParameter, Limits, Ranges, Velocity);
+
+    if (Status != InitialOrbitStatus::SUCCESS)
+    {
+        return InitialOrbitSolution{.Status = Status};
+    }
+
+    return Finalise(Triplet.Times[1], Triplet.Sites[1] + Triplet.Directions[1] * Ranges[1], Velocity, GravitationalParameter, Limits);
+}
+
+TwoBody::InitialOrbitSolution TwoBody::Gooding(const AnglesTriplet& Triplet, double GravitationalParameter, const InitialOrbitLimits& Limits) noexcept
+{
+    std::array<double, 3> Ranges{};
+    Vector3 Velocity = Vector3::ZERO();
+
+    // The unrefined Gauss ranges suffice as a starting point where the refinement fails
+    const InitialOrbitStatus Status = SolveGauss(Triplet, GravitationalParameter, Limits, Ranges, Velocity);
+
+    if ((Status != InitialOrbitStatus::SUCCESS) && (Status != InitialOrbitStatus::NOT_CONVERGED))
+    {
+        return InitialOrbitSolution{.Status = Status};
+    }
+
+    const Vector3 Normal = (Triplet.Sites[1] + Triplet.Directions[1] * Ranges[1]).Cross(Velocity);
+
+    // Directions perpendicular to the middle line of sight
+    const Vector3& Sight = Triplet.Directions[1];
+    const Vector3 Axis = (Abs(Sight.X) < 0.5) ? Vector3::UNIT_X() : Vector3::UNIT_Y();
+    const Vector3 Across = Sight.Cross(Axis).Unit();
+    const Vector3 Along = Sight.Cross(Across);
+
+    double Range1 = Ranges[0];
+    double Range3 = Ranges[2];
+    double Miss[2] = {};
+    Vector3 Position = Vector3::ZERO();
+
+    for (int Iteration = 0; Iteration < MAX_GOODING_ITERATIONS; Iteration++)
+    {
+        if ((Range1 <= 0.0) || (Range3 <= 0.0) ||
+            (GoodingMiss(Triplet, GravitationalParameter, Normal, Across, Along, Range1, Range3, Miss, Position, Velocity) == false))
+        {
+            return InitialOrbitSolution{.Status = InitialOrbitStatus::NOT_CONVERGED};
+        }
+
+        if (Sqrt(Square(Miss[0]) + Square(Miss[1])) < GOODING_TOLERANCE)
+        {
+            return Finalise(Triplet.Times[1], Position, Velocity, GravitationalParameter, Limits);
+        }
+
+        // Jacobian of the miss with respect to the end ranges, by forward differences
+        const double Step1 = GOODING_STEP * Range1;
+        const double Step3 = GOODING_STEP * Range3;
+        double Miss1[2] = {};
+        double Miss3[2] = {};
+        Vector3 UnusedPosition = Vector3::ZERO();
+        Vector3 UnusedVelocity = Vector3::ZERO();
+
+        if ((GoodingMiss(Triplet, GravitationalParameter, Normal, Across, Along, Range1 + Step1, Range3, Miss1, UnusedPosition, UnusedVelocity) == false) ||
+            (GoodingMiss(Triplet, GravitationalParameter, Normal, Across, Along, Range1, Range3 + Step3, Miss3, UnusedPosition, UnusedVelocity) == false))
+        {
+            return InitialOrbitSolution{.Status = InitialOrbitStatus::NOT_CONVERGED};
+        }
+
+        const double J11 = (Miss1[0] - Miss[0]) / Step1;
+        const double J21 = (Miss1[1] - Miss[1]) / Step1;
+        const double J13 = (Miss3[0] - Miss[0]) / Step3;
+        const double J23 = (Miss3[1] - Miss[1]) / Step3;
+        const double Determinant = J11 * J23 - J13 * J21;
+
+        if (Determinant == 0.0)
+        {
+            return InitialOrbitSolution{.Status = InitialOrbitStatus::NOT_CONVERGED};
+        }
+
+        double Delta1 = -(J23 * Miss[0] - J13 * Miss[1]) / Determinant;
+        double Delta3 = -(J11 * Miss[1] - J21 * Miss[0]) / Determinant;
+
+        // Halve steps which would place the object behind either site
+        while ((Range1 + Delta1 <= 0.0) || (Range3 + Delta3 <= 0.0))
+        {
+            Delta1 *= 0.5;
+            Delta3 *= 0.5;
+        }
+
+        Range1 += Delta1;
+        Range3 += Delta3;
+    }
+
+    return InitialOrbitSolution{.Status = InitialOrbitStatus::NOT_CONVERGED};
+}
+
+void TwoBody::SolveBatch(ThreadPool& Pool, std::span<const PositionTriplet> Triplets, PositionMethod Method, double GravitationalParameter,
+    const InitialOrbitLimits& Limits, std::span<InitialOrbitSolution> Solutions)
+{
+    if (Triplets.size() != Solutions.size())
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    Pool.ParallelFor(Triplets.size(), TRIPLET_GRAIN, [&](size_t Index)
+    {
+        const PositionTriplet& Triplet = Triplets[Index];
+        bool Close = (Method == PositionMethod::HERRICK_GIBBS);
+
+        if (Method == PositionMethod::AUTOMATIC)
+        {
+            const double Separation12 = Atan2(Triplet.Positions[0].Cross(Triplet.Positions[1]).Norm(), Triplet.Positions[0].Dot(Triplet.Positions[1]));
+            const double Separation23 = Atan2(Triplet.Positions[1].Cross(Triplet.Positions[2]).Norm(), Triplet.Positions[1].Dot(Triplet.Positions[2]));
+            Close = Max(Separation12, Separation23) < HERRICK_GIBBS_SEPARATION;
+        }
+
+        Solutions[Index] = Close ? HerrickGibbs(Triplet, GravitationalParameter, Limits) : Gibbs(Triplet, GravitationalParameter, Limits);
+    });
+}
+
+void TwoBody::SolveBatch(ThreadPool& Pool, std::span<const AnglesTriplet> Triplets, AnglesMethod Method, double GravitationalParameter,
+    const InitialOrbitLimits& Limits, std::span<InitialOrbitSolution> Solutions)
+{
+    if (Triplets.size() != Solutions.size())
+    {
+        throw Error::HArraySizeMismatch(__FILE__, __LINE__);
+    }
+
+    Pool.ParallelFor(Triplets.size(), TRIPLET_GRAIN, [&](size_t Index)
+    {
+        Solutions[Index] = (Method == AnglesMethod::GAUSS) ? Gauss(Triplets[Index], GravitationalParameter, Limits) :
+                                                             Gooding(Triplets[Index], GravitationalParameter, Limits);
+    });
+}
@@ -0,0 +1,273 @@
+#include "twobody/mean_elements.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/root1d.hpp"
+
+namespace
+{
+    // Solution of Kepler's equation, converged to near machine precision
+    constexpr RootFind::NewtonParameters KEPLER_PARAMETERS{.Tolerance = 1.0E-14, .MaxIterations = 64};
+
+    // Orbits converted or propagated in sequence by each thread of a batch
+    constexpr size_t ELEMENT_GRAIN = 256;
+
+    // Magnitude of 1 - 5 cos^2 I, within about 0.7 degrees of the critical inclination, below
+    // which the singular long period terms are dropped
+    constexpr double CRITICAL_TOLERANCE = 0.05;
+
+    /**
+     * @return Angle wrapped into [0, 2 PI)
+     */
+    double Wrap(double Angle) noexcept
+    {
+        return Angle - 2.0 * PI * Floor(Angle / (2.0 * PI));
+    }
+
+    /**
+     * @return Argument of perigee of the elements, zero for a circular orbit
+     */
+    double PerigeeOf(const TwoBody::KeplerianElements& Elements) noexcept
+    {
+        return TwoBody::IsCircular(Elements) ? 0.0 : Elements.ArgumentPerigee;
+    }
+
+    /**
+     * @return True anomoly of the elements, measured from the node for a circular orbit
+     */
+    double TrueAnomolyOf(const TwoBody::KeplerianElements& Elements) noexcept
+    {
+        return TwoBody::IsCircular(Elements) ? Elements.ArgumentLatitude : Elements.TrueAnomoly;
+    }
+
+    /**
+     * @return Mean anomoly of a closed orbit from its true anomoly
+     */
+    double TrueToMeanAnomoly(double TrueAnomoly, double Eccentricity) noexcept
+    {
+        return TwoBody::EccentricToMeanAnomoly(TwoBody::TrueToEccentricAnomoly(TrueAnomoly, Eccentricity), Eccentricity);
+    }
+
+    /**
+     * @return True anomoly of a closed orbit from its mean anomoly, within (-PI, PI]
+     */
+    double MeanToTrueAnomoly(double MeanAnomoly, double Eccentricity) noexcept
+    {
+        const double Wrapped = Wrap(MeanAnomoly);
+
+        // Kepler's equation, from an initial guess which converges for any eccentricity
+        const auto Result = RootFind::Newton(
+            [=](double E) {return E - Eccentricity * Sin(E) - Wrapped;},
+            [=](double E) {return 1.0 - Eccentricity * Cos(E);},
+            (Eccentricity < 0.8) ? Wrapped : PI,
+            KEPLER_PARAMETERS);
+
+        return TwoBody::EccentricToTrueAnomoly(Result.X, Eccentricity);
+    }
+
+    /**
+     * @return Elements of a closed orbit, with every special case angle consistent with the
+     * node, perigee and true anomoly
+     */
+    TwoBody::KeplerianElements MakeElements(double GravitationalParameter, double SemiMajorAxis, double Eccentricity, double Inclination,
+        double Node, double ArgumentPerigee, double TrueAnomoly) noexcept
+    {
+        return TwoBody::KeplerianElements{
+            .SemiParameter = SemiMajorAxis * (1.0 - Square(Eccentricity)),
+            .SemiMajorAxis = SemiMajorAxis,
+            .Eccentricity = Eccentricity,
+            .Inclination = Inclination,
+            .Node = Wrap(Node),
+            .ArgumentPerigee = Wrap(ArgumentPerigee),
+            .TrueAnomoly = Wrap(TrueAnomoly),
+            .TrueLongitudeOfPeriapsis = Wrap(Node + ArgumentPerigee),
+            .ArgumentLatitude = Wrap(ArgumentPerigee + TrueAnomoly),
+            .TrueLongitude = Wrap(Node + ArgumentPerigee + TrueAnomoly),
+            .GravitationalParameter = GravitationalParameter};
+    }
+
+    /**
+     * First order mapping between the mean and osculating elements of Brouwer and Lyddane.
+     * The mapping is its own inverse to first order with the sign of J2 reversed
+     * @param Elements Mean or osculating elements
+     * @param Body Oblateness of the central body
+     * @param Sign One to map from mean to osculating, negative one from osculating to mean
+     * @return Osculating or mean elements
+     */
+    TwoBody::KeplerianElements BrouwerLyddane(const TwoBody::KeplerianElements& Elements, const TwoBody::Oblateness& Body, double Sign) noexcept
+    {
+        const double A = Elements.SemiMajorAxis;
+        const double E = Elements.Eccentricity;
+        const double I = Elements.Inclination;
+        const double Node = Elements.Node;
+        const double W = PerigeeOf(Elements);
+        const double F = TrueAnomolyOf(Elements);
+        const double M = TrueToMeanAnomoly(F, E);
+
+        const double Gamma = Sign * 0.5 * Body.J2 * Square(Body.Radius / A);
+        const double Eta = Sqrt(1.0 - Square(E));
+        const double GammaPrime = Gamma / Quart(Eta);
+        const double RadiusRatio = (1.0 + E * Cos(F)) / Square(Eta);
+
+        const double C = Cos(I);
+        const double C2 = Square(C);
+        const double S2 = 1.0 - C2;
+        const double Critical = 1.0 - 5.0 * C2;
+        const bool NearCritical = Abs(Critical) < CRITICAL_TOLERANCE;
+        const double CosF = Cos(F);
+        const double SinF = Sin(F);
+
+        // Difference of the true and mean anomolies, the equation of the centre, within (-PI, PI]
+        const double EquationOfCentre = Wrap(F - M + PI) - PI + E * SinF;
+
+        // Short period terms in the argument of latitude and its multiples
+        const double Cos2W2F = Cos(2.0 * W + 2.0 * F);
+        const double Sin2W2F = Sin(2.0 * W + 2.0 * F);
+        const double Cos2WF = Cos(2.0 * W + F);
+        const double Sin2WF = Sin(2.0 * W + F);
+        const double Cos2W3F = Cos(2.0 * W + 3.0 * F);
+        const double Sin2W3F = Sin(2.0 * W + 3.0 * F);
+        const double Cos2W = Cos(2.0 * W);
+        const double Sin2W = Sin(2.0 * W);
+
+        // Long period terms, singular at the critical inclination, where they are dropped. The
+        // factor 1 - 11 cos^2 I - 40 cos^4 I / (1 - 5 cos^2 I) is written with its root at the
+        // equator factored out
+        const double LongGamma = NearCritical ? 0.0 : GammaPrime;
+        const double Divisor = NearCritical ? 1.0 : Critical;
+        const double LongPeriod = S2 * (1.0 - 15.0 * C2) / Divisor;
+        const double NodeLongPeriod = 11.0 + 80.0 * C2 / Divisor + 200.0 * Square(C2) / Square(Divisor);
+        const double CentreCubic = 3.0 * CosF + 3.0 * E * Square(CosF) + Square(E) * Cube(CosF);
+
+        const double SemiMajorAxis = A + A * Gamma * ((3.0 * C2 - 1.0) * (Cube(RadiusRatio) - 1.0 / Cube(Eta))
+            + 3.0 * S2 * Cube(RadiusRatio) * Cos2W2F);
+
+        const double DeltaE1 = LongGamma / 8.0 * E * Square(Eta) * LongPeriod * Cos2W;
+        const double DeltaE = DeltaE1 + 0.5 * Square(Eta) * (Gamma * ((3.0 * C2 - 1.0) / Cube(Square(Eta)) * (E * Eta + E / (1.0 + Eta) + CentreCubic)
+            + 3.0 * S2 / Cube(Square(Eta)) * (E + CentreCubic) * Cos2W2F) - GammaPrime * S2 * (3.0 * Cos2WF + Cos2W3F));
+
+        // The long period term e dE1 / (eta^2 tan I), which vanishes at the equator with its factor
+        // of sin^2 I
+        const double DeltaI = -LongGamma / 8.0 * Square(E) * C * Sqrt(S2) * (1.0 - 15.0 * C2) / Divisor * Cos2W
+            + 0.5 * GammaPrime * C * Sqrt(S2) * (3.0 * Cos2W2F + 3.0 * E * Cos2WF + E * Cos2W3F);
+
+        const double LatitudeTerms = 6.0 * EquationOfCentre - 3.0 * Sin2W2F - 3.0 * E * Sin2WF - E * Sin2W3F;
+        const double DeltaNode = -LongGamma / 8.0 * Square(E) * C * NodeLongPeriod * Sin2W - 0.5 * GammaPrime * C * LatitudeTerms;
+
+        // Sum of the mean anomoly, perigee and node, the mean longitude, which is free of the
+        // small divisors of its parts
+        const double Longitude = M + W + Node + LongGamma / 8.0 * Cube(Eta) * LongPeriod * Sin2W
+            - LongGamma / 16.0 * (2.0 + Square(E) - 11.0 * (2.0 + 3.0 * Square(E)) * C2 - 40.0 * (2.0 + 5.0 * Square(E)) * Square(C2) / Divisor
+                - 400.0 * Square(E) * Cube(C2) / Square(Divisor)) * Sin2W
+            + GammaPrime / 4.0 * (-6.0 * Critical * EquationOfCentre + (3.0 - 5.0 * C2) * (3.0 * Sin2W2F + 3.0 * E * Sin2WF + E * Sin2W3F))
+            + DeltaNode;
+
+        const double RatioEta = Square(RadiusRatio * Eta);
+        const double EDeltaM = LongGamma / 8.0 * E * Cube(Eta) * LongPeriod * Sin2W
+            - GammaPrime / 4.0 * Cube(Eta) * (2.0 * (3.0 * C2 - 1.0) * (RatioEta + RadiusRatio + 1.0) * SinF
+                + 3.0 * S2 * ((-RatioEta - RadiusRatio + 1.0) * Sin2WF + (RatioEta + RadiusRatio + 1.0 / 3.0) * Sin2W3F));
+
+        // Eccentricity and mean anomoly, and inclination and node, recombined without division
+        // by the eccentricity or the sine of the inclination
+        const double D1 = (E + DeltaE) * Sin(M) + EDeltaM * Cos(M);
+        const double D2 = (E + DeltaE) * Cos(M) - EDeltaM * Sin(M);
+        const double MeanAnomoly = Atan2(D1, D2);
+        const double Eccentricity = Sqrt(Square(D1) + Square(D2));
+
+        const double SinHalf = Sin(0.5 * I);
+        const double CosHalf = Cos(0.5 * I);
+        const double D3 = (SinHalf + 0.5 * CosHalf * DeltaI) * Sin(Node) + SinHalf * DeltaNode * Cos(Node);
+        const double D4 = (SinHalf + 0.5 * CosHalf * DeltaI) * Cos(Node) - SinHalf * DeltaNode * Sin(Node);
+        const double MappedNode = Atan2(D3, D4);
+        const double Inclination = 2.0 * Asin(Min(Sqrt(Square(D3) + Square(D4)), 1.0));
+        const double ArgumentPerigee = Longitude - MeanAnomoly - MappedNode;
+
+        return MakeElements(Elements.GravitationalParameter, SemiMajorAxis, Eccentricity, Inclination, MappedNode, ArgumentPerigee,
+            MeanToTrueAnomoly(MeanAnomoly, Eccentricity));
+    }
+}
+
+TwoBody::SecularRates TwoBody::J2SecularRates(const KeplerianElements& Mean, const Oblateness& Body) noexcept
+{
+    const double Eta = Sqrt(1.0 - Square(Mean.Eccentricity));
+    const double MeanMotion = Sqrt(Mean.GravitationalParameter / Cube(Mean.SemiMajorAxis));
+    const double Gamma = 0.5 * Body.J2 * Square(Body.Radius / Mean.SemiMajorAxis) / Quart(Eta);
+    const double C = Cos(Mean.Inclination);
+    const double C2 = Square(C);
+    const double C4 = Square(C2);
+    const double Eta2 = Square(Eta);
+
+    // First order terms, and the second order terms in J2 squared of Brouwer
+    return SecularRates{
+        .Node = MeanMotion * (-3.0 * Gamma * C
+            + 0.375 * Square(Gamma) * ((-5.0 + 12.0 * Eta + 9.0 * Eta2) * C + (-35.0 - 36.0 * Eta - 5.0 * Eta2) * C * C2)),
+        .ArgumentPerigee = MeanMotion * (1.5 * Gamma * (5.0 * C2 - 1.0)
+            + 3.0 / 32.0 * Square(Gamma) * (-35.0 + 24.0 * Eta + 25.0 * Eta2 + (90.0 - 192.0 * Eta - 126.0 * Eta2) * C2
+                + (385.0 + 360.0 * Eta + 45.0 * Eta2) * C4)),
+        .MeanAnomoly = MeanMotion * (1.0 + 1.5 * Gamma * Eta * (3.0 * C2 - 1.0)
+            + 3.0 / 32.0 * Square(Gamma) * Eta * (-15.0 + 16.0 * Eta + 25.0 * Eta2 + (30.0 - 96.0 * Eta - 90.0 * Eta2) * C2
+                + (105.0 + 144.0 * Eta + 25.0 * Eta2) * C4))};
+}
+
+TwoBody::KeplerianElements TwoBody::PropagateMean(const KeplerianElements& Mean, double DeltaTime, const Oblateness& Body) noexcept
+{
+    const SecularRates Rates = J2SecularRates(Mean, Body);
+    const double Eccentricity = Mean.Eccentricity;
+    const double MeanAnomoly = TrueToMeanAnomoly(TrueAnomolyOf(Mean), Eccentricity) + Rates.MeanAnomoly * DeltaTime;
+
+    return MakeElements(Mean.GravitationalParameter, Mean.SemiMajorAxis, Eccentricity, Mean.Inclination,
+        Mean.Node + Rates.Node * DeltaTime,
+        PerigeeOf(Mean) + Rates.ArgumentPerigee * DeltaTime,
+        MeanToTrueAnomoly(MeanAnomoly, Eccentricity));
+}
+
+TwoBody::KeplerianElements TwoBody::MeanToOsculating(const KeplerianElements& Mean, const Oblateness& Body) noexcept
+{
+    return BrouwerLyddane(Mean, Body, 1.0);
+}
+
+TwoBody::KeplerianElements TwoBody::OsculatingToMean(const KeplerianElements& Osculating, const Oblateness& Body) noexcept
+{
+    return BrouwerLyddane(Osculating, Body, -1.0);
+}
+
+Vector3 TwoBody::OblateAcceleration(const Vector3& Position, double GravitationalParameter, const Oblateness& Body) noexcept
+{
+    const double RadiusSquared = Position.NormSquared();
+    const double Radius = Sqrt(RadiusSquared);
+    const double PointMass = -GravitationalParameter / (RadiusSquared * Radius);
+
+    // Gradient of the second zonal harmonic of the potential
+    const double Zonal = -1.5 * Body.J2 * GravitationalParameter * Square(Body.Radius) / Square(RadiusSquared) / Radius;
+    const double Polar = 5.0 * Square(Position.Z) / RadiusSquared;
+
+    return Vector3({
+        (PointMass + Zonal * (1.0 - Polar)) * Position.X,
+        (PointMass + Zonal * (1.0 - Polar)) * Position.Y,
+        (PointMass + Zonal * (3.0 - Polar)) * Position.Z});
+}
+
+void TwoBody::PropagateMean(ThreadPool& Pool, std::span<const KeplerianElements> Mean, double DeltaTime,
+    std::span<KeplerianElements> Propagated, const Oblateness& Body) noexcept
+{
+    Pool.ParallelFor(Mean.size(), ELEMENT_GRAIN, [&](size_t Index)
+    {
+        Propagated[Index] = PropagateMean(Mean[Index], DeltaTime, Body);
+    });
+}
+
+void TwoBody::MeanToOsculating(ThreadPool& Pool, std::span<const KeplerianElements> Mean, std::span<KeplerianElements> Osculating,
+    const Oblateness& Body) noexcept
+{
+    Pool.ParallelFor(Mean.size(), ELEMENT_GRAIN, [&](size_t Index)
+    {
+        Osculating[Index] = BrouwerLyddane(Mean[Index], Body, 1.0);
+    });
+}
+
+void TwoBody::OsculatingToMean(ThreadPool& Pool, std::span<const KeplerianElements> Osculating, std::span<KeplerianElements> Mean,
+    const Oblateness& Body) noexcept
+{
+    Pool.ParallelFor(Osculating.size(), ELEMENT_GRAIN, [&](size_t Index)
+    {
+        Mean[Index] = BrouwerLyddane(Osculating[Index], Body, -1.0);
+    });
+}
@@ -1,38 +1,49 @@
 #include "twobody/orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/root1d.hpp"
+
+namespace
+{
+    // Solution of Kepler's equation, converged to near machine precision
+    constexpr RootFind::NewtonParameters KEPLER_PARAMETERS{.Tolerance = 1.0E-14, .MaxIterations = 64};
+
+    // Orbits updated in sequence by each thread of a bulk update
+    constexpr size_t UPDATE_GRAIN = 64;
+}
 
 double TwoBody::Orbit::DeltaTimeFromTrueAnomoly(double TrueAnomoly) const noexcept
 {
     // Orbital elements are invalid    
-    if (mClassification == OrbitClassification::INVALID)
+    if (mState.Classification == OrbitClassification::INVALID)
     {
         return Infinity<double>();
     }
 
     // Circular orbit
-    if (IsCircular(mElements) == true)
+    if (IsCircular(mState.Elements) == true)
     {
-        return mMeanRadialPeriod * TrueAnomoly;
+        return mState.MeanRadialPeriod * TrueAnomoly;
     }
     // Elliptical orbit
-    if (IsClosed(mElements) == true)
+    if (IsClosed(mState.Elements) == true)
     {
-        const double DeltaTrueAnomoly = TrueAnomoly - mElements.TrueAnomoly;
-        const double Polarity = Signum(DeltaTrueAnomoly);
-        const double FullRevolutions = Floor(Polarity * DeltaTrueAnomoly / (2.0 * PI));
-
-        const double TrueAnomolyEnd = TrueAnomoly - Polarity * FullRevolutions;
-        const double AnomolyEnd = TrueToEccentricAnomoly(TrueAnomolyEnd, mElements.Eccentricity);
-        const double MeanAnomolyEnd = TwoBody::EccentricToMeanAnomoly(AnomolyEnd, mElements.Eccentricity);
+        // Mean anomoly, continuous over whole revolutions of the true anomoly
+        const auto Unwrapped = [this](double Anomoly) noexcept
+        {
+            const double Revolutions = Floor((Anomoly + PI) / (2.0 * PI));
+            const double Eccentric = TrueToEccentricAnomoly(Anomoly - 2.0 * PI * Revolutions, mState.Elements.Eccentricity);
+            return 2.0 * PI * Revolutions + TwoBody::EccentricToMeanAnomoly(Eccentric, mState.Elements.Eccentricity);
+        };
 
-        return mMeanRadialPeriod * (2.0 * PI * FullRevolutions + (MeanAnomolyEnd - mMeanAnomoly) );
+        return mState.MeanRadialPeriod * (Unwrapped(TrueAnomoly) - Unwrapped(mState.Elements.TrueAnomoly));
     }
     // Hyperbolic or parabolic trajectory
     else
     {
         // Check for valid hyperbolic range    
-        if (mClassification == OrbitClassification::HYPERBOLIC)
+        if (mState.Classification == OrbitClassification::HYPERBOLIC)
         {
-            const double CriticalAngle = Acos(1.0 / mElements.Eccentricity);
+            const double CriticalAngle = Acos(1.0 / mState.Elements.Eccentricity);
             if ((TrueAnomoly > PI - CriticalAngle) || (TrueAnomoly < -PI + CriticalAngle))
             {
                 // Input anomoly is out of bounds    
@@ -40,79 +51,122 @@ double TwoBody::Orbit::DeltaTimeFromTrueAnomoly(double TrueAnomoly) const noexce
             }
         }
 
-        const double AnomolyEnd = TrueToEccentricAnomoly(TrueAnomoly, mElements.Eccentricity);
-        const double MeanAnomolyEnd = TwoBody::EccentricToMeanAnomoly(AnomolyEnd, mElements.Eccentricity);
+        const double AnomolyEnd = TrueToEccentricAnomoly(TrueAnomoly, mState.Elements.Eccentricity);
+        const double MeanAnomolyEnd = TwoBody::EccentricToMeanAnomoly(AnomolyEnd, mState.Elements.Eccentricity);
 
-        return mMeanRadialPeriod * ( MeanAnomolyEnd - mMeanAnomoly );                
+        return mState.MeanRadialPeriod * ( MeanAnomolyEnd - mState.MeanAnomoly );                
     }
 }
 
 TwoBody::Orbit::Orbit(const KeplerianElements& Elements) noexcept : 
-    mElements{Elements},
-    mClassification{ClassifyOrbit(mElements)},
-    mEccentricAnomoly{TwoBody::TrueToEccentricAnomoly(mElements.TrueAnomoly, mElements.Eccentricity)},
-    mMeanRadialPeriod{TwoBody::CalculateMeanRadialPeriod(mElements)},
-    mPeriod{(IsClosed(mElements) == true) ? 2.0 * PI * mMeanRadialPeriod : Infinity<double>()},
-    mRadius{TwoBody::CalculateRadius(mElements)},
-    mMeanAnomoly{TwoBody::EccentricToMeanAnomoly(mEccentricAnomoly, mElements.Eccentricity)},
+    mState{.Elements = Elements, .Classification = ClassifyOrbit(Elements)},
     mDynamicIndex({
         .PtrMapDouble = {
-            {"Semiparameter", &mElements.SemiParameter},
-            {"SemiMajorAxis", &mElements.SemiMajorAxis},
-            {"Eccentricity", &mElements.Eccentricity},
-            {"Inclination", &mElements.Inclination},
-            {"Node", &mElements.Node},
-            {"TrueAnomoly", &mElements.TrueAnomoly},
-            {"TrueLongitude", &mElements.TrueLongitude},
-            {"TrueLongitudeOfPeriapsis", &mElements.TrueLongitudeOfPeriapsis},
-            {"ArgumentLatitude", &mElements.ArgumentLatitude},
-            {"ArgumentPerigee", &mElements.ArgumentPerigee},
-            {"GravitationalParameter", &mElements.GravitationalParameter},
-            {"Period", &mPeriod},
-            {"EccentricAnomoly", &mEccentricAnomoly},
-            {"MeanRadialPeriod", &mMeanRadialPeriod},
-            {"Radius", &mRadius},
-            {"MeanAnomoly", &mMeanAnomoly}
+            {"Semiparameter", &mState.Elements.SemiParameter},
+            {"SemiMajorAxis", &mState.Elements.SemiMajorAxis},
+            {"Eccentricity", &mState.Elements.Eccentricity},
+            {"Inclination", &mState.Elements.Inclination},
+            {"Node", &mState.Elements.Node},
+            {"TrueAnomoly", &mState.Elements.TrueAnomoly},
+            {"TrueLongitude", &mState.Elements.TrueLongitude},
+            {"TrueLongitudeOfPeriapsis", &mState.Elements.TrueLongitudeOfPeriapsis},
+            {"ArgumentLatitude", &mState.Elements.ArgumentLatitude},
+            {"ArgumentPerigee", &mState.Elements.ArgumentPerigee},
+            {"GravitationalParameter", &mState.Elements.GravitationalParameter},
+            {"Period", &mState.Period},
+            {"EccentricAnomoly", &mState.EccentricAnomoly},
+            {"MeanRadialPeriod", &mState.MeanRadialPeriod},
+            {"Radius", &mState.Radius},
+            {"MeanAnomoly", &mState.MeanAnomoly}
         }
     })
 {
-    
+    mState.EccentricAnomoly = TwoBody::TrueToEccentricAnomoly(mState.Elements.TrueAnomoly, mState.Elements.Eccentricity);
+    mState.MeanRadialPeriod = TwoBody::CalculateMeanRadialPeriod(mState.Elements);
+    mState.Period = (IsClosed(mState.Elements) == true) ? 2.0 * PI * mState.MeanRadialPeriod : Infinity<double>();
+    mState.Radius = TwoBody::CalculateRadius(mState.Elements);
+    mState.MeanAnomoly = TwoBody::EccentricToMeanAnomoly(mState.EccentricAnomoly, mState.Elements.Eccentricity);
 }
 
 TwoBody::DeltaTimeAnomoly TwoBody::Orbit::AnomolyFromDeltaTime(double DeltaTime) const noexcept
 {
 
     // Orbital elements are invalid    
-    if (mClassification == OrbitClassification::INVALID)
+    if (mState.Classification == OrbitClassification::INVALID)
     {
         return DeltaTimeAnomoly{};
     }
-    // Circular orbit
-    else if (IsCircular(mElements) == true)
+    // Circular orbit, the anomoly is measured by the true longitude
+    else if (IsCircular(mState.Elements) == true)
     {
+        const double Longitude = mState.Elements.TrueLongitude + DeltaTime / mState.MeanRadialPeriod;
+        const double Revolutions = Floor(Longitude / (2.0 * PI));
+        const double Anomoly = Longitude - 2.0 * PI * Revolutions;
+
         return DeltaTimeAnomoly{
-            .EccentricAnomoly = Fmod(DeltaTime, mPeriod),
-            .NumberRevolutions = static_cast<int>(Floor(DeltaTime / mPeriod))
+            .MeanAnomoly = Anomoly,
+            .EccentricAnomoly = Anomoly,
+            .NumberRevolutions = static_cast<int32_t>(Revolutions - Floor(mState.Elements.TrueLongitude / (2.0 * PI)))
         };
     }
     // Elliptical orbit
-    if (IsClosed(mElements) == true)
+    if (IsClosed(mState.Elements) == true)
     {
-        return DeltaTimeAnomoly{};
+        const double Eccentricity = mState.Elements.Eccentricity;
+        const double Mean = mState.MeanAnomoly + DeltaTime / mState.MeanRadialPeriod;
+        const double Revolutions = Floor(Mean / (2.0 * PI));
+        const double MeanAnomoly = Mean - 2.0 * PI * Revolutions;
+
+        // Kepler's equation, from an initial guess which converges for any eccentricity
+        const auto Result = RootFind::Newton(
+            [=](double E) {return E - Eccentricity * Sin(E) - MeanAnomoly;},
+            [=](double E) {return 1.0 - Eccentricity * Cos(E);},
+            (Eccentricity < 0.8) ? MeanAnomoly : PI,
+            KEPLER_PARAMETERS);
+
+        return DeltaTimeAnomoly{
+            .MeanAnomoly = MeanAnomoly,
+            .EccentricAnomoly = Result.X,
+            .NumberRevolutions = static_cast<int32_t>(Revolutions - Floor(mState.MeanAnomoly / (2.0 * PI)))
+        };
     }
     // Hyperbolic trajectory
-    else if (mClassification == OrbitClassification::HYPERBOLIC)
+    else if (mState.Classification == OrbitClassification::HYPERBOLIC)
     {
-        return DeltaTimeAnomoly{};
+        const double Eccentricity = mState.Elements.Eccentricity;
+        const double MeanAnomoly = mState.MeanAnomoly + DeltaTime / mState.MeanRadialPeriod;
+
+        // Initial guess of Vallado, Algorithm 4
+        double Guess = MeanAnomoly / (Eccentricity - 1.0);
+
+        if (Eccentricity < 1.6)
+        {
+            Guess = (((-PI < MeanAnomoly) && (MeanAnomoly < 0.0)) || (MeanAnomoly > PI)) ? MeanAnomoly - Eccentricity : MeanAnomoly + Eccentricity;
+        }
+        else if ((Eccentricity < 3.6) && (Abs(MeanAnomoly) > PI))
+        {
+            Guess = MeanAnomoly - Signum(MeanAnomoly) * Eccentricity;
+        }
+
+        const auto Result = RootFind::Newton(
+            [=](double H) {return Eccentricity * Sinh(H) - H - MeanAnomoly;},
+            [=](double H) {return Eccentricity * Cosh(H) - 1.0;},
+            Guess,
+            KEPLER_PARAMETERS);
+
+        return DeltaTimeAnomoly{
+            .MeanAnomoly = MeanAnomoly,
+            .EccentricAnomoly = Result.X
+        };
     } 
     // Parabolic trajectory
     else
     {
-        const double A = 1.5 * (DeltaTime / mMeanRadialPeriod - mMeanAnomoly);
+        const double A = 1.5 * (DeltaTime / mState.MeanRadialPeriod - mState.MeanAnomoly);
         const double B = Cbrt(A + Sqrt(Square(A) + 1.0));
         const double EccentricAnomoly = 2.0 * Atan(B - 1.0 / B);
         return DeltaTimeAnomoly {
-            .MeanAnomoly = EccentricToMeanAnomoly(EccentricAnomoly, mElements.Eccentricity),
+            .MeanAnomoly = EccentricToMeanAnomoly(EccentricAnomoly, mState.Elements.Eccentricity),
             .EccentricAnomoly = EccentricAnomoly
         };
     }
@@ -122,15 +176,30 @@ void TwoBody::Orbit::Update(double DeltaTime) noexcept
 {
     const auto Anomoly = AnomolyFromDeltaTime(DeltaTime);
 
-    if (IsCircular(mElements) == true)
+    if (IsCircular(mState.Elements) == true)
     {
-        mElements.TrueLongitude = Anomoly.EccentricAnomoly;
+        mState.Elements.TrueLongitude = Anomoly.EccentricAnomoly;
     }
     else
     {
-        mMeanAnomoly = Anomoly.MeanAnomoly;
-        mEccentricAnomoly = Anomoly.EccentricAnomoly;
-        mElements.TrueAnomoly = EccentricToTrueAnomoly(mEccentricAnomoly, mElements.Eccentricity);
-        mRadius = CalculateRadius(mElements);
+        mState.MeanAnomoly = Anomoly.MeanAnomoly;
+        mState.EccentricAnomoly = Anomoly.EccentricAnomoly;
+        mState.Elements.TrueAnomoly = EccentricToTrueAnomoly(mState.EccentricAnomoly, mState.Elements.Eccentricity);
+
+        // Closed orbits measure the true anomoly over (0 - 2 PI)
+        if ((IsClosed(mState.Elements) == true) && (mState.Elements.TrueAnomoly < 0.0))
+        {
+            mState.Elements.TrueAnomoly += 2.0 * PI;
+        }
+
+        mState.Radius = CalculateRadius(mState.Elements);
     }
-}
\ No newline at end of file
+}
+
+void TwoBody::Orbit::Update(ThreadPool& Pool, std::span<Orbit* const> Orbits, double DeltaTime) noexcept
+{
+    Pool.ParallelFor(Orbits.size(), UPDATE_GRAIN, [&](size_t Index)
+    {
+        Orbits[Index]->Update(DeltaTime);
+    });
+}
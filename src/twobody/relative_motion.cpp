@@ -0,0 +1,253 @@
+#include "twobody/relative_motion.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/root1d.hpp"
+
+namespace
+{
+    // Solution of Kepler's equation, converged to near machine precision
+    constexpr RootFind::NewtonParameters KEPLER_PARAMETERS{.Tolerance = 1.0E-14, .MaxIterations = 64};
+
+    // Horizontal component of the unit angular momentum below which the orbit is equatorial,
+    // and the node is taken along the x axis
+    constexpr double EQUATORIAL_TOLERANCE = 1.0E-12;
+
+    // Deputies propagated in sequence by each thread
+    constexpr size_t DEPUTY_GRAIN = 256;
+
+    /**
+     * @return Angle wrapped into [0, 2 PI)
+     */
+    double Wrap(double Angle) noexcept
+    {
+        return Angle - 2.0 * PI * Floor(Angle / (2.0 * PI));
+    }
+
+    /**
+     * @return Mean motion of a closed orbit (rad/s)
+     */
+    double MeanMotion(const TwoBody::KeplerianElements& Elements) noexcept
+    {
+        const double SemiMajorAxis = Elements.SemiParameter / (1.0 - Square(Elements.Eccentricity));
+        return Sqrt(Elements.GravitationalParameter / Cube(SemiMajorAxis));
+    }
+
+    /**
+     * @return True anomoly of a closed orbit after a time of flight, within (-PI, PI]
+     */
+    double TrueAnomolyAfter(const TwoBody::KeplerianElements& Elements, double DeltaTime) noexcept
+    {
+        const double Eccentricity = Elements.Eccentricity;
+        const double Initial = TwoBody::EccentricToMeanAnomoly(TwoBody::TrueToEccentricAnomoly(Elements.TrueAnomoly, Eccentricity), Eccentricity);
+        const double MeanAnomoly = Wrap(Initial + MeanMotion(Elements) * DeltaTime);
+
+        // Kepler's equation, from an initial guess which converges for any eccentricity
+        const auto Result = RootFind::Newton(
+            [=](double E) {return E - Eccentricity * Sin(E) - MeanAnomoly;},
+            [=](double E) {return 1.0 - Eccentricity * Cos(E);},
+            (Eccentricity < 0.8) ? MeanAnomoly : PI,
+            KEPLER_PARAMETERS);
+
+        return TwoBody::EccentricToTrueAnomoly(Result.X, Eccentricity);
+    }
+
+    /**
+     * Signed permutation from the LVLH frame (radial, along track, cross track) to the frame
+     * of Yamanaka and Ankersen (along track, negative cross track, negative radial), of
+     * positions and velocities
+     */
+    MatrixN<6, 6> LVLHToYamanakaAnkersen(void) noexcept
+    {
+        MatrixN<6, 6> Permutation{};
+
+        for (size_t Offset = 0; Offset < 6; Offset += 3)
+        {
+            Permutation(Offset + 0, Offset + 1) = 1.0;
+            Permutation(Offset + 1, Offset + 2) = -1.0;
+            Permutation(Offset + 2, Offset + 0) = -1.0;
+        }
+
+        return Permutation;
+    }
+}
+
+Rotator TwoBody::LVLHFrame(const Vector3& Position, const Vector3& Velocity) noexcept
+{
+    const Vector3 Normal = Position.Cross(Velocity).Unit();
+    const double Horizontal = Sqrt(Square(Normal.X) + Square(Normal.Y));
+
+    // Node, inclination and argument of latitude, rotating the inertial frame onto the LVLH frame
+    const double Node = (Horizontal > EQUATORIAL_TOLERANCE) ? Atan2(Normal.X, -Normal.Y) : 0.0;
+    const double Inclination = Atan2(Horizontal, Normal.Z);
+    const Vector3 Line = Vector3({Cos(Node), Sin(Node), 0.0});
+    const double Latitude = Atan2(Position.Dot(Normal.Cross(Line)), Position.Dot(Line));
+
+    return Rotator::Compose(
+        Rotator::FromVectorAngle(Vector3::UNIT_Z(), Node),
+        Rotator::FromVectorAngle(Vector3::UNIT_X(), Inclination),
+        Rotator::FromVectorAngle(Vector3::UNIT_Z(), Latitude));
+}
+
+TwoBody::StateVector TwoBody::InertialToLVLH(const EphemerisState& Chief, const EphemerisState& Deputy) noexcept
+{
+    const Rotator Frame = LVLHFrame(Chief.Pos, Chief.Vel);
+    const Vector3 Rate = Vector3::UNIT_Z() * (Chief.Pos.Cross(Chief.Vel).Norm() / Chief.Pos.NormSquared());
+
+    const Vector3 Position = Frame.Rotate(Deputy.Pos - Chief.Pos);
+    const Vector3 Velocity = Frame.Rotate(Deputy.Vel - Chief.Vel) - Rate.Cross(Position);
+
+    return MakeStateVector(Position, Velocity);
+}
+
+EphemerisState TwoBody::LVLHToInertial(const EphemerisState& Chief, const StateVector& Relative) noexcept
+{
+    const Rotator Frame = LVLHFrame(Chief.Pos, Chief.Vel);
+    const Vector3 Rate = Vector3::UNIT_Z() * (Chief.Pos.Cross(Chief.Vel).Norm() / Chief.Pos.NormSquared());
+
+    const Vector3 Position = Vector3({Relative[0], Relative[1], Relative[2]});
+    const Vector3 Velocity = Vector3({Relative[3], Relative[4], Relative[5]}) + Rate.Cross(Position);
+
+    return EphemerisState{.Pos = Chief.Pos + Frame.RotateInv(Position), .Vel = Chief.Vel + Frame.RotateInv(Velocity)};
+}
+
+MatrixN<6, 6> TwoBody::ClohessyWiltshire(double MeanMotion, double DeltaTime) noexcept
+{
+    const double Angle = MeanMotion * DeltaTime;
+    const double S = Sin(Angle);
+    const double C = Cos(Angle);
+    const double N = MeanMotion;
+
+    return MatrixN<6, 6>{.Data = {
+        4.0 - 3.0 * C,          0.0, 0.0,    S / N,              2.0 * (1.0 - C) / N,            0.0,
+        6.0 * (S - Angle),      1.0, 0.0,    -2.0 * (1.0 - C) / N, (4.0 * S - 3.0 * Angle) / N,   0.0,
+        0.0,                    0.0, C,      0.0,                0.0,                            S / N,
+        3.0 * N * S,            0.0, 0.0,    C,                  2.0 * S,                        0.0,
+        -6.0 * N * (1.0 - C),   0.0, 0.0,    -2.0 * S,           4.0 * C - 3.0,                  0.0,
+        0.0,                    0.0, -N * S, 0.0,                0.0,                            C}};
+}
+
+MatrixN<6, 6> TwoBody::YamanakaAnkersen(const KeplerianElements& Chief, double DeltaTime) noexcept
+{
+    const double E = Chief.Eccentricity;
+    const double K2 = Sqrt(Chief.GravitationalParameter / Cube(Chief.SemiParameter));
+    const double J = K2 * DeltaTime;
+    const double Initial = Chief.TrueAnomoly;
+    const double Final = TrueAnomolyAfter(Chief, DeltaTime);
+
+    // Transformation of each axis to the variables of the Tschauner-Hempel equations, the
+    // position scaled by 1 + e cos(true anomoly) and its derivative with respect to the true anomoly
+    const auto Transform = [=](double Anomoly)
+    {
+        const double Rho = 1.0 + E * Cos(Anomoly);
+        MatrixN<6, 6> Result{};
+
+        for (size_t Axis = 0; Axis < 3; Axis++)
+        {
+            Result(Axis, Axis) = Rho;
+            Result(Axis + 3, Axis) = -E * Sin(Anomoly);
+            Result(Axis + 3, Axis + 3) = 1.0 / (K2 * Rho);
+        }
+
+        return Result;
+    };
+
+    const auto InverseTransform = [=](double Anomoly)
+    {
+        const double Rho = 1.0 + E * Cos(Anomoly);
+        MatrixN<6, 6> Result{};
+
+        for (size_t Axis = 0; Axis < 3; Axis++)
+        {
+            Result(Axis, Axis) = 1.0 / Rho;
+            Result(Axis + 3, Axis) = K2 * E * Sin(Anomoly);
+            Result(Axis + 3, Axis + 3) = K2 * Rho;
+        }
+
+        return Result;
+    };
+
+    // In plane fundamental solution at the final anomoly, in the transformed position and derivative
+    // along track and radially
+    const double Rho = 1.0 + E * Cos(Final);
+    const double S = Rho * Sin(Final);
+    const double C = Rho * Cos(Final);
+    const double SPrime = Cos(Final) + E * Cos(2.0 * Final);
+    const double CPrime = -(Sin(Final) + E * Sin(2.0 * Final));
+
+    const MatrixN<4, 4> Fundamental{.Data = {
+        1.0,    -C * (1.0 + 1.0 / Rho),     S * (1.0 + 1.0 / Rho),  3.0 * Square(Rho) * J,
+        0.0,    S,                          C,                      2.0 - 3.0 * E * S * J,
+        0.0,    2.0 * S,                    2.0 * C - E,            3.0 * (1.0 - 2.0 * E * S * J),
+        0.0,    SPrime,                     CPrime,                 -3.0 * E * (SPrime * J + S / Square(Rho))}};
+
+    // Inverse of the fundamental solution at the initial anomoly, where J is zero
+    const double Rho0 = 1.0 + E * Cos(Initial);
+    const double S0 = Rho0 * Sin(Initial);
+    const double C0 = Rho0 * Cos(Initial);
+    const double Scale = 1.0 / (1.0 - Square(E));
+
+    const MatrixN<4, 4> InitialInverse = MatrixN<4, 4>{.Data = {
+        1.0 - Square(E),    3.0 * E * S0 * (1.0 / Rho0 + 1.0 / Square(Rho0)),       -E * S0 * (1.0 + 1.0 / Rho0),   -E * C0 + 2.0,
+        0.0,                -3.0 * S0 * (1.0 / Rho0 + Square(E) / Square(Rho0)),    S0 * (1.0 + 1.0 / Rho0),        C0 - 2.0 * E,
+        0.0,                -3.0 * (C0 / Rho0 + E),                                 C0 * (1.0 + 1.0 / Rho0) + E,    -S0,
+        0.0,                3.0 * Rho0 + Square(E) - 1.0,                           -Square(Rho0),                  E * S0}} * Scale;
+
+    const MatrixN<4, 4> InPlane = Fundamental * InitialInverse;
+
+    // Transformed transition, in plane (along track, radial) and out of plane (cross track) harmonic
+    constexpr size_t IN_PLANE[4] = {0, 2, 3, 5};
+    MatrixN<6, 6> Transformed{};
+
+    for (size_t Row = 0; Row < 4; Row++)
+    {
+        for (size_t Col = 0; Col < 4; Col++)
+        {
+            Transformed(IN_PLANE[Row], IN_PLANE[Col]) = InPlane(Row, Col);
+        }
+    }
+
+    const double Sweep = Final - Initial;
+    Transformed(1, 1) = Cos(Sweep);
+    Transformed(1, 4) = Sin(Sweep);
+    Transformed(4, 1) = -Sin(Sweep);
+    Transformed(4, 4) = Cos(Sweep);
+
+    const MatrixN<6, 6> Permutation = LVLHToYamanakaAnkersen();
+    return Permutation.Transpose() * InverseTransform(Final) * Transformed * Transform(Initial) * Permutation;
+}
+
+size_t TwoBody::Formation::Add(const StateVector& Relative)
+{
+    mStates.push_back(Relative);
+    return mStates.size() - 1;
+}
+
+void TwoBody::Formation::Reserve(size_t Capacity)
+{
+    mStates.reserve(Capacity);
+}
+
+MatrixN<6, 6> TwoBody::Formation::Transition(double DeltaTime) const noexcept
+{
+    if (mModel == RelativeModel::CLOHESSY_WILTSHIRE)
+    {
+        return ClohessyWiltshire(MeanMotion(mChief), DeltaTime);
+    }
+
+    return YamanakaAnkersen(mChief, DeltaTime);
+}
+
+void TwoBody::Formation::Propagate(ThreadPool& Pool, double DeltaTime) noexcept
+{
+    const MatrixN<6, 6> Matrix = Transition(DeltaTime);
+
+    Pool.ParallelFor(mStates.size(), DEPUTY_GRAIN, [&](size_t Index)
+    {
+        mStates[Index] = Matrix * mStates[Index];
+    });
+
+    // Advance the chief, every angle measured to its position sweeping the same anomoly
+    const double Sweep = TrueAnomolyAfter(mChief, DeltaTime) - mChief.TrueAnomoly;
+    mChief.TrueAnomoly = Wrap(mChief.TrueAnomoly + Sweep);
+    mChief.ArgumentLatitude = Wrap(mChief.ArgumentLatitude + Sweep);
+    mChief.TrueLongitude = Wrap(mChief.TrueLongitude + Sweep);
+}
@@ -0,0 +1,75 @@
+#include "concurrency/spsc_ring.hpp"
+#include "gtest/gtest.h"
+
+#include <thread>
+
+// Records are received in order and intact while the producer and consumer run concurrently
+TEST(SpscRing, Transfer)
+{
+    constexpr uint64_t RECORDS = 100000;
+    SpscRing<uint64_t> Ring(5, 3);
+    ASSERT_EQ(Ring.Capacity(), 8u);
+    ASSERT_EQ(Ring.Width(), 3u);
+    ASSERT_TRUE(Ring.Front().empty());
+
+    std::thread Producer([&]()
+    {
+        for (uint64_t Index = 0; Index < RECORDS; Index++)
+        {
+            std::span<uint64_t> Slot = Ring.BeginPush();
+
+            while (Slot.empty() == true)
+            {
+                std::this_thread::yield();
+                Slot = Ring.BeginPush();
+            }
+
+            Slot[0] = Index;
+            Slot[1] = 2 * Index;
+            Slot[2] = 3 * Index;
+            Ring.EndPush();
+        }
+    });
+
+    for (uint64_t Index = 0; Index < RECORDS;)
+    {
+        const std::span<const uint64_t> Record = Ring.Front();
+
+        if (Record.empty() == true)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ASSERT_EQ(Record[0], Index);
+        ASSERT_EQ(Record[1], 2 * Index);
+        ASSERT_EQ(Record[2], 3 * Index);
+        Ring.Pop();
+        Index++;
+    }
+
+    Producer.join();
+    ASSERT_TRUE(Ring.Front().empty());
+}
+
+// A full ring refuses records until one is released
+TEST(SpscRing, Full)
+{
+    SpscRing<double> Ring(2, 1);
+
+    for (double Value : {1.0, 2.0})
+    {
+        const std::span<double> Slot = Ring.BeginPush();
+        ASSERT_EQ(Slot.size(), 1u);
+        Slot[0] = Value;
+        Ring.EndPush();
+    }
+
+    ASSERT_TRUE(Ring.BeginPush().empty());
+
+    const std::span<const double> Record = Ring.Front();
+    ASSERT_EQ(Record.size(), 1u);
+    ASSERT_EQ(Record[0], 1.0);
+    Ring.Pop();
+    ASSERT_EQ(Ring.BeginPush().size(), 1u);
+}
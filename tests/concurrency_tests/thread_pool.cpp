@@ -0,0 +1,204 @@
+#include "concurrency/thread_pool.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Every iteration executes exactly once, for any number of threads and iterations
+TEST(ThreadPool, ParallelFor)
+{
+    for (const size_t Workers : {0u, 1u, 3u, 7u})
+    {
+        ThreadPool Pool(Workers);
+        ASSERT_EQ(Pool.Concurrency(), Workers + 1);
+
+        for (const size_t Count : {0u, 1u, 2u, 5u, 1000u})
+        {
+            std::vector<std::atomic<int>> Executed(Count);
+            Pool.ParallelFor(Count, [&](size_t Index) {Executed[Index].fetch_add(1);});
+
+            for (size_t Index = 0; Index < Count; Index++)
+            {
+                ASSERT_EQ(Executed[Index].load(), 1);
+            }
+        }
+    }
+}
+
+// Idle threads steal the iterations of a thread with costly iterations
+TEST(ThreadPool, Stealing)
+{
+    ThreadPool Pool(3);
+    constexpr size_t COUNT = 64;
+    std::vector<std::atomic<int>> Executed(COUNT);
+    std::vector<std::thread::id> Threads(COUNT);
+
+    // Every costly iteration is initially assigned to the calling thread
+    Pool.ParallelFor(COUNT, [&](size_t Index)
+    {
+        if (Index < COUNT / 4)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        Threads[Index] = std::this_thread::get_id();
+        Executed[Index].fetch_add(1);
+    });
+
+    size_t Stolen = 0;
+
+    for (size_t Index = 0; Index < COUNT; Index++)
+    {
+        ASSERT_EQ(Executed[Index].load(), 1);
+        Stolen += (Index < COUNT / 4) && (Threads[Index] != std::this_thread::get_id());
+    }
+
+    ASSERT_GT(Stolen, 0u);
+}
+
+// Every iteration executes exactly once for any grain, including partial final chunks
+TEST(ThreadPool, Grain)
+{
+    ThreadPool Pool(3);
+
+    for (const size_t Grain : {0u, 1u, 7u, 64u, 5000u})
+    {
+        std::vector<std::atomic<int>> Executed(1000);
+        Pool.ParallelFor(Executed.size(), Grain, [&](size_t Index) {Executed[Index].fetch_add(1);});
+
+        for (const std::atomic<int>& Count : Executed)
+        {
+            ASSERT_EQ(Count.load(), 1);
+        }
+    }
+}
+
+// Reductions are bitwise identical for any number of threads
+TEST(ThreadPool, ParallelReduce)
+{
+    constexpr size_t COUNT = 100000;
+    std::vector<double> Values(COUNT);
+
+    for (size_t Index = 0; Index < COUNT; Index++)
+    {
+        Values[Index] = 1.0 / static_cast<double>(Index + 1) * ((Index % 3 == 0) ? -1.0E6 : 1.0);
+    }
+
+    const auto Sum = [&](ThreadPool& Pool)
+    {
+        return Pool.ParallelReduce(COUNT, 1000, 0.0,
+            [&](size_t Begin, size_t End)
+            {
+                double Total = 0.0;
+
+                for (size_t Index = Begin; Index < End; Index++)
+                {
+                    Total += Values[Index];
+                }
+
+                return Total;
+            },
+            [](double A, double B) {return A + B;});
+    };
+
+    ThreadPool Serial(0);
+    const double Expected = Sum(Serial);
+
+    for (const size_t Workers : {1u, 3u, 7u})
+    {
+        ThreadPool Pool(Workers);
+
+        for (int Repeat = 0; Repeat < 10; Repeat++)
+        {
+            ASSERT_EQ(Sum(Pool), Expected);
+        }
+    }
+
+    ASSERT_EQ(Serial.ParallelReduce(0, 10, 1.5, [](size_t, size_t) {return 0.0;}, [](double A, double B) {return A + B;}), 1.5);
+}
+
+// A loop started from within a loop executes serially rather than deadlocking
+TEST(ThreadPool, Nested)
+{
+    ThreadPool Pool(3, AffinityHint::COMPACT);
+    std::vector<std::atomic<int>> Executed(64 * 64);
+
+    Pool.ParallelFor(64, [&](size_t Outer)
+    {
+        Pool.ParallelFor(64, [&](size_t Inner) {Executed[Outer * 64 + Inner].fetch_add(1);});
+    });
+
+    for (const std::atomic<int>& Count : Executed)
+    {
+        ASSERT_EQ(Count.load(), 1);
+    }
+}
+
+// Every task executes once, including tasks spawned by tasks, before the group completes
+TEST(ThreadPool, TaskGroup)
+{
+    for (const size_t Workers : {0u, 1u, 3u})
+    {
+        ThreadPool Pool(Workers, AffinityHint::SCATTER);
+        std::atomic<size_t> Leaves{0};
+
+        // Binary tree of tasks, 2^10 leaves
+        std::function<void(TaskGroup&, int)> Spawn = [&](TaskGroup& Group, int Depth)
+        {
+            if (Depth == 0)
+            {
+                Leaves.fetch_add(1);
+                return;
+            }
+
+            Group.Run([&, Depth]() {Spawn(Group, Depth - 1);});
+            Group.Run([&, Depth]() {Spawn(Group, Depth - 1);});
+        };
+
+        TaskGroup Group(Pool);
+        Spawn(Group, 10);
+        Group.Wait();
+        ASSERT_EQ(Leaves.load(), 1024u);
+
+        // Tasks may wait on groups of their own, and run loops
+        std::atomic<size_t> Executed{0};
+
+        {
+            TaskGroup Outer(Pool);
+
+            for (int Task = 0; Task < 8; Task++)
+            {
+                Outer.Run([&]()
+                {
+                    TaskGroup Inner(Pool);
+
+                    for (int Child = 0; Child < 8; Child++)
+                    {
+                        Inner.Run([&]() {Pool.ParallelFor(4, [&](size_t) {Executed.fetch_add(1);});});
+                    }
+                });
+            }
+        }
+
+        ASSERT_EQ(Executed.load(), 256u);
+
+        // A closure failing to copy is not counted, so the group may still be waited upon
+        struct Throwing
+        {
+            Throwing() = default;
+            Throwing(const Throwing&) {throw std::runtime_error("Copy");}
+            void operator()(void) const noexcept { }
+        };
+
+        const Throwing Failing{};
+        TaskGroup Failed(Pool);
+        Failed.Run([&]() {Leaves.fetch_add(1);});
+        ASSERT_THROW(Failed.Run(Failing), std::runtime_error);
+        Failed.Wait();
+        ASSERT_EQ(Leaves.load(), 1025u);
+    }
+}
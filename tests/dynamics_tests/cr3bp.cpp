@@ -0,0 +1,178 @@
+#include "dynamics/cr3bp.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+    const double MU = CR3BP::EARTH_MOON.MassRatio;
+
+    // Northern L2 halo orbit near its bifurcation from the planar Lyapunov family, and the
+    // southern 9:2 near rectilinear halo orbit of the Gateway, each at its crossing of the XZ plane
+    const CR3BP::State HALO{.Data = {1.18, 0.0, 0.02, 0.0, -0.16, 0.0}};
+    const CR3BP::State NRHO{.Data = {1.0221, 0.0, -0.1821, 0.0, -0.1033, 0.0}};
+
+    /**
+     * @return Largest difference between the state after one period and the initial state
+     */
+    double PeriodicityError(const CR3BP::PeriodicOrbit& Orbit)
+    {
+        const ODE::IntegratorResult<6, 1> Result = CR3BP::Propagate(Orbit.InitialState, MU, Orbit.Period);
+        double Error = 0.0;
+
+        for (size_t Index = 0; Index < 6; Index++)
+        {
+            Error = Max(Error, Abs(Result.State[Index] - Orbit.InitialState[Index]));
+        }
+
+        return Error;
+    }
+}
+
+// The libration points are equilibria of the rotating frame
+TEST(CR3BP, LibrationPoints)
+{
+    for (const CR3BP::LibrationPoint Point : {CR3BP::LibrationPoint::L1, CR3BP::LibrationPoint::L2, CR3BP::LibrationPoint::L3,
+                                              CR3BP::LibrationPoint::L4, CR3BP::LibrationPoint::L5})
+    {
+        const Vector3 Position = CR3BP::LibrationPosition(MU, Point);
+        const CR3BP::State Derivative = CR3BP::Derivative(CR3BP::State{.Data = {Position.X, Position.Y, Position.Z, 0.0, 0.0, 0.0}}, MU);
+
+        for (size_t Index = 0; Index < 6; Index++)
+        {
+            EXPECT_NEAR(Derivative[Index], 0.0, 1.0E-14);
+        }
+    }
+
+    EXPECT_NEAR(CR3BP::LibrationPosition(MU, CR3BP::LibrationPoint::L1).X, 0.8369151258, 1.0E-9);
+    EXPECT_NEAR(CR3BP::LibrationPosition(MU, CR3BP::LibrationPoint::L2).X, 1.1556821654, 1.0E-9);
+    EXPECT_NEAR(CR3BP::EARTH_MOON.Time / 86400.0, 4.3425, 1.0E-3);
+}
+
+// The state transition matrix matches central differences of the trajectory, and the Jacobi
+// constant is conserved
+TEST(CR3BP, Variational)
+{
+    const double Time = 1.5;
+    const ODE::IntegratorResult<6, 7> Result = CR3BP::PropagateTransition(HALO, MU, Time);
+    ASSERT_EQ(Result.ExitCode, ODE::IntegratorStatus::SUCCESS);
+
+    const double Delta = 1.0E-6;
+
+    for (size_t Col = 0; Col < 6; Col++)
+    {
+        CR3BP::State Plus = HALO, Minus = HALO;
+        Plus[Col] += Delta;
+        Minus[Col] -= Delta;
+        const CR3BP::State Difference = (CR3BP::Propagate(Plus, MU, Time).State - CR3BP::Propagate(Minus, MU, Time).State) / (2.0 * Delta);
+
+        for (size_t Row = 0; Row < 6; Row++)
+        {
+            EXPECT_NEAR(Result.State(Row, Col + 1), Difference[Row], 1.0E-5 * Max(1.0, Abs(Difference[Row]))) << Row << ", " << Col;
+        }
+    }
+
+    EXPECT_NEAR(CR3BP::JacobiConstant(Result.State.Block<6, 1>(0, 0), MU), CR3BP::JacobiConstant(HALO, MU), 1.0E-11);
+}
+
+// Single shooting corrects the linear Lyapunov guess and the halo orbits to periodic orbits, whose
+// monodromy matrix has the flow direction as an eigenvector of unit eigenvalue
+TEST(CR3BP, SingleShooting)
+{
+    const CR3BP::PeriodicOrbit Guess = CR3BP::LyapunovGuess(MU, CR3BP::LibrationPoint::L1, -0.01);
+    const CR3BP::PeriodicOrbit Lyapunov = CR3BP::CorrectSymmetric(Guess.InitialState, 0.5 * Guess.Period, MU, CR3BP::FamilyParameter::X);
+    ASSERT_TRUE(Lyapunov.Converged);
+    EXPECT_EQ(Lyapunov.InitialState[0], Guess.InitialState[0]);
+    EXPECT_EQ(Lyapunov.InitialState[2], 0.0);
+    EXPECT_NEAR(Lyapunov.Period, Guess.Period, 0.05 * Guess.Period);
+    EXPECT_LT(PeriodicityError(Lyapunov), 1.0E-9);
+
+    const CR3BP::PeriodicOrbit Halo = CR3BP::CorrectSymmetric(HALO, 1.7, MU);
+    ASSERT_TRUE(Halo.Converged);
+    EXPECT_EQ(Halo.InitialState[2], HALO[2]);
+    EXPECT_LT(PeriodicityError(Halo), 1.0E-9);
+
+    const CR3BP::State Flow = CR3BP::Derivative(Halo.InitialState, MU);
+    const CR3BP::State Mapped = Halo.Monodromy * Flow;
+
+    for (size_t Index = 0; Index < 6; Index++)
+    {
+        EXPECT_NEAR(Mapped[Index], Flow[Index], 1.0E-6);
+    }
+
+    // The 9:2 resonant NRHO completes nine orbits in two lunar synodic months, of 6.56 days
+    const CR3BP::PeriodicOrbit Nrho = CR3BP::CorrectSymmetric(NRHO, 0.75, MU);
+    ASSERT_TRUE(Nrho.Converged);
+    EXPECT_NEAR(Nrho.Period * CR3BP::EARTH_MOON.Time / 86400.0, 6.56, 0.01);
+    EXPECT_LT(PeriodicityError(Nrho), 1.0E-9);
+}
+
+// Multiple shooting corrects perturbed patch points of the NRHO to a periodic orbit, identically
+// for any number of threads
+TEST(CR3BP, MultipleShooting)
+{
+    const CR3BP::PeriodicOrbit Nrho = CR3BP::CorrectSymmetric(NRHO, 0.75, MU);
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+    std::vector<CR3BP::PeriodicOrbit> Orbits{};
+
+    for (ThreadPool* Threads : {&None, &Pool})
+    {
+        std::vector<CR3BP::State> Patches(8);
+        std::vector<double> Durations(Patches.size(), 1.01 * Nrho.Period / static_cast<double>(Patches.size()));
+
+        for (size_t Index = 0; Index < Patches.size(); Index++)
+        {
+            Patches[Index] = CR3BP::Propagate(Nrho.InitialState, MU, Nrho.Period * static_cast<double>(Index) / static_cast<double>(Patches.size())).State;
+            Patches[Index][0] += 1.0E-4 * static_cast<double>(Index % 3);
+            Patches[Index][4] += 1.0E-4;
+        }
+
+        Orbits.push_back(CR3BP::CorrectMultipleShooting(*Threads, Patches, Durations, MU));
+        ASSERT_TRUE(Orbits.back().Converged);
+        EXPECT_EQ(Orbits.back().InitialState, Patches[0]);
+        EXPECT_LT(PeriodicityError(Orbits.back()), 1.0E-9);
+        EXPECT_NEAR(Orbits.back().Period, Nrho.Period, 0.05 * Nrho.Period);
+    }
+
+    EXPECT_EQ(Orbits[0].InitialState, Orbits[1].InitialState);
+    EXPECT_EQ(Orbits[0].Monodromy, Orbits[1].Monodromy);
+}
+
+// Continuation of the L2 halo family towards the Moon, each member periodic, by natural parameter
+// steps in the out of plane amplitude and by pseudo-arclength, identically for any number of threads
+TEST(CR3BP, Continuation)
+{
+    const CR3BP::PeriodicOrbit Halo = CR3BP::CorrectSymmetric(HALO, 1.7, MU);
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+
+    const CR3BP::ContinuationSettings Natural{.Method = CR3BP::ContinuationMethod::NATURAL_PARAMETER, .Step = 2.0E-3, .Members = 20, .Batch = 4};
+    const std::vector<CR3BP::PeriodicOrbit> Steps = CR3BP::ContinueFamily(Pool, Halo, MU, Natural);
+    ASSERT_EQ(Steps.size(), 20u);
+
+    for (size_t Index = 1; Index < Steps.size(); Index++)
+    {
+        EXPECT_TRUE(Steps[Index].Converged);
+        EXPECT_GT(Steps[Index].InitialState[2], Steps[Index - 1].InitialState[2]);
+        EXPECT_LT(Steps[Index].JacobiConstant, Steps[Index - 1].JacobiConstant);
+    }
+
+    const CR3BP::ContinuationSettings Arclength{.Step = 5.0E-3, .MaxStep = 2.0E-2, .Members = 60};
+    const std::vector<CR3BP::PeriodicOrbit> Serial = CR3BP::ContinueFamily(None, Halo, MU, Arclength);
+    const std::vector<CR3BP::PeriodicOrbit> Parallel = CR3BP::ContinueFamily(Pool, Halo, MU, Arclength);
+    ASSERT_EQ(Serial.size(), 60u);
+    ASSERT_EQ(Parallel.size(), Serial.size());
+
+    for (size_t Index = 0; Index < Serial.size(); Index++)
+    {
+        EXPECT_TRUE(Serial[Index].Converged);
+        EXPECT_EQ(Serial[Index].InitialState, Parallel[Index].InitialState);
+        EXPECT_LT(PeriodicityError(Serial[Index]), 1.0E-9) << Index;
+    }
+
+    // The family passes the fold of the out of plane amplitude, approaching the Moon
+    EXPECT_LT(Serial.back().InitialState[0], 1.09);
+    EXPECT_LT(Serial.back().Period, 2.4);
+}
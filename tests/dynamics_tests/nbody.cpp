@@ -0,0 +1,165 @@
+#include "dynamics/nbody.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/random.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+
+    /**
+     * Fragments of a cloud of a kilometre, of a range of masses, with a few clustered pairs
+     */
+    NBodySystem MakeCloud(size_t Count, const NBodySettings& Settings)
+    {
+        NBodySystem System(Settings);
+        Random::Stream Stream(7, 0);
+
+        for (size_t Index = 0; Index < Count; Index++)
+        {
+            const Vector3 Position({1.0E3 * Stream.Normal(), 1.0E3 * Stream.Normal(), 2.0E2 * Stream.Normal()});
+            const Vector3 Velocity({Stream.Normal(), Stream.Normal(), Stream.Normal()});
+            System.Add(6.674E-11 * (1.0 + 100.0 * Stream.Uniform()), Position, Velocity);
+        }
+
+        return System;
+    }
+
+    /**
+     * @return Largest error of the accelerations relative to the largest expected acceleration
+     */
+    double RelativeError(const std::vector<Vector3>& Actual, const std::vector<Vector3>& Expected)
+    {
+        double Error = 0.0, Scale = 0.0;
+
+        for (size_t Index = 0; Index < Actual.size(); Index++)
+        {
+            Error = Max(Error, (Actual[Index] - Expected[Index]).Norm());
+            Scale = Max(Scale, Expected[Index].Norm());
+        }
+
+        return Error / Scale;
+    }
+}
+
+// Bodies are stored and negative masses rejected, the method chosen by the number of bodies
+TEST(NBody, Bodies)
+{
+    NBodySystem System;
+    ASSERT_EQ(System.Add(1.0, Vector3({1.0, 2.0, 3.0}), Vector3({4.0, 5.0, 6.0})), 0u);
+    EXPECT_EQ(System.GetPosition(0), Vector3({1.0, 2.0, 3.0}));
+    EXPECT_EQ(System.GetVelocity(0), Vector3({4.0, 5.0, 6.0}));
+    EXPECT_EQ(System.GetGravitationalParameter(0), 1.0);
+    EXPECT_THROW(System.Add(-1.0, Vector3::ZERO(), Vector3::ZERO()), Error::GenericException);
+    EXPECT_EQ(System.Size(), 1u);
+
+    EXPECT_EQ(System.GetActiveMethod(), NBodyMethod::DIRECT);
+    EXPECT_EQ(MakeCloud(5000, {}).GetActiveMethod(), NBodyMethod::BARNES_HUT);
+}
+
+// Direct summation matches the pairwise law, and the octree matches direct summation to within
+// the error of the opening angle, exactly when every cell is opened
+TEST(NBody, Accelerations)
+{
+    NBodySystem Pair;
+    Pair.Add(2.0, Vector3({1.0, 0.0, 0.0}), Vector3::ZERO());
+    Pair.Add(3.0, Vector3({1.0, 2.0, 0.0}), Vector3::ZERO());
+
+    ThreadPool Pool(3);
+    std::vector<Vector3> Accelerations(2, Vector3::ZERO());
+    Pair.MutualAccelerations(Pool, Accelerations);
+    EXPECT_NEAR((Accelerations[0] - Vector3({0.0, 0.75, 0.0})).Norm(), 0.0, 1.0E-15);
+    EXPECT_NEAR((Accelerations[1] - Vector3({0.0, -0.5, 0.0})).Norm(), 0.0, 1.0E-15);
+
+    NBodySystem Cloud = MakeCloud(3000, NBodySettings{.Method = NBodyMethod::DIRECT});
+    std::vector<Vector3> Direct(Cloud.Size(), Vector3::ZERO());
+    std::vector<Vector3> Tree(Cloud.Size(), Vector3::ZERO());
+    Cloud.MutualAccelerations(Pool, Direct);
+
+    for (const auto& [Opening, Tolerance] : {std::pair{0.0, 1.0E-12}, std::pair{0.3, 2.0E-3}, std::pair{0.7, 1.0E-2}})
+    {
+        Cloud.SetSettings(NBodySettings{.Method = NBodyMethod::BARNES_HUT, .Opening = Opening});
+        Cloud.MutualAccelerations(Pool, Tree);
+        EXPECT_LT(RelativeError(Tree, Direct), Tolerance) << Opening;
+    }
+
+    // Softening bounds the acceleration of coincident bodies
+    NBodySystem Close(NBodySettings{.Softening = 1.0});
+    Close.Add(1.0, Vector3::ZERO(), Vector3::ZERO());
+    Close.Add(1.0, Vector3({1.0E-9, 0.0, 0.0}), Vector3::ZERO());
+    Close.MutualAccelerations(Pool, Accelerations);
+    EXPECT_LT(Accelerations[0].Norm(), 1.0E-8);
+}
+
+// Accelerations are identical for any number of threads, by either method
+TEST(NBody, Deterministic)
+{
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+
+    for (const NBodyMethod Method : {NBodyMethod::DIRECT, NBodyMethod::BARNES_HUT})
+    {
+        NBodySystem Cloud = MakeCloud(6000, NBodySettings{.Method = Method});
+        std::vector<Vector3> Serial(Cloud.Size(), Vector3::ZERO());
+        std::vector<Vector3> Parallel(Cloud.Size(), Vector3::ZERO());
+
+        Cloud.MutualAccelerations(None, Serial);
+        Cloud.MutualAccelerations(Pool, Parallel);
+        EXPECT_EQ(Serial, Parallel);
+    }
+}
+
+// The leapfrog conserves the momentum of the mutual gravitation, and follows a circular orbit in
+// an external field
+TEST(NBody, Integrate)
+{
+    ThreadPool Pool(3);
+    NBodySystem Cloud = MakeCloud(500, NBodySettings{.Method = NBodyMethod::DIRECT});
+
+    const auto Momentum = [&]()
+    {
+        Vector3 Total = Vector3::ZERO();
+
+        for (size_t Index = 0; Index < Cloud.Size(); Index++)
+        {
+            Total = Total + Cloud.GetVelocity(Index) * Cloud.GetGravitationalParameter(Index);
+        }
+
+        return Total;
+    };
+
+    const Vector3 Initial = Momentum();
+
+    for (size_t Step = 0; Step < 100; Step++)
+    {
+        Cloud.Integrate(Pool, 10.0);
+    }
+
+    EXPECT_NEAR((Momentum() - Initial).Norm(), 0.0, 1.0E-12 * Initial.Norm());
+    EXPECT_EQ(Cloud.GetTime(), 1000.0);
+
+    // Test particles about the Earth
+    NBodySystem Orbit;
+    const double Radius = 7.0E6;
+    const double Speed = Sqrt(MU / Radius);
+    Orbit.Add(0.0, Vector3({Radius, 0.0, 0.0}), Vector3({0.0, Speed, 0.0}));
+    Orbit.Add(0.0, Vector3({0.0, 0.0, Radius}), Vector3({-Speed, 0.0, 0.0}));
+
+    const double Period = 2.0 * PI * Sqrt(Cube(Radius) / MU);
+    const size_t Steps = 1000;
+
+    for (size_t Step = 0; Step < Steps; Step++)
+    {
+        Orbit.Integrate(Pool, Period / static_cast<double>(Steps), [](double, const Vector3& Position)
+        {
+            return Position * (-MU / Cube(Position.Norm()));
+        });
+    }
+
+    EXPECT_NEAR(Orbit.GetPosition(0).Norm(), Radius, 1.0E-5 * Radius);
+    EXPECT_NEAR((Orbit.GetPosition(0) - Vector3({Radius, 0.0, 0.0})).Norm(), 0.0, 1.0E-3 * Radius);
+    EXPECT_NEAR((Orbit.GetPosition(1) - Vector3({0.0, 0.0, Radius})).Norm(), 0.0, 1.0E-3 * Radius);
+}
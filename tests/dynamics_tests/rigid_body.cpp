@@ -0,0 +1,167 @@
+#include "dynamics/rigid_body.hpp"
+#include "utils/errors.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+    // Asymmetric inertia with products of inertia
+    constexpr Matrix3 INERTIA{.XX = 10.0, .XY = 0.5, .XZ = -0.3,
+                              .YX = 0.5, .YY = 20.0, .YZ = 0.2,
+                              .ZX = -0.3, .ZY = 0.2, .ZZ = 30.0};
+
+    constexpr double MU = 3.986004418E14;
+
+    // Rotational kinetic energy and inertial angular momentum of a vehicle
+    double Energy(const RigidBodyState& State, const Matrix3& Inertia)
+    {
+        const Vector3 W(State.AngularVelocity);
+        return 0.5 * W.Dot(Inertia * W);
+    }
+
+    Vector3 Momentum(const RigidBodyState& State, const Matrix3& Inertia)
+    {
+        return State.Attitude.RotateInv(Inertia * Vector3(State.AngularVelocity));
+    }
+}
+
+// Per vehicle state and properties round trip, invalid properties are rejected
+TEST(RigidBody, Vehicles)
+{
+    RigidBodySwarm Swarm;
+
+    const RigidBodyState State{
+        .Position = Vector3({1.0, 2.0, 3.0}),
+        .Velocity = Vector3({4.0, 5.0, 6.0}),
+        .Attitude = Quaternion{.X = 0.0, .Y = 0.0, .Z = 2.0, .S = 2.0},
+        .AngularVelocity = Axis3{0.1, 0.2, 0.3}
+    };
+
+    // Grows beyond the initial capacity
+    for (size_t Index = 0; Index < 100; Index++)
+    {
+        ASSERT_EQ(Swarm.Add(RigidBodyProperties{.Mass = 1.0 + static_cast<double>(Index), .Inertia = INERTIA}, State), Index);
+    }
+
+    ASSERT_EQ(Swarm.Size(), 100u);
+    ASSERT_EQ(Swarm.GetProperties(42).Mass, 43.0);
+    ASSERT_TRUE(IsMatrix3Near(Swarm.GetProperties(99).Inertia, INERTIA, 1.0E-15));
+    ASSERT_TRUE(IsVector3Near(Swarm.GetState(99).Velocity, State.Velocity, 1.0E-15));
+
+    // Attitude is stored normalised
+    ASSERT_TRUE(IsQuaternionNear(Swarm.GetState(0).Attitude, State.Attitude.Unit(), 1.0E-15));
+
+    ASSERT_THROW(Swarm.Add(RigidBodyProperties{.Mass = 0.0}, State), Error::GenericException);
+    ASSERT_THROW(Swarm.Add(RigidBodyProperties{.Mass = 1.0, .Inertia = Matrix3::ZERO()}, State), Error::GenericException);
+    ASSERT_THROW(Swarm.AddForces(std::vector<Vector3>(3, Vector3::ZERO())), Error::HArraySizeMismatch);
+    ASSERT_EQ(Swarm.Size(), 100u);
+}
+
+// Applied loads are held over a step, then cleared
+TEST(RigidBody, AppliedLoads)
+{
+    RigidBodySwarm Swarm;
+    Swarm.Add(RigidBodyProperties{.Mass = 2.0}, RigidBodyState{});
+
+    // Force along body X of an attitude rotated 90 degrees about Z
+    Swarm.SetState(0, RigidBodyState{.Attitude = Quaternion::FromVectorAngle(Vector3::UNIT_Z(), PI / 2.0)});
+    const RigidBodyState Initial = Swarm.GetState(0);
+    const Vector3 BodyX = Initial.Attitude.RotateInv(Vector3::UNIT_X());
+
+    Swarm.AddForceAtPoint(0, 4.0 * BodyX, Vector3({0.0, 1.0, 0.0}));
+    ASSERT_TRUE(IsVector3Near(Swarm.GetAppliedForce(0), 4.0 * BodyX, 1.0E-15));
+    ASSERT_TRUE(IsVector3Near(Swarm.GetAppliedTorque(0), Vector3({0.0, 0.0, -4.0}), 1.0E-14));
+
+    // Constant acceleration is integrated exactly
+    Swarm.Integrate(0.5);
+    const RigidBodyState Final = Swarm.GetState(0);
+    ASSERT_TRUE(IsVector3Near(Final.Position, 0.5 * 2.0 * 0.25 * BodyX, 1.0E-14));
+    ASSERT_TRUE(IsVector3Near(Final.Velocity, 2.0 * 0.5 * BodyX, 1.0E-14));
+    ASSERT_NEAR(Final.AngularVelocity.Z, -4.0 * 0.5, 1.0E-14);
+    ASSERT_TRUE(IsVector3Near(Swarm.GetAppliedForce(0), Vector3::ZERO(), 1.0E-15));
+}
+
+// Spin about a principal axis matches the analytical attitude
+TEST(RigidBody, Spin)
+{
+    RigidBodySwarm Swarm;
+    constexpr double RATE = 0.3;
+    Swarm.Add(RigidBodyProperties{.Inertia = Matrix3::IDENTITY()}, RigidBodyState{.AngularVelocity = Axis3{0.0, 0.0, RATE}});
+
+    for (size_t Step = 0; Step < 100; Step++)
+    {
+        Swarm.Integrate(0.1);
+    }
+
+    // Body X axis in the inertial frame rotates positively about Z
+    const Vector3 BodyX = Swarm.GetState(0).Attitude.RotateInv(Vector3::UNIT_X());
+    ASSERT_TRUE(IsVector3Near(BodyX, Vector3({Cos(RATE * 10.0), Sin(RATE * 10.0), 0.0}), 1.0E-7));
+}
+
+// Torque free tumbling conserves energy and inertial angular momentum, for every vehicle
+TEST(RigidBody, TorqueFree)
+{
+    RigidBodySwarm Swarm;
+    std::vector<RigidBodyState> Initial;
+
+    // Not a multiple of the vectorised group size
+    for (size_t Index = 0; Index < 13; Index++)
+    {
+        const double Scale = 1.0 + 0.1 * static_cast<double>(Index);
+        Initial.push_back(RigidBodyState{
+            .Attitude = Quaternion::FromVectorAngle(Vector3({1.0, 2.0, 3.0}).Unit(), Scale),
+            .AngularVelocity = Axis3{0.1 * Scale, -0.2, 0.05 * Scale}
+        });
+        Swarm.Add(RigidBodyProperties{.Inertia = INERTIA}, Initial.back());
+    }
+
+    for (size_t Step = 0; Step < 2000; Step++)
+    {
+        Swarm.Integrate(0.05);
+    }
+
+    for (size_t Index = 0; Index < Swarm.Size(); Index++)
+    {
+        const RigidBodyState Final = Swarm.GetState(Index);
+        ASSERT_NEAR(Energy(Final, INERTIA), Energy(Initial[Index], INERTIA), 1.0E-9);
+        ASSERT_TRUE(IsVector3Near(Momentum(Final, INERTIA), Momentum(Initial[Index], INERTIA), 1.0E-8));
+        ASSERT_NEAR(Final.Attitude.Norm(), 1.0, 1.0E-15);
+    }
+}
+
+// Load models are evaluated at each stage, conserving a circular orbit
+TEST(RigidBody, LoadModel)
+{
+    RigidBodySwarm Swarm;
+    constexpr double RADIUS = 7.0E6;
+    const double Speed = Sqrt(MU / RADIUS);
+    const double Period = 2.0 * PI * RADIUS / Speed;
+
+    Swarm.Add(RigidBodyProperties{.Mass = 100.0, .Inertia = INERTIA},
+        RigidBodyState{.Position = Vector3({RADIUS, 0.0, 0.0}), .Velocity = Vector3({0.0, Speed, 0.0})});
+
+    const size_t Steps = 1000;
+    const double Step = Period / static_cast<double>(Steps);
+    const auto Gravity = [](RigidBodySwarm& Stage) noexcept
+    {
+        Stage.AddPointMassGravity(MU);
+        Stage.AddGravityGradientTorque(MU);
+    };
+
+    for (size_t Index = 0; Index < Steps; Index++)
+    {
+        Swarm.Integrate(Step, Gravity);
+    }
+
+    const RigidBodyState Final = Swarm.GetState(0);
+    ASSERT_NEAR(Final.Position.Norm(), RADIUS, 1.0E-2);
+    ASSERT_TRUE(IsVector3Near(Final.Position, Vector3({RADIUS, 0.0, 0.0}), 1.0));
+
+    // Gravity gradient of an asymmetric body induces rotation from rest
+    ASSERT_GT(Vector3(Final.AngularVelocity).Norm(), 0.0);
+
+    // Loads of a model are not retained as applied loads
+    ASSERT_TRUE(IsVector3Near(Swarm.GetAppliedForce(0), Vector3::ZERO(), 1.0E-15));
+}
@@ -0,0 +1,81 @@
+#include "ephemeris/analytic.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+
+// Julian date to seconds past J2000
+constexpr double JulianDate2Epoch(double JulianDate)
+{
+    return (JulianDate - 2451545.0) * 86400.0;
+}
+
+// Geocentric Moon, example 47.a taken from Astronomical Algorithms, 2nd Edition
+// Jean Meeus
+TEST(AnalyticEphemeris, Moon)
+{
+    constexpr double Centuries = Analytic::EpochToCenturies(JulianDate2Epoch(2448724.5));
+    constexpr Vector3 Moon = Analytic::MoonPosition(Centuries);
+
+    // Back to ecliptic co-ordinates    
+    constexpr double CosEps = Cos(Analytic::OBLIQUITY_J2000);
+    constexpr double SinEps = Sin(Analytic::OBLIQUITY_J2000);
+    constexpr Vector3 Ecliptic = Vector3({Moon.X, CosEps * Moon.Y + SinEps * Moon.Z, -SinEps * Moon.Y + CosEps * Moon.Z});
+
+    // Meeus values are referred to the mean equinox of date, remove the precession since J2000
+    constexpr double Longitude = R2D(Atan2(Ecliptic.Y, Ecliptic.X)) + 1.3972 * Centuries;
+    constexpr double Latitude = R2D(Asin(Ecliptic.Z / Moon.Norm()));
+
+    static_assert(IsNear(Moon.Norm(), 368409.7E3, 100.0E3));
+    static_assert(IsNear(Longitude, 133.162655, 0.02));
+    static_assert(IsNear(Latitude, -3.229126, 0.01));
+}
+
+// Heliocentric Venus, example 33.a taken from Astronomical Algorithms, 2nd Edition
+// Jean Meeus
+TEST(AnalyticEphemeris, Planets)
+{
+    constexpr double Centuries = Analytic::EpochToCenturies(JulianDate2Epoch(2448976.5));
+    constexpr Vector3 Venus = Analytic::PlanetPosition(Analytic::Body::VENUS, Centuries);
+
+    static_assert(IsNear(Venus.Norm() / Analytic::ASTRONOMICAL_UNIT, 0.724603, 1.0E-4));
+
+    // Orbital radii remain within perihelion and aphelion over the valid range of the elements
+    for (int Year = 1900; Year < 2050; Year += 5)
+    {
+        const double YearCenturies = (Year - 2000) / 100.0;
+        const double Jupiter = Analytic::PlanetPosition(Analytic::Body::JUPITER, YearCenturies).Norm() / Analytic::ASTRONOMICAL_UNIT;
+        const double Mars = Analytic::PlanetPosition(Analytic::Body::MARS, YearCenturies).Norm() / Analytic::ASTRONOMICAL_UNIT;
+        ASSERT_GT(Jupiter, 4.94);
+        ASSERT_LT(Jupiter, 5.46);
+        ASSERT_GT(Mars, 1.38);
+        ASSERT_LT(Mars, 1.67);
+    }
+}
+
+// The geocentric solar series and the heliocentric earth-moon barycentre must agree
+TEST(AnalyticEphemeris, Consistency)
+{
+    for (int Day = 0; Day < 3650; Day += 10)
+    {
+        const double Centuries = Analytic::EpochToCenturies(Day * 86400.0);
+        const Vector3 Sun = Analytic::SunPosition(Centuries);
+        const Vector3 EMB = Analytic::PlanetPosition(Analytic::Body::EARTH_MOON_BARYCENTER, Centuries);
+
+        ASSERT_LT((Sun + EMB).Norm() / Analytic::ASTRONOMICAL_UNIT, 1.0E-3);
+    }
+
+    // Ephemeris interface
+    const AnalyticEphemeris SunWrtEarth(Analytic::Body::SUN, Analytic::Body::EARTH);
+    const AnalyticEphemeris EarthWrtSun(Analytic::Body::EARTH, Analytic::Body::SUN);
+    const Ephemeris& Eph = SunWrtEarth;
+
+    const EphemerisState State = Eph.GetState(0.0);
+    ASSERT_TRUE(IsVector3Near(State.Pos, -EarthWrtSun.GetState(0.0).Pos, 1.0E-3));
+    ASSERT_NEAR(State.LightTime, 490.7, 1.0); // Perihelion in early January
+
+    // Earth orbital speed relative to the sun (m/s)
+    ASSERT_NEAR(State.Vel.Norm(), 30.3E3, 0.2E3);
+
+    // Constant evaluated state
+    constexpr EphemerisState MoonState = AnalyticEphemeris::CalculateState(Analytic::Body::MOON, Analytic::Body::EARTH, 0.0);
+    static_assert(IsNear(MoonState.Vel.Norm(), 1.0E3, 0.1E3));
+}
@@ -0,0 +1,108 @@
+#include "ephemeris/graph.hpp"
+#include "math/constants.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+/**
+ * Body moving with constant velocity relative to its parent, counts evaluations
+ */
+class LinearEphemeris : public Ephemeris
+{
+public:
+    LinearEphemeris(const Vector3& Pos, const Vector3& Vel) : mPos{Pos}, mVel{Vel} { }
+
+    EphemerisState GetState(double EpochTime) const noexcept override
+    {
+        Evaluations++;
+        return EphemerisState{.Pos = mPos + mVel * EpochTime, .Vel = mVel};
+    }
+
+    mutable int Evaluations = 0;
+
+private:
+    Vector3 mPos;
+    Vector3 mVel;
+};
+
+TEST(EphemerisGraph, Composition)
+{
+    constexpr int32_t SSB = 0, EMB = 3, EARTH = 399, MOON = 301, SUN = 10, CRAFT = -60000;
+
+    LinearEphemeris EMBWrtSSB(Vector3({1.5E11, 0.0, 0.0}), Vector3({0.0, 3.0E4, 0.0}));
+    LinearEphemeris EarthWrtEMB(Vector3({-4.6E6, 0.0, 0.0}), Vector3({0.0, -12.0, 0.0}));
+    LinearEphemeris MoonWrtEMB(Vector3({3.8E8, 0.0, 0.0}), Vector3({0.0, 1.0E3, 0.0}));
+    LinearEphemeris SunWrtSSB(Vector3({1.0E6, 2.0E5, 0.0}), Vector3({0.0, 10.0, 0.0}));
+    LinearEphemeris CraftWrtMoon(Vector3({0.0, 7.0E7, 0.0}), Vector3({100.0, 0.0, 0.0}));
+
+    EphemerisGraph Graph(SSB);
+    ASSERT_TRUE(Graph.AddBody(EMB, SSB, EMBWrtSSB));
+    ASSERT_TRUE(Graph.AddBody(EARTH, EMB, EarthWrtEMB));
+    ASSERT_TRUE(Graph.AddBody(MOON, EMB, MoonWrtEMB));
+    ASSERT_TRUE(Graph.AddBody(SUN, SSB, SunWrtSSB));
+    ASSERT_TRUE(Graph.AddBody(CRAFT, MOON, CraftWrtMoon));
+
+    // Duplicate bodies and unknown parents are rejected
+    ASSERT_FALSE(Graph.AddBody(MOON, EMB, MoonWrtEMB));
+    ASSERT_FALSE(Graph.AddBody(401, 4, MoonWrtEMB));
+    ASSERT_EQ(Graph.Size(), 6u);
+
+    constexpr double Epoch = 100.0;
+    const std::vector<BodyPair> Pairs{{CRAFT, MOON}, {CRAFT, EARTH}, {CRAFT, SUN}, {EARTH, CRAFT}};
+    std::vector<EphemerisState> States(Pairs.size());
+    Graph.GetRelativeStates(Pairs, Epoch, States);
+
+    // Spacecraft relative to the moon is the raw ephemeris
+    ASSERT_TRUE(IsVector3Near(States[0].Pos, CraftWrtMoon.GetState(Epoch).Pos, 1.0E-6));
+    ASSERT_TRUE(IsVector3Near(States[0].Vel, CraftWrtMoon.GetState(Epoch).Vel, 1.0E-9));
+
+    // Spacecraft relative to the earth composes through the barycentre
+    const Vector3 CraftWrtEarth = CraftWrtMoon.GetState(Epoch).Pos + MoonWrtEMB.GetState(Epoch).Pos - EarthWrtEMB.GetState(Epoch).Pos;
+    ASSERT_TRUE(IsVector3Near(States[1].Pos, CraftWrtEarth, 1.0E-6));
+    ASSERT_NEAR(States[1].LightTime, CraftWrtEarth.Norm() / SPEED_LIGHT, 1.0E-12);
+    ASSERT_TRUE(IsVector3Near(States[3].Pos, -CraftWrtEarth, 1.0E-6));
+
+    // Spacecraft relative to the sun
+    const Vector3 CraftWrtSun = CraftWrtMoon.GetState(Epoch).Pos + MoonWrtEMB.GetState(Epoch).Pos 
+        + EMBWrtSSB.GetState(Epoch).Pos - SunWrtSSB.GetState(Epoch).Pos;
+    ASSERT_TRUE(IsVector3Near(States[2].Pos, CraftWrtSun, 1.0E-3));
+
+    // Unknown bodies give a zero state
+    ASSERT_TRUE(Graph.GetRelativeState({CRAFT, 499}, Epoch).Pos.IsZeroVector());
+}
+
+TEST(EphemerisGraph, Memoisation)
+{
+    LinearEphemeris EarthWrtSSB(Vector3({1.5E11, 0.0, 0.0}), Vector3({0.0, 3.0E4, 0.0}));
+    LinearEphemeris MoonWrtEarth(Vector3({3.8E8, 0.0, 0.0}), Vector3({0.0, 1.0E3, 0.0}));
+
+    EphemerisGraph Graph(0);
+    Graph.AddBody(399, 0, EarthWrtSSB);
+    Graph.AddBody(301, 399, MoonWrtEarth);
+
+    // Many queries at one epoch evaluate each ephemeris exactly once
+    for (int Index = 0; Index < 10; Index++)
+    {
+        Graph.GetRelativeState({301, 399}, 5.0);
+        Graph.GetRelativeState({399, 0}, 5.0);
+        Graph.GetRelativeState({0, 301}, 5.0);
+    }
+    ASSERT_EQ(EarthWrtSSB.Evaluations, 1);
+    ASSERT_EQ(MoonWrtEarth.Evaluations, 1);
+
+    // A new epoch triggers a single re-evaluation
+    Graph.GetRelativeState({301, 0}, 6.0);
+    ASSERT_EQ(EarthWrtSSB.Evaluations, 2);
+    ASSERT_EQ(MoonWrtEarth.Evaluations, 2);
+
+    // Cache may be explicitly discarded
+    Graph.ClearCache();
+    Graph.GetRelativeState({301, 0}, 6.0);
+    ASSERT_EQ(MoonWrtEarth.Evaluations, 3);
+
+    // Pair view is usable as an ephemeris
+    const GraphEphemeris MoonWrtSSB(Graph, {301, 0});
+    const Ephemeris& Eph = MoonWrtSSB;
+    ASSERT_TRUE(IsVector3Near(Eph.GetState(6.0).Pos, Vector3({1.5E11 + 3.8E8, 6.0 * 3.1E4, 0.0}), 1.0E-3));
+}
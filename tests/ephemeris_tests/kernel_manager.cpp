@@ -0,0 +1,228 @@
+#include "ephemeris/kernel_manager.hpp"
+#include "utils/mapped_file.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const std::string GATEWAY_KERNEL = std::string(PROJECT_DIR)
+        + std::string("/data/spice/gateway_nrho_reference/receding_horiz_3189_1burnApo_DiffCorr_15yr.bsp");
+
+    constexpr int32_t GATEWAY = -60000;
+
+    /**
+     * Writes a standalone SPK holding a subset of the segments of the first summary record
+     * of the gateway kernel, relabelled with a body and centre, returns the path
+     */
+    std::string WriteSubsetKernel(const std::string& Name, size_t First, size_t Last, int32_t Body = GATEWAY, int32_t Center = 399)
+    {
+        const MappedFile Source(GATEWAY_KERNEL);
+        if (Source.IsOpen() == false)
+        {
+            return std::string();
+        }
+
+        const auto* Bytes = reinterpret_cast<const char*>(Source.Data().data());
+
+        int32_t Forward = 0;
+        std::memcpy(&Forward, Bytes + 76, sizeof(int32_t));
+
+        // Summaries are 5 doubles (start, end, 6 packed integers), names are 40 characters
+        const size_t SummaryRecord = (static_cast<size_t>(Forward) - 1) * 1024;
+        const size_t NameRecord = SummaryRecord + 1024;
+
+        double Count = 0.0;
+        std::memcpy(&Count, Bytes + SummaryRecord + 16, sizeof(double));
+
+        // Copy everything up to the end of the data referenced by the first summary record
+        int32_t LastAddress = 0;
+        for (size_t Index = 0; Index < static_cast<size_t>(Count); Index++)
+        {
+            int32_t Address = 0;
+            std::memcpy(&Address, Bytes + SummaryRecord + 24 + Index * 40 + 16 + 5 * sizeof(int32_t), sizeof(int32_t));
+            LastAddress = Max(LastAddress, Address);
+        }
+
+        const size_t Length = ((static_cast<size_t>(LastAddress) * 8 + 1023) / 1024) * 1024;
+        std::string Subset(Bytes, Length);
+
+        // Single summary record, holding only the requested segments
+        const int32_t Free = LastAddress + 1;
+        std::memcpy(Subset.data() + 80, &Forward, sizeof(int32_t));
+        std::memcpy(Subset.data() + 84, &Free, sizeof(int32_t));
+
+        const double Header[3] = {0.0, 0.0, static_cast<double>(Last - First)};
+        std::memcpy(Subset.data() + SummaryRecord, Header, sizeof(Header));
+        std::memmove(Subset.data() + SummaryRecord + 24, Subset.data() + SummaryRecord + 24 + First * 40, (Last - First) * 40);
+        std::memmove(Subset.data() + NameRecord, Subset.data() + NameRecord + First * 40, (Last - First) * 40);
+
+        for (size_t Index = 0; Index < Last - First; Index++)
+        {
+            std::memcpy(Subset.data() + SummaryRecord + 24 + Index * 40 + 16, &Body, sizeof(int32_t));
+            std::memcpy(Subset.data() + SummaryRecord + 24 + Index * 40 + 16 + sizeof(int32_t), &Center, sizeof(int32_t));
+        }
+
+        const std::string Path = (std::filesystem::temp_directory_path() / Name).string();
+        std::ofstream Out(Path, std::ios::binary);
+        Out.write(Subset.data(), static_cast<std::streamsize>(Subset.size()));
+
+        return Path;
+    }
+}
+
+// Coverage is indexed from the DAF summaries without loading the kernel
+TEST(KernelManager, Coverage)
+{
+    KernelManager Manager{};
+
+    ASSERT_TRUE(Manager.Register(GATEWAY_KERNEL));
+    ASSERT_FALSE(Manager.Register(DEFAULT_LEAP_SECOND_KERNAL));
+    ASSERT_FALSE(Manager.Register(std::string(PROJECT_DIR) + std::string("/missing.bsp")));
+
+    ASSERT_EQ(Manager.RegisteredCount(), 1u);
+    ASSERT_EQ(Manager.LoadedCount(), 0u);
+
+    // Thousands of contiguous segments merge into a single interval
+    ASSERT_EQ(Manager.GetCoverage().size(), 1u);
+    const KernelCoverage& Coverage = Manager.GetCoverage()[0];
+    ASSERT_EQ(Coverage.Body, GATEWAY);
+    ASSERT_EQ(Coverage.Center, 399);
+    ASSERT_NEAR(Coverage.Start, 631224576.0, 1.0);
+    ASSERT_NEAR(Coverage.End, 1108051199.75, 1.0);
+
+    ASSERT_TRUE(Manager.IsCovered(GATEWAY, 7.0E8));
+    ASSERT_FALSE(Manager.IsCovered(GATEWAY, 6.0E8));
+    ASSERT_FALSE(Manager.IsCovered(301, 7.0E8));
+}
+
+// Kernels are loaded on first use, and the least recently used unloaded over budget
+TEST(KernelManager, LoadOnDemand)
+{
+    const std::string Late = WriteSubsetKernel("hamilton_gateway_late.bsp", 0, 10);
+    const std::string Early = WriteSubsetKernel("hamilton_gateway_early.bsp", 10, 20);
+
+    const MappedFile LateFile(Late);
+    KernelManager Manager(LateFile.Size() + LateFile.Size() / 2);
+    Manager.LoadAuxillary(DEFAULT_LEAP_SECOND_KERNAL);
+
+    ASSERT_TRUE(Manager.Register(Late));
+    ASSERT_TRUE(Manager.Register(Early));
+    ASSERT_EQ(Manager.GetCoverage().size(), 2u);
+
+    const KernelCoverage LateCoverage = Manager.GetCoverage()[1];
+    const KernelCoverage EarlyCoverage = Manager.GetCoverage()[0];
+    ASSERT_EQ(LateCoverage.Kernel, 0u);
+    ASSERT_LT(EarlyCoverage.End, LateCoverage.End);
+
+    const double LateEpoch = 0.5 * (LateCoverage.Start + LateCoverage.End);
+    const double EarlyEpoch = 0.5 * (EarlyCoverage.Start + EarlyCoverage.End);
+
+    // Uncovered queries load nothing
+    ASSERT_FALSE(Manager.Require(GATEWAY, 7.0E8));
+    ASSERT_EQ(Manager.LoadedCount(), 0u);
+
+    ASSERT_TRUE(Manager.Require(GATEWAY, LateEpoch));
+    ASSERT_EQ(Manager.LoadedCount(), 1u);
+    ASSERT_EQ(Manager.LoadedBytes(), LateFile.Size());
+
+    // Second kernel exceeds the budget, so the first is unloaded
+    ASSERT_TRUE(Manager.Require(GATEWAY, EarlyEpoch));
+    ASSERT_EQ(Manager.LoadedCount(), 1u);
+
+    // Spanning both kernels keeps both loaded irrespective of the budget
+    ASSERT_TRUE(Manager.Require(GATEWAY, EarlyEpoch, LateEpoch));
+    ASSERT_EQ(Manager.LoadedCount(), 2u);
+
+    // Lazy ephemeris matches the directly loaded kernel
+    const LazySpiceEphemeris Lazy(Manager, {.Object = "-60000", .Frame = "J2000", .Reference = "EARTH"}, GATEWAY, 399);
+    const SpiceEphemeris Direct({.Object = "-60000", .Frame = "J2000", .Reference = "EARTH"});
+
+    Manager.UnloadAll();
+    const EphemerisState State = Lazy.GetState(LateEpoch);
+    ASSERT_EQ(Manager.LoadedCount(), 1u);
+    ASSERT_TRUE(IsVector3Near(State.Pos, Direct.GetState(LateEpoch).Pos, 1.0E-6));
+
+    Manager.UnloadAll();
+    std::filesystem::remove(Late);
+    std::filesystem::remove(Early);
+}
+
+// A registered kernel which can no longer be loaded fails every state of the lazy ephemeris
+TEST(KernelManager, MissingKernel)
+{
+    const std::string Removed = WriteSubsetKernel("hamilton_gateway_removed.bsp", 0, 10);
+
+    KernelManager Manager{};
+    Manager.LoadAuxillary(DEFAULT_LEAP_SECOND_KERNAL);
+    ASSERT_TRUE(Manager.Register(Removed));
+
+    const KernelCoverage Coverage = Manager.GetCoverage()[0];
+    std::filesystem::remove(Removed);
+
+    const LazySpiceEphemeris Lazy(Manager, {.Object = "-60000", .Frame = "J2000", .Reference = "EARTH"}, GATEWAY, 399);
+    const std::vector<double> Epochs{Coverage.Start + 60.0, 0.5 * (Coverage.Start + Coverage.End), Coverage.End - 60.0};
+    std::vector<EphemerisState> Out(Epochs.size(), EphemerisState{.Pos = Vector3({1.0, 2.0, 3.0})});
+
+    ASSERT_FALSE(Lazy.GetStates(Epochs, Out));
+    ASSERT_EQ(Manager.LoadedCount(), 0u);
+
+    for (const EphemerisState& State : Out)
+    {
+        ASSERT_TRUE(State.Pos.IsZeroVector());
+        ASSERT_TRUE(State.Vel.IsZeroVector());
+    }
+
+    ASSERT_TRUE(Lazy.GetState(Epochs[1]).Pos.IsZeroVector());
+}
+
+// A body whose segments have different centres loads the chain of every centre covering the
+// interval, and only those
+TEST(KernelManager, MixedCentres)
+{
+    const std::string EarthSegments = WriteSubsetKernel("hamilton_chain_earth.bsp", 0, 5, GATEWAY, 399);
+    const std::string MoonSegments = WriteSubsetKernel("hamilton_chain_moon.bsp", 5, 10, GATEWAY, 301);
+    const std::string Earth = WriteSubsetKernel("hamilton_chain_earth_centre.bsp", 0, 10, 399, 3);
+    const std::string Moon = WriteSubsetKernel("hamilton_chain_moon_centre.bsp", 0, 10, 301, 3);
+
+    KernelManager Manager{};
+
+    for (const std::string& Path : {EarthSegments, MoonSegments, Earth, Moon})
+    {
+        ASSERT_TRUE(Manager.Register(Path));
+    }
+
+    const std::span<const KernelCoverage> Coverage = Manager.GetCoverage();
+    const auto AboutEarth = std::find_if(Coverage.begin(), Coverage.end(), [](const KernelCoverage& Entry)
+    {
+        return (Entry.Body == GATEWAY) && (Entry.Center == 399);
+    });
+    const auto AboutMoon = std::find_if(Coverage.begin(), Coverage.end(), [](const KernelCoverage& Entry)
+    {
+        return (Entry.Body == GATEWAY) && (Entry.Center == 301);
+    });
+    ASSERT_NE(AboutEarth, Coverage.end());
+    ASSERT_NE(AboutMoon, Coverage.end());
+
+    // Spanning both centres loads all four kernels
+    ASSERT_TRUE(Manager.Require(GATEWAY, Min(AboutEarth->Start, AboutMoon->Start), Max(AboutEarth->End, AboutMoon->End)));
+    ASSERT_EQ(Manager.LoadedCount(), 4u);
+
+    // Within the segments centred on the moon, the earth is not required
+    Manager.UnloadAll();
+    ASSERT_TRUE(Manager.Require(GATEWAY, 0.5 * (AboutMoon->Start + AboutMoon->End)));
+    ASSERT_EQ(Manager.LoadedCount(), 2u);
+
+    Manager.UnloadAll();
+
+    for (const std::string& Path : {EarthSegments, MoonSegments, Earth, Moon})
+    {
+        std::filesystem::remove(Path);
+    }
+}
@@ -0,0 +1,163 @@
+#include "ephemeris/light_time.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    /**
+     * Body moving with constant velocity, counts batched queries
+     */
+    class ConstantVelocityEphemeris : public Ephemeris
+    {
+    public:
+        ConstantVelocityEphemeris(const Vector3& Pos, const Vector3& Vel) : mPos{Pos}, mVel{Vel} { }
+
+        EphemerisState GetState(double EpochTime) const noexcept override
+        {
+            return EphemerisState{.Pos = mPos + mVel * EpochTime, .Vel = mVel};
+        }
+
+        bool GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const override
+        {
+            Queries++;
+            return Ephemeris::GetStates(Epochs, Out);
+        }
+
+        /**
+         * @return Exact reception light time for an observer stationary at the origin, the
+         * positive root of |P + V (t - LT)| = c LT
+         */
+        double ExactLightTime(double EpochTime) const noexcept
+        {
+            const Vector3 P = mPos + mVel * EpochTime;
+            const double A = SPEED_LIGHT * SPEED_LIGHT - mVel.NormSquared();
+            const double B = 2.0 * Vector3::Dot(P, mVel);
+            const double C = -P.NormSquared();
+            return (-B + Sqrt(B * B - 4.0 * A * C)) / (2.0 * A);
+        }
+
+        mutable int Queries = 0;
+
+    private:
+        Vector3 mPos;
+        Vector3 mVel;
+    };
+}
+
+// Converged light time matches the closed form solution for linear motion
+TEST(LightTime, Convergence)
+{
+    const ConstantVelocityEphemeris Near(Vector3({4.0E8, 0.0, 0.0}), Vector3({0.0, 1.0E3, 0.0}));
+    const ConstantVelocityEphemeris Far(Vector3({-2.0E12, 1.0E11, 0.0}), Vector3({3.0E4, -2.0E4, 1.0E4}));
+
+    const std::vector<const Ephemeris*> Targets{&Near, &Far, &Near, &Far};
+    const std::vector<EphemerisState> Observers(Targets.size());
+    std::vector<EphemerisState> Out(Targets.size());
+
+    constexpr double Epoch = 1.0E4;
+    LightTimeSolver Solver(LightTimeOptions{.Aberration = false, .Tolerance = 1.0E-12});
+    ASSERT_EQ(Solver.Solve(Targets, Observers, Epoch, Out), 0u);
+
+    for (size_t Index = 0; Index < Out.size(); Index++)
+    {
+        const auto* Target = static_cast<const ConstantVelocityEphemeris*>(Targets[Index]);
+        const double LightTime = Target->ExactLightTime(Epoch);
+
+        ASSERT_NEAR(Out[Index].LightTime, LightTime, 1.0E-9);
+        ASSERT_TRUE(IsVector3Near(Out[Index].Pos, Target->GetState(Epoch - LightTime).Pos, 1.0E-3));
+    }
+
+    // Each target is queried once per iteration irrespective of the number of pairs sharing it
+    ASSERT_EQ(Max(Near.Queries, Far.Queries), static_cast<int>(Solver.GetIterations()));
+    ASSERT_LE(Near.Queries, Far.Queries);
+    ASSERT_LE(Solver.GetIterations(), 5u);
+
+    // Iteration limits are reported
+    LightTimeSolver Limited(LightTimeOptions{.Aberration = false, .Tolerance = 1.0E-12, .MaxIterations = 1});
+    ASSERT_EQ(Limited.Solve(Targets, Observers, Epoch, Out), 4u);
+
+    std::vector<EphemerisState> Short(1);
+    ASSERT_THROW(Solver.Solve(Targets, Observers, Epoch, Short), Error::HArraySizeMismatch);
+}
+
+// Targets which cannot be evaluated are reported, rather than solved from a default state
+TEST(LightTime, Failure)
+{
+    /**
+     * Body which cannot be evaluated before an epoch
+     */
+    class BoundedEphemeris : public ConstantVelocityEphemeris
+    {
+    public:
+        BoundedEphemeris(const Vector3& Pos, double Start) : ConstantVelocityEphemeris(Pos, Vector3::ZERO()), mStart{Start} { }
+
+        EphemerisState GetState(double EpochTime) const noexcept override
+        {
+            return (EpochTime < mStart) ? EphemerisState{} : ConstantVelocityEphemeris::GetState(EpochTime);
+        }
+
+        bool GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const override
+        {
+            ConstantVelocityEphemeris::GetStates(Epochs, Out);
+            return std::all_of(Epochs.begin(), Epochs.end(), [&](double Epoch) {return Epoch >= mStart;});
+        }
+
+    private:
+        double mStart = 0.0;
+    };
+
+    const ConstantVelocityEphemeris Valid(Vector3({4.0E8, 0.0, 0.0}), Vector3({0.0, 1.0E3, 0.0}));
+    const BoundedEphemeris Missing(Vector3({3.0E8, 0.0, 0.0}), 1.0E6);
+    const BoundedEphemeris Late(Vector3({3.0E8, 0.0, 0.0}), 0.5);
+
+    const std::vector<const Ephemeris*> Targets{&Valid, &Missing, &Late};
+    const std::vector<EphemerisState> Observers(Targets.size(), EphemerisState{.Vel = Vector3({0.0, 3.0E4, 0.0})});
+    std::vector<EphemerisState> Out(Targets.size());
+
+    // The late target is evaluated at the epoch, then fails once offset by the light time
+    LightTimeSolver Solver;
+    ASSERT_EQ(Solver.Solve(Targets, Observers, 1.0, Out), 2u);
+    ASSERT_GT(Out[0].LightTime, 1.0);
+
+    for (size_t Index = 1; Index < Out.size(); Index++)
+    {
+        ASSERT_EQ(Out[Index].LightTime, 0.0);
+        ASSERT_EQ(Out[Index].Pos.Norm(), 0.0);
+    }
+}
+
+// Transmission evaluates the target in the future
+TEST(LightTime, Transmission)
+{
+    const ConstantVelocityEphemeris Target(Vector3({1.0E11, 0.0, 0.0}), Vector3({0.0, 3.0E4, 0.0}));
+    const std::vector<const Ephemeris*> Targets{&Target};
+    const std::vector<EphemerisState> Observers(1);
+    std::vector<EphemerisState> Out(1);
+
+    LightTimeSolver Solver(LightTimeOptions{.Direction = LightTimeDirection::TRANSMISSION, .Aberration = false});
+    ASSERT_EQ(Solver.Solve(Targets, Observers, 0.0, Out), 0u);
+
+    // Target recedes perpendicular to the line of sight, so the path lengthens
+    ASSERT_TRUE(IsVector3Near(Out[0].Pos, Target.GetState(Out[0].LightTime).Pos, 1.0E-3));
+    ASSERT_GT(Out[0].LightTime, 1.0E11 / SPEED_LIGHT);
+}
+
+// Aberration displaces the target towards the observer velocity by asin(v/c)
+TEST(LightTime, StellarAberration)
+{
+    constexpr Vector3 Pos = Vector3({1.0E11, 0.0, 0.0});
+    constexpr Vector3 Vel = Vector3({0.0, 3.0E4, 0.0});
+
+    constexpr Vector3 Received = StellarAberration(Pos, Vel, LightTimeDirection::RECEPTION);
+    constexpr Vector3 Transmitted = StellarAberration(Pos, Vel, LightTimeDirection::TRANSMISSION);
+
+    static_assert(IsNear(Received.Norm(), Pos.Norm(), 1.0E-3));
+    static_assert(IsNear(Atan2(Received.Y, Received.X), Asin(3.0E4 / SPEED_LIGHT), 1.0E-12));
+    static_assert(IsNear(Atan2(Transmitted.Y, Transmitted.X), -Asin(3.0E4 / SPEED_LIGHT), 1.0E-12));
+
+    // Motion along the line of sight has no effect
+    static_assert(StellarAberration(Pos, Vector3({1.0E4, 0.0, 0.0}), LightTimeDirection::RECEPTION) == Pos);
+}
@@ -7,6 +7,7 @@
 #include "gtest/gtest.h"
 
 #include <string_view>
+#include <vector>
 
 TEST(Spice, GetEphemerisState)
 {
@@ -32,4 +33,50 @@ TEST(Spice, GetEphemerisState)
         ASSERT_TRUE(IsVector3Near(Result.Vel, Vector3({-790.033, -394.054, -579.696}), 1.0E-3));
         ASSERT_NEAR(Result.LightTime, 1.34899, 1.0E-5);
     }
-}
\ No newline at end of file
+}
+
+TEST(Spice, GetEphemerisStates)
+{
+    auto GatewayEphemeris = SpiceEphemeris({
+        .Object = Spice::GetObjectString(Spice::ObjectID::GATEWAY), 
+        .Frame = Spice::GetFrameString(Spice::FrameID::J2000), 
+        .Reference = Spice::GetObjectString(Spice::ObjectID::EARTH)
+    });    
+
+    {
+        // Load Kernels    
+        Spice::KernelSet Kernels{ };
+        Kernels.LoadAuxillary(DEFAULT_LEAP_SECOND_KERNAL); // Leap seconds kernel
+        Kernels.LoadEphemeris(std::string(PROJECT_DIR) 
+            + std::string("/data/spice/gateway_nrho_reference/receding_horiz_3189_1burnApo_DiffCorr_15yr.bsp")); // Gateway
+
+        const double EpochTime = Spice::Date2Epoch("2024 June 10, 13:00:00 PST");
+        const std::vector<double> Epochs{EpochTime, EpochTime + 60.0, EpochTime + 3600.0, EpochTime + 86400.0};
+        std::vector<EphemerisState> Results(Epochs.size());
+
+        ASSERT_TRUE(GatewayEphemeris.GetStates(Epochs, Results));
+
+        // Batched states must be identical to the states evaluated one at a time
+        for (size_t Index = 0; Index < Epochs.size(); Index++)
+        {
+            const EphemerisState Expected = GatewayEphemeris.GetState(Epochs[Index]);
+            ASSERT_TRUE(IsVector3Near(Results[Index].Pos, Expected.Pos, 1.0E-9));
+            ASSERT_TRUE(IsVector3Near(Results[Index].Vel, Expected.Vel, 1.0E-12));
+            ASSERT_EQ(Results[Index].LightTime, Expected.LightTime);
+        }
+
+        ASSERT_TRUE(IsVector3Near(Results.front().Pos, Vector3({-286826000.0, 264939000.0, 105314000.0}), 1.0E3));
+
+        // An epoch outside of the kernel coverage fails alone, leaving the default state
+        const std::vector<double> Uncovered{EpochTime, EpochTime - 100.0 * 365.25 * 86400.0, EpochTime + 60.0};
+        std::vector<EphemerisState> Partial(Uncovered.size());
+
+        ASSERT_FALSE(GatewayEphemeris.GetStates(Uncovered, Partial));
+        ASSERT_TRUE(IsVector3Near(Partial[0].Pos, Results[0].Pos, 1.0E-9));
+        ASSERT_EQ(Partial[1].Pos.Norm(), 0.0);
+        ASSERT_TRUE(IsVector3Near(Partial[2].Pos, Results[1].Pos, 1.0E-9));
+
+        // Mismatched input and output sizes
+        ASSERT_THROW(GatewayEphemeris.GetStates(Epochs, std::span<EphemerisState>(Results).first(2)), Error::HArraySizeMismatch);
+    }
+}
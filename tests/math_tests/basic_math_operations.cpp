@@ -47,4 +47,15 @@ TEST(Math, BasicOperations)
         static_assert(Clamp(5.0, 2.0, 4.0) == 4.0);
         static_assert(Clamp(1.0, 2.0, 4.0) == 2.0);
     }     
+
+    // Erfc, evaluated at compile time without cancellation in the tail
+    {
+        constexpr double Values[] = {-1.5, 0.3, 1.4, 1.9, 4.0, 9.0, 26.0};
+        constexpr double Constant[] = {Erfc(-1.5), Erfc(0.3), Erfc(1.4), Erfc(1.9), Erfc(4.0), Erfc(9.0), Erfc(26.0)};
+
+        for (size_t Index = 0; Index < std::size(Values); Index++)
+        {
+            EXPECT_NEAR(Constant[Index], Erfc(Values[Index]), 1.0E-13 * Erfc(Values[Index])) << Values[Index];
+        }
+    }
 }
\ No newline at end of file
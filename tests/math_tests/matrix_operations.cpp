@@ -2,6 +2,7 @@
 #include "test_utils.hpp"
 #include "math/core_math.hpp"
 #include "math/matrix3.hpp"
+#include "math/matrixn.hpp"
 
 TEST(Matrix3, BasicOperations)
 {
@@ -178,3 +179,68 @@ TEST(Matrix3, BasicOperations)
         }
     }
 }
+
+TEST(MatrixN, BasicOperations)
+{
+    // Default matrix constructors
+    {
+        static_assert(MatrixN<4, 4>::IDENTITY()(0, 0) == 1.0);
+        static_assert(MatrixN<4, 4>::IDENTITY()(3, 3) == 1.0);
+        static_assert(MatrixN<4, 4>::IDENTITY()(0, 3) == 0.0);
+        static_assert(MatrixN<2, 5>::ZERO() == MatrixN<2, 5>{});
+    }
+
+    // Matrix multiplication and transpose
+    {
+        constexpr auto Mat1 = MatrixN<2, 3>{.Data = {1.0, 2.0, 3.0,
+                                                     4.0, 5.0, 6.0}};
+
+        constexpr auto Mat2 = Mat1 * Mat1.Transpose();
+        static_assert(Mat2 == MatrixN<2, 2>{.Data = {14.0, 32.0,
+                                                     32.0, 77.0}});
+
+        constexpr auto Vec = VectorN<3>{.Data = {1.0, 0.0, -1.0}};
+        static_assert(Mat1 * Vec == VectorN<2>{.Data = {-2.0, -2.0}});
+        static_assert(Mat1 * MatrixN<3, 3>::IDENTITY() == Mat1);
+    }
+
+    // Matrix addition, subtraction, negation and blocks
+    {
+        constexpr auto Mat1 = MatrixN<3, 3>{.Data = {2.0, 3.0, -4.0,
+                                                     11.0, 8.0, 7.0,
+                                                     2.0, 5.0, 3.0}};
+
+        static_assert(Mat1 + (-Mat1) == MatrixN<3, 3>::ZERO());
+        static_assert(Mat1 - 2.0 * Mat1 == -Mat1);
+        static_assert(Mat1.Symmetric()(0, 1) == 7.0);
+        static_assert(Mat1.Block<2, 2>(1, 1) == MatrixN<2, 2>{.Data = {8.0, 7.0,
+                                                                       5.0, 3.0}});
+    }
+
+    // Cholesky decomposition
+    {
+        constexpr auto Mat1 = MatrixN<3, 3>{.Data = {4.0, 12.0, -16.0,
+                                                     12.0, 37.0, -43.0,
+                                                     -16.0, -43.0, 98.0}};
+
+        MatrixN<3, 3> Lower{};
+        ASSERT_TRUE(Mat1.Cholesky(Lower));
+        ASSERT_EQ(Lower, (MatrixN<3, 3>{.Data = {2.0, 0.0, 0.0,
+                                                 6.0, 1.0, 0.0,
+                                                 -8.0, 5.0, 3.0}}));
+
+        ASSERT_FALSE((-Mat1).Cholesky(Lower));
+
+        // Solution of A x X = B, where X = {1, -1, 2}
+        const auto Vec = VectorN<3>{.Data = {1.0, -1.0, 2.0}};
+        VectorN<3> Solution{};
+        ASSERT_TRUE(Mat1.SolveSymmetric(Mat1 * Vec, Solution));
+
+        for (size_t Index = 0; Index < 3; Index++)
+        {
+            ASSERT_NEAR(Solution[Index], Vec[Index], 1.0E-12);
+        }
+
+        ASSERT_FALSE((-Mat1).SolveSymmetric(Vec, Solution));
+    }
+}
@@ -0,0 +1,257 @@
+#include "meta/snapshot.hpp"
+#include "twobody/orbit.hpp"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /**
+     * Minimal snapshotable object
+     */
+    struct Counter
+    {
+        struct State
+        {
+            double Value = 0.0;
+            int64_t Count = 0;
+        } Data{};
+
+        uint32_t Version = 1;
+
+        SnapshotBlock GetSnapshotBlock(void) noexcept
+        {
+            return SnapshotBlock{.Type = "Counter", .Version = Version, .Data = std::as_writable_bytes(std::span(&Data, 1))};
+        }
+    };
+
+    std::string TemporaryPath(const std::string& Name)
+    {
+        return (std::filesystem::temp_directory_path() / Name).string();
+    }
+
+    TwoBody::Orbit MakeOrbit(double Eccentricity)
+    {
+        return TwoBody::Orbit::FromKeplerianElements(TwoBody::KeplerianElements{
+            .SemiParameter = 7.0E6 * (1.0 - Eccentricity * Eccentricity),
+            .SemiMajorAxis = 7.0E6,
+            .Eccentricity = Eccentricity,
+            .Inclination = 0.9,
+            .Node = 0.3,
+            .ArgumentPerigee = 1.2,
+            .TrueAnomoly = 0.4,
+            .GravitationalParameter = 3.986004418E14});
+    }
+
+    std::vector<std::byte> Copy(SnapshotBlock Block)
+    {
+        return std::vector<std::byte>(Block.Data.begin(), Block.Data.end());
+    }
+}
+
+// Orbits are restored bitwise, and viewed in place without restoring
+TEST(Snapshot, Orbit)
+{
+    const std::string Path = TemporaryPath("snapshot_orbit.snap");
+
+    TwoBody::Orbit Circular = MakeOrbit(0.0);
+    TwoBody::Orbit Elliptical = MakeOrbit(0.2);
+    const std::vector<std::byte> Expected = Copy(Elliptical.GetSnapshotBlock());
+
+    SnapshotSet Checkpoint;
+    Checkpoint.Register("Circular", Circular);
+    Checkpoint.Register("Elliptical", Elliptical);
+    ASSERT_EQ(Checkpoint.Size(), 2u);
+    ASSERT_EQ(Checkpoint.GetId(), 0u);
+
+    const uint64_t Id = Checkpoint.Save(Path);
+    ASSERT_EQ(Checkpoint.GetId(), Id);
+
+    Circular.Update(100.0);
+    Elliptical.Update(100.0);
+    Checkpoint.Restore(Path);
+
+    ASSERT_EQ(Copy(Elliptical.GetSnapshotBlock()), Expected);
+    ASSERT_EQ(Elliptical.GetElements().TrueAnomoly, 0.4);
+    ASSERT_EQ(*Elliptical.GetDynamicIndexMap()->GetPtrDouble("TrueAnomoly"), 0.4);
+    ASSERT_EQ(Circular.GetElements().TrueLongitude, 0.0);
+
+    const SnapshotReader Reader(Path);
+    ASSERT_EQ(Reader.GetId(), Id);
+    ASSERT_FALSE(Reader.IsDelta());
+    ASSERT_EQ(Reader.Size(), 2u);
+    ASSERT_EQ(Reader.GetSchema(1).Type, HString("TwoBody::Orbit"));
+    ASSERT_EQ(Reader.GetSchema(1).Version, TwoBody::Orbit::SNAPSHOT_VERSION);
+
+    const TwoBody::Orbit::State& View = Reader.View<TwoBody::Orbit::State>(Reader.Find("Elliptical"));
+    ASSERT_EQ(View.Elements.Eccentricity, 0.2);
+    ASSERT_EQ(View.Period, Elliptical.GetPeriod());
+    ASSERT_THROW(Reader.View<Counter::State>(0), Error::GenericException);
+    ASSERT_THROW(Reader.Find("Missing"), Error::GenericException);
+}
+
+// Deltas hold only the changed objects and are restored on top of their chain
+TEST(Snapshot, Delta)
+{
+    const std::string Full = TemporaryPath("snapshot_full.snap");
+    const std::string First = TemporaryPath("snapshot_first.snap");
+    const std::string Second = TemporaryPath("snapshot_second.snap");
+
+    std::vector<Counter> Counters(100);
+    SnapshotSet Checkpoint;
+
+    for (size_t Index = 0; Index < Counters.size(); Index++)
+    {
+        Checkpoint.Register(HString(std::to_string(Index)), Counters[Index]);
+    }
+
+    ASSERT_THROW(Checkpoint.SaveDelta(First), Error::GenericException);
+    const uint64_t FullId = Checkpoint.Save(Full);
+
+    Counters[3].Data.Count = 3;
+    Counters[50].Data.Value = 0.5;
+    const uint64_t FirstId = Checkpoint.SaveDelta(First);
+
+    Counters[50].Data.Value = 1.5;
+    Checkpoint.SaveDelta(Second);
+
+    const SnapshotReader Reader(First);
+    ASSERT_TRUE(Reader.IsDelta());
+    ASSERT_EQ(Reader.GetBase(), FullId);
+    ASSERT_EQ(Reader.Size(), 2u);
+    ASSERT_EQ(Reader.GetKey(0), HString("3"));
+    ASSERT_EQ(Reader.GetKey(1), HString("50"));
+    ASSERT_EQ(SnapshotReader(Second).GetBase(), FirstId);
+
+    for (Counter& Entry : Counters)
+    {
+        Entry.Data = Counter::State{.Value = -1.0, .Count = -1};
+    }
+
+    Checkpoint.Restore(Full, {First, Second});
+    ASSERT_EQ(Counters[3].Data.Count, 3);
+    ASSERT_EQ(Counters[50].Data.Value, 1.5);
+    ASSERT_EQ(Counters[99].Data.Value, 0.0);
+
+    Checkpoint.Restore(Full, {First});
+    ASSERT_EQ(Counters[50].Data.Value, 0.5);
+    ASSERT_EQ(Checkpoint.GetId(), FirstId);
+
+    // Deltas must follow in sequence
+    ASSERT_THROW(Checkpoint.Restore(Full, {Second}), Error::GenericException);
+    ASSERT_THROW(Checkpoint.Restore(Full, {Second, First}), Error::GenericException);
+    ASSERT_THROW(Checkpoint.Restore(First), Error::GenericException);
+
+    // A restored state forks a new chain
+    Checkpoint.Restore(Full);
+    Counters[7].Data.Count = 7;
+    const std::string Fork = TemporaryPath("snapshot_fork.snap");
+    Checkpoint.SaveDelta(Fork);
+    ASSERT_EQ(SnapshotReader(Fork).GetBase(), FullId);
+    ASSERT_EQ(SnapshotReader(Fork).Size(), 1u);
+
+    // A corrupt delta, or a snapshot holding an object twice, anywhere in the chain leaves every
+    // object unchanged
+    const std::string Corrupt = TemporaryPath("snapshot_corrupt.snap");
+    std::filesystem::copy_file(Second, Corrupt, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::resize_file(Corrupt, std::filesystem::file_size(Corrupt) - 1);
+
+    std::ifstream FullFile(Full, std::ios::binary);
+    std::string Duplicated((std::istreambuf_iterator<char>(FullFile)), std::istreambuf_iterator<char>());
+    const std::string KeyOne("\x00\x00\x00\x00\x01\x00" "1", 7);
+    ASSERT_NE(Duplicated.find(KeyOne), std::string::npos);
+    Duplicated[Duplicated.find(KeyOne) + 6] = '0';
+    const std::string Twice = TemporaryPath("snapshot_twice.snap");
+    std::ofstream(Twice, std::ios::binary) << Duplicated;
+
+    for (Counter& Entry : Counters)
+    {
+        Entry.Data = Counter::State{.Value = -1.0, .Count = -1};
+    }
+
+    const uint64_t Id = Checkpoint.GetId();
+    ASSERT_THROW(Checkpoint.Restore(Full, {First, Corrupt}), Error::GenericException);
+    ASSERT_THROW(Checkpoint.Restore(Twice), Error::GenericException);
+
+    for (const Counter& Entry : Counters)
+    {
+        ASSERT_EQ(Entry.Data.Value, -1.0);
+        ASSERT_EQ(Entry.Data.Count, -1);
+    }
+
+    ASSERT_EQ(Checkpoint.GetId(), Id);
+}
+
+// Keys and layouts are validated on registration and restore
+TEST(Snapshot, Schema)
+{
+    const std::string Path = TemporaryPath("snapshot_schema.snap");
+
+    Counter A;
+    Counter B;
+    Counter C;
+    Counter D;
+    C.Version = 2;
+    D.Version = 2;
+
+    SnapshotSet Checkpoint;
+    Checkpoint.Register("A", A);
+    ASSERT_THROW(Checkpoint.Register("A", B), Error::GenericException);
+    ASSERT_THROW(Checkpoint.Register("C", C), Error::GenericException);
+    Checkpoint.Register("B", B);
+    Checkpoint.Save(Path);
+
+    // Changed version of a type
+    SnapshotSet Changed;
+    Changed.Register("A", C);
+    Changed.Register("B", D);
+    ASSERT_THROW(Changed.Restore(Path), Error::GenericException);
+
+    // Objects matched by key, regardless of order
+    A.Data.Count = 1;
+    B.Data.Count = 2;
+    Checkpoint.Save(Path);
+
+    D.Version = 1;
+    Counter E;
+    SnapshotSet Reordered;
+    Reordered.Register("B", D);
+    Reordered.Register("A", E);
+    Reordered.Restore(Path);
+    ASSERT_EQ(D.Data.Count, 2);
+    ASSERT_EQ(E.Data.Count, 1);
+
+    // Every registered object must be held, and every held object registered
+    SnapshotSet Missing;
+    Missing.Register("A", D);
+    ASSERT_THROW(Missing.Restore(Path), Error::GenericException);
+
+    SnapshotSet Unknown;
+    Unknown.Register("A", D);
+    Unknown.Register("X", E);
+    ASSERT_THROW(Unknown.Restore(Path), Error::GenericException);
+}
+
+// Missing, foreign and truncated files are rejected
+TEST(Snapshot, InvalidFile)
+{
+    ASSERT_THROW(SnapshotReader(TemporaryPath("snapshot_missing.snap")), Error::GenericException);
+
+    const std::string Foreign = TemporaryPath("snapshot_foreign.snap");
+    std::ofstream(Foreign) << "Not a snapshot";
+    ASSERT_THROW(SnapshotReader{Foreign}, Error::GenericException);
+
+    const std::string Path = TemporaryPath("snapshot_truncated.snap");
+    Counter A;
+    SnapshotSet Checkpoint;
+    Checkpoint.Register("A", A);
+    Checkpoint.Save(Path);
+
+    std::filesystem::resize_file(Path, std::filesystem::file_size(Path) - 1);
+    ASSERT_THROW(SnapshotReader{Path}, Error::GenericException);
+}
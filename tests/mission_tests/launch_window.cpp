@@ -0,0 +1,241 @@
+#include "mission/launch_window.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "coordinates/earth.hpp"
+#include "twobody/mean_elements.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace
+{
+    const Mission::LaunchSite CAPE_CANAVERAL{.Latitude = D2R(28.5), .Longitude = D2R(-80.6)};
+    const Mission::LaunchSite BAIKONUR{.Latitude = D2R(45.9), .Longitude = D2R(63.3)};
+    const Mission::LaunchSite KOUROU{.Latitude = D2R(5.2), .Longitude = D2R(-52.8), .Altitude = 20.0};
+
+    const Mission::TargetOrbit ISS{.Inclination = D2R(51.6), .Node = 1.0, .Altitude = 400.0E3};
+
+    /**
+     * @return Rate of the node of a circular target by J2 (rad/s)
+     */
+    double NodeRate(const Mission::TargetOrbit& Target)
+    {
+        const double SemiMajorAxis = Earth::WGS84::SEMI_MAJOR_AXIS + Target.Altitude;
+
+        return TwoBody::J2SecularRates(TwoBody::KeplerianElements{.SemiParameter = SemiMajorAxis, .SemiMajorAxis = SemiMajorAxis,
+            .Inclination = Target.Inclination, .GravitationalParameter = Earth::GRAVITATIONAL_CONSTANT}).Node;
+    }
+
+    /**
+     * @return Angle of the site from the plane of the target, and its argument of latitude in the plane (rad)
+     */
+    std::array<double, 2> PlaneGeometry(const Mission::LaunchSite& Site, const Mission::TargetOrbit& Target, double Time)
+    {
+        const LLA Geodetic{.Lat = R2D(Site.Latitude), .Lgt = R2D(Site.Longitude), .Alt = Site.Altitude};
+        const Vector3 Inertial = Earth::ECI2ECEF(Time).RotateInv(Earth::LLA2ECEF(Geodetic, Earth::WGS84RadiiComponents(Site.Latitude)));
+        const Vector3 Position = Inertial.Unit();
+        const double Node = Target.Node + NodeRate(Target) * Time;
+
+        const Vector3 Normal({Sin(Node) * Sin(Target.Inclination), -Cos(Node) * Sin(Target.Inclination), Cos(Target.Inclination)});
+        const Vector3 Ascending({Cos(Node), Sin(Node), 0.0});
+        const Vector3 Apex = Normal.Cross(Ascending);
+
+        return {Asin(Position.Dot(Normal)), Atan2(Position.Dot(Apex), Position.Dot(Ascending))};
+    }
+}
+
+// The site lies in the target plane at each opportunity, on the ascending then descending half of
+// the orbit, and at the plane tolerance at the opening and closing of each window
+TEST(LaunchWindow, Opportunities)
+{
+    const Mission::LaunchWindowSettings Settings{.Start = 1000.0, .Duration = 3.0 * 86400.0, .PlaneTolerance = D2R(0.5)};
+    std::vector<Mission::LaunchOpportunity> Opportunities(16);
+
+    const Mission::LaunchWindowResult Result = Mission::FindLaunchOpportunities(CAPE_CANAVERAL, ISS, Settings, Opportunities);
+    ASSERT_EQ(Result.Status, LaunchStatus::SUCCESS);
+
+    // The node regresses, so the site returns to the plane slightly sooner than once a sidereal day
+    const double Period = 2.0 * PI / (Earth::ROTATIONAL_RATE - NodeRate(ISS));
+    ASSERT_GE(Result.Count, 6u);
+    ASSERT_LE(Result.Count, 7u);
+
+    for (size_t Index = 0; Index < Result.Count; Index++)
+    {
+        const Mission::LaunchOpportunity& Opportunity = Opportunities[Index];
+        const std::array<double, 2> Geometry = PlaneGeometry(CAPE_CANAVERAL, ISS, Opportunity.Time);
+
+        EXPECT_GE(Opportunity.Time, Settings.Start);
+        EXPECT_LE(Opportunity.Time, Settings.Start + Settings.Duration);
+        EXPECT_NEAR(Geometry[0], 0.0, 1.0E-12) << Index;
+        EXPECT_GT(Geometry[1], 0.0);
+        EXPECT_EQ(Abs(Geometry[1]) < 0.5 * PI, Opportunity.Pass == LaunchPass::ASCENDING) << Index;
+        EXPECT_NEAR(Abs(PlaneGeometry(CAPE_CANAVERAL, ISS, Opportunity.Open)[0]), Settings.PlaneTolerance, 0.01 * Settings.PlaneTolerance);
+        EXPECT_NEAR(Abs(PlaneGeometry(CAPE_CANAVERAL, ISS, Opportunity.Close)[0]), Settings.PlaneTolerance, 0.01 * Settings.PlaneTolerance);
+
+        if (Index > 0)
+        {
+            EXPECT_GT(Opportunity.Time, Opportunities[Index - 1].Time);
+            EXPECT_NE(Opportunity.Pass, Opportunities[Index - 1].Pass);
+        }
+
+        if (Index > 1)
+        {
+            EXPECT_NEAR(Opportunity.Time - Opportunities[Index - 2].Time, Period, 1.0E-6);
+        }
+    }
+
+    // Launching northeast on the ascending pass, southeast on the descending
+    const Mission::LaunchOpportunity& First = (Opportunities[0].Pass == LaunchPass::ASCENDING) ? Opportunities[0] : Opportunities[1];
+    const Mission::LaunchOpportunity& Second = (Opportunities[0].Pass == LaunchPass::ASCENDING) ? Opportunities[1] : Opportunities[0];
+    EXPECT_NEAR(R2D(First.Azimuth), 42.5, 1.0);
+    EXPECT_NEAR(First.Azimuth, PI - Second.Azimuth, 1.0E-12);
+    EXPECT_NEAR(First.DeltaV, Second.DeltaV, 1.0E-9);
+
+    // Restricting the passes halves the opportunities, and the count does not depend on the storage
+    const Mission::LaunchWindowSettings Descending{.Start = Settings.Start, .Duration = Settings.Duration, .Ascending = false};
+    const Mission::LaunchWindowResult Counted = Mission::FindLaunchOpportunities(CAPE_CANAVERAL, ISS, Descending, {});
+    EXPECT_EQ(Counted.Count, static_cast<size_t>(std::count_if(Opportunities.begin(), Opportunities.begin() + static_cast<std::ptrdiff_t>(Result.Count),
+        [](const Mission::LaunchOpportunity& Opportunity) {return Opportunity.Pass == LaunchPass::DESCENDING;})));
+}
+
+// Sites further from the equator than the inclination of the target are unreachable
+TEST(LaunchWindow, Unreachable)
+{
+    const Mission::TargetOrbit Low{.Inclination = D2R(28.5), .Altitude = 400.0E3};
+    const Mission::TargetOrbit Retrograde{.Inclination = D2R(180.0 - 40.0), .Altitude = 400.0E3};
+    std::vector<Mission::LaunchOpportunity> Opportunities(4);
+
+    EXPECT_EQ(Mission::FindLaunchOpportunities(BAIKONUR, Low, {}, Opportunities).Status, LaunchStatus::INCLINATION_UNREACHABLE);
+    EXPECT_EQ(Mission::FindLaunchOpportunities(BAIKONUR, Retrograde, {}, Opportunities).Status, LaunchStatus::INCLINATION_UNREACHABLE);
+    EXPECT_EQ(Mission::FindLaunchOpportunities(BAIKONUR, Retrograde, {}, Opportunities).Count, 0u);
+    EXPECT_EQ(Mission::FindLaunchOpportunities(KOUROU, Retrograde, {}, Opportunities).Status, LaunchStatus::SUCCESS);
+}
+
+// A target inclined at the declination of the site is reached once per revolution, at the apex of
+// the orbit, the passes merged into a single window bounded by the plane tolerance
+TEST(LaunchWindow, Tangent)
+{
+    const LLA Geodetic{.Lat = R2D(CAPE_CANAVERAL.Latitude), .Lgt = R2D(CAPE_CANAVERAL.Longitude), .Alt = CAPE_CANAVERAL.Altitude};
+    const Vector3 Fixed = Earth::LLA2ECEF(Geodetic, Earth::WGS84RadiiComponents(CAPE_CANAVERAL.Latitude));
+    const Mission::TargetOrbit Target{.Inclination = Atan2(Fixed.Z, Sqrt(Square(Fixed.X) + Square(Fixed.Y))), .Node = 1.0, .Altitude = 400.0E3};
+    const Mission::LaunchWindowSettings Settings{.Start = 1000.0, .Duration = 3.0 * 86400.0, .PlaneTolerance = D2R(0.5)};
+    std::vector<Mission::LaunchOpportunity> Opportunities(16);
+
+    const Mission::LaunchWindowResult Result = Mission::FindLaunchOpportunities(CAPE_CANAVERAL, Target, Settings, Opportunities);
+    ASSERT_EQ(Result.Status, LaunchStatus::SUCCESS);
+    ASSERT_GE(Result.Count, 3u);
+    ASSERT_LE(Result.Count, 4u);
+
+    const double Period = 2.0 * PI / (Earth::ROTATIONAL_RATE - NodeRate(Target));
+
+    for (size_t Index = 0; Index < Result.Count; Index++)
+    {
+        const Mission::LaunchOpportunity& Opportunity = Opportunities[Index];
+
+        EXPECT_EQ(Opportunity.Pass, LaunchPass::ASCENDING);
+        EXPECT_NEAR(PlaneGeometry(CAPE_CANAVERAL, Target, Opportunity.Time)[0], 0.0, 1.0E-9) << Index;
+        EXPECT_NEAR(PlaneGeometry(CAPE_CANAVERAL, Target, Opportunity.Time)[1], 0.5 * PI, 1.0E-6) << Index;
+        EXPECT_NEAR(R2D(Opportunity.Azimuth), 90.0, 1.0);
+        EXPECT_NEAR(Abs(PlaneGeometry(CAPE_CANAVERAL, Target, Opportunity.Open)[0]), Settings.PlaneTolerance, 0.01 * Settings.PlaneTolerance);
+        EXPECT_NEAR(Abs(PlaneGeometry(CAPE_CANAVERAL, Target, Opportunity.Close)[0]), Settings.PlaneTolerance, 0.01 * Settings.PlaneTolerance);
+
+        if (Index > 0)
+        {
+            EXPECT_NEAR(Opportunity.Time - Opportunities[Index - 1].Time, Period, 1.0E-6);
+        }
+    }
+
+    // Without a tolerance the merged window closes to the crossing
+    const Mission::LaunchWindowSettings Exact{.Start = Settings.Start, .Duration = Settings.Duration};
+    EXPECT_EQ(Mission::FindLaunchOpportunities(CAPE_CANAVERAL, Target, Exact, Opportunities).Count, Result.Count);
+    EXPECT_EQ(Opportunities[0].Open, Opportunities[0].Time);
+}
+
+// An equatorial site lies in the plane of an equatorial target throughout, a single window spanning the search
+TEST(LaunchWindow, Equatorial)
+{
+    const Mission::LaunchSite Site{.Longitude = D2R(-50.0)};
+    const Mission::TargetOrbit Target{.Node = 1.0, .Altitude = 400.0E3};
+    const Mission::LaunchWindowSettings Settings{.Start = 1000.0, .Duration = 86400.0};
+    std::vector<Mission::LaunchOpportunity> Opportunities(4);
+
+    const Mission::LaunchWindowResult Result = Mission::FindLaunchOpportunities(Site, Target, Settings, Opportunities);
+    ASSERT_EQ(Result.Status, LaunchStatus::SUCCESS);
+    ASSERT_EQ(Result.Count, 1u);
+    EXPECT_EQ(Opportunities[0].Open, Settings.Start);
+    EXPECT_EQ(Opportunities[0].Close, Settings.Start + Settings.Duration);
+    EXPECT_NEAR(R2D(Opportunities[0].Azimuth), 90.0, 1.0E-9);
+    EXPECT_GT(Opportunities[0].DeltaV, 0.0);
+
+    ThreadPool Pool(0);
+    const std::vector<double> Inclinations = {0.0};
+    const std::vector<double> Nodes = {0.0, 1.0};
+    std::vector<Mission::LaunchCell> Cells(2);
+    Mission::EvaluateLaunchGrid(Pool, Mission::LaunchGrid{.Sites = {&Site, 1}, .Inclinations = Inclinations, .Nodes = Nodes, .Altitude = 400.0E3},
+        Settings, Cells);
+
+    for (const Mission::LaunchCell& Cell : Cells)
+    {
+        EXPECT_EQ(Cell.Status, LaunchStatus::SUCCESS);
+        EXPECT_EQ(Cell.Count, 1u);
+        EXPECT_EQ(Cell.First.Close, Opportunities[0].Close);
+    }
+}
+
+// Every cell of the grid holds the first opportunity and count of the search of its site and
+// target, identically for any number of threads
+TEST(LaunchWindow, Grid)
+{
+    const std::vector<Mission::LaunchSite> Sites = {CAPE_CANAVERAL, BAIKONUR, KOUROU};
+    const std::vector<double> Inclinations = {D2R(28.5), D2R(51.6), D2R(98.0)};
+    std::vector<double> Nodes(24);
+
+    for (size_t Index = 0; Index < Nodes.size(); Index++)
+    {
+        Nodes[Index] = 2.0 * PI * static_cast<double>(Index) / static_cast<double>(Nodes.size());
+    }
+
+    const Mission::LaunchGrid Grid{.Sites = Sites, .Inclinations = Inclinations, .Nodes = Nodes, .Altitude = 500.0E3};
+    const Mission::LaunchWindowSettings Settings{.Start = 3600.0, .Duration = 2.0 * 86400.0, .PlaneTolerance = D2R(0.2)};
+
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+    std::vector<Mission::LaunchCell> Serial(Grid.Size()), Parallel(Grid.Size());
+    Mission::EvaluateLaunchGrid(None, Grid, Settings, Serial);
+    Mission::EvaluateLaunchGrid(Pool, Grid, Settings, Parallel);
+
+    for (size_t Site = 0; Site < Sites.size(); Site++)
+    {
+        for (size_t Inclination = 0; Inclination < Inclinations.size(); Inclination++)
+        {
+            for (size_t Node = 0; Node < Nodes.size(); Node++)
+            {
+                const Mission::LaunchCell& Cell = Serial[Grid.Index(Site, Inclination, Node)];
+                const Mission::LaunchCell& Other = Parallel[Grid.Index(Site, Inclination, Node)];
+                const Mission::TargetOrbit Target{.Inclination = Inclinations[Inclination], .Node = Nodes[Node], .Altitude = Grid.Altitude};
+
+                std::array<Mission::LaunchOpportunity, 1> First{};
+                const Mission::LaunchWindowResult Result = Mission::FindLaunchOpportunities(Sites[Site], Target, Settings, First);
+
+                ASSERT_EQ(Cell.Status, Result.Status);
+                ASSERT_EQ(Cell.Count, Result.Count);
+                EXPECT_EQ(Cell.First.Time, First[0].Time);
+                EXPECT_EQ(Cell.First.Open, First[0].Open);
+                EXPECT_EQ(Cell.First.Azimuth, First[0].Azimuth);
+                EXPECT_EQ(Cell.First.Pass, First[0].Pass);
+
+                EXPECT_EQ(Other.Status, Cell.Status);
+                EXPECT_EQ(Other.Count, Cell.Count);
+                EXPECT_EQ(Other.First.Time, Cell.First.Time);
+                EXPECT_EQ(Other.First.DeltaV, Cell.First.DeltaV);
+            }
+        }
+    }
+
+    // Only Baikonur cannot reach the inclination of Cape Canaveral
+    EXPECT_EQ(Serial[Grid.Index(1, 0, 0)].Status, LaunchStatus::INCLINATION_UNREACHABLE);
+    EXPECT_EQ(Serial[Grid.Index(1, 0, 0)].Count, 0u);
+    EXPECT_EQ(Serial[Grid.Index(0, 0, 0)].Status, LaunchStatus::SUCCESS);
+    EXPECT_EQ(Serial[Grid.Index(1, 1, 0)].Status, LaunchStatus::SUCCESS);
+}
@@ -7,50 +7,80 @@
 
 TEST(LaunchManoeuvre, CapeCanaveral)
 {
-    {    
-        auto Latitude = D2R(28.5);
-        auto Inclination = D2R(51.6);      // International Space Station Inclination
-        auto OrbitalVelocity = 7730.0;     // m/s, for a 300 km circular orbit
-        auto LaunchSiteVelocity = 465.101; // m/s
+    auto Latitude = D2R(28.5);
+    auto Inclination = D2R(51.6);                       // International Space Station Inclination
+    auto OrbitalVelocity = 7730.0;                      // m/s, for a 300 km circular orbit
+    auto LaunchSiteVelocity = 465.101 * Cos(Latitude);  // m/s
 
-        auto LaunchComponents = LaunchVelocityComponents({
-            .TargetInclination = Inclination,
-            .SiteLatitude = Latitude,
-            .OrbitalVelocity = OrbitalVelocity,
-            .SiteVelocity = LaunchSiteVelocity});
-
-        printf("AzimuthTrue = %g, AzimuthInertial = %g, V = (%g, %g)\n", 
-            R2D(LaunchComponents.Azimuth), 
-            R2D(LaunchComponents.AzimuthInertial),
-            LaunchComponents.Vx,
-            LaunchComponents.Vy);
-    }
+    auto LaunchComponents = LaunchVelocityComponents({
+        .TargetInclination = Inclination,
+        .SiteLatitude = Latitude,
+        .OrbitalVelocity = OrbitalVelocity,
+        .SiteVelocity = LaunchSiteVelocity});
+
+    ASSERT_EQ(LaunchComponents.Status, LaunchStatus::SUCCESS);
+    EXPECT_NEAR(R2D(LaunchComponents.AzimuthInertial), 44.97, 0.01);
+    EXPECT_NEAR(R2D(LaunchComponents.Azimuth), 42.8, 0.1);
+
+    // The velocity supplied by the vehicle is the orbital velocity less that of the site
+    EXPECT_NEAR(LaunchComponents.Vx, OrbitalVelocity * Sin(LaunchComponents.AzimuthInertial) - LaunchSiteVelocity, 1.0E-9);
+    EXPECT_NEAR(LaunchComponents.Vy, OrbitalVelocity * Cos(LaunchComponents.AzimuthInertial), 1.0E-9);
+
+    // The descending pass launches southwards, mirrored about east
+    auto Descending = LaunchVelocityComponents({
+        .TargetInclination = Inclination,
+        .SiteLatitude = Latitude,
+        .OrbitalVelocity = OrbitalVelocity,
+        .SiteVelocity = LaunchSiteVelocity,
+        .Pass = LaunchPass::DESCENDING});
+
+    ASSERT_EQ(Descending.Status, LaunchStatus::SUCCESS);
+    EXPECT_NEAR(Descending.AzimuthInertial, PI - LaunchComponents.AzimuthInertial, 1.0E-12);
+    EXPECT_NEAR(Descending.Azimuth, PI - LaunchComponents.Azimuth, 1.0E-12);
+    EXPECT_NEAR(Descending.Vy, -LaunchComponents.Vy, 1.0E-9);
 }
 
 TEST(LaunchManoeuvre, AbbottsPoint)
 {
-    {
-        auto Latitude = D2R(-19.0);
-        auto Inclination = D2R(98.0);
-        auto OrbitalVelocity = Sqrt(Earth::GRAVITATIONAL_CONSTANT / (Earth::WGS84::SEMI_MAJOR_AXIS + 500.0E3)); // m/s
-        
-        auto LaunchSiteVelocity = Earth::ROTATIONAL_RATE * Earth::WGS84Radius(D2R(-19.0)) * Cos(Latitude); // m/s
+    auto Latitude = D2R(-19.0);
+    auto Inclination = D2R(98.0);
+    auto OrbitalVelocity = Sqrt(Earth::GRAVITATIONAL_CONSTANT / (Earth::WGS84::SEMI_MAJOR_AXIS + 500.0E3)); // m/s
+    auto LaunchSiteVelocity = Earth::ROTATIONAL_RATE * Earth::WGS84Radius(Latitude) * Cos(Latitude);       // m/s
+
+    auto LaunchComponents = LaunchVelocityComponents({
+        .TargetInclination = Inclination,
+        .SiteLatitude = Latitude,
+        .OrbitalVelocity = OrbitalVelocity,
+        .SiteVelocity = LaunchSiteVelocity});
 
+    // A retrograde orbit is launched west of north, against the rotation of the site
+    ASSERT_EQ(LaunchComponents.Status, LaunchStatus::SUCCESS);
+    EXPECT_LT(LaunchComponents.AzimuthInertial, 0.0);
+    EXPECT_LT(LaunchComponents.Azimuth, LaunchComponents.AzimuthInertial);
+    EXPECT_GT(Sqrt(Square(LaunchComponents.Vx) + Square(LaunchComponents.Vy)), OrbitalVelocity);
+}
+
+TEST(LaunchManoeuvre, Unreachable)
+{
+    // The plane of an orbit inclined less than the site latitude (or its supplement) never passes overhead
+    for (const double Inclination : {D2R(28.4), D2R(151.6), D2R(0.0), D2R(180.0)})
+    {
         auto LaunchComponents = LaunchVelocityComponents({
             .TargetInclination = Inclination,
-            .SiteLatitude = Latitude,
-            .OrbitalVelocity = OrbitalVelocity,
-            .SiteVelocity = LaunchSiteVelocity});
-
-        printf("Orbital Velocity = %g, AzimuthTrue = %g, Azimuth Inertial = %g, V = (%g, %g)\n",
-            OrbitalVelocity, 
-            R2D(LaunchComponents.Azimuth), 
-            R2D(LaunchComponents.AzimuthInertial),
-            LaunchComponents.Vx,
-            LaunchComponents.Vy);
-
-        printf("Launch Site Velocity = %g m/s\n", LaunchSiteVelocity);
-        printf("Latitude Delta V Penalty = %g m/s\n", 
-            Sqrt(LaunchComponents.Vx * LaunchComponents.Vx + LaunchComponents.Vy * LaunchComponents.Vy) - OrbitalVelocity);
-    }    
+            .SiteLatitude = D2R(28.5),
+            .OrbitalVelocity = 7730.0,
+            .SiteVelocity = 400.0});
+
+        EXPECT_EQ(LaunchComponents.Status, LaunchStatus::INCLINATION_UNREACHABLE);
+    }
+
+    // Launching due east reaches an inclination equal to the latitude
+    auto East = LaunchVelocityComponents({
+        .TargetInclination = D2R(28.5),
+        .SiteLatitude = D2R(28.5),
+        .OrbitalVelocity = 7730.0,
+        .SiteVelocity = 400.0});
+
+    ASSERT_EQ(East.Status, LaunchStatus::SUCCESS);
+    EXPECT_NEAR(East.AzimuthInertial, 0.5 * PI, 1.0E-6);
 }
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include "mission/transfer.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "coordinates/earth.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = Earth::GRAVITATIONAL_CONSTANT;
+    constexpr double RADIUS = Earth::WGS84::SEMI_MAJOR_AXIS;
+
+    /**
+     * @return Circular state of a radius, inclination, node and argument of latitude
+     */
+    EphemerisState Circular(double Radius, double Inclination, double Node, double Latitude)
+    {
+        const double Speed = Sqrt(MU / Radius);
+
+        return EphemerisState{
+            .Pos = Vector3({Cos(Node) * Cos(Latitude) - Sin(Node) * Sin(Latitude) * Cos(Inclination),
+                Sin(Node) * Cos(Latitude) + Cos(Node) * Sin(Latitude) * Cos(Inclination), Sin(Latitude) * Sin(Inclination)}) * Radius,
+            .Vel = Vector3({-Cos(Node) * Sin(Latitude) - Sin(Node) * Cos(Latitude) * Cos(Inclination),
+                -Sin(Node) * Sin(Latitude) + Cos(Node) * Cos(Latitude) * Cos(Inclination), Cos(Latitude) * Sin(Inclination)}) * Speed};
+    }
+
+    /**
+     * Flies the impulses of a plan from a state, each in the local frame before the impulse
+     * @return State at the end of the plan
+     */
+    EphemerisState Fly(EphemerisState State, const Mission::TransferPlan& Plan)
+    {
+        double Time = 0.0;
+
+        for (size_t Index = 0; Index < Plan.Count; Index++)
+        {
+            const Mission::Impulse& Burn = Plan.Impulses[Index];
+            State = TwoBody::PropagateUniversal(State.Pos, State.Vel, MU, Burn.Time - Time);
+            Time = Burn.Time;
+
+            const Vector3 Radial = State.Pos.Unit();
+            const Vector3 Normal = State.Pos.Cross(State.Vel).Unit();
+            State.Vel = State.Vel + Radial * Burn.DeltaV.X + Normal.Cross(Radial) * Burn.DeltaV.Y + Normal * Burn.DeltaV.Z;
+        }
+
+        return State;
+    }
+}
+
+// Example taken from fundamentals of astrodynamics and applications, 4th Edition
+// David A. Vallado
+// Example 6-1
+TEST(Transfer, HohmannBiElliptic)
+{
+    const Mission::TransferPlan Geostationary = Mission::Hohmann(RADIUS + 191.34411E3, RADIUS + 35781.34857E3, MU);
+    ASSERT_EQ(Geostationary.Count, 2u);
+    EXPECT_NEAR(Geostationary.Impulses[0].DeltaV.Y, 2457.0, 1.0);
+    EXPECT_NEAR(Geostationary.Impulses[1].DeltaV.Y, 1478.2, 1.0);
+    EXPECT_NEAR(Geostationary.DeltaV, 3935.2, 1.0);
+    EXPECT_NEAR(Geostationary.Duration / 3600.0, 5.2567, 1.0E-3);
+
+    // Beyond a radius ratio of 15.58 a bi-elliptic transfer through a high enough apoapsis is cheaper,
+    // taking the time of two half ellipses
+    const Mission::TransferPlan Direct = Mission::Hohmann(RADIUS + 191.34411E3, 376310.0E3, MU);
+    const Mission::TransferPlan Indirect = Mission::BiElliptic(RADIUS + 191.34411E3, 376310.0E3, 503873.0E3, MU);
+    ASSERT_EQ(Indirect.Count, 3u);
+    EXPECT_LT(Indirect.DeltaV, Direct.DeltaV - 50.0);
+    EXPECT_NEAR(Indirect.Duration, PI * (Sqrt(Cube(0.5 * (RADIUS + 191.34411E3 + 503873.0E3)) / MU) + Sqrt(Cube(0.5 * (376310.0E3 + 503873.0E3)) / MU)),
+        1.0E-6);
+
+    // Below a radius ratio of 11.94 the Hohmann transfer is the cheaper for any intermediate radius
+    for (const double Intermediate : {15.0, 50.0, 500.0})
+    {
+        EXPECT_LT(Mission::Hohmann(RADIUS, 11.0 * RADIUS, MU).DeltaV, Mission::BiElliptic(RADIUS, 11.0 * RADIUS, Intermediate * RADIUS, MU).DeltaV);
+    }
+
+    // Each transfer flown from its initial orbit arrives circular at its final radius
+    for (const auto& [Plan, Radius] : {std::pair{Geostationary, RADIUS + 35781.34857E3}, std::pair{Indirect, 376310.0E3}})
+    {
+        const EphemerisState Final = Fly(Circular(RADIUS + 191.34411E3, 0.0, 0.0, 0.0), Plan);
+
+        EXPECT_NEAR(Final.Pos.Norm() / Radius, 1.0, 1.0E-9);
+        EXPECT_NEAR(Final.Vel.Norm(), Sqrt(MU / Radius), 1.0E-6);
+        EXPECT_NEAR(Final.Pos.Dot(Final.Vel), 0.0, 1.0E-3 * Radius);
+    }
+}
+
+// The plane change from a low orbit at the latitude of Cape Canaveral to the geostationary orbit
+// is split to minimise the delta v, most at the apoapsis of the transfer
+TEST(Transfer, CombinedPlaneChange)
+{
+    const double Initial = RADIUS + 191.34411E3, Final = RADIUS + 35781.34857E3, PlaneChange = D2R(28.5);
+    const Mission::TransferPlan Plan = Mission::Hohmann(Initial, Final, MU, PlaneChange);
+    ASSERT_EQ(Plan.Count, 2u);
+    EXPECT_NEAR(Plan.Impulses[0].PlaneChange + Plan.Impulses[1].PlaneChange, PlaneChange, 1.0E-12);
+    EXPECT_GT(R2D(Plan.Impulses[0].PlaneChange), 1.0);
+    EXPECT_LT(R2D(Plan.Impulses[0].PlaneChange), 4.0);
+
+    // No split by a scan of the first plane change improves upon it
+    const auto Cost = [&](double Angle)
+    {
+        const double Transfer = 0.5 * (Initial + Final);
+        const double Perigee = Sqrt(MU * (2.0 / Initial - 1.0 / Transfer)), Apogee = Sqrt(MU * (2.0 / Final - 1.0 / Transfer));
+        return Sqrt(MU / Initial + Square(Perigee) - 2.0 * Sqrt(MU / Initial) * Perigee * Cos(Angle)) +
+            Sqrt(MU / Final + Square(Apogee) - 2.0 * Sqrt(MU / Final) * Apogee * Cos(PlaneChange - Angle));
+    };
+
+    for (size_t Index = 0; Index <= 1000; Index++)
+    {
+        EXPECT_GE(Cost(PlaneChange * static_cast<double>(Index) / 1000.0), Plan.DeltaV - 1.0E-6);
+    }
+
+    EXPECT_LT(Plan.DeltaV, Cost(0.0) - 20.0);
+    EXPECT_LT(Plan.DeltaV, Cost(PlaneChange));
+
+    // Flown from the descending node of the inclined orbit, the transfer arrives in the equatorial plane
+    const EphemerisState Arrival = Fly(Circular(Initial, PlaneChange, 0.0, PI), Plan);
+    const Vector3 Normal = Arrival.Pos.Cross(Arrival.Vel).Unit();
+
+    EXPECT_NEAR(Normal.Z, 1.0, 1.0E-12);
+
+    // Between orbits of different nodes, the plane change is the angle between the planes
+    const TwoBody::KeplerianElements Low{.SemiMajorAxis = Initial, .Inclination = D2R(51.6), .Node = 0.2, .GravitationalParameter = MU};
+    const TwoBody::KeplerianElements High{.SemiMajorAxis = Final, .Inclination = D2R(51.6), .Node = 0.5, .GravitationalParameter = MU};
+    EXPECT_NEAR(Mission::PlaneAngle(Low, High), Acos(Square(Cos(D2R(51.6))) + Square(Sin(D2R(51.6))) * Cos(0.3)), 1.0E-12);
+    EXPECT_NEAR(Mission::Hohmann(Low, High).DeltaV, Mission::Hohmann(Initial, Final, MU, Mission::PlaneAngle(Low, High)).DeltaV, 1.0E-9);
+}
+
+// A chaser phasing for a target ahead or behind meets it after the phasing revolutions
+TEST(Transfer, Phasing)
+{
+    const double Radius = RADIUS + 400.0E3;
+
+    for (const double Phase : {0.3, -0.3, 1.5})
+    {
+        for (const uint32_t Revolutions : {1u, 3u})
+        {
+            const Mission::TransferPlan Plan = Mission::Phasing(Radius, Phase, Revolutions, MU);
+            ASSERT_EQ(Plan.Count, 2u);
+            EXPECT_NEAR(Plan.Impulses[0].DeltaV.Y, -Plan.Impulses[1].DeltaV.Y, 1.0E-12);
+            EXPECT_EQ(Plan.Impulses[0].DeltaV.Y < 0.0, Phase > 0.0);
+
+            const EphemerisState Chaser = Fly(Circular(Radius, 0.9, 0.1, 0.0), Plan);
+            const EphemerisState Target = TwoBody::PropagateUniversal(Circular(Radius, 0.9, 0.1, Phase).Pos, Circular(Radius, 0.9, 0.1, Phase).Vel, MU,
+                Plan.Duration);
+
+            EXPECT_LT((Chaser.Pos - Target.Pos).Norm(), 1.0E-3);
+            EXPECT_LT((Chaser.Vel - Target.Vel).Norm(), 1.0E-6);
+        }
+    }
+
+    // More revolutions phase more gently
+    EXPECT_LT(Mission::Phasing(Radius, 0.3, 4, MU).DeltaV, Mission::Phasing(Radius, 0.3, 1, MU).DeltaV);
+    EXPECT_EQ(Mission::Phasing(Radius, 0.3, 0, MU).Count, 0u);
+
+    // A single revolution cannot phase by most of an orbit, the phasing orbit being too short
+    for (const double Phase : {4.5, 5.5, 6.2})
+    {
+        const Mission::TransferPlan Plan = Mission::Phasing(Radius, Phase, 1, MU);
+        EXPECT_EQ(Plan.Count, 0u);
+        EXPECT_EQ(Plan.DeltaV, 0.0);
+    }
+
+    EXPECT_EQ(Mission::Phasing(Radius, 4.5, 3, MU).Count, 2u);
+}
+
+// The planned rendezvous, flown from the chaser, meets the target in position and velocity
+TEST(Transfer, Rendezvous)
+{
+    const EphemerisState Chaser = Circular(RADIUS + 400.0E3, D2R(51.6), 0.0, 0.0);
+    const EphemerisState Target = Circular(RADIUS + 550.0E3, D2R(53.0), 0.3, 2.0);
+    const Mission::RendezvousSettings Settings{.MaxDuration = 2.0 * 86400.0};
+
+    const Mission::RendezvousPlan Plan = Mission::PlanRendezvous(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU), Settings);
+
+    ASSERT_EQ(Plan.Status, Mission::RendezvousStatus::SUCCESS);
+    EXPECT_EQ(Plan.Kind, Mission::TransferKind::HOHMANN);
+    EXPECT_GT(Plan.Revolutions, 0u);
+    EXPECT_LE(Plan.Transfer.Duration, Settings.MaxDuration);
+    EXPECT_EQ(Plan.Transfer.Impulses[0].Time, Plan.Wait);
+
+    const EphemerisState Final = Fly(Chaser, Plan.Transfer);
+    const EphemerisState Met = TwoBody::PropagateUniversal(Target.Pos, Target.Vel, MU, Plan.Transfer.Duration);
+    EXPECT_LT((Final.Pos - Met.Pos).Norm(), 1.0);
+    EXPECT_LT((Final.Vel - Met.Vel).Norm(), 1.0E-3);
+
+    // The delta v is close to that of the plane change and Hohmann transfer alone, and falls as more
+    // phasing revolutions are allowed
+    const Mission::TransferPlan Transfer = Mission::Hohmann(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU).GetElements(),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU).GetElements());
+    EXPECT_GE(Plan.Transfer.DeltaV, Transfer.DeltaV - 1.0E-6);
+    EXPECT_LT(Plan.Transfer.DeltaV, Transfer.DeltaV + 40.0);
+
+    const Mission::RendezvousPlan Patient = Mission::PlanRendezvous(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU), Mission::RendezvousSettings{.MaxDuration = Settings.MaxDuration, .Revolutions = 28});
+    EXPECT_LE(Patient.Transfer.DeltaV, Plan.Transfer.DeltaV);
+
+    // No rendezvous fits within a few minutes
+    const Mission::RendezvousPlan Hurried = Mission::PlanRendezvous(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU), Mission::RendezvousSettings{.MaxDuration = 600.0});
+    EXPECT_EQ(Hurried.Status, Mission::RendezvousStatus::INFEASIBLE);
+
+    // The plane change is split against the impulse entering the phasing orbit, so moving it between
+    // the impulses does not lower their sum
+    const double Radius = RADIUS + 400.0E3;
+    const double Outer = RADIUS + 550.0E3;
+    const double SemiMajorAxis = 0.5 * (Radius + Outer);
+    const Mission::Impulse& Entry = Plan.Transfer.Impulses[1];
+    const double Arriving = Sqrt(MU * (2.0 / Outer - 1.0 / SemiMajorAxis));
+    const double Phasing = Sqrt(Square(Entry.DeltaV.Y + Arriving) + Square(Entry.DeltaV.Z));
+    const double PlaneChange = Plan.Transfer.Impulses[0].PlaneChange + Entry.PlaneChange;
+
+    const auto Sum = [&](double Angle)
+    {
+        const double Departing = Sqrt(MU * (2.0 / Radius - 1.0 / SemiMajorAxis));
+        const double Circular = Sqrt(MU / Radius);
+
+        return Sqrt(Square(Circular) + Square(Departing) - 2.0 * Circular * Departing * Cos(Angle)) +
+            Sqrt(Square(Arriving) + Square(Phasing) - 2.0 * Arriving * Phasing * Cos(PlaneChange - Angle));
+    };
+
+    ASSERT_EQ(Plan.Transfer.Count, 3u);
+    EXPECT_NEAR(Sum(Plan.Transfer.Impulses[0].PlaneChange), Plan.Transfer.Impulses[0].DeltaV.Norm() + Entry.DeltaV.Norm(), 1.0E-6);
+    EXPECT_GE(Sum(Plan.Transfer.Impulses[0].PlaneChange + 1.0E-3), Sum(Plan.Transfer.Impulses[0].PlaneChange));
+    EXPECT_GE(Sum(Plan.Transfer.Impulses[0].PlaneChange - 1.0E-3), Sum(Plan.Transfer.Impulses[0].PlaneChange));
+
+    // The transfer itself must lie within the radius constraints
+    const Mission::RendezvousPlan Low = Mission::PlanRendezvous(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU), Mission::RendezvousSettings{.MaxDuration = Settings.MaxDuration, .MaxRadius = Outer - 1.0E3});
+    const Mission::RendezvousPlan High = Mission::PlanRendezvous(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU), Mission::RendezvousSettings{.MaxDuration = Settings.MaxDuration, .MinRadius = Radius + 1.0E3});
+    EXPECT_EQ(Low.Status, Mission::RendezvousStatus::INFEASIBLE);
+    EXPECT_EQ(High.Status, Mission::RendezvousStatus::INFEASIBLE);
+}
+
+// To a distant orbit the multistart search finds a bi-elliptic transfer cheaper than the Hohmann
+TEST(Transfer, RendezvousBiElliptic)
+{
+    const EphemerisState Chaser = Circular(RADIUS + 500.0E3, D2R(30.0), 0.0, 0.5);
+    const EphemerisState Target = Circular(20.0 * (RADIUS + 500.0E3), D2R(10.0), 1.0, 1.0);
+    const Mission::RendezvousSettings Settings{.MaxDuration = 120.0 * 86400.0, .MaxRadius = 1.0E9, .Starts = 6};
+
+    const Mission::RendezvousPlan Plan = Mission::PlanRendezvous(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU), Settings);
+
+    ASSERT_EQ(Plan.Status, Mission::RendezvousStatus::SUCCESS);
+    EXPECT_EQ(Plan.Kind, Mission::TransferKind::BI_ELLIPTIC);
+    EXPECT_LE(Plan.IntermediateRadius, Settings.MaxRadius);
+
+    const EphemerisState Final = Fly(Chaser, Plan.Transfer);
+    const EphemerisState Met = TwoBody::PropagateUniversal(Target.Pos, Target.Vel, MU, Plan.Transfer.Duration);
+    EXPECT_LT((Final.Pos - Met.Pos).Norm(), 10.0);
+    EXPECT_LT((Final.Vel - Met.Vel).Norm(), 1.0E-3);
+
+    const Mission::RendezvousPlan Hohmann = Mission::PlanRendezvous(TwoBody::Orbit::FromNewtonian(Chaser.Pos, Chaser.Vel, MU),
+        TwoBody::Orbit::FromNewtonian(Target.Pos, Target.Vel, MU), Mission::RendezvousSettings{.MaxDuration = Settings.MaxDuration,
+        .MaxRadius = Settings.MaxRadius, .Starts = 0});
+    ASSERT_EQ(Hohmann.Status, Mission::RendezvousStatus::SUCCESS);
+    EXPECT_LT(Plan.Transfer.DeltaV, Hohmann.Transfer.DeltaV);
+}
+
+// Planning many targets in parallel matches planning each alone
+TEST(Transfer, RendezvousBatch)
+{
+    const TwoBody::Orbit Chaser = TwoBody::Orbit::FromNewtonian(Circular(RADIUS + 300.0E3, D2R(52.0), 0.0, 0.0).Pos,
+        Circular(RADIUS + 300.0E3, D2R(52.0), 0.0, 0.0).Vel, MU);
+    std::vector<TwoBody::Orbit> Targets{};
+
+    for (size_t Index = 0; Index < 12; Index++)
+    {
+        const EphemerisState Slot = Circular(RADIUS + 550.0E3, D2R(53.0), 0.05 * static_cast<double>(Index % 3), 0.5 * static_cast<double>(Index));
+        Targets.push_back(TwoBody::Orbit::FromNewtonian(Slot.Pos, Slot.Vel, MU));
+    }
+
+    const Mission::RendezvousSettings Settings{.MaxDuration = 3.0 * 86400.0, .Starts = 2, .Iterations = 16};
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+    std::vector<Mission::RendezvousPlan> Serial(Targets.size()), Parallel(Targets.size());
+    Mission::PlanRendezvous(None, Chaser, Targets, Settings, Serial);
+    Mission::PlanRendezvous(Pool, Chaser, Targets, Settings, Parallel);
+
+    for (size_t Index = 0; Index < Targets.size(); Index++)
+    {
+        const Mission::RendezvousPlan Single = Mission::PlanRendezvous(Chaser, Targets[Index], Settings);
+        ASSERT_EQ(Serial[Index].Status, Mission::RendezvousStatus::SUCCESS);
+        EXPECT_EQ(Serial[Index].Transfer.DeltaV, Single.Transfer.DeltaV);
+        EXPECT_EQ(Serial[Index].Transfer.Duration, Single.Transfer.Duration);
+        EXPECT_EQ(Parallel[Index].Transfer.DeltaV, Single.Transfer.DeltaV);
+        EXPECT_EQ(Parallel[Index].Revolutions, Single.Revolutions);
+        EXPECT_EQ(Parallel[Index].Kind, Single.Kind);
+    }
+
+    std::vector<Mission::RendezvousPlan> Short(Targets.size() - 1);
+    EXPECT_THROW(Mission::PlanRendezvous(Pool, Chaser, Targets, Settings, Short), Error::HArraySizeMismatch);
+}
@@ -0,0 +1,89 @@
+#include "navigation/attitude_filter.hpp"
+#include "numerics/random.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr double STEP = 0.1;
+    constexpr double SENSOR_NOISE = 1.0E-3;
+
+    const Navigation::GyroNoise NOISE{.AngleRandomWalk = 1.0E-4, .RateRandomWalk = 1.0E-6};
+
+    const Vector3 SUN = Vector3({1.0, 0.0, 0.0});
+    const Vector3 FIELD = Vector3({0.0, 0.6, 0.8});
+
+    // Angle (rad) between two attitudes
+    double AngleBetween(const Quaternion& A, const Quaternion& B)
+    {
+        const Quaternion Difference = A.Inverse() * B;
+        return 2.0 * Atan2(Sqrt(Square(Difference.X) + Square(Difference.Y) + Square(Difference.Z)), Abs(Difference.S));
+    }
+
+    Navigation::AttitudeFilter::ErrorCovariance InitialCovariance(double AttitudeSigma, double BiasSigma)
+    {
+        Navigation::AttitudeFilter::ErrorCovariance Covariance{};
+
+        for (size_t Axis = 0; Axis < 3; Axis++)
+        {
+            Covariance(Axis, Axis) = Square(AttitudeSigma);
+            Covariance(Axis + 3, Axis + 3) = Square(BiasSigma);
+        }
+
+        return Covariance;
+    }
+}
+
+// Attitude and gyro bias converge from a poor initial estimate of a tumbling body
+TEST(AttitudeFilter, Convergence)
+{
+    const Vector3 Rate = Vector3({0.02, -0.01, 0.03});
+    const Vector3 Bias = Vector3({2.0E-4, -1.0E-4, 3.0E-4});
+
+    Quaternion Truth = Quaternion::FromVectorAngle(Vector3({1.0, 1.0, 0.0}).Unit(), 0.5);
+    const Quaternion Initial = (Truth * Quaternion::FromVectorAngle(Vector3({0.0, 0.0, 1.0}), 0.1)).Unit();
+
+    Navigation::AttitudeFilter Filter(Initial, Vector3::ZERO(), InitialCovariance(0.2, 1.0E-3), NOISE);
+    Random::Stream Noise(1, 0);
+
+    const auto Measure = [&](const Vector3& Reference)
+    {
+        return Truth.Rotate(Reference) + Vector3({Noise.Normal(0.0, SENSOR_NOISE), Noise.Normal(0.0, SENSOR_NOISE), Noise.Normal(0.0, SENSOR_NOISE)});
+    };
+
+    for (size_t Index = 0; Index < 3000; Index++)
+    {
+        Truth = (Truth * Quaternion::FromVectorAngle(Rate.Unit(), Rate.Norm() * STEP)).Unit();
+
+        const double Sigma = NOISE.AngleRandomWalk / Sqrt(STEP);
+        const Vector3 Gyro = Rate + Bias + Vector3({Noise.Normal(0.0, Sigma), Noise.Normal(0.0, Sigma), Noise.Normal(0.0, Sigma)});
+        Filter.Predict(Gyro, STEP);
+
+        EXPECT_EQ(Filter.UpdateVector(SUN, Measure(SUN), SENSOR_NOISE), Navigation::UpdateStatus::ACCEPTED);
+        EXPECT_EQ(Filter.UpdateVector(FIELD, Measure(FIELD), SENSOR_NOISE), Navigation::UpdateStatus::ACCEPTED);
+    }
+
+    const Navigation::AttitudeFilter::ErrorCovariance Covariance = Filter.GetCovariance();
+
+    EXPECT_NEAR(Filter.GetAttitude().Norm(), 1.0, 1.0E-12);
+    EXPECT_LT(AngleBetween(Filter.GetAttitude(), Truth), 3.0 * Sqrt(Covariance(0, 0) + Covariance(1, 1) + Covariance(2, 2)));
+    EXPECT_LT(AngleBetween(Filter.GetAttitude(), Truth), 1.0E-3);
+    EXPECT_LT((Filter.GetBias() - Bias).Norm(), 3.0E-5);
+}
+
+// A precise attitude measurement corrects the attitude, and an inconsistent direction is rejected
+TEST(AttitudeFilter, Measurements)
+{
+    const Quaternion Truth = Quaternion::FromVectorAngle(Vector3({0.0, 1.0, 0.0}), 1.0);
+    const Quaternion Initial = (Truth * Quaternion::FromVectorAngle(Vector3({1.0, 0.0, 0.0}), 0.05)).Unit();
+
+    Navigation::AttitudeFilter Filter(Initial, Vector3::ZERO(), InitialCovariance(0.1, 1.0E-4), NOISE);
+
+    EXPECT_EQ(Filter.UpdateAttitude(Truth, 1.0E-5), Navigation::UpdateStatus::ACCEPTED);
+    EXPECT_LT(AngleBetween(Filter.GetAttitude(), Truth), 1.0E-3);
+    EXPECT_LT(Filter.GetCovariance()(0, 0), 1.0E-9);
+
+    // Reversed direction against a tightly known attitude
+    const Quaternion Attitude = Filter.GetAttitude();
+    EXPECT_EQ(Filter.UpdateVector(SUN, -Truth.Rotate(SUN), SENSOR_NOISE, 16.0), Navigation::UpdateStatus::GATED);
+    EXPECT_EQ(Filter.GetAttitude(), Attitude);
+}
@@ -0,0 +1,163 @@
+#include "navigation/kalman.hpp"
+#include "numerics/random.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr double STEP = 0.5;
+    constexpr double ACCELERATION_NOISE = 0.01;
+    constexpr double POSITION_NOISE = 2.0;
+    constexpr size_t STEPS = 50;
+
+    // Constant velocity motion of a position and velocity, with white acceleration noise
+    const MatrixN<2, 2> TRANSITION{.Data = {1.0, STEP, 0.0, 1.0}};
+
+    const MatrixN<2, 2> PROCESS_NOISE = Square(ACCELERATION_NOISE) * MatrixN<2, 2>{.Data = {
+        Cube(STEP) / 3.0, Square(STEP) / 2.0,
+        Square(STEP) / 2.0, STEP}};
+
+    const MatrixN<1, 1> MEASUREMENT_NOISE{.Data = {Square(POSITION_NOISE)}};
+
+    const VectorN<2> INITIAL_STATE{.Data = {10.0, -1.0}};
+    const MatrixN<2, 2> INITIAL_COVARIANCE{.Data = {100.0, 5.0, 5.0, 4.0}};
+
+    auto Process = [](const VectorN<2>& X, MatrixN<2, 2>& Jacobian)
+    {
+        Jacobian = TRANSITION;
+        return TRANSITION * X;
+    };
+
+    auto Position = [](const VectorN<2>& X, MatrixN<1, 2>& Jacobian)
+    {
+        Jacobian = MatrixN<1, 2>{.Data = {1.0, 0.0}};
+        return VectorN<1>{.Data = {X[0]}};
+    };
+
+    template <typename FilterType>
+    void ExpectNear(const FilterType& Filter, const VectorN<2>& State, const MatrixN<2, 2>& Covariance)
+    {
+        const MatrixN<2, 2> Estimated = Filter.GetCovariance();
+
+        for (size_t Row = 0; Row < 2; Row++)
+        {
+            EXPECT_NEAR(Filter.GetState()[Row], State[Row], 1.0E-9 * (1.0 + Abs(State[Row])));
+
+            for (size_t Col = 0; Col < 2; Col++)
+            {
+                EXPECT_NEAR(Estimated(Row, Col), Covariance(Row, Col), 1.0E-9 * Sqrt(Covariance(Row, Row) * Covariance(Col, Col)));
+            }
+        }
+    }
+}
+
+// Every form of the filter is exact for a linear system, matching the textbook Kalman filter
+TEST(Kalman, Linear)
+{
+    Navigation::ExtendedKalmanFilter<2> Joseph(INITIAL_STATE, INITIAL_COVARIANCE);
+    Navigation::ExtendedKalmanFilter<2, Navigation::CovarianceForm::SQUARE_ROOT> SquareRoot(INITIAL_STATE, INITIAL_COVARIANCE);
+    Navigation::UnscentedKalmanFilter<2> Unscented(INITIAL_STATE, INITIAL_COVARIANCE);
+
+    VectorN<2> State = INITIAL_STATE;
+    MatrixN<2, 2> Covariance = INITIAL_COVARIANCE;
+    Random::Stream Noise(42, 0);
+
+    for (size_t Index = 0; Index < STEPS; Index++)
+    {
+        State = TRANSITION * State;
+        Covariance = TRANSITION * Covariance * TRANSITION.Transpose() + PROCESS_NOISE;
+
+        Joseph.Predict(Process, PROCESS_NOISE);
+        SquareRoot.Predict(Process, PROCESS_NOISE);
+        ASSERT_TRUE(Unscented.Predict([](const VectorN<2>& X) {return TRANSITION * X;}, PROCESS_NOISE));
+
+        const double Truth = 10.0 - 0.8 * STEP * static_cast<double>(Index + 1);
+        const VectorN<1> Measurement{.Data = {Truth + Noise.Normal(0.0, POSITION_NOISE)}};
+
+        // Reference update, K = P H^T / (H P H^T + R)
+        const double Innovation = Covariance(0, 0) + MEASUREMENT_NOISE[0];
+        const VectorN<2> Gain{.Data = {Covariance(0, 0) / Innovation, Covariance(1, 0) / Innovation}};
+        State = State + Gain * (Measurement[0] - State[0]);
+        Covariance = Covariance - Gain * MatrixN<1, 2>{.Data = {Covariance(0, 0), Covariance(0, 1)}};
+
+        EXPECT_EQ(Joseph.Update(Measurement, MEASUREMENT_NOISE, Position), Navigation::UpdateStatus::ACCEPTED);
+        EXPECT_EQ(SquareRoot.Update(Measurement, MEASUREMENT_NOISE, Position), Navigation::UpdateStatus::ACCEPTED);
+        EXPECT_EQ(Unscented.Update(Measurement, MEASUREMENT_NOISE, [](const VectorN<2>& X) {return VectorN<1>{.Data = {X[0]}};}),
+            Navigation::UpdateStatus::ACCEPTED);
+    }
+
+    ExpectNear(Joseph, State, Covariance);
+    ExpectNear(SquareRoot, State, Covariance);
+    ExpectNear(Unscented, State, Covariance);
+}
+
+// Measurements beyond the gate or of a singular innovation covariance are rejected without effect
+TEST(Kalman, Rejection)
+{
+    Navigation::ExtendedKalmanFilter<2> Filter(INITIAL_STATE, INITIAL_COVARIANCE);
+    const MatrixN<2, 2> Covariance = Filter.GetCovariance();
+
+    // 9 sigma outlier against a 3 sigma gate
+    const double Sigma = Sqrt(INITIAL_COVARIANCE(0, 0) + MEASUREMENT_NOISE[0]);
+    const VectorN<1> Outlier{.Data = {INITIAL_STATE[0] + 9.0 * Sigma}};
+
+    EXPECT_EQ(Filter.Update(Outlier, MEASUREMENT_NOISE, Position, 9.0), Navigation::UpdateStatus::GATED);
+    EXPECT_EQ(Filter.GetState(), INITIAL_STATE);
+    EXPECT_EQ(Filter.GetCovariance(), Covariance);
+
+    // A measurement independent of the state, without noise
+    const auto Unobservable = [](const VectorN<2>&, MatrixN<1, 2>& Jacobian)
+    {
+        Jacobian = MatrixN<1, 2>{};
+        return VectorN<1>{};
+    };
+
+    EXPECT_EQ(Filter.Update(VectorN<1>{}, MatrixN<1, 1>{}, Unobservable), Navigation::UpdateStatus::ILL_CONDITIONED);
+    EXPECT_EQ(Filter.GetState(), INITIAL_STATE);
+
+    Navigation::UnscentedKalmanFilter<2> Unscented(INITIAL_STATE, INITIAL_COVARIANCE);
+    EXPECT_EQ(Unscented.Update(Outlier, MEASUREMENT_NOISE, [](const VectorN<2>& X) {return VectorN<1>{.Data = {X[0]}};}, 9.0),
+        Navigation::UpdateStatus::GATED);
+    EXPECT_EQ(Unscented.GetState(), INITIAL_STATE);
+
+    const MatrixN<2, 2> Singular{.Data = {1.0, 1.0, 1.0, 1.0}};
+    EXPECT_THROW(Navigation::ExtendedKalmanFilter<2>(INITIAL_STATE, Singular), Error::GenericException);
+    EXPECT_THROW(Navigation::UnscentedKalmanFilter<2>(INITIAL_STATE, Singular), Error::GenericException);
+}
+
+// Nonlinear range measurements of a planar position converge on the truth in either filter
+TEST(Kalman, Nonlinear)
+{
+    const VectorN<2> Truth{.Data = {300.0, 400.0}};
+    const VectorN<2> Initial{.Data = {250.0, 450.0}};
+    const MatrixN<2, 2> Covariance{.Data = {2500.0, 0.0, 0.0, 2500.0}};
+    const MatrixN<1, 1> Noise{.Data = {1.0}};
+    const VectorN<2> Stations[] = {{.Data = {0.0, 0.0}}, {.Data = {1000.0, 0.0}}, {.Data = {0.0, 1000.0}}};
+
+    Navigation::ExtendedKalmanFilter<2> Extended(Initial, Covariance);
+    Navigation::UnscentedKalmanFilter<2> Unscented(Initial, Covariance);
+    Random::Stream Stream(7, 0);
+
+    for (size_t Index = 0; Index < 30; Index++)
+    {
+        const VectorN<2>& Station = Stations[Index % 3];
+        const auto Range = [&Station](const VectorN<2>& X) {return Sqrt(Square(X[0] - Station[0]) + Square(X[1] - Station[1]));};
+        const VectorN<1> Measurement{.Data = {Range(Truth) + Stream.Normal()}};
+
+        Extended.Update(Measurement, Noise, [&](const VectorN<2>& X, MatrixN<1, 2>& Jacobian)
+        {
+            const double R = Range(X);
+            Jacobian = MatrixN<1, 2>{.Data = {(X[0] - Station[0]) / R, (X[1] - Station[1]) / R}};
+            return VectorN<1>{.Data = {R}};
+        });
+
+        Unscented.Update(Measurement, Noise, [&](const VectorN<2>& X) {return VectorN<1>{.Data = {Range(X)}};});
+    }
+
+    for (size_t Row = 0; Row < 2; Row++)
+    {
+        EXPECT_NEAR(Extended.GetState()[Row], Truth[Row], 3.0 * Sqrt(Extended.GetCovariance()(Row, Row)));
+        EXPECT_NEAR(Unscented.GetState()[Row], Truth[Row], 3.0 * Sqrt(Unscented.GetCovariance()(Row, Row)));
+        EXPECT_LT(Extended.GetCovariance()(Row, Row), 1.0);
+    }
+}
@@ -0,0 +1,231 @@
+#include "navigation/observation_generator.hpp"
+#include "twobody/orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double MIN_ELEVATION = 0.17;
+
+    const TwoBody::StateVector TRUTH = TwoBody::MakeStateVector(
+        Vector3({6.9E6, 1.0E5, -2.0E5}),
+        Vector3({-100.0, 5800.0, 4800.0}));
+
+    const TwoBody::Orbit ORBIT = TwoBody::Orbit::FromNewtonian(Vector3({6.9E6, 1.0E5, -2.0E5}), Vector3({-100.0, 5800.0, 4800.0}), MU);
+    const TwoBody::Orbit SECOND_ORBIT = TwoBody::Orbit::FromNewtonian(Vector3({-7.2E6, 5.0E5, 1.0E5}), Vector3({300.0, -4000.0, 5900.0}), MU);
+
+    const LLA STATIONS[] = {
+        {.Lat = 34.4, .Lgt = 11.5, .Alt = 100.0},
+        {.Lat = -28.6, .Lgt = 120.3, .Alt = 500.0},
+        {.Lat = 5.7, .Lgt = -86.0, .Alt = 0.0}};
+
+    std::string TemporaryPath(const std::string& Name)
+    {
+        return (std::filesystem::temp_directory_path() / Name).string();
+    }
+
+    std::vector<Navigation::ObservationRecord> ReadAll(const std::string& Path)
+    {
+        Navigation::ObservationReader Reader(Path);
+        std::vector<Navigation::ObservationRecord> Records{};
+        std::vector<Navigation::ObservationRecord> Buffer(100);
+
+        for (size_t Count = Reader.Read(Buffer); Count > 0; Count = Reader.Read(Buffer))
+        {
+            Records.insert(Records.end(), Buffer.begin(), Buffer.begin() + static_cast<std::ptrdiff_t>(Count));
+        }
+
+        return Records;
+    }
+
+    void AddStations(Navigation::ObservationGenerator& Generator, double Scale)
+    {
+        for (const LLA& Location : STATIONS)
+        {
+            Navigation::GroundStation Station{.Location = Location, .MinElevation = MIN_ELEVATION};
+
+            for (double& Sigma : Station.Sigmas)
+            {
+                Sigma *= Scale;
+            }
+
+            Generator.AddStation(Station);
+        }
+    }
+
+    /**
+     * Orbit which cannot be evaluated from a given time
+     */
+    class TruncatedEphemeris : public Ephemeris
+    {
+    public:
+        TruncatedEphemeris(const TwoBody::Orbit& Orbit, double End) : mOrbit(Orbit), mEnd{End} { }
+
+        EphemerisState GetState(double EpochTime) const noexcept override
+        {
+            return (EpochTime < mEnd) ? mOrbit.GetState(EpochTime) : EphemerisState{};
+        }
+
+        bool GetStates(std::span<const double> Epochs, std::span<EphemerisState> Out) const override
+        {
+            Ephemeris::GetStates(Epochs, Out);
+            return std::all_of(Epochs.begin(), Epochs.end(), [&](double Epoch) {return Epoch < mEnd;});
+        }
+
+    private:
+        TwoBody::OrbitEphemeris mOrbit;
+        double mEnd = 0.0;
+    };
+}
+
+// Noise free observations match the orbit determination measurement model, and only visible passes are observed
+TEST(ObservationGenerator, Observables)
+{
+    const TwoBody::OrbitEphemeris Target(ORBIT);
+    const std::string Path = TemporaryPath("generator_observables.hobs");
+
+    Navigation::ObservationGenerator Generator(Navigation::GeneratorSettings{.End = 21600.0, .Interval = 30.0, .BatchEpochs = 50,
+        .Types = {Navigation::ObservationType::RANGE, Navigation::ObservationType::RANGE_RATE, Navigation::ObservationType::AZIMUTH,
+                  Navigation::ObservationType::ELEVATION, Navigation::ObservationType::DOPPLER}});
+    AddStations(Generator, 0.0);
+    Generator.AddTarget(Target);
+
+    ThreadPool Pool(3);
+    Navigation::ObservationWriter Writer(Path);
+    const uint64_t Generated = Generator.Generate(Pool, Writer);
+    Writer.Close();
+
+    const std::vector<Navigation::ObservationRecord> Records = ReadAll(Path);
+    ASSERT_EQ(Records.size(), Generated);
+    ASSERT_GT(Records.size(), 100);
+
+    // Fewer than every station observes at every time
+    EXPECT_LT(Records.size(), 721 * 3 * Navigation::OBSERVATION_TYPES);
+
+    MatrixN<1, 6> Partials{};
+
+    for (size_t Index = 0; Index < Records.size(); Index++)
+    {
+        const Navigation::ObservationRecord& Record = Records[Index];
+        const Navigation::Observation Measurement = Generator.MakeObservation(Record);
+        const double Expected = Navigation::OrbitDetermination::Evaluate(Measurement, TwoBody::Propagate(TRUTH, MU, Record.Time), Partials);
+
+        EXPECT_NEAR(Record.Value, Expected, 1.0E-6 * Abs(Expected) + 1.0E-12);
+        EXPECT_EQ(Record.Type, static_cast<Navigation::ObservationType>(Index % Navigation::OBSERVATION_TYPES));
+
+        if (Record.Type == Navigation::ObservationType::ELEVATION)
+        {
+            EXPECT_GE(Record.Value, MIN_ELEVATION);
+        }
+
+        if (Index > 0)
+        {
+            EXPECT_GE(Record.Time, Records[Index - 1].Time);
+        }
+    }
+}
+
+// The stream is identical for any number of threads and batch size
+TEST(ObservationGenerator, Reproducible)
+{
+    const TwoBody::OrbitEphemeris First(ORBIT);
+    const TwoBody::OrbitEphemeris Second(SECOND_ORBIT);
+    std::vector<Navigation::ObservationRecord> Streams[2];
+
+    for (size_t Run = 0; Run < 2; Run++)
+    {
+        const std::string Path = TemporaryPath("generator_reproducible.hobs");
+
+        Navigation::ObservationGenerator Generator(Navigation::GeneratorSettings{.End = 43200.0, .Interval = 20.0, .BatchEpochs = (Run == 0) ? size_t(500) : size_t(7), .Seed = 11});
+        AddStations(Generator, 1.0);
+        Generator.AddTarget(First);
+        Generator.AddTarget(Second);
+
+        ThreadPool Pool((Run == 0) ? size_t(0) : size_t(3));
+        Navigation::ObservationWriter Writer(Path);
+        Generator.Generate(Pool, Writer);
+        Writer.Close();
+
+        Streams[Run] = ReadAll(Path);
+    }
+
+    ASSERT_GT(Streams[0].size(), 100);
+    ASSERT_EQ(Streams[0].size(), Streams[1].size());
+    EXPECT_EQ(std::memcmp(Streams[0].data(), Streams[1].data(), Streams[0].size() * sizeof(Navigation::ObservationRecord)), 0);
+}
+
+// Generated observations of a day are fitted by batch least squares to within their noise
+TEST(ObservationGenerator, OrbitDetermination)
+{
+    const TwoBody::OrbitEphemeris Target(ORBIT);
+    const std::string Path = TemporaryPath("generator_fit.hobs");
+
+    Navigation::ObservationGenerator Generator(Navigation::GeneratorSettings{.Interval = 60.0, .Seed = 5});
+    AddStations(Generator, 1.0);
+    Generator.AddTarget(Target);
+
+    ThreadPool Pool(3);
+    Navigation::ObservationWriter Writer(Path);
+    Generator.Generate(Pool, Writer);
+    Writer.Close();
+
+    Navigation::OrbitDetermination Fit(MU);
+
+    for (const Navigation::ObservationRecord& Record : ReadAll(Path))
+    {
+        Fit.Add(Generator.MakeObservation(Record));
+    }
+
+    const Navigation::FitResult Result = Fit.Solve(Pool, TRUTH + TwoBody::StateVector{.Data = {2000.0, -1500.0, 1000.0, 1.0, -2.0, 1.5}});
+
+    EXPECT_EQ(Result.Status, Navigation::FitStatus::CONVERGED);
+    EXPECT_NEAR(Result.WeightedRMS, 1.0, 0.2);
+
+    for (size_t Index = 0; Index < 6; Index++)
+    {
+        EXPECT_NEAR(Result.State[Index], TRUTH[Index], 4.0 * Sqrt(Result.Covariance(Index, Index)));
+    }
+}
+
+// Times at which a target could not be evaluated are skipped rather than observed from a zero state
+TEST(ObservationGenerator, Unevaluated)
+{
+    const TwoBody::OrbitEphemeris Complete(ORBIT);
+    const TruncatedEphemeris Truncated(ORBIT, 10000.0);
+    std::vector<Navigation::ObservationRecord> Streams[2];
+    uint64_t Skipped[2] = {};
+
+    for (size_t Run = 0; Run < 2; Run++)
+    {
+        const std::string Path = TemporaryPath("generator_unevaluated.hobs");
+
+        Navigation::ObservationGenerator Generator(Navigation::GeneratorSettings{.End = 21600.0, .Interval = 30.0, .BatchEpochs = 64, .Seed = 3});
+        AddStations(Generator, 1.0);
+        Generator.AddTarget((Run == 0) ? static_cast<const Ephemeris&>(Complete) : static_cast<const Ephemeris&>(Truncated));
+
+        ThreadPool Pool(3);
+        Navigation::ObservationWriter Writer(Path);
+        Generator.Generate(Pool, Writer);
+        Writer.Close();
+
+        Streams[Run] = ReadAll(Path);
+        Skipped[Run] = Generator.GetSkipped();
+    }
+
+    EXPECT_EQ(Skipped[0], 0u);
+    EXPECT_EQ(Skipped[1], 721u - 334u);
+
+    // Observations before the end of the trajectory are unchanged, and none follow it
+    const auto End = std::find_if(Streams[0].begin(), Streams[0].end(), [](const Navigation::ObservationRecord& Record) {return Record.Time >= 10000.0;});
+    ASSERT_NE(End, Streams[0].end());
+    ASSERT_GT(End - Streams[0].begin(), 0);
+    ASSERT_EQ(Streams[1].size(), static_cast<size_t>(End - Streams[0].begin()));
+    EXPECT_EQ(std::memcmp(Streams[0].data(), Streams[1].data(), Streams[1].size() * sizeof(Navigation::ObservationRecord)), 0);
+}
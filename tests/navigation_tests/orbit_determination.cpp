@@ -0,0 +1,233 @@
+#include "navigation/orbit_determination.hpp"
+#include "coordinates/general.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/random.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double EARTH_RADIUS = 6.378137E6;
+    constexpr double EARTH_RATE = 7.2921159E-5;
+    constexpr double MIN_ELEVATION = 0.17;
+
+    const double SIGMAS[] = {5.0, 0.01, 1.0E-4, 1.0E-4};
+
+    // Low Earth orbit at the epoch
+    const TwoBody::StateVector TRUTH = TwoBody::MakeStateVector(
+        Vector3({6.9E6, 1.0E5, -2.0E5}),
+        Vector3({-100.0, 5800.0, 4800.0}));
+
+    const LLARad STATIONS[] = {
+        {.LatRad = 0.6, .LgtRad = 0.2, .Alt = 100.0},
+        {.LatRad = -0.5, .LgtRad = 2.1, .Alt = 500.0},
+        {.LatRad = 0.1, .LgtRad = -1.5, .Alt = 0.0}};
+
+    /**
+     * Observation geometry of a station on a spherical, rotating Earth
+     */
+    Navigation::Observation MakeGeometry(const LLARad& Site, double Time)
+    {
+        const Quaternion InertialToFixed = Quaternion::FromVectorAngle(Vector3::UNIT_Z(), EARTH_RATE * Time);
+        const double Radius = EARTH_RADIUS + Site.Alt;
+        const Vector3 Fixed = Vector3({Radius * Cos(Site.LatRad) * Cos(Site.LgtRad), Radius * Cos(Site.LatRad) * Sin(Site.LgtRad), Radius * Sin(Site.LatRad)});
+        const Vector3 Position = InertialToFixed.RotateInv(Fixed);
+
+        return Navigation::Observation{
+            .Time = Time,
+            .StationPosition = Position,
+            .StationVelocity = Vector3({0.0, 0.0, EARTH_RATE}).Cross(Position),
+            .InertialToENU = InertialToFixed * QuatBCBF2ENU(Site)
+        };
+    }
+
+    /**
+     * Simulates every observation type from every station above the minimum elevation, once a minute for a day
+     */
+    void Simulate(Navigation::OrbitDetermination& Fit, uint64_t Seed)
+    {
+        Random::Stream Noise(Seed, 0);
+        MatrixN<1, 6> Partials{};
+
+        for (double Time = 0.0; Time < 86400.0; Time += 60.0)
+        {
+            const TwoBody::StateVector State = TwoBody::Propagate(TRUTH, MU, Time);
+
+            for (const LLARad& Site : STATIONS)
+            {
+                Navigation::Observation Measurement = MakeGeometry(Site, Time);
+                Measurement.Type = Navigation::ObservationType::ELEVATION;
+
+                if (Navigation::OrbitDetermination::Evaluate(Measurement, State, Partials) < MIN_ELEVATION)
+                {
+                    continue;
+                }
+
+                for (size_t Type = 0; Type < 4; Type++)
+                {
+                    Measurement.Type = static_cast<Navigation::ObservationType>(Type);
+                    Measurement.Sigma = SIGMAS[Type];
+                    Measurement.Value = Navigation::OrbitDetermination::Evaluate(Measurement, State, Partials) + Noise.Normal(0.0, Measurement.Sigma);
+                    Fit.Add(Measurement);
+                }
+            }
+        }
+    }
+
+    TwoBody::StateVector Perturb(const TwoBody::StateVector& State)
+    {
+        return State + TwoBody::StateVector{.Data = {2000.0, -1500.0, 1000.0, 1.0, -2.0, 1.5}};
+    }
+
+    void ExpectConsistent(const Navigation::FitResult& Result)
+    {
+        for (size_t Index = 0; Index < 6; Index++)
+        {
+            EXPECT_NEAR(Result.State[Index], TRUTH[Index], 4.0 * Sqrt(Result.Covariance(Index, Index)));
+        }
+    }
+}
+
+// Analytic partial derivatives of every observation type match central differences
+TEST(OrbitDetermination, Partials)
+{
+    const TwoBody::StateVector State = TwoBody::Propagate(TRUTH, MU, 600.0);
+    Navigation::Observation Measurement = MakeGeometry(STATIONS[0], 600.0);
+
+    for (size_t Type = 0; Type < Navigation::OBSERVATION_TYPES; Type++)
+    {
+        Measurement.Type = static_cast<Navigation::ObservationType>(Type);
+
+        MatrixN<1, 6> Partials{};
+        Navigation::OrbitDetermination::Evaluate(Measurement, State, Partials);
+
+        for (size_t Col = 0; Col < 6; Col++)
+        {
+            const double Step = (Col < 3) ? 1.0 : 1.0E-3;
+            TwoBody::StateVector Upper = State;
+            TwoBody::StateVector Lower = State;
+            Upper[Col] += Step;
+            Lower[Col] -= Step;
+
+            MatrixN<1, 6> Unused{};
+            const double Derivative = (Navigation::OrbitDetermination::Evaluate(Measurement, Upper, Unused) -
+                                       Navigation::OrbitDetermination::Evaluate(Measurement, Lower, Unused)) / (2.0 * Step);
+
+            EXPECT_NEAR(Partials[Col], Derivative, 1.0E-5 * Abs(Derivative) + 1.0E-12);
+        }
+    }
+}
+
+// The fit converges from a poor initial state, consistently with its covariance, identically for any number of threads
+TEST(OrbitDetermination, Convergence)
+{
+    Navigation::OrbitDetermination Fit(MU);
+    Simulate(Fit, 3);
+    ASSERT_GT(Fit.Size(), 100);
+
+    ThreadPool Serial(0);
+    ThreadPool Parallel(3);
+
+    const Navigation::FitResult Result = Fit.Solve(Serial, Perturb(TRUTH));
+    const Navigation::FitResult Repeat = Fit.Solve(Parallel, Perturb(TRUTH));
+
+    EXPECT_EQ(Result.Status, Navigation::FitStatus::CONVERGED);
+    EXPECT_LT(Result.Iterations, 10);
+    EXPECT_NEAR(Result.WeightedRMS, 1.0, 0.2);
+    EXPECT_EQ(Result.Accepted + Result.Edited, Fit.Size());
+    EXPECT_LT(Result.Edited, Fit.Size() / 100);
+    ExpectConsistent(Result);
+
+    EXPECT_EQ(Result.State, Repeat.State);
+    EXPECT_EQ(Result.Covariance, Repeat.Covariance);
+}
+
+// Gross outliers are edited without corrupting the estimate
+TEST(OrbitDetermination, Editing)
+{
+    Navigation::OrbitDetermination Fit(MU);
+    Simulate(Fit, 5);
+
+    Navigation::OrbitDetermination Corrupted(MU);
+    std::vector<size_t> Outliers{};
+
+    for (size_t Index = 0; Index < Fit.Size(); Index++)
+    {
+        Navigation::Observation Measurement = Fit.GetObservation(Index);
+
+        if ((Index % 97 == 0) && (Measurement.Type == Navigation::ObservationType::RANGE))
+        {
+            Measurement.Value += 5000.0;
+            Outliers.push_back(Index);
+        }
+
+        Corrupted.Add(Measurement);
+    }
+
+    ASSERT_FALSE(Outliers.empty());
+
+    ThreadPool Pool(2);
+    const Navigation::FitResult Result = Corrupted.Solve(Pool, Perturb(TRUTH));
+
+    EXPECT_EQ(Result.Status, Navigation::FitStatus::CONVERGED);
+    EXPECT_GE(Result.Edited, Outliers.size());
+    ExpectConsistent(Result);
+
+    for (size_t Index : Outliers)
+    {
+        EXPECT_TRUE(Corrupted.IsEdited(Index));
+        EXPECT_NEAR(Corrupted.GetResidual(Index), 5000.0, 50.0);
+    }
+
+    // Fewer observations than estimated parameters
+    Navigation::OrbitDetermination Sparse(MU);
+
+    for (size_t Index = 0; Index < 3; Index++)
+    {
+        Sparse.Add(Fit.GetObservation(Index));
+    }
+
+    EXPECT_EQ(Sparse.Solve(Pool, TRUTH).Status, Navigation::FitStatus::INSUFFICIENT_OBSERVATIONS);
+}
+
+// Angles of a pass directly overhead carry no information at the zenith, and are edited without
+// corrupting the normal equations
+TEST(OrbitDetermination, Zenith)
+{
+    Navigation::OrbitDetermination Fit(MU);
+    Simulate(Fit, 7);
+
+    // Station directly beneath the object
+    const double Time = 1800.0;
+    const TwoBody::StateVector State = TwoBody::Propagate(TRUTH, MU, Time);
+    const Vector3 Fixed = Quaternion::FromVectorAngle(Vector3::UNIT_Z(), EARTH_RATE * Time).Rotate(Vector3({State[0], State[1], State[2]}));
+    const LLARad Beneath{.LatRad = Asin(Fixed.Z / Fixed.Norm()), .LgtRad = Atan2(Fixed.Y, Fixed.X), .Alt = 0.0};
+
+    Navigation::Observation Measurement = MakeGeometry(Beneath, Time);
+    std::vector<size_t> Overhead{};
+    MatrixN<1, 6> Partials{};
+
+    for (const Navigation::ObservationType Type : {Navigation::ObservationType::AZIMUTH, Navigation::ObservationType::ELEVATION})
+    {
+        Measurement.Type = Type;
+        Measurement.Sigma = 1.0E-4;
+        Measurement.Value = Navigation::OrbitDetermination::Evaluate(Measurement, State, Partials);
+        EXPECT_EQ(Partials, (MatrixN<1, 6>{}));
+        Overhead.push_back(Fit.Add(Measurement));
+    }
+
+    EXPECT_NEAR(Measurement.Value, 0.5 * PI, 1.0E-6);
+
+    ThreadPool Pool(2);
+    const Navigation::FitResult Result = Fit.Solve(Pool, Perturb(TRUTH));
+
+    EXPECT_EQ(Result.Status, Navigation::FitStatus::CONVERGED);
+    ExpectConsistent(Result);
+
+    for (const size_t Index : Overhead)
+    {
+        EXPECT_TRUE(Fit.IsEdited(Index));
+    }
+}
@@ -0,0 +1,53 @@
+#include "gtest/gtest.h"
+#include "numerics/ode.hpp"
+
+namespace
+{
+    // Harmonic oscillator of unit frequency, position and velocity
+    const auto OSCILLATOR = [](double, const VectorN<2>& State) {return VectorN<2>{.Data = {State[1], -State[0]}};};
+    const VectorN<2> INITIAL{.Data = {1.0, 0.0}};
+}
+
+// Fixed steps of the classical Runge-Kutta method converge at fourth order
+TEST(ODE, RungeKutta4)
+{
+    const double Coarse = Abs(ODE::RungeKutta4(OSCILLATOR, 0.0, 10.0, INITIAL, uint64_t(100))[0] - Cos(10.0));
+    const double Fine = Abs(ODE::RungeKutta4(OSCILLATOR, 0.0, 10.0, INITIAL, uint64_t(200))[0] - Cos(10.0));
+
+    EXPECT_LT(Coarse, 1.0E-5);
+    EXPECT_NEAR(Coarse / Fine, 16.0, 2.0);
+
+    // Backward integration returns to the initial state
+    const VectorN<2> Forward = ODE::RungeKutta4(OSCILLATOR, 0.0, 3.0, INITIAL, uint64_t(300));
+    const VectorN<2> Backward = ODE::RungeKutta4(OSCILLATOR, 3.0, 0.0, Forward, uint64_t(300));
+    EXPECT_NEAR(Backward[0], 1.0, 1.0E-9);
+    EXPECT_NEAR(Backward[1], 0.0, 1.0E-9);
+}
+
+// Adaptive Dormand-Prince steps meet the tolerance, in either direction, and report failure
+TEST(ODE, DormandPrince)
+{
+    for (const double End : {25.0, -25.0})
+    {
+        const auto Result = ODE::DormandPrince(OSCILLATOR, 0.0, End, INITIAL, ODE::IntegratorSettings{.RelativeTolerance = 1.0E-12, .AbsoluteTolerance = 1.0E-12});
+
+        ASSERT_EQ(Result.ExitCode, ODE::IntegratorStatus::SUCCESS);
+        EXPECT_EQ(Result.Time, End);
+        EXPECT_NEAR(Result.State[0], Cos(End), 1.0E-9);
+        EXPECT_NEAR(Result.State[1], -Sin(End), 1.0E-9);
+        EXPECT_LT(Result.Steps, 2000u);
+    }
+
+    // Looser tolerances take fewer steps
+    const auto Loose = ODE::DormandPrince(OSCILLATOR, 0.0, 25.0, INITIAL, ODE::IntegratorSettings{.RelativeTolerance = 1.0E-6, .AbsoluteTolerance = 1.0E-6});
+    const auto Tight = ODE::DormandPrince(OSCILLATOR, 0.0, 25.0, INITIAL, ODE::IntegratorSettings{.RelativeTolerance = 1.0E-12, .AbsoluteTolerance = 1.0E-12});
+    EXPECT_LT(Loose.Steps, Tight.Steps);
+    EXPECT_NEAR(Loose.State[0], Cos(25.0), 1.0E-4);
+
+    const auto Limited = ODE::DormandPrince(OSCILLATOR, 0.0, 25.0, INITIAL, ODE::IntegratorSettings{.MaxSteps = 10});
+    EXPECT_EQ(Limited.ExitCode, ODE::IntegratorStatus::MAX_STEPS_EXCEEDED);
+    EXPECT_LT(Limited.Time, 25.0);
+
+    const auto Underflow = ODE::DormandPrince(OSCILLATOR, 0.0, 25.0, INITIAL, ODE::IntegratorSettings{.InitialStep = 1.0E-3, .MinStep = 1.0});
+    EXPECT_EQ(Underflow.ExitCode, ODE::IntegratorStatus::STEP_SIZE_UNDERFLOW);
+}
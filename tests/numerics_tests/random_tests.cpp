@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include "tests/test_utils.hpp"
+#include "numerics/random.hpp"
+#include "numerics/statistics.hpp"
+
+#include <vector>
+
+// Philox4x32-10 known answers of the reference implementation
+TEST(Random, Philox)
+{
+    static_assert(Random::Philox({0, 0, 0, 0}, {0, 0}) == Random::Counter{0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8});
+
+    ASSERT_EQ(Random::Philox({0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF}, {0xFFFFFFFF, 0xFFFFFFFF}),
+              (Random::Counter{0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD}));
+
+    ASSERT_EQ(Random::Philox({0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344}, {0xA4093822, 0x299F31D0}),
+              (Random::Counter{0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1}));
+}
+
+// Streams are reproducible, independent of one another and may be positioned directly
+TEST(Random, Stream)
+{
+    Random::Stream A(42, 7);
+    Random::Stream B(42, 7);
+    Random::Stream Other(42, 8);
+
+    std::vector<double> Sequence;
+
+    for (int Index = 0; Index < 10; Index++)
+    {
+        Sequence.push_back(A.Uniform());
+        ASSERT_EQ(Sequence.back(), B.Uniform());
+        ASSERT_NE(Sequence.back(), Other.Uniform());
+        ASSERT_GE(Sequence.back(), 0.0);
+        ASSERT_LT(Sequence.back(), 1.0);
+    }
+
+    A.Seek(3);
+    ASSERT_EQ(A.Uniform(), Sequence[6]);
+    ASSERT_EQ(A.Uniform(), Sequence[7]);
+}
+
+// Moments of the uniform and normal distributions
+TEST(Random, Distributions)
+{
+    Random::Stream Samples(1, 0);
+    Statistics::Accumulator Uniform;
+    Statistics::Accumulator Normal;
+
+    for (int Index = 0; Index < 100000; Index++)
+    {
+        Uniform.Add(Samples.Uniform(-1.0, 3.0));
+        Normal.Add(Samples.Normal(5.0, 2.0));
+    }
+
+    ASSERT_NEAR(Uniform.Mean(), 1.0, 0.02);
+    ASSERT_NEAR(Uniform.Variance(), 16.0 / 12.0, 0.02);
+    ASSERT_GE(Uniform.Minimum(), -1.0);
+    ASSERT_LT(Uniform.Maximum(), 3.0);
+    ASSERT_NEAR(Normal.Mean(), 5.0, 0.03);
+    ASSERT_NEAR(Normal.StandardDeviation(), 2.0, 0.03);
+}
+
+// Merging accumulators matches accumulating in sequence
+TEST(Statistics, Merge)
+{
+    Statistics::Accumulator Sequential;
+    Statistics::Accumulator First;
+    Statistics::Accumulator Second;
+
+    for (int Index = 0; Index < 100; Index++)
+    {
+        const double Value = Square(static_cast<double>(Index)) - 20.0;
+        Sequential.Add(Value);
+        (Index < 30 ? First : Second).Add(Value);
+    }
+
+    First.Merge(Second);
+    First.Merge(Statistics::Accumulator{});
+
+    ASSERT_EQ(First.Count(), 100u);
+    ASSERT_TRUE(IsNear(First.Mean(), Sequential.Mean(), 1.0E-10));
+    ASSERT_TRUE(IsNear(First.Variance(), Sequential.Variance(), 1.0E-6));
+    ASSERT_EQ(First.Minimum(), -20.0);
+    ASSERT_EQ(First.Maximum(), Square(99.0) - 20.0);
+}
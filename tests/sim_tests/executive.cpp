@@ -0,0 +1,185 @@
+#include "sim/executive.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /**
+     * Counts its updates and publishes the count, optionally offset by an input signal
+     */
+    class CountingComponent : public Component
+    {
+    public:
+        CountingComponent(const std::string& Name, double Rate, const Signal<double>* Input = nullptr) :
+            Component(Name, Rate),
+            mInput{Input},
+            mDynamicIndex({
+                .PtrMapInt = {{"Updates", &Updates}},
+                .PtrMapDouble = {{"Observed", &Observed}}
+            })
+        {
+            AddOutput(Output);
+        }
+
+        void Update(double Time, double Step) override
+        {
+            Updates++;
+            LastTime = Time;
+            LastStep = Step;
+            Observed = (mInput != nullptr) ? mInput->Get() : 0.0;
+            Output.Set(static_cast<double>(Updates));
+        }
+
+        const Indexable* GetDynamicIndexMap(void) const override {return &mDynamicIndex;}
+
+        Signal<double> Output{};
+        int Updates = 0;
+        double Observed = 0.0;
+        double LastTime = 0.0;
+        double LastStep = 0.0;
+
+    private:
+        const Signal<double>* mInput = nullptr;
+        Indexable mDynamicIndex;
+    };
+}
+
+// Rate groups execute at integer divisors of the base rate
+TEST(Executive, RateGroups)
+{
+    CountingComponent Fast("Fast", 100.0), Medium("Medium", 50.0), Slow("Slow", 10.0);
+
+    Executive Exec(100.0);
+    Exec.Add(Slow);
+    Exec.Add(Medium);
+    Exec.Add(Fast);
+    Exec.Build();
+
+    ASSERT_EQ(Exec.GetMajorFrame(), 10u);
+    ASSERT_EQ(Slow.GetDivisor(), 10u);
+
+    Exec.Run(100);
+
+    ASSERT_EQ(Fast.Updates, 100);
+    ASSERT_EQ(Medium.Updates, 50);
+    ASSERT_EQ(Slow.Updates, 10);
+    ASSERT_NEAR(Exec.GetTime(), 1.0, 1.0E-12);
+    ASSERT_NEAR(Slow.LastTime, 0.9, 1.0E-12);
+    ASSERT_NEAR(Slow.LastStep, 0.1, 1.0E-12);
+    ASSERT_NEAR(Fast.LastStep, 0.01, 1.0E-12);
+}
+
+// Dependents observe outputs of the same frame, others observe the previous frame
+TEST(Executive, Dependencies)
+{
+    CountingComponent Sensor("Sensor", 100.0);
+    CountingComponent Controller("Controller", 50.0, &Sensor.Output);
+    CountingComponent Monitor("Monitor", 100.0, &Controller.Output);
+    CountingComponent Independent("Independent", 100.0, &Sensor.Output);
+
+    Controller.DependsOn(Sensor);
+    Monitor.DependsOn(Controller);
+
+    // Added out of order, the schedule follows the dependencies
+    Executive Exec(100.0);
+    Exec.Add(Monitor);
+    Exec.Add(Controller);
+    Exec.Add(Independent);
+    Exec.Add(Sensor);
+    Exec.Build();
+
+    ASSERT_EQ(Exec.GetLevels(0).size(), 3u);
+    ASSERT_EQ(Exec.GetLevels(1).size(), 2u);
+    ASSERT_EQ(Exec.GetComponents(Exec.GetLevels(0)[2])[0], &Monitor);
+
+    Exec.Run(4);
+
+    // Controller ran on frames 0 and 2, seeing the sensor count of those frames
+    ASSERT_EQ(Controller.Observed, 3.0);
+    ASSERT_EQ(Monitor.Observed, 2.0);
+
+    // Independent shares the sensor level, so sees the previous frame
+    ASSERT_EQ(Independent.Observed, 3.0);
+    ASSERT_EQ(Sensor.Output.Get(), 4.0);
+
+    // Telemetry of each component is reachable through the executive
+    const Indexable* Telemetry = Exec.GetDynamicIndexMap();
+    ASSERT_NE(Telemetry, nullptr);
+    ASSERT_EQ(*Telemetry->GetPtrInt("Controller.Updates"), 2);
+    ASSERT_EQ(*Telemetry->GetPtrDouble("Monitor.Observed"), 2.0);
+    ASSERT_NEAR(*Telemetry->GetPtrDouble("Time"), 0.04, 1.0E-12);
+}
+
+// Invalid configurations are rejected when built
+TEST(Executive, Validation)
+{
+    CountingComponent A("A", 100.0), B("B", 30.0), C("C", 100.0), D("D", 100.0), Duplicate("A", 100.0);
+
+    Executive Rates(100.0);
+    Rates.Add(B);
+    ASSERT_THROW(Rates.Build(), Error::GenericException);
+
+    C.DependsOn(D);
+    D.DependsOn(C);
+    Executive Cyclic(100.0);
+    Cyclic.Add(C);
+    Cyclic.Add(D);
+    ASSERT_THROW(Cyclic.Build(), Error::GenericException);
+
+    Executive Missing(100.0);
+    Missing.Add(C);
+    ASSERT_THROW(Missing.Build(), Error::GenericException);
+
+    Executive Names(100.0);
+    Names.Add(A);
+    Names.Add(Duplicate);
+    ASSERT_THROW(Names.Build(), Error::GenericException);
+}
+
+// Parallel execution produces the same result as serial execution
+TEST(Executive, Parallel)
+{
+    constexpr size_t COUNT = 256;
+
+    struct Model
+    {
+        std::vector<std::unique_ptr<CountingComponent>> Sources{};
+        std::vector<std::unique_ptr<CountingComponent>> Sinks{};
+    };
+
+    const auto Populate = [](Model& Target, Executive& Exec)
+    {
+        for (size_t Index = 0; Index < COUNT; Index++)
+        {
+            const double Rate = (Index % 3 == 0) ? 50.0 : 100.0;
+            Target.Sources.push_back(std::make_unique<CountingComponent>("Source" + std::to_string(Index), Rate));
+            Target.Sinks.push_back(std::make_unique<CountingComponent>("Sink" + std::to_string(Index), 100.0, &Target.Sources.back()->Output));
+            Target.Sinks.back()->DependsOn(*Target.Sources.back());
+
+            Exec.Add(*Target.Sources.back());
+            Exec.Add(*Target.Sinks.back());
+        }
+    };
+
+    Model SerialModel, ParallelModel;
+    Executive Serial(100.0), Parallel(100.0, 3);
+    Parallel.SetParallelThreshold(2);
+
+    Populate(SerialModel, Serial);
+    Populate(ParallelModel, Parallel);
+
+    Serial.Run(21);
+    Parallel.Run(21);
+
+    for (size_t Index = 0; Index < COUNT; Index++)
+    {
+        ASSERT_EQ(ParallelModel.Sources[Index]->Updates, (Index % 3 == 0) ? 11 : 21);
+        ASSERT_EQ(ParallelModel.Sources[Index]->Updates, SerialModel.Sources[Index]->Updates);
+        ASSERT_EQ(ParallelModel.Sinks[Index]->Updates, 21);
+        ASSERT_EQ(ParallelModel.Sinks[Index]->Observed, SerialModel.Sinks[Index]->Observed);
+    }
+}
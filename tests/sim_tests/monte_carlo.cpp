@@ -0,0 +1,101 @@
+#include "sim/monte_carlo.hpp"
+#include "utils/errors.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+
+#include <span>
+
+namespace
+{
+    /**
+     * Nominal scenario parameters
+     */
+    struct Vehicle
+    {
+        double Mass = 100.0;
+        double Thrust = 400.0;
+        Indexable DynamicIndex{IndexMap{.PtrMapDouble = {{"Mass", &Mass}, {"Thrust", &Thrust}}}};
+    };
+
+    // Acceleration of a dispersed vehicle, with measurement noise
+    void Model(const MonteCarloCase& Case, std::span<double> Outputs)
+    {
+        Random::Stream Noise = Case.GetStream(0);
+        Outputs[0] = Case.Get("Vehicle.Thrust") / *Case.GetDynamicIndexMap()->GetPtrDouble("Vehicle.Mass");
+        Outputs[1] = Outputs[0] + Noise.Normal(0.0, 0.1);
+    }
+}
+
+// Dispersions are validated, nominal values are read by key
+TEST(MonteCarlo, Dispersions)
+{
+    const Vehicle Nominal;
+    const Indexable Scenario(IndexMap{.PtrMapIndexable = {{"Vehicle", &Nominal.DynamicIndex}}});
+
+    DispersionSet Dispersions;
+    Dispersions.AddNormal("Vehicle.Mass", Scenario, 5.0);
+    Dispersions.AddUniform("Vehicle.Thrust", 380.0, 420.0);
+
+    ASSERT_EQ(Dispersions.Size(), 2u);
+    ASSERT_EQ(Dispersions.GetDispersions()[0].A, 100.0);
+    ASSERT_EQ(Dispersions.Find("Vehicle.Thrust"), 1u);
+
+    ASSERT_THROW(Dispersions.AddNormal("Vehicle.Mass", 1.0, 1.0), Error::GenericException);
+    ASSERT_THROW(Dispersions.AddNormal("Vehicle.Isp", Scenario, 1.0), Error::GenericException);
+    ASSERT_THROW(Dispersions.AddNormal("Drag", 1.0, -1.0), Error::GenericException);
+    ASSERT_THROW(Dispersions.AddUniform("Drag", 1.0, 0.0), Error::GenericException);
+    ASSERT_THROW(Dispersions.Find("Drag"), Error::GenericException);
+
+    // Samples of a parameter do not depend upon the parameters added after it
+    DispersionSet Single;
+    Single.AddNormal("Vehicle.Mass", 100.0, 5.0);
+
+    for (uint64_t Case = 0; Case < 10; Case++)
+    {
+        ASSERT_EQ(Single.Sample(3, Case, 0), Dispersions.Sample(3, Case, 0));
+        ASSERT_NE(Dispersions.Sample(3, Case, 0), Dispersions.Sample(4, Case, 0));
+    }
+}
+
+// Statistics are bitwise identical for any number of threads
+TEST(MonteCarlo, Reproducible)
+{
+    DispersionSet Dispersions;
+    Dispersions.AddNormal("Vehicle.Mass", 100.0, 5.0);
+    Dispersions.AddUniform("Vehicle.Thrust", 380.0, 420.0);
+
+    const MonteCarlo Experiment(Dispersions, {"Acceleration", "Measured"}, MonteCarloOptions{.Cases = 1001, .Seed = 11, .ChunkSize = 8});
+
+    ThreadPool Serial(0);
+    const MonteCarloResult Reference = Experiment.Run(Serial, Model);
+
+    for (const size_t Workers : {1u, 3u, 8u})
+    {
+        ThreadPool Pool(Workers);
+        const MonteCarloResult Result = Experiment.Run(Pool, Model);
+
+        ASSERT_EQ(Result.Statistics, Reference.Statistics);
+    }
+
+    ASSERT_EQ(Reference.Get("Acceleration").Count(), 1001u);
+    ASSERT_THROW(Reference.Get("Velocity"), Error::GenericException);
+    ASSERT_THROW(MonteCarlo(Dispersions, {}, MonteCarloOptions{.ChunkSize = 0}), Error::GenericException);
+}
+
+// Outputs are reduced from the dispersed distributions
+TEST(MonteCarlo, Statistics)
+{
+    DispersionSet Dispersions;
+    Dispersions.AddNormal("Vehicle.Mass", 100.0, 0.0);
+    Dispersions.AddNormal("Vehicle.Thrust", 400.0, 20.0);
+
+    ThreadPool Pool(2);
+    const MonteCarloResult Result = MonteCarlo(Dispersions, {"Acceleration", "Measured"}, MonteCarloOptions{.Cases = 20000}).Run(Pool, Model);
+
+    const Statistics::Accumulator& Acceleration = Result.Get("Acceleration");
+    ASSERT_NEAR(Acceleration.Mean(), 4.0, 0.01);
+    ASSERT_NEAR(Acceleration.StandardDeviation(), 0.2, 0.005);
+
+    // Independent measurement noise adds in quadrature
+    ASSERT_NEAR(Result.Get("Measured").Variance(), 0.04 + 0.01, 0.002);
+}
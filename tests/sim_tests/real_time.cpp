@@ -0,0 +1,171 @@
+#include "sim/real_time.hpp"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace
+{
+    /**
+     * Counts its updates, optionally taking a fixed time to update
+     */
+    class DelayComponent : public Component
+    {
+    public:
+        DelayComponent(const std::string& Name, double Rate, std::chrono::microseconds Delay) :
+            Component(Name, Rate),
+            mDelay{Delay}
+        {
+
+        }
+
+        void Update(double, double) override
+        {
+            Updates++;
+
+            if (mDelay.count() > 0)
+            {
+                std::this_thread::sleep_for(mDelay);
+            }
+        }
+
+        int Updates = 0;
+
+    private:
+        std::chrono::microseconds mDelay{};
+    };
+}
+
+// Percentiles are within the bucket resolution of the exact values
+TEST(RealTime, Histogram)
+{
+    LatencyHistogram Histogram;
+    ASSERT_EQ(Histogram.Percentile(0.5), 0);
+
+    // Uniformly distributed from 1 us to 1 ms
+    for (int64_t Value = 1; Value <= 1000; Value++)
+    {
+        Histogram.Record(Value * 1000);
+    }
+
+    ASSERT_EQ(Histogram.Count(), 1000u);
+    ASSERT_EQ(Histogram.Min(), 1000);
+    ASSERT_EQ(Histogram.Max(), 1000000);
+    ASSERT_NEAR(Histogram.Mean(), 500500.0, 1.0E-6);
+
+    const double Resolution = 1.0 / static_cast<double>(LatencyHistogram::SUB_BUCKETS);
+    ASSERT_NEAR(static_cast<double>(Histogram.Percentile(0.5)), 500000.0, 500000.0 * Resolution);
+    ASSERT_NEAR(static_cast<double>(Histogram.Percentile(0.99)), 990000.0, 990000.0 * Resolution);
+    ASSERT_EQ(Histogram.Percentile(1.0), 1000000);
+    ASSERT_EQ(Histogram.Percentile(0.0), 1000);
+
+    // Small values are exact, excessive values are clamped
+    Histogram.Reset();
+    Histogram.Record(-5);
+    Histogram.Record(7);
+    Histogram.Record(INT64_MAX);
+    ASSERT_EQ(Histogram.Percentile(0.0), 0);
+    ASSERT_EQ(Histogram.Percentile(0.5), 7);
+    ASSERT_EQ(Histogram.Percentile(1.0), INT64_MAX);
+}
+
+// Frames are paced to the base rate, with statistics published to telemetry
+TEST(RealTime, Pacing)
+{
+    DelayComponent Fast("Fast", 1000.0, std::chrono::microseconds(0));
+    DelayComponent Slow("Slow", 250.0, std::chrono::microseconds(0));
+
+    Executive Exec(1000.0);
+    Exec.Add(Fast);
+    Exec.Add(Slow);
+
+    RealTimeRunner Runner(Exec, RealTimeOptions{.LockMemory = false, .PublishInterval = 10});
+
+    const auto Start = std::chrono::steady_clock::now();
+    Runner.Run(40);
+    const double Elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+
+    // The first frame is released immediately, the last 39 periods later
+    ASSERT_GE(Elapsed, 0.039);
+    ASSERT_EQ(Fast.Updates, 40);
+    ASSERT_EQ(Slow.Updates, 10);
+    ASSERT_EQ(Runner.GetComponentDurations(1).Count(), 10u);
+
+    const Indexable* Telemetry = Runner.GetDynamicIndexMap();
+    ASSERT_NE(Telemetry, nullptr);
+    ASSERT_EQ(*Telemetry->GetPtrInt("Frames"), 40);
+    ASSERT_EQ(*Telemetry->GetPtrInt("Components.Slow.Count"), 10);
+    ASSERT_EQ(*Telemetry->GetPtrInt("Jitter.Count"), 40);
+    ASSERT_GE(*Telemetry->GetPtrDouble("Jitter.Max"), *Telemetry->GetPtrDouble("Jitter.P50"));
+    ASSERT_GE(*Telemetry->GetPtrDouble("Components.Fast.Max"), 0.0);
+    ASSERT_NEAR(*Telemetry->GetPtrDouble("Executive.Time"), 0.04, 1.0E-12);
+    ASSERT_EQ(*Telemetry->GetPtrBool("MemoryLocked"), false);
+}
+
+// Components and dependencies added after the executive was built or the runner started
+// rebuild the schedule before the next frame
+TEST(RealTime, Reconfigured)
+{
+    DelayComponent Fast("Fast", 1000.0, std::chrono::microseconds(0));
+    DelayComponent Slow("Slow", 500.0, std::chrono::microseconds(0));
+    DelayComponent Late("Late", 1000.0, std::chrono::microseconds(0));
+
+    Executive Exec(1000.0);
+    Exec.Add(Fast);
+    Exec.Build();
+    Exec.Add(Slow);
+    ASSERT_EQ(Exec.IsBuilt(), false);
+
+    RealTimeRunner Runner(Exec, RealTimeOptions{.LockMemory = false});
+    Runner.Start();
+    ASSERT_EQ(Exec.IsBuilt(), true);
+    ASSERT_EQ(Exec.GetMajorFrame(), 2u);
+
+    Runner.Run(4);
+    ASSERT_EQ(Slow.Updates, 2);
+    ASSERT_EQ(Runner.GetComponentDurations(1).Count(), 2u);
+
+    // Restarted with the new schedule, the statistics of the earlier schedule discarded
+    Late.DependsOn(Slow);
+    ASSERT_EQ(Exec.IsBuilt(), true);
+    Exec.Add(Late);
+    Runner.Run(2);
+    ASSERT_EQ(Exec.IsBuilt(), true);
+    ASSERT_EQ(Late.Updates, 2);
+    ASSERT_EQ(Runner.GetComponentDurations(2).Count(), 2u);
+    ASSERT_EQ(*Runner.GetDynamicIndexMap()->GetPtrInt("Frames"), 2);
+
+    Fast.DependsOn(Slow);
+    ASSERT_EQ(Exec.IsBuilt(), false);
+    Runner.Step();
+    ASSERT_EQ(Exec.GetComponents(Exec.GetLevels(0)[0]).size(), 1u);
+    ASSERT_EQ(Runner.GetFrameDurations().Count(), 1u);
+}
+
+// Frames longer than the period are detected, and optionally skip missed releases
+TEST(RealTime, Overruns)
+{
+    DelayComponent First("Overrunning", 1000.0, std::chrono::microseconds(3000));
+    DelayComponent Second("Overrunning", 1000.0, std::chrono::microseconds(3000));
+
+    Executive CatchUpExec(1000.0);
+    CatchUpExec.Add(First);
+    RealTimeRunner CatchUp(CatchUpExec, RealTimeOptions{.Policy = OverrunPolicy::CATCH_UP, .LockMemory = false});
+    CatchUp.Run(5);
+
+    ASSERT_EQ(CatchUp.GetOverruns(), 5u);
+    ASSERT_EQ(*CatchUp.GetDynamicIndexMap()->GetPtrInt("Overruns"), 5);
+    ASSERT_EQ(*CatchUp.GetDynamicIndexMap()->GetPtrInt("Skipped"), 0);
+    ASSERT_GE(*CatchUp.GetDynamicIndexMap()->GetPtrDouble("Frame.P50"), 0.003);
+
+    // Each frame spans at least three periods, so at least two releases are missed
+    Executive SkipExec(1000.0);
+    SkipExec.Add(Second);
+    RealTimeRunner Skip(SkipExec, RealTimeOptions{.Policy = OverrunPolicy::SKIP, .LockMemory = false});
+    Skip.Run(5);
+
+    ASSERT_EQ(Skip.GetOverruns(), 5u);
+    ASSERT_GE(*Skip.GetDynamicIndexMap()->GetPtrInt("Skipped"), 10);
+    ASSERT_EQ(Second.Updates, 5);
+}
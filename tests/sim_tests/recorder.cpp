@@ -0,0 +1,239 @@
+#include "sim/recorder.hpp"
+#include "math/axis3.hpp"
+#include "math/quaternion.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace
+{
+    /**
+     * Recorded vehicle state
+     */
+    struct Vehicle
+    {
+        double Mass = 100.0;
+        int Mode = 0;
+        bool Firing = false;
+        Axis3 Rate{};
+        Quaternion Attitude{};
+
+        Indexable DynamicIndex{IndexMap{
+            .PtrMapInt = {{"Mode", &Mode}},
+            .PtrMapDouble = {{"Mass", &Mass}},
+            .PtrMapBool = {{"Firing", &Firing}},
+            .PtrMapAxis3 = {{"Rate", &Rate}},
+            .PtrMapQuaternion = {{"Attitude", &Attitude}}}};
+    };
+
+    std::string TemporaryPath(const std::string& Name)
+    {
+        return (std::filesystem::temp_directory_path() / Name).string();
+    }
+}
+
+// Parameters are bound by key, with a column per element of vectors and quaternions
+TEST(Recorder, Bind)
+{
+    Vehicle Craft;
+    const Indexable Scenario(IndexMap{.PtrMapIndexable = {{"Vehicle", &Craft.DynamicIndex}}});
+
+    Recorder Telemetry(TemporaryPath("recorder_bind.htlm"));
+    Telemetry.Bind(Scenario, "Vehicle.Mass");
+    Telemetry.Bind(Scenario, "Vehicle.Mode");
+    Telemetry.Bind(Scenario, "Vehicle.Firing");
+    Telemetry.Bind(Scenario, "Vehicle.Rate");
+    Telemetry.Bind(Scenario, "Vehicle.Attitude");
+
+    ASSERT_EQ(Telemetry.Columns(), 11u);
+
+    ASSERT_THROW(Telemetry.Bind(Scenario, "Vehicle.Missing"), Error::GenericException);
+    ASSERT_THROW(Telemetry.Bind(Scenario, "Vehicle.Mass"), Error::GenericException);
+    ASSERT_THROW(Telemetry.Bind(Scenario, "Vehicle.Rate"), Error::GenericException);
+
+    Telemetry.Start();
+    ASSERT_THROW(Telemetry.Start(), Error::GenericException);
+    ASSERT_THROW(Telemetry.Bind(Scenario, "Vehicle"), Error::GenericException);
+    Telemetry.Stop();
+}
+
+// Every frame is read back exactly, across several chunks
+TEST(Recorder, RoundTrip)
+{
+    constexpr size_t FRAMES = 2500;
+    const std::string Path = TemporaryPath("recorder_round_trip.htlm");
+
+    Vehicle Craft;
+    Recorder Telemetry(Path, RecorderOptions{.RingFrames = 64, .ChunkFrames = 1000});
+    Telemetry.Bind(Craft.DynamicIndex, "Mass");
+    Telemetry.Bind(Craft.DynamicIndex, "Mode");
+    Telemetry.Bind(Craft.DynamicIndex, "Firing");
+    Telemetry.Bind(Craft.DynamicIndex, "Rate");
+    Telemetry.Bind(Craft.DynamicIndex, "Attitude");
+
+    const auto Update = [&](size_t Frame)
+    {
+        const double Time = 0.1 * static_cast<double>(Frame);
+        Craft.Mass = 100.0 - 0.01 * Time;
+        Craft.Mode = static_cast<int>(Frame / 700) - 1;
+        Craft.Firing = (Frame % 3) == 0;
+        Craft.Rate = Axis3{.X = std::sin(Time), .Y = 0.0, .Z = -1.0E-300};
+        Craft.Attitude = Quaternion{.X = 0.0, .Y = 0.0, .Z = std::sin(Time), .S = std::cos(Time)};
+        return Time;
+    };
+
+    Telemetry.Start();
+
+    for (size_t Frame = 0; Frame < FRAMES; Frame++)
+    {
+        Telemetry.Record(Update(Frame));
+    }
+
+    Telemetry.Stop();
+    ASSERT_EQ(Telemetry.GetFrames(), FRAMES);
+    ASSERT_EQ(Telemetry.GetDropped(), 0u);
+
+    const TelemetryReader Reader(Path);
+    ASSERT_EQ(Reader.Columns(), 11u);
+    ASSERT_EQ(Reader.Frames(), FRAMES);
+    ASSERT_EQ(Reader.GetName(0), HString("Time"));
+    ASSERT_EQ(Reader.GetName(1), HString("Mass"));
+    ASSERT_EQ(Reader.GetName(2), HString("Rate.X"));
+    ASSERT_EQ(Reader.GetName(8), HString("Attitude.S"));
+    ASSERT_EQ(Reader.GetType(8), TelemetryType::DOUBLE);
+    ASSERT_EQ(Reader.GetType(Reader.Find("Mode")), TelemetryType::INT);
+    ASSERT_EQ(Reader.GetType(Reader.Find("Firing")), TelemetryType::BOOL);
+    ASSERT_THROW(Reader.Find("Missing"), Error::GenericException);
+
+    const std::vector<double> Time = Reader.ReadColumn("Time");
+    const std::vector<double> Mass = Reader.ReadColumn("Mass");
+    const std::vector<double> Mode = Reader.ReadColumn("Mode");
+    const std::vector<double> Firing = Reader.ReadColumn("Firing");
+    const std::vector<double> RateZ = Reader.ReadColumn("Rate.Z");
+    const std::vector<double> Scalar = Reader.ReadColumn("Attitude.S");
+
+    for (size_t Frame = 0; Frame < FRAMES; Frame++)
+    {
+        ASSERT_EQ(Time[Frame], Update(Frame));
+        ASSERT_EQ(Mass[Frame], Craft.Mass);
+        ASSERT_EQ(Mode[Frame], static_cast<double>(Craft.Mode));
+        ASSERT_EQ(Firing[Frame], Craft.Firing ? 1.0 : 0.0);
+        ASSERT_EQ(RateZ[Frame], Craft.Rate.Z);
+        ASSERT_EQ(Scalar[Frame], Craft.Attitude.S);
+    }
+}
+
+// Without blocking, frames are dropped when the writer falls behind and every other
+// frame is written
+TEST(Recorder, Dropping)
+{
+    constexpr size_t FRAMES = 5000;
+    const std::string Path = TemporaryPath("recorder_dropping.htlm");
+
+    Vehicle Craft;
+    Recorder Telemetry(Path, RecorderOptions{.RingFrames = 2, .ChunkFrames = 16, .Block = false});
+    Telemetry.Bind(Craft.DynamicIndex, "Mass");
+
+    // Frames are not recorded before starting
+    Telemetry.Record(0.0);
+    Telemetry.Start();
+
+    for (size_t Frame = 0; Frame < FRAMES; Frame++)
+    {
+        Telemetry.Record(static_cast<double>(Frame));
+    }
+
+    Telemetry.Stop();
+    ASSERT_EQ(Telemetry.GetFrames() + Telemetry.GetDropped(), FRAMES);
+
+    const TelemetryReader Reader(Path);
+    ASSERT_EQ(Reader.Frames(), Telemetry.GetFrames());
+
+    const std::vector<double> Time = Reader.ReadColumn(0);
+
+    for (size_t Frame = 1; Frame < Time.size(); Frame++)
+    {
+        ASSERT_LT(Time[Frame - 1], Time[Frame]);
+    }
+}
+
+// Missing, foreign and truncated files are rejected
+TEST(Recorder, InvalidFile)
+{
+    ASSERT_THROW(TelemetryReader(TemporaryPath("recorder_missing.htlm")), Error::GenericException);
+
+    const std::string Foreign = TemporaryPath("recorder_foreign.htlm");
+    std::ofstream(Foreign) << "Not a recording";
+    ASSERT_THROW(TelemetryReader{Foreign}, Error::GenericException);
+
+    // Recording truncated within its only chunk
+    const std::string Path = TemporaryPath("recorder_truncated.htlm");
+    Vehicle Craft;
+    Recorder Telemetry(Path);
+    Telemetry.Bind(Craft.DynamicIndex, "Mass");
+    Telemetry.Start();
+    Telemetry.Record(0.0);
+    Telemetry.Record(1.0);
+    Telemetry.Stop();
+
+    std::filesystem::resize_file(Path, std::filesystem::file_size(Path) - 1);
+    ASSERT_THROW(TelemetryReader{Path}, Error::GenericException);
+
+    // A file which cannot be created is reported when started
+    Recorder Unwritable(TemporaryPath("recorder_missing/recorder.htlm"));
+    Unwritable.Bind(Craft.DynamicIndex, "Mass");
+    ASSERT_THROW(Unwritable.Start(), Error::GenericException);
+    Unwritable.Record(0.0);
+    ASSERT_EQ(Unwritable.GetFrames(), 0u);
+
+    // Writes failing once recording has started are reported when stopped, without blocking recording
+    if (std::filesystem::exists("/dev/full") == true)
+    {
+        Recorder Full("/dev/full", RecorderOptions{.RingFrames = 2, .ChunkFrames = 1});
+        Full.Bind(Craft.DynamicIndex, "Mass");
+
+        ASSERT_THROW(
+        {
+            Full.Start();
+
+            for (int Frame = 0; Frame < 100; Frame++)
+            {
+                Full.Record(static_cast<double>(Frame));
+            }
+
+            Full.Stop();
+        }, Error::GenericException);
+    }
+}
+
+// Columns which do not decode to exactly the frames of each chunk are rejected when read
+TEST(Recorder, ShortColumn)
+{
+    const std::string Path = TemporaryPath("recorder_short.htlm");
+    Vehicle Craft;
+    Recorder Telemetry(Path);
+    Telemetry.Bind(Craft.DynamicIndex, "Mass");
+    Telemetry.Start();
+    Telemetry.Record(0.0);
+    Telemetry.Record(1.0);
+    Telemetry.Stop();
+
+    ASSERT_EQ(TelemetryReader(Path).ReadColumn("Mass").size(), 2u);
+    ASSERT_THROW(TelemetryReader(Path).ReadColumn(2), Error::GenericException);
+
+    // The chunk claims one frame of the two recorded, after the magic, version, count and the
+    // type, length and name of each column
+    const uint32_t Frames = 1;
+    std::fstream File(Path, std::ios::binary | std::ios::in | std::ios::out);
+    File.seekp(4 + 4 + 4 + 2 * (1 + 2 + 4));
+    File.write(reinterpret_cast<const char*>(&Frames), sizeof(Frames));
+    File.close();
+
+    const TelemetryReader Reader(Path);
+    ASSERT_EQ(Reader.Frames(), 1u);
+    ASSERT_THROW(Reader.ReadColumn("Time"), Error::GenericException);
+}
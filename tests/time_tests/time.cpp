@@ -0,0 +1,177 @@
+#include "time/time_scales.hpp"
+#include "time/iso8601.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+using namespace Time;
+
+// Calendar round trips and the J2000 epoch definition
+TEST(Time, Calendar)
+{
+    static_assert(FromCalendar(CalendarDate{2000, 1, 1}, 12) == Epoch{});
+    static_assert(FromCalendar(CalendarDate{2000, 1, 1}) == Epoch{.Day = -1.0, .Fraction = 0.5});
+    static_assert(DaysFromCivil(CalendarDate{1970, 1, 1}) == 0);
+    static_assert(CivilFromDays(UNIX_TO_J2000_DAYS).Year == 2000);
+    static_assert(CivilFromDays(DaysFromCivil(CalendarDate{2024, 2, 29})).Day == 29);
+    static_assert(Epoch::FromJulianDate(2451544.5) == Epoch{.Day = -1.0, .Fraction = 0.5});
+
+    for (int64_t Days = -100000; Days < 100000; Days += 7)
+    {
+        const CalendarDate Date = CivilFromDays(Days);
+        ASSERT_EQ(DaysFromCivil(Date), Days);
+    }
+}
+
+// Two part epochs retain sub nanosecond resolution a century from J2000
+TEST(Time, Resolution)
+{
+    const Epoch Start = FromCalendar(CalendarDate{2100, 6, 1}, 3, 4, 5.0);
+    const Epoch End = Start.AddSeconds(1.0E-6);
+
+    ASSERT_NEAR(End.SecondsSince(Start), 1.0E-6, 1.0E-10);
+    ASSERT_NEAR(Start.SecondsSince(FromCalendar(CalendarDate{2100, 6, 1})), 3.0 * 3600.0 + 4.0 * 60.0 + 5.0, 1.0E-9);
+}
+
+// TAI - UTC either side of a leap second
+TEST(Time, LeapSeconds)
+{
+    constexpr Epoch Before = FromCalendar(CalendarDate{2016, 12, 31}, 23, 59, 59.0);
+    constexpr Epoch After = FromCalendar(CalendarDate{2017, 1, 1});
+
+    static_assert(DEFAULT_LEAP_SECONDS.Size() == 28);
+    static_assert(DEFAULT_LEAP_SECONDS.OffsetFromUTC(Before) == 36.0);
+    static_assert(DEFAULT_LEAP_SECONDS.OffsetFromUTC(After) == 37.0);
+    static_assert(DEFAULT_LEAP_SECONDS.OffsetFromUTC(FromCalendar(CalendarDate{1960, 1, 1})) == 0.0);
+
+    // The inserted second elapses in TAI but not in UTC
+    ASSERT_NEAR(UTC2TAI(After).SecondsSince(UTC2TAI(Before)), 2.0, 1.0E-9);
+
+    // Round trip through TAI
+    ASSERT_NEAR(TAI2UTC(UTC2TAI(Before)).SecondsSince(Before), 0.0, 1.0E-9);
+    ASSERT_NEAR(TAI2UTC(UTC2TAI(After)).SecondsSince(After), 0.0, 1.0E-9);
+}
+
+// Fixed offsets and the GPS epoch
+TEST(Time, TimeScales)
+{
+    constexpr Epoch UTC = FromCalendar(CalendarDate{2020, 5, 17}, 8, 30);
+    constexpr Epoch TAI = UTC2TAI(UTC);
+
+    static_assert(IsNear(Convert(UTC, TimeScale::UTC, TimeScale::TT).SecondsSince(TAI), 32.184, 1.0E-9));
+    static_assert(IsNear(Convert(UTC, TimeScale::UTC, TimeScale::GPS).SecondsSince(TAI), -19.0, 1.0E-9));
+
+    // GPS and UTC coincide at the GPS epoch
+    constexpr Epoch GPSEpoch = FromCalendar(CalendarDate{1980, 1, 6});
+    static_assert(IsNear(Convert(GPSEpoch, TimeScale::UTC, TimeScale::GPS).SecondsSince(GPSEpoch), 0.0, 1.0E-9));
+
+    // TDB - TT is periodic with an amplitude of 1.657 ms
+    for (double Seconds = 0.0; Seconds < 3.2E7; Seconds += 1.0E5)
+    {
+        ASSERT_LE(Abs(TDBMinusTT(Seconds)), 1.66E-3);
+    }
+
+    // Round trip between every pair of time scales
+    constexpr TimeScale SCALES[] = {TimeScale::UTC, TimeScale::TAI, TimeScale::TT, TimeScale::TDB, TimeScale::GPS};
+
+    for (TimeScale From : SCALES)
+    {
+        for (TimeScale To : SCALES)
+        {
+            const Epoch Back = Convert(Convert(UTC, From, To), To, From);
+            ASSERT_NEAR(Back.SecondsSince(UTC), 0.0, 1.0E-9);
+        }
+    }
+}
+
+// Ephemeris time of J2000 UTC, as given by Spice str2et
+TEST(Time, EphemerisTime)
+{
+    constexpr double EphemerisTime = UTC2EphemerisTime(FromCalendar(CalendarDate{2000, 1, 1}, 12));
+    static_assert(IsNear(EphemerisTime, 64.183927284731, 1.0E-6));
+}
+
+// Leap second kernels parse to the compiled in table
+TEST(Time, LoadLeapSecondKernel)
+{
+    const std::string Directory = std::string(PROJECT_DIR) + std::string("/data/spice/leap_seconds_kernel/");
+
+    for (const char* Name : {"naif0012.tls", "naif0012.tls.pc"})
+    {
+        const LeapSecondTable Table = LoadLeapSecondKernel(Directory + std::string(Name));
+
+        ASSERT_EQ(Table.Size(), DEFAULT_LEAP_SECONDS.Size());
+
+        for (size_t Index = 0; Index < Table.Size(); Index++)
+        {
+            ASSERT_EQ(Table[Index].Day, DEFAULT_LEAP_SECONDS[Index].Day);
+            ASSERT_EQ(Table[Index].Offset, DEFAULT_LEAP_SECONDS[Index].Offset);
+        }
+
+        ASSERT_EQ(Table.GetTDBModel().DeltaTA, 32.184);
+        ASSERT_EQ(Table.GetTDBModel().K, 1.657E-3);
+        ASSERT_EQ(Table.GetTDBModel().EB, 1.671E-2);
+        ASSERT_EQ(Table.GetTDBModel().M0, 6.239996);
+        ASSERT_EQ(Table.GetTDBModel().M1, 1.99096871E-7);
+    }
+
+    ASSERT_THROW(LoadLeapSecondKernel(Directory + std::string("missing.tls")), Error::GenericException);
+}
+
+// Compile time ISO-8601 round trip
+constexpr bool RoundTrip(std::string_view Input, std::string_view Expected, size_t Decimals)
+{
+    const ParseResult Result = ParseISO8601(Input);
+    std::array<char, 32> Buffer{};
+    const size_t Length = FormatISO8601(Result.Value, Buffer, Decimals);
+
+    return (Result.Status == ParseStatus::SUCCESS) && (std::string_view(Buffer.data(), Length) == Expected);
+}
+
+// ISO-8601 parsing and formatting
+TEST(Time, ISO8601)
+{
+    static_assert(RoundTrip("2021-03-04T05:06:07.890Z", "2021-03-04T05:06:07.890", 3));
+    static_assert(RoundTrip("2000-01-01T12:00:00", "2000-01-01T12:00:00", 0));
+    static_assert(RoundTrip("1999-12-31 23:59:59.9996", "2000-01-01T00:00:00.000", 3));
+    static_assert(RoundTrip("2024-02-29", "2024-02-29T00:00:00.000000", 6));
+    static_assert(RoundTrip("1972-06-30T23:59", "1972-06-30T23:59:00", 0));
+
+    static_assert(ParseISO8601("2000-01-01T12:00:00").Value == Epoch{});
+    static_assert(ParseISO8601("2023-02-29").Status == ParseStatus::INVALID_DATE);
+    static_assert(ParseISO8601("2023-13-01").Status == ParseStatus::INVALID_DATE);
+    static_assert(ParseISO8601("2023-01-01T24:00:00").Status == ParseStatus::INVALID_TIME);
+    static_assert(ParseISO8601("2023-01-01T12:00:00.").Status == ParseStatus::INVALID_FORMAT);
+    static_assert(ParseISO8601("2023-01-01X").Status == ParseStatus::INVALID_FORMAT);
+    static_assert(ParseISO8601("2023/01/01").Status == ParseStatus::INVALID_FORMAT);
+    static_assert(ParseISO8601("").Status == ParseStatus::INVALID_FORMAT);
+
+    // Leap second is carried into the following day
+    constexpr Epoch Leap = ParseISO8601("2016-12-31T23:59:60").Value;
+    static_assert(Leap == FromCalendar(CalendarDate{2017, 1, 1}));
+    static_assert(ParseISO8601("1972-06-30T23:59:60.5").Status == ParseStatus::SUCCESS);
+
+    // Second 60 is only valid in the last minute of a day ending in a leap second
+    static_assert(ParseISO8601("2016-12-30T23:59:60").Status == ParseStatus::INVALID_TIME);
+    static_assert(ParseISO8601("2016-12-31T23:58:60").Status == ParseStatus::INVALID_TIME);
+    static_assert(ParseISO8601("2016-12-31T12:59:60").Status == ParseStatus::INVALID_TIME);
+    static_assert(ParseISO8601("2023-06-30T23:59:60").Status == ParseStatus::INVALID_TIME);
+    static_assert(ParseISO8601("1971-12-31T23:59:60").Status == ParseStatus::INVALID_TIME);
+
+    // Leap seconds are those of the given table
+    LeapSecondTable Future = DEFAULT_LEAP_SECONDS;
+    ASSERT_TRUE(Future.AddEntry(CalendarDate{2030, 1, 1}, 38.0));
+    ASSERT_EQ(ParseISO8601("2029-12-31T23:59:60").Status, ParseStatus::INVALID_TIME);
+    ASSERT_EQ(ParseISO8601("2029-12-31T23:59:60", Future).Status, ParseStatus::SUCCESS);
+    ASSERT_EQ(ParseISO8601("2016-12-31T23:59:60", LeapSecondTable{}).Status, ParseStatus::INVALID_TIME);
+
+    // Milliseconds are preserved over many centuries
+    const ParseResult Result = ParseISO8601("2150-07-04T01:02:03.456");
+    std::array<char, 32> Buffer{};
+    const size_t Length = FormatISO8601(Result.Value, Buffer, 3);
+    ASSERT_EQ(std::string(Buffer.data(), Length), std::string("2150-07-04T01:02:03.456"));
+    ASSERT_EQ(FormatISO8601(Result.Value, std::span<char>(Buffer.data(), 10), 3), 0U);
+}
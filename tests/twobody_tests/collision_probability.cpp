@@ -0,0 +1,145 @@
+#include "twobody/collision_probability.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+    // Crossing encounter with a correlated covariance, elongated along track
+    const TwoBody::Conjunction ENCOUNTER{
+        .RelativePosition = Vector3({30.0, -20.0, 15.0}),
+        .RelativeVelocity = Vector3({100.0, 2000.0, -14000.0}),
+        .Covariance = Matrix3{.XX = 2500.0, .XY = 600.0, .XZ = -200.0,
+                              .YX = 600.0, .YY = 900.0, .YZ = 150.0,
+                              .ZX = -200.0, .ZY = 150.0, .ZZ = 1600.0},
+        .HardBodyRadius = 10.0};
+
+    /**
+     * @return Conjunction with an isotropic covariance, crossing along Z
+     */
+    TwoBody::Conjunction Isotropic(double Miss, double Sigma, double Radius)
+    {
+        return TwoBody::Conjunction{
+            .RelativePosition = Vector3({Miss, 0.0, 5.0}),
+            .RelativeVelocity = Vector3({0.0, 0.0, -7500.0}),
+            .Covariance = Matrix3::IDENTITY() * Square(Sigma),
+            .HardBodyRadius = Radius};
+    }
+}
+
+// The miss and covariance are projected normal to the relative velocity, along the principal axes
+TEST(CollisionProbability, Projection)
+{
+    const TwoBody::EncounterPlane Plane = TwoBody::ProjectEncounter(TwoBody::Conjunction{
+        .RelativePosition = Vector3({100.0, 0.0, 50.0}),
+        .RelativeVelocity = Vector3({0.0, 0.0, 7000.0}),
+        .Covariance = Matrix3{.XX = 100.0, .YY = 400.0, .ZZ = 900.0},
+        .HardBodyRadius = 5.0});
+
+    EXPECT_NEAR(Plane.SigmaX, 20.0, 1.0E-12);
+    EXPECT_NEAR(Plane.SigmaY, 10.0, 1.0E-12);
+    EXPECT_NEAR(Abs(Plane.MissX), 0.0, 1.0E-12);
+    EXPECT_NEAR(Abs(Plane.MissY), 100.0, 1.0E-12);
+    EXPECT_EQ(Plane.HardBodyRadius, 5.0);
+
+    // The miss distance is preserved, and the axes ordered
+    const TwoBody::EncounterPlane General = TwoBody::ProjectEncounter(ENCOUNTER);
+    const Vector3 Along = ENCOUNTER.RelativeVelocity.Unit();
+    const Vector3 Miss = ENCOUNTER.RelativePosition - Along * ENCOUNTER.RelativePosition.Dot(Along);
+    EXPECT_NEAR(Sqrt(Square(General.MissX) + Square(General.MissY)), Miss.Norm(), 1.0E-10);
+    EXPECT_GE(General.SigmaX, General.SigmaY);
+}
+
+// Every method matches the closed form of an isotropic covariance centred on the hard body, and
+// Foster and Chan agree for an isotropic covariance, for which the series is exact
+TEST(CollisionProbability, Isotropic)
+{
+    const double Sigma = 20.0, Radius = 10.0;
+    const double Exact = 1.0 - Exp(-0.5 * Square(Radius / Sigma));
+    const TwoBody::EncounterPlane Centred = TwoBody::ProjectEncounter(Isotropic(0.0, Sigma, Radius));
+
+    EXPECT_NEAR(TwoBody::FosterProbability(Centred), Exact, 1.0E-10 * Exact);
+    EXPECT_NEAR(TwoBody::ChanProbability(Centred), Exact, 1.0E-14);
+
+    for (const double Miss : {5.0, 40.0, 150.0})
+    {
+        const TwoBody::EncounterPlane Plane = TwoBody::ProjectEncounter(Isotropic(Miss, Sigma, Radius));
+        const double Foster = TwoBody::FosterProbability(Plane);
+        EXPECT_NEAR(TwoBody::ChanProbability(Plane, 60), Foster, 1.0E-8 * Foster) << Miss;
+    }
+}
+
+// The methods agree with the Monte Carlo reference, sampled from the full covariance, and the
+// Monte Carlo estimate is identical for any number of threads
+TEST(CollisionProbability, MonteCarlo)
+{
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+    const TwoBody::EncounterPlane Plane = TwoBody::ProjectEncounter(ENCOUNTER);
+    const double Foster = TwoBody::FosterProbability(Plane);
+
+    const TwoBody::MonteCarloCollision Serial = TwoBody::MonteCarloProbability(None, ENCOUNTER, 1000000, 3);
+    const TwoBody::MonteCarloCollision Parallel = TwoBody::MonteCarloProbability(Pool, ENCOUNTER, 1000000, 3);
+    EXPECT_EQ(Serial.Hits, Parallel.Hits);
+    EXPECT_EQ(Serial.Samples, 1000000u);
+    EXPECT_NEAR(Parallel.Probability, Foster, 4.0 * Parallel.StandardError);
+
+    // The equal area approximation of Chan holds for a small hard body
+    EXPECT_NEAR(TwoBody::ChanProbability(Plane), Foster, 1.0E-2 * Foster);
+
+    TwoBody::Conjunction Singular = ENCOUNTER;
+    Singular.Covariance = Matrix3::ZERO();
+    EXPECT_THROW(TwoBody::MonteCarloProbability(Pool, Singular, 1000), Error::GenericException);
+}
+
+// The maximum bounds the probability of every scaling of the covariance, and approaches the
+// closed form of a small hard body in an isotropic covariance, R^2 / (e d^2)
+TEST(CollisionProbability, AlfanoMaximum)
+{
+    const TwoBody::EncounterPlane Plane = TwoBody::ProjectEncounter(ENCOUNTER);
+    const double Maximum = TwoBody::AlfanoMaximumProbability(Plane);
+
+    for (const double Scale : {0.1, 0.5, 1.0, 2.0, 10.0})
+    {
+        TwoBody::Conjunction Scaled = ENCOUNTER;
+        Scaled.Covariance = ENCOUNTER.Covariance * Scale;
+        EXPECT_LE(TwoBody::CollisionProbability(Scaled, TwoBody::CollisionMethod::FOSTER), Maximum * (1.0 + 1.0E-6)) << Scale;
+    }
+
+    const double Miss = 1000.0, Radius = 1.0;
+    const double Small = TwoBody::AlfanoMaximumProbability(TwoBody::ProjectEncounter(Isotropic(Miss, 50.0, Radius)));
+    EXPECT_NEAR(Small, Square(Radius / Miss) / Exp(1.0), 1.0E-6 * Small);
+
+    EXPECT_EQ(TwoBody::AlfanoMaximumProbability(TwoBody::ProjectEncounter(Isotropic(5.0, 50.0, 10.0))), 1.0);
+}
+
+// Batches match each conjunction evaluated alone
+TEST(CollisionProbability, Batch)
+{
+    ThreadPool Pool(3);
+    std::vector<TwoBody::Conjunction> Events{};
+
+    for (size_t Index = 0; Index < 500; Index++)
+    {
+        TwoBody::Conjunction Event = ENCOUNTER;
+        Event.RelativePosition = ENCOUNTER.RelativePosition * (0.01 * static_cast<double>(Index));
+        Events.push_back(Event);
+    }
+
+    std::vector<double> Probabilities(Events.size());
+
+    for (const TwoBody::CollisionMethod Method : {TwoBody::CollisionMethod::FOSTER, TwoBody::CollisionMethod::CHAN, TwoBody::CollisionMethod::ALFANO_MAXIMUM})
+    {
+        TwoBody::CollisionProbability(Pool, Events, Method, Probabilities);
+
+        for (size_t Index = 0; Index < Events.size(); Index++)
+        {
+            EXPECT_EQ(Probabilities[Index], TwoBody::CollisionProbability(Events[Index], Method)) << Index;
+        }
+
+        std::vector<double> Short(Events.size() - 1);
+        EXPECT_THROW(TwoBody::CollisionProbability(Pool, Events, Method, Short), Error::HArraySizeMismatch);
+    }
+}
@@ -0,0 +1,194 @@
+#include "twobody/covariance.hpp"
+#include "twobody/orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+
+    // Elliptical low Earth orbit
+    const TwoBody::StateVector STATE = TwoBody::MakeStateVector(
+        Vector3({6.9E6, 1.0E5, -2.0E5}),
+        Vector3({-100.0, 6800.0, 3000.0}));
+
+    // Position uncertainty of tens of metres and velocity of centimetres per second, correlated
+    TwoBody::StateCovariance MakeCovariance(double Scale)
+    {
+        TwoBody::StateCovariance Covariance{};
+        const double Sigma[6] = {100.0, 50.0, 30.0, 0.1, 0.05, 0.02};
+
+        for (size_t Row = 0; Row < 6; Row++)
+        {
+            for (size_t Col = 0; Col < 6; Col++)
+            {
+                const double Correlation = (Row == Col) ? 1.0 : 0.3;
+                Covariance(Row, Col) = Square(Scale) * Correlation * Sigma[Row] * Sigma[Col];
+            }
+        }
+
+        return Covariance;
+    }
+
+    void ExpectNear(const TwoBody::StateCovariance& A, const TwoBody::StateCovariance& B, double Relative)
+    {
+        for (size_t Row = 0; Row < 6; Row++)
+        {
+            for (size_t Col = 0; Col < 6; Col++)
+            {
+                const double Scale = Sqrt(A(Row, Row) * A(Col, Col));
+                EXPECT_NEAR(A(Row, Col), B(Row, Col), Relative * Scale) << Row << ", " << Col;
+            }
+        }
+    }
+}
+
+// Universal variable propagation agrees with Kepler propagation of the elements
+TEST(Covariance, Propagate)
+{
+    TwoBody::Orbit Reference = TwoBody::Orbit::FromNewtonian(Vector3({STATE[0], STATE[1], STATE[2]}), Vector3({STATE[3], STATE[4], STATE[5]}), MU);
+
+    for (const double DeltaTime : {60.0, 1500.0, 20000.0})
+    {
+        const TwoBody::StateVector Final = TwoBody::Propagate(STATE, MU, DeltaTime);
+
+        Reference.Update(DeltaTime);
+        const EphemerisState Expected = TwoBody::Kepler2Newtonian(Reference.GetElements());
+        Reference.Update(-DeltaTime);
+
+        EXPECT_NEAR(Final[0], Expected.Pos.X, 1.0E-3);
+        EXPECT_NEAR(Final[1], Expected.Pos.Y, 1.0E-3);
+        EXPECT_NEAR(Final[2], Expected.Pos.Z, 1.0E-3);
+        EXPECT_NEAR(Final[3], Expected.Vel.X, 1.0E-6);
+        EXPECT_NEAR(Final[4], Expected.Vel.Y, 1.0E-6);
+        EXPECT_NEAR(Final[5], Expected.Vel.Z, 1.0E-6);
+    }
+
+    // Hyperbolic trajectories are propagated forwards and back
+    const TwoBody::StateVector Escape = TwoBody::MakeStateVector(Vector3({7.0E6, 0.0, 0.0}), Vector3({0.0, 12000.0, 1000.0}));
+    const TwoBody::StateVector Returned = TwoBody::Propagate(TwoBody::Propagate(Escape, MU, 50000.0), MU, -50000.0);
+
+    for (size_t Index = 0; Index < 6; Index++)
+    {
+        EXPECT_NEAR(Returned[Index], Escape[Index], (Index < 3) ? 1.0E-3 : 1.0E-6);
+    }
+}
+
+// The state transition matrix is symplectic, Phi^T J Phi = J
+TEST(Covariance, StateTransition)
+{
+    const MatrixN<6, 6> Transition = TwoBody::StateTransition(STATE, MU, 3000.0);
+
+    MatrixN<6, 6> J{};
+    J.SetBlock(0, 3, MatrixN<3, 3>::IDENTITY());
+    J.SetBlock(3, 0, -MatrixN<3, 3>::IDENTITY());
+
+    const MatrixN<6, 6> Result = Transition.Transpose() * J * Transition;
+    // Rows and columns of position derivatives are of larger magnitude
+    const double Tolerance[6] = {1.0E-7, 1.0E-7, 1.0E-7, 1.0E-2, 1.0E-2, 1.0E-2};
+
+    for (size_t Row = 0; Row < 6; Row++)
+    {
+        for (size_t Col = 0; Col < 6; Col++)
+        {
+            EXPECT_NEAR(Result(Row, Col), J(Row, Col), Tolerance[Min(Row, Col)]) << Row << ", " << Col;
+        }
+    }
+
+    // No propagation is the identity
+    const MatrixN<6, 6> Identity = TwoBody::StateTransition(STATE, MU, 0.0);
+    ExpectNear(Identity, MatrixN<6, 6>::IDENTITY(), 1.0E-9);
+
+    // A state at rest falls radially, its velocity columns differenced about zero velocity. Over
+    // a short time the position follows the velocity, perturbed by the gravity gradient
+    const TwoBody::StateVector Rest = TwoBody::MakeStateVector(Vector3({6.9E6, 1.0E5, -2.0E5}), Vector3::ZERO());
+    const MatrixN<6, 6> Falling = TwoBody::StateTransition(Rest, MU, 10.0);
+
+    for (size_t Row = 0; Row < 6; Row++)
+    {
+        for (size_t Col = 0; Col < 6; Col++)
+        {
+            const double Expected = (Row == Col) ? 1.0 : ((Row + 3 == Col) ? 10.0 : 0.0);
+            EXPECT_NEAR(Falling(Row, Col), Expected, 1.0E-3 * ((Col < 3) ? 1.0 : 10.0)) << Row << ", " << Col;
+        }
+    }
+}
+
+// For a small uncertainty the unscented transform agrees with linear propagation
+TEST(Covariance, Unscented)
+{
+    const TwoBody::StateCovariance Initial = MakeCovariance(1.0);
+    const TwoBody::StateCovariance Linear = TwoBody::PropagateLinear(STATE, Initial, MU, 3000.0);
+
+    TwoBody::StateVector State = STATE;
+    TwoBody::StateCovariance Covariance = Initial;
+    TwoBody::PropagateUnscented(State, Covariance, MU, 3000.0);
+
+    ExpectNear(Linear, Covariance, 1.0E-4);
+
+    const TwoBody::StateVector Expected = TwoBody::Propagate(STATE, MU, 3000.0);
+    EXPECT_NEAR(State[0], Expected[0], 1.0);
+    EXPECT_NEAR(State[4], Expected[4], 1.0E-3);
+
+    // No propagation preserves the covariance
+    State = STATE;
+    Covariance = Initial;
+    TwoBody::PropagateUnscented(State, Covariance, MU, 0.0);
+    ExpectNear(Covariance, Initial, 1.0E-9);
+
+    // Large uncertainties bend the distribution away from the linear prediction
+    State = STATE;
+    Covariance = MakeCovariance(100.0);
+    TwoBody::PropagateUnscented(State, Covariance, MU, 20000.0);
+    const TwoBody::StateCovariance LinearLarge = TwoBody::PropagateLinear(STATE, MakeCovariance(100.0), MU, 20000.0);
+    EXPECT_GT(Abs(Covariance(0, 0) - LinearLarge(0, 0)), 1.0E-3 * LinearLarge(0, 0));
+
+    Covariance = -Initial;
+    ASSERT_THROW(TwoBody::PropagateUnscented(State, Covariance, MU, 60.0), Error::GenericException);
+}
+
+// Batches match propagating each object in turn
+TEST(Covariance, Batch)
+{
+    constexpr size_t COUNT = 200;
+
+    ThreadPool Pool(3);
+    TwoBody::CovarianceBatch Linear(MU);
+    TwoBody::CovarianceBatch Unscented(MU);
+
+    for (size_t Index = 0; Index < COUNT; Index++)
+    {
+        TwoBody::StateVector State = STATE;
+        State[1] += 1.0E3 * static_cast<double>(Index);
+        Linear.Add(State, MakeCovariance(1.0 + 0.01 * static_cast<double>(Index)));
+        Unscented.Add(State, MakeCovariance(1.0 + 0.01 * static_cast<double>(Index)));
+    }
+
+    ASSERT_EQ(Linear.Size(), COUNT);
+
+    Linear.PropagateLinear(Pool, 600.0);
+    Unscented.PropagateUnscented(Pool, 600.0);
+
+    for (size_t Index = 0; Index < COUNT; Index++)
+    {
+        TwoBody::StateVector State = STATE;
+        State[1] += 1.0E3 * static_cast<double>(Index);
+        const TwoBody::StateCovariance Covariance = MakeCovariance(1.0 + 0.01 * static_cast<double>(Index));
+
+        ASSERT_EQ(Linear.GetCovariance(Index), TwoBody::PropagateLinear(State, Covariance, MU, 600.0));
+        ASSERT_EQ(Linear.GetState(Index), TwoBody::Propagate(State, MU, 600.0));
+
+        TwoBody::StateCovariance Expected = Covariance;
+        TwoBody::PropagateUnscented(State, Expected, MU, 600.0);
+        ASSERT_EQ(Unscented.GetCovariance(Index), Expected);
+        ASSERT_EQ(Unscented.GetState(Index), State);
+    }
+
+    // An invalid covariance leaves every object unchanged
+    TwoBody::CovarianceBatch Invalid(MU);
+    Invalid.Add(STATE, MakeCovariance(1.0));
+    Invalid.Add(STATE, -MakeCovariance(1.0));
+    ASSERT_THROW(Invalid.PropagateUnscented(Pool, 60.0), Error::GenericException);
+    ASSERT_EQ(Invalid.GetState(0), STATE);
+}
@@ -0,0 +1,175 @@
+#include "twobody/initial_orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "utils/errors.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+    constexpr double EARTH_RADIUS = 6.378137E6;
+    constexpr double EARTH_RATE = 7.2921159E-5;
+
+    // Inclined, mildly eccentric low Earth orbit
+    const Vector3 POSITION = Vector3({6.9E6, 1.0E5, -2.0E5});
+    const Vector3 VELOCITY = Vector3({-100.0, 5800.0, 4800.0});
+
+    EphemerisState Truth(double Time)
+    {
+        return TwoBody::PropagateUniversal(POSITION, VELOCITY, MU, Time);
+    }
+
+    TwoBody::PositionTriplet MakePositions(double T1, double T2, double T3)
+    {
+        return TwoBody::PositionTriplet{.Times = {T1, T2, T3}, .Positions = {Truth(T1).Pos, Truth(T2).Pos, Truth(T3).Pos}};
+    }
+
+    // Lines of sight from a site on a rotating, spherical Earth, near the ground track at the middle time
+    TwoBody::AnglesTriplet MakeAngles(double T1, double T2, double T3)
+    {
+        TwoBody::AnglesTriplet Triplet{.Times = {T1, T2, T3}};
+        const Vector3 Site = (Truth(T2).Pos + Vector3({3.0E5, -4.0E5, 2.0E5})).Unit() * EARTH_RADIUS;
+
+        for (size_t Index = 0; Index < 3; Index++)
+        {
+            const Quaternion Rotation = Quaternion::FromVectorAngle(Vector3::UNIT_Z(), EARTH_RATE * (Triplet.Times[Index] - T2));
+            Triplet.Sites[Index] = Rotation.RotateInv(Site);
+            Triplet.Directions[Index] = (Truth(Triplet.Times[Index]).Pos - Triplet.Sites[Index]).Unit();
+        }
+
+        return Triplet;
+    }
+
+    void ExpectState(const TwoBody::InitialOrbitSolution& Solution, double PositionTolerance, double VelocityTolerance)
+    {
+        ASSERT_EQ(Solution.Status, TwoBody::InitialOrbitStatus::SUCCESS);
+
+        const EphemerisState Expected = Truth(Solution.Time);
+        EXPECT_LT((Solution.Position - Expected.Pos).Norm(), PositionTolerance);
+        EXPECT_LT((Solution.Velocity - Expected.Vel).Norm(), VelocityTolerance);
+
+        const TwoBody::KeplerianElements Elements = TwoBody::Newtonian2Kepler(Expected.Pos, Expected.Vel, MU);
+        EXPECT_NEAR(Solution.Elements.SemiMajorAxis, Elements.SemiMajorAxis, 1.0E-3 * Elements.SemiMajorAxis);
+        EXPECT_NEAR(Solution.Elements.Inclination, Elements.Inclination, 1.0E-3);
+    }
+}
+
+// Lambert transfers reproduce the propagated velocities, the short and long way, elliptical and hyperbolic
+TEST(InitialOrbit, Lambert)
+{
+    const Vector3 Normal = POSITION.Cross(VELOCITY);
+
+    for (const double Time : {600.0, 2000.0, 4500.0})
+    {
+        const EphemerisState Final = Truth(Time);
+        Vector3 Initial = Vector3::ZERO();
+        Vector3 Arrival = Vector3::ZERO();
+
+        ASSERT_TRUE(TwoBody::Lambert(POSITION, Final.Pos, Time, MU, Normal, Initial, Arrival));
+        EXPECT_LT((Initial - VELOCITY).Norm(), 1.0E-6 * VELOCITY.Norm());
+        EXPECT_LT((Arrival - Final.Vel).Norm(), 1.0E-6 * VELOCITY.Norm());
+    }
+
+    const Vector3 Escape = VELOCITY * 1.6;
+    const EphemerisState Final = TwoBody::PropagateUniversal(POSITION, Escape, MU, 3000.0);
+    Vector3 Initial = Vector3::ZERO();
+    Vector3 Arrival = Vector3::ZERO();
+
+    ASSERT_TRUE(TwoBody::Lambert(POSITION, Final.Pos, 3000.0, MU, Normal, Initial, Arrival));
+    EXPECT_LT((Initial - Escape).Norm(), 1.0E-6 * Escape.Norm());
+
+    // Collinear positions have no unique transfer plane
+    EXPECT_FALSE(TwoBody::Lambert(POSITION, POSITION * 2.0, 1000.0, MU, Normal, Initial, Arrival));
+}
+
+// Gibbs for widely spaced positions and Herrick-Gibbs for closely spaced positions
+TEST(InitialOrbit, Positions)
+{
+    ExpectState(TwoBody::Gibbs(MakePositions(0.0, 600.0, 1300.0), MU), 1.0E-6, 1.0E-6);
+    ExpectState(TwoBody::HerrickGibbs(MakePositions(100.0, 130.0, 165.0), MU), 1.0E-6, 1.0E-3);
+
+    // Out of order times, or positions out of a common plane
+    EXPECT_EQ(TwoBody::Gibbs(MakePositions(600.0, 0.0, 1300.0), MU).Status, TwoBody::InitialOrbitStatus::DEGENERATE_GEOMETRY);
+
+    TwoBody::PositionTriplet Skewed = MakePositions(0.0, 600.0, 1300.0);
+    Skewed.Positions[0] = Skewed.Positions[0] + Vector3({0.0, 0.0, 2.0E5});
+    EXPECT_EQ(TwoBody::Gibbs(Skewed, MU).Status, TwoBody::InitialOrbitStatus::NOT_COPLANAR);
+    EXPECT_EQ(TwoBody::HerrickGibbs(Skewed, MU).Status, TwoBody::InitialOrbitStatus::NOT_COPLANAR);
+
+    // Outside of the plausible radii
+    EXPECT_EQ(TwoBody::Gibbs(MakePositions(0.0, 600.0, 1300.0), MU, TwoBody::InitialOrbitLimits{.MaxRadius = 6.5E6}).Status,
+        TwoBody::InitialOrbitStatus::REJECTED);
+}
+
+// Gauss and Gooding recover the orbit from exact lines of sight, Gooding over an arc too long for Gauss
+TEST(InitialOrbit, Angles)
+{
+    ExpectState(TwoBody::Gauss(MakeAngles(0.0, 120.0, 240.0), MU), 1.0, 1.0E-3);
+    ExpectState(TwoBody::Gooding(MakeAngles(0.0, 120.0, 240.0), MU), 1.0, 1.0E-3);
+    ExpectState(TwoBody::Gooding(MakeAngles(0.0, 500.0, 1100.0), MU), 1.0, 1.0E-3);
+
+    // Lines of sight in a common plane
+    TwoBody::AnglesTriplet Coplanar = MakeAngles(0.0, 120.0, 240.0);
+    Coplanar.Directions[2] = (Coplanar.Directions[0] + Coplanar.Directions[1]).Unit();
+    EXPECT_EQ(TwoBody::Gauss(Coplanar, MU).Status, TwoBody::InitialOrbitStatus::DEGENERATE_GEOMETRY);
+}
+
+// Batches match individual solutions, for good and bad candidates alike
+TEST(InitialOrbit, Batch)
+{
+    std::vector<TwoBody::PositionTriplet> Positions{};
+    std::vector<TwoBody::AnglesTriplet> Angles{};
+
+    for (size_t Index = 0; Index < 200; Index++)
+    {
+        const double Start = 30.0 * static_cast<double>(Index);
+        const double Spacing = (Index % 2 == 0) ? 20.0 : 400.0;
+
+        Positions.push_back(MakePositions(Start, Start + Spacing, Start + 2.1 * Spacing));
+        Angles.push_back(MakeAngles(Start, Start + 60.0, Start + 130.0));
+
+        // Mismatched candidates
+        if (Index % 5 == 0)
+        {
+            Positions.back().Positions[2] = Positions.back().Positions[2] + Vector3({1.0E5, 3.0E5, -2.0E5});
+            Angles.back().Directions[0] = Angles[(Index + 50) % Angles.size()].Directions[0];
+        }
+    }
+
+    ThreadPool Pool(3);
+    std::vector<TwoBody::InitialOrbitSolution> PositionSolutions(Positions.size());
+    std::vector<TwoBody::InitialOrbitSolution> AngleSolutions(Angles.size());
+
+    TwoBody::SolveBatch(Pool, std::span<const TwoBody::PositionTriplet>(Positions), TwoBody::PositionMethod::AUTOMATIC, MU, {}, PositionSolutions);
+    TwoBody::SolveBatch(Pool, std::span<const TwoBody::AnglesTriplet>(Angles), TwoBody::AnglesMethod::GAUSS, MU, {}, AngleSolutions);
+
+    size_t Rejected = 0;
+
+    for (size_t Index = 0; Index < Positions.size(); Index++)
+    {
+        const TwoBody::InitialOrbitSolution Expected = (Index % 2 == 0) ? TwoBody::HerrickGibbs(Positions[Index], MU) : TwoBody::Gibbs(Positions[Index], MU);
+        EXPECT_EQ(PositionSolutions[Index].Status, Expected.Status);
+        EXPECT_EQ(PositionSolutions[Index].Velocity, Expected.Velocity);
+
+        EXPECT_EQ(AngleSolutions[Index].Status, TwoBody::Gauss(Angles[Index], MU).Status);
+
+        if (Index % 5 != 0)
+        {
+            EXPECT_EQ(PositionSolutions[Index].Status, TwoBody::InitialOrbitStatus::SUCCESS);
+            EXPECT_EQ(AngleSolutions[Index].Status, TwoBody::InitialOrbitStatus::SUCCESS);
+        }
+        else
+        {
+            Rejected += (PositionSolutions[Index].Status != TwoBody::InitialOrbitStatus::SUCCESS) ? size_t(1) : size_t(0);
+        }
+    }
+
+    EXPECT_EQ(Rejected, Positions.size() / 5);
+
+    std::vector<TwoBody::InitialOrbitSolution> Short(Positions.size() - 1);
+    EXPECT_THROW(TwoBody::SolveBatch(Pool, std::span<const TwoBody::PositionTriplet>(Positions), TwoBody::PositionMethod::AUTOMATIC, MU, {}, Short),
+        Error::HArraySizeMismatch);
+    EXPECT_THROW(TwoBody::SolveBatch(Pool, std::span<const TwoBody::AnglesTriplet>(Angles), TwoBody::AnglesMethod::GAUSS, MU, {}, Short),
+        Error::HArraySizeMismatch);
+}
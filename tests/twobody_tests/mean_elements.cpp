@@ -0,0 +1,203 @@
+#include "twobody/mean_elements.hpp"
+#include "twobody/covariance.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "numerics/ode.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+
+    /**
+     * Mean elements of a closed orbit
+     */
+    TwoBody::KeplerianElements MakeMean(double SemiMajorAxis, double Eccentricity, double Inclination, double Node, double Perigee, double Anomoly)
+    {
+        return TwoBody::KeplerianElements{
+            .SemiParameter = SemiMajorAxis * (1.0 - Square(Eccentricity)),
+            .SemiMajorAxis = SemiMajorAxis,
+            .Eccentricity = Eccentricity,
+            .Inclination = Inclination,
+            .Node = Node,
+            .ArgumentPerigee = Perigee,
+            .TrueAnomoly = Anomoly,
+            .ArgumentLatitude = Perigee + Anomoly,
+            .GravitationalParameter = MU};
+    }
+
+    // Low Earth orbits, near circular and eccentric, prograde and retrograde
+    const TwoBody::KeplerianElements LOW = MakeMean(7.0E6, 0.001, 0.9, 0.5, 1.0, 2.0);
+    const TwoBody::KeplerianElements ECCENTRIC = MakeMean(9.0E6, 0.2, 0.5, 4.0, 2.5, 5.0);
+    const TwoBody::KeplerianElements RETROGRADE = MakeMean(7.2E6, 0.01, 1.72, 1.0, 0.3, 0.2);
+
+    /**
+     * @return Difference of two angles, within (-PI, PI]
+     */
+    double AngleDifference(double A, double B)
+    {
+        return Atan2(Sin(A - B), Cos(A - B));
+    }
+
+    /**
+     * Osculating state after a time of flight, by numerical integration under J2
+     */
+    EphemerisState IntegrateOblate(const EphemerisState& Initial, double DeltaTime)
+    {
+        const auto Result = ODE::DormandPrince([](double, const TwoBody::StateVector& State)
+        {
+            const Vector3 Acceleration = TwoBody::OblateAcceleration(Vector3({State[0], State[1], State[2]}), MU);
+            return TwoBody::StateVector{.Data = {State[3], State[4], State[5], Acceleration.X, Acceleration.Y, Acceleration.Z}};
+        }, 0.0, DeltaTime, TwoBody::MakeStateVector(Initial.Pos, Initial.Vel), ODE::IntegratorSettings{.RelativeTolerance = 1.0E-12, .AbsoluteTolerance = 1.0E-9});
+
+        EXPECT_EQ(Result.ExitCode, ODE::IntegratorStatus::SUCCESS);
+        return EphemerisState{.Pos = Vector3({Result.State[0], Result.State[1], Result.State[2]}),
+                              .Vel = Vector3({Result.State[3], Result.State[4], Result.State[5]})};
+    }
+}
+
+// Secular rates match the classical results, the node of a sun synchronous orbit regressing
+// eastward once a year
+TEST(MeanElements, SecularRates)
+{
+    const TwoBody::KeplerianElements SunSynchronous = MakeMean(Earth::WGS84::SEMI_MAJOR_AXIS + 8.0E5, 0.0, 98.6 * PI / 180.0, 0.0, 0.0, 0.0);
+    EXPECT_NEAR(TwoBody::J2SecularRates(SunSynchronous).Node, 2.0 * PI / (365.2422 * 86400.0), 2.0E-3 * 1.991E-7);
+
+    // Perigee is frozen at the critical inclination, but for terms of second order
+    const TwoBody::KeplerianElements Critical = MakeMean(2.6E7, 0.7, Acos(Sqrt(0.2)), 0.0, 0.0, 0.0);
+    const TwoBody::SecularRates Frozen = TwoBody::J2SecularRates(Critical);
+    EXPECT_LT(Abs(Frozen.ArgumentPerigee), 1.0E-3 * Abs(Frozen.Node));
+
+    // No oblateness leaves Keplerian motion
+    const TwoBody::SecularRates Kepler = TwoBody::J2SecularRates(ECCENTRIC, TwoBody::Oblateness{.J2 = 0.0});
+    EXPECT_EQ(Kepler.Node, 0.0);
+    EXPECT_EQ(Kepler.ArgumentPerigee, 0.0);
+    EXPECT_NEAR(Kepler.MeanAnomoly, Sqrt(MU / Cube(9.0E6)), 1.0E-18);
+
+    // Propagation over a whole number of anomalistic periods returns to the same anomoly
+    const TwoBody::SecularRates Rates = TwoBody::J2SecularRates(ECCENTRIC);
+    const TwoBody::KeplerianElements Propagated = TwoBody::PropagateMean(ECCENTRIC, 10.0 * 2.0 * PI / Rates.MeanAnomoly);
+    EXPECT_NEAR(AngleDifference(Propagated.TrueAnomoly, ECCENTRIC.TrueAnomoly), 0.0, 1.0E-9);
+    EXPECT_NEAR(AngleDifference(Propagated.Node, ECCENTRIC.Node), Rates.Node * 20.0 * PI / Rates.MeanAnomoly, 1.0E-9);
+    EXPECT_NEAR(AngleDifference(Propagated.ArgumentLatitude, Propagated.ArgumentPerigee + Propagated.TrueAnomoly), 0.0, 1.0E-12);
+    EXPECT_EQ(Propagated.SemiMajorAxis, ECCENTRIC.SemiMajorAxis);
+}
+
+// Mean to osculating and back recovers the mean elements, to second order in J2
+TEST(MeanElements, Conversion)
+{
+    for (const TwoBody::KeplerianElements& Mean : {LOW, ECCENTRIC, RETROGRADE})
+    {
+        const TwoBody::KeplerianElements Osculating = TwoBody::MeanToOsculating(Mean);
+        const TwoBody::KeplerianElements Recovered = TwoBody::OsculatingToMean(Osculating);
+
+        // Short period oscillation of the semi-major axis of kilometres
+        EXPECT_GT(Abs(Osculating.SemiMajorAxis - Mean.SemiMajorAxis), 100.0);
+        EXPECT_NEAR(Recovered.SemiMajorAxis, Mean.SemiMajorAxis, 20.0);
+        EXPECT_NEAR(Recovered.Eccentricity, Mean.Eccentricity, 1.0E-5);
+        EXPECT_NEAR(Recovered.Inclination, Mean.Inclination, 1.0E-5);
+        EXPECT_NEAR(AngleDifference(Recovered.Node, Mean.Node), 0.0, 1.0E-5);
+        EXPECT_NEAR(AngleDifference(Recovered.ArgumentLatitude, Mean.ArgumentLatitude), 0.0, 1.0E-5);
+    }
+
+    // No oblateness maps the elements to themselves
+    const TwoBody::KeplerianElements Same = TwoBody::MeanToOsculating(ECCENTRIC, TwoBody::Oblateness{.J2 = 0.0});
+    EXPECT_NEAR(Same.SemiMajorAxis, ECCENTRIC.SemiMajorAxis, 1.0E-6);
+    EXPECT_NEAR(Same.Eccentricity, ECCENTRIC.Eccentricity, 1.0E-14);
+    EXPECT_NEAR(AngleDifference(Same.TrueAnomoly, ECCENTRIC.TrueAnomoly), 0.0, 1.0E-12);
+}
+
+// The mapping stays finite and invertible for equatorial and near equatorial orbits, where the node
+// is undefined, and at the critical inclination, where the long period terms are singular
+TEST(MeanElements, SingularInclinations)
+{
+    for (const double Inclination : {0.0, 1.0E-9, 1.0E-3, Acos(Sqrt(0.2)), PI - Acos(Sqrt(0.2)), Acos(Sqrt(0.2)) + 1.0E-3})
+    {
+        for (const double Eccentricity : {0.0, 0.001, 0.01})
+        {
+            const TwoBody::KeplerianElements Mean = MakeMean(7.0E6, Eccentricity, Inclination, 0.3, 0.5, 1.0);
+            const TwoBody::KeplerianElements Osculating = TwoBody::MeanToOsculating(Mean);
+            const TwoBody::KeplerianElements Recovered = TwoBody::OsculatingToMean(Osculating);
+
+            // Short period oscillations of kilometres in the semi-major axis and of a few thousandths
+            // in the eccentricity, with the inclination moving by no more than milliradians
+            EXPECT_NEAR(Osculating.SemiMajorAxis, Mean.SemiMajorAxis, 2.0E4) << Inclination << " " << Eccentricity;
+            EXPECT_NEAR(Osculating.Eccentricity, Mean.Eccentricity, 5.0E-3) << Inclination << " " << Eccentricity;
+            EXPECT_NEAR(Osculating.Inclination, Mean.Inclination, 1.0E-3) << Inclination << " " << Eccentricity;
+            EXPECT_NEAR(AngleDifference(Osculating.TrueLongitude, Mean.Node + Mean.ArgumentLatitude), 0.0, 1.0E-2) << Inclination << " " << Eccentricity;
+
+            EXPECT_NEAR(Recovered.SemiMajorAxis, Mean.SemiMajorAxis, 30.0) << Inclination << " " << Eccentricity;
+            EXPECT_NEAR(Recovered.Eccentricity, Mean.Eccentricity, 1.0E-5) << Inclination << " " << Eccentricity;
+            EXPECT_NEAR(Recovered.Inclination, Mean.Inclination, 1.0E-5) << Inclination << " " << Eccentricity;
+            EXPECT_NEAR(AngleDifference(Recovered.TrueLongitude, Mean.Node + Mean.ArgumentLatitude), 0.0, 1.0E-5) << Inclination << " " << Eccentricity;
+        }
+    }
+
+    // An equatorial orbit stays equatorial
+    EXPECT_EQ(TwoBody::MeanToOsculating(MakeMean(7.0E6, 0.01, 0.0, 0.3, 0.5, 1.0)).Inclination, 0.0);
+}
+
+// Mean elements propagated analytically match the mean elements of an osculating state integrated
+// numerically under J2, over several days
+TEST(MeanElements, NumericalIntegration)
+{
+    constexpr double DAYS = 3.0;
+
+    for (const TwoBody::KeplerianElements& Mean : {LOW, ECCENTRIC, RETROGRADE})
+    {
+        const EphemerisState Initial = TwoBody::Kepler2Newtonian(TwoBody::MeanToOsculating(Mean));
+        const EphemerisState Final = IntegrateOblate(Initial, DAYS * 86400.0);
+
+        const TwoBody::KeplerianElements Expected = TwoBody::PropagateMean(Mean, DAYS * 86400.0);
+        const TwoBody::KeplerianElements Actual = TwoBody::OsculatingToMean(TwoBody::Newtonian2Kepler(Final.Pos, Final.Vel, MU));
+
+        // The node drifts by degrees a day, matched to within the second order error of the
+        // mapping between mean and osculating elements
+        EXPECT_GT(Abs(AngleDifference(Expected.Node, Mean.Node)), 0.05);
+        EXPECT_NEAR(Actual.SemiMajorAxis, Expected.SemiMajorAxis, 30.0);
+        EXPECT_NEAR(Actual.Eccentricity, Expected.Eccentricity, 2.0E-6);
+        EXPECT_NEAR(Actual.Inclination, Expected.Inclination, 2.0E-6);
+        EXPECT_NEAR(AngleDifference(Actual.Node, Expected.Node), 0.0, 1.0E-5);
+        EXPECT_NEAR(AngleDifference(Actual.TrueLongitude, Expected.TrueLongitude), 0.0, 5.0E-4);
+
+        // The osculating position follows to within kilometres
+        const EphemerisState Analytic = TwoBody::Kepler2Newtonian(TwoBody::MeanToOsculating(Expected));
+        EXPECT_LT((Analytic.Pos - Final.Pos).Norm(), 5.0E3);
+    }
+}
+
+// Batches match the single orbit functions for any number of threads
+TEST(MeanElements, Batch)
+{
+    std::vector<TwoBody::KeplerianElements> Mean;
+
+    for (size_t Index = 0; Index < 1000; Index++)
+    {
+        const double Fraction = static_cast<double>(Index) / 1000.0;
+        Mean.push_back(MakeMean(6.8E6 + 2.0E7 * Fraction, 0.3 * Fraction, 0.1 + 2.8 * Fraction, 6.0 * Fraction, 5.0 * Fraction, 6.2 * Fraction));
+    }
+
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+    std::vector<TwoBody::KeplerianElements> Serial(Mean.size());
+    std::vector<TwoBody::KeplerianElements> Parallel(Mean.size());
+
+    TwoBody::PropagateMean(None, Mean, 86400.0, Serial);
+    TwoBody::PropagateMean(Pool, Mean, 86400.0, Parallel);
+
+    for (size_t Index = 0; Index < Mean.size(); Index++)
+    {
+        EXPECT_EQ(Serial[Index].TrueLongitude, Parallel[Index].TrueLongitude);
+        EXPECT_EQ(Serial[Index].TrueLongitude, TwoBody::PropagateMean(Mean[Index], 86400.0).TrueLongitude);
+    }
+
+    TwoBody::MeanToOsculating(Pool, Mean, Parallel);
+    TwoBody::OsculatingToMean(None, Parallel, Serial);
+
+    for (size_t Index = 0; Index < Mean.size(); Index++)
+    {
+        EXPECT_EQ(Parallel[Index].SemiMajorAxis, TwoBody::MeanToOsculating(Mean[Index]).SemiMajorAxis);
+        EXPECT_EQ(Serial[Index].SemiMajorAxis, TwoBody::OsculatingToMean(Parallel[Index]).SemiMajorAxis);
+    }
+}
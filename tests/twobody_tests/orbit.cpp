@@ -0,0 +1,143 @@
+#include "twobody/orbit.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "math/core_math.hpp"
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+
+    TwoBody::KeplerianElements MakeElements(double SemiMajorAxis, double Eccentricity, double TrueAnomoly)
+    {
+        return TwoBody::KeplerianElements{
+            .SemiParameter = SemiMajorAxis * (1.0 - Eccentricity * Eccentricity),
+            .SemiMajorAxis = SemiMajorAxis,
+            .Eccentricity = Eccentricity,
+            .Inclination = 0.9,
+            .Node = 0.3,
+            .ArgumentPerigee = 1.2,
+            .TrueAnomoly = TrueAnomoly,
+            .GravitationalParameter = MU};
+    }
+}
+
+// After a whole period an elliptical orbit returns to its initial state
+TEST(Orbit, Period)
+{
+    for (const double Eccentricity : {0.01, 0.3, 0.7, 0.95})
+    {
+        TwoBody::Orbit Elliptical = TwoBody::Orbit::FromKeplerianElements(MakeElements(8.0E6, Eccentricity, 0.4));
+        const double Radius = Elliptical.GetRadius();
+
+        const TwoBody::DeltaTimeAnomoly Anomoly = Elliptical.AnomolyFromDeltaTime(Elliptical.GetPeriod());
+        ASSERT_EQ(Anomoly.NumberRevolutions, 1);
+
+        Elliptical.Update(Elliptical.GetPeriod());
+        ASSERT_NEAR(Elliptical.GetElements().TrueAnomoly, 0.4, 1.0E-9);
+        ASSERT_NEAR(Elliptical.GetRadius(), Radius, 1.0E-6);
+    }
+}
+
+// The eccentric anomoly found satisfies Kepler's equation for any eccentricity
+TEST(Orbit, KeplerEquation)
+{
+    for (const double Eccentricity : {0.0001, 0.2, 0.6, 0.9, 0.999})
+    {
+        const TwoBody::Orbit Elliptical = TwoBody::Orbit::FromKeplerianElements(MakeElements(1.0E7, Eccentricity, 0.0));
+
+        for (double Fraction = 0.0; Fraction < 3.0; Fraction += 0.07)
+        {
+            const TwoBody::DeltaTimeAnomoly Anomoly = Elliptical.AnomolyFromDeltaTime(Fraction * Elliptical.GetPeriod());
+            const double E = Anomoly.EccentricAnomoly;
+
+            ASSERT_NEAR(E - Eccentricity * Sin(E), Anomoly.MeanAnomoly, 1.0E-12);
+            ASSERT_GE(Anomoly.MeanAnomoly, 0.0);
+            ASSERT_LT(Anomoly.MeanAnomoly, 2.0 * PI);
+            ASSERT_EQ(Anomoly.NumberRevolutions, static_cast<int32_t>(Floor(Fraction)));
+        }
+    }
+}
+
+// Propagating by the time to reach an anomoly arrives at that anomoly
+TEST(Orbit, RoundTrip)
+{
+    for (const double Eccentricity : {0.1, 0.5, 0.8})
+    {
+        for (const double Target : {0.8, 2.0, 3.0})
+        {
+            TwoBody::Orbit Elliptical = TwoBody::Orbit::FromKeplerianElements(MakeElements(9.0E6, Eccentricity, 0.5));
+            const double DeltaTime = Elliptical.DeltaTimeFromTrueAnomoly(Target);
+            ASSERT_GT(DeltaTime, 0.0);
+            ASSERT_LT(DeltaTime, 0.5 * Elliptical.GetPeriod());
+
+            Elliptical.Update(DeltaTime);
+            ASSERT_NEAR(Elliptical.GetElements().TrueAnomoly, Target, 1.0E-9);
+        }
+
+        // Whole revolutions are included
+        const TwoBody::Orbit Elliptical = TwoBody::Orbit::FromKeplerianElements(MakeElements(9.0E6, Eccentricity, 0.5));
+        ASSERT_NEAR(Elliptical.DeltaTimeFromTrueAnomoly(0.5 + 4.0 * PI), 2.0 * Elliptical.GetPeriod(), 1.0E-6);
+    }
+}
+
+// Hyperbolic trajectories are propagated to and from an anomoly
+TEST(Orbit, Hyperbolic)
+{
+    for (const double Eccentricity : {1.2, 2.0, 5.0})
+    {
+        for (const double Target : {-0.4, 0.3, 1.0})
+        {
+            TwoBody::Orbit Hyperbolic = TwoBody::Orbit::FromKeplerianElements(MakeElements(-2.0E7, Eccentricity, -0.5));
+            ASSERT_EQ(TwoBody::ClassifyOrbit(Hyperbolic.GetElements()), TwoBody::OrbitClassification::HYPERBOLIC);
+
+            const double DeltaTime = Hyperbolic.DeltaTimeFromTrueAnomoly(Target);
+            ASSERT_GT(DeltaTime, 0.0);
+
+            Hyperbolic.Update(DeltaTime);
+            ASSERT_NEAR(Hyperbolic.GetElements().TrueAnomoly, Target, 1.0E-9);
+        }
+    }
+}
+
+// Bulk updates match updating each orbit in turn, bitwise
+TEST(Orbit, BulkUpdate)
+{
+    constexpr size_t COUNT = 1000;
+
+    std::vector<std::unique_ptr<TwoBody::Orbit>> Serial;
+    std::vector<std::unique_ptr<TwoBody::Orbit>> Bulk;
+    std::vector<TwoBody::Orbit*> Orbits;
+
+    for (size_t Index = 0; Index < COUNT; Index++)
+    {
+        const double Eccentricity = (Index % 3 == 0) ? 0.0 : 0.001 * static_cast<double>(Index % 900);
+        const TwoBody::KeplerianElements Elements = MakeElements(7.0E6 + 1.0E3 * static_cast<double>(Index), Eccentricity, 0.01 * static_cast<double>(Index));
+
+        Serial.emplace_back(new TwoBody::Orbit(TwoBody::Orbit::FromKeplerianElements(Elements)));
+        Bulk.emplace_back(new TwoBody::Orbit(TwoBody::Orbit::FromKeplerianElements(Elements)));
+        Orbits.push_back(Bulk.back().get());
+    }
+
+    ThreadPool Pool(3);
+
+    for (size_t Step = 0; Step < 10; Step++)
+    {
+        for (const auto& Entry : Serial)
+        {
+            Entry->Update(600.0);
+        }
+
+        TwoBody::Orbit::Update(Pool, Orbits, 600.0);
+    }
+
+    for (size_t Index = 0; Index < COUNT; Index++)
+    {
+        const SnapshotBlock Expected = Serial[Index]->GetSnapshotBlock();
+        const SnapshotBlock Actual = Bulk[Index]->GetSnapshotBlock();
+        ASSERT_EQ(std::memcmp(Expected.Data.data(), Actual.Data.data(), Expected.Data.size()), 0);
+    }
+}
@@ -0,0 +1,149 @@
+#include "twobody/relative_motion.hpp"
+#include "concurrency/thread_pool.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr double MU = 3.986004418E14;
+
+    // Inclined chief orbits, circular and eccentric
+    const Vector3 POSITION = Vector3({7.0E6, 0.0, 0.0});
+    const Vector3 CIRCULAR_VELOCITY = Vector3({0.0, 0.8, 0.6}) * Sqrt(MU / 7.0E6);
+    const Vector3 ECCENTRIC_VELOCITY = Vector3({1500.0, 7200.0, 5400.0});
+
+    // Relative state of a deputy, hundreds of metres from the chief
+    const TwoBody::StateVector RELATIVE{.Data = {200.0, -300.0, 150.0, 0.1, -0.2, 0.15}};
+
+    void ExpectNear(const TwoBody::StateVector& Actual, const TwoBody::StateVector& Expected, double PositionTolerance, double VelocityTolerance)
+    {
+        for (size_t Index = 0; Index < 6; Index++)
+        {
+            EXPECT_NEAR(Actual[Index], Expected[Index], (Index < 3) ? PositionTolerance : VelocityTolerance) << Index;
+        }
+    }
+
+    /**
+     * Expects a linearised relative state to match the propagated state, to within the curvature
+     * of the orbit over the separation of the deputy
+     */
+    void ExpectLinearised(const TwoBody::StateVector& Actual, const TwoBody::StateVector& Expected)
+    {
+        const double Separation = Vector3({Expected[0], Expected[1], Expected[2]}).Norm();
+        const double Curvature = Square(Separation) / POSITION.Norm();
+
+        ExpectNear(Actual, Expected, 0.01 + Curvature, 1.0E-5 + 3.0E-3 * Curvature);
+    }
+
+    /**
+     * Relative state of the deputy after a time of flight, by propagating the chief and the deputy
+     */
+    TwoBody::StateVector PropagateTruth(const Vector3& Velocity, double DeltaTime)
+    {
+        const EphemerisState Chief{.Pos = POSITION, .Vel = Velocity};
+        const EphemerisState Deputy = TwoBody::LVLHToInertial(Chief, RELATIVE);
+
+        return TwoBody::InertialToLVLH(
+            TwoBody::PropagateUniversal(Chief.Pos, Chief.Vel, MU, DeltaTime),
+            TwoBody::PropagateUniversal(Deputy.Pos, Deputy.Vel, MU, DeltaTime));
+    }
+}
+
+// The LVLH frame is radial, along track and normal, and conversions to and from it are inverse
+TEST(RelativeMotion, Frame)
+{
+    const Rotator Frame = TwoBody::LVLHFrame(POSITION + Vector3({1.0E5, -2.0E5, 3.0E5}), ECCENTRIC_VELOCITY);
+    const Vector3 Radial = Frame.Rotate(POSITION + Vector3({1.0E5, -2.0E5, 3.0E5}));
+    const Vector3 Normal = Frame.Rotate((POSITION + Vector3({1.0E5, -2.0E5, 3.0E5})).Cross(ECCENTRIC_VELOCITY));
+
+    EXPECT_NEAR(Radial.Y, 0.0, 1.0E-6);
+    EXPECT_NEAR(Radial.Z, 0.0, 1.0E-6);
+    EXPECT_GT(Radial.X, 0.0);
+    EXPECT_NEAR(Normal.X, 0.0, 1.0E-9 * Normal.Norm());
+    EXPECT_NEAR(Normal.Y, 0.0, 1.0E-9 * Normal.Norm());
+    EXPECT_GT(Normal.Z, 0.0);
+
+    // Equatorial retrograde chief
+    const Rotator Retrograde = TwoBody::LVLHFrame(POSITION, Vector3({0.0, -7500.0, 0.0}));
+    EXPECT_NEAR((Retrograde.Rotate(Vector3::UNIT_Z()) - Vector3({0.0, 0.0, -1.0})).Norm(), 0.0, 1.0E-12);
+
+    const EphemerisState Chief{.Pos = POSITION, .Vel = ECCENTRIC_VELOCITY};
+    ExpectNear(TwoBody::InertialToLVLH(Chief, TwoBody::LVLHToInertial(Chief, RELATIVE)), RELATIVE, 1.0E-6, 1.0E-9);
+}
+
+// Hill-Clohessy-Wiltshire matches the propagated relative motion about a circular chief
+TEST(RelativeMotion, ClohessyWiltshire)
+{
+    const double MeanMotion = Sqrt(MU / Cube(POSITION.Norm()));
+
+    for (const double Time : {300.0, 2000.0, 6000.0})
+    {
+        ExpectLinearised(TwoBody::ClohessyWiltshire(MeanMotion, Time) * RELATIVE, PropagateTruth(CIRCULAR_VELOCITY, Time));
+    }
+}
+
+// Yamanaka-Ankersen matches the propagated relative motion about an eccentric chief, and reduces to
+// Hill-Clohessy-Wiltshire for a circular chief
+TEST(RelativeMotion, YamanakaAnkersen)
+{
+    const TwoBody::KeplerianElements Chief = TwoBody::Newtonian2Kepler(POSITION, ECCENTRIC_VELOCITY, MU);
+    ASSERT_GT(Chief.Eccentricity, 0.1);
+
+    const MatrixN<6, 6> Initial = TwoBody::YamanakaAnkersen(Chief, 0.0);
+    const MatrixN<6, 6> Identity = MatrixN<6, 6>::IDENTITY();
+
+    for (size_t Index = 0; Index < 36; Index++)
+    {
+        EXPECT_NEAR(Initial[Index], Identity[Index], 1.0E-10);
+    }
+
+    for (const double Time : {300.0, 2000.0, 6000.0, 20000.0})
+    {
+        ExpectLinearised(TwoBody::YamanakaAnkersen(Chief, Time) * RELATIVE, PropagateTruth(ECCENTRIC_VELOCITY, Time));
+    }
+
+    TwoBody::KeplerianElements Circular = TwoBody::Newtonian2Kepler(POSITION, CIRCULAR_VELOCITY, MU);
+    Circular.Eccentricity = 0.0;
+    const MatrixN<6, 6> Expected = TwoBody::ClohessyWiltshire(Sqrt(MU / Cube(POSITION.Norm())), 4000.0);
+    const MatrixN<6, 6> Actual = TwoBody::YamanakaAnkersen(Circular, 4000.0);
+
+    for (size_t Index = 0; Index < 36; Index++)
+    {
+        EXPECT_NEAR(Actual[Index], Expected[Index], 1.0E-9 * (1.0 + Abs(Expected[Index])));
+    }
+}
+
+// Deputies of a formation propagate by one transition matrix per step, identically for any number of threads
+TEST(RelativeMotion, Formation)
+{
+    const TwoBody::KeplerianElements Chief = TwoBody::Newtonian2Kepler(POSITION, ECCENTRIC_VELOCITY, MU);
+    TwoBody::Formation Serial(Chief);
+    TwoBody::Formation Parallel(Chief);
+
+    for (size_t Index = 0; Index < 1000; Index++)
+    {
+        const TwoBody::StateVector Deputy = RELATIVE * (static_cast<double>(Index) / 500.0 - 1.0);
+        Serial.Add(Deputy);
+        Parallel.Add(Deputy);
+    }
+
+    ThreadPool None(0);
+    ThreadPool Pool(3);
+
+    for (size_t Step = 0; Step < 10; Step++)
+    {
+        Serial.Propagate(None, 700.0);
+        Parallel.Propagate(Pool, 700.0);
+    }
+
+    // Steps compose to the transition over the whole time
+    ExpectNear(Serial.GetState(999), TwoBody::YamanakaAnkersen(Chief, 7000.0) * (RELATIVE * (999.0 / 500.0 - 1.0)), 1.0E-6, 1.0E-9);
+
+    for (size_t Index = 0; Index < Serial.Size(); Index++)
+    {
+        EXPECT_EQ(Serial.GetState(Index), Parallel.GetState(Index));
+    }
+
+    // The chief has advanced by the same time
+    const EphemerisState Expected = TwoBody::PropagateUniversal(POSITION, ECCENTRIC_VELOCITY, MU, 7000.0);
+    EXPECT_NEAR(Serial.GetChief().TrueAnomoly, TwoBody::Newtonian2Kepler(Expected.Pos, Expected.Vel, MU).TrueAnomoly, 1.0E-9);
+}